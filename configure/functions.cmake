@@ -41,18 +41,22 @@ function(set_cflags_and_include target)
                             opentelemetry-cpp::ostream_log_record_exporter
                             opentelemetry-cpp::ostream_span_exporter
                             opentelemetry-cpp::logs
+                            opentelemetry-cpp::metrics
+                            opentelemetry-cpp::ostream_metrics_exporter
                             ZLIB::ZLIB
                            )
       if (TANGO_TELEMETRY_USE_HTTP)
         target_link_libraries(${target} PRIVATE
                               opentelemetry-cpp::otlp_http_exporter
                               opentelemetry-cpp::otlp_http_log_record_exporter
+                              opentelemetry-cpp::otlp_http_metric_exporter
                              )
       endif()
       if (TANGO_TELEMETRY_USE_GRPC)
         target_link_libraries(${target} PRIVATE
                               opentelemetry-cpp::otlp_grpc_exporter
                               opentelemetry-cpp::otlp_grpc_log_record_exporter
+                              opentelemetry-cpp::otlp_grpc_metrics_exporter
                              )
         endif()
   endif()
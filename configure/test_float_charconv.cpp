@@ -0,0 +1,12 @@
+#include <charconv>
+
+// Check that std::from_chars() and std::to_chars() support the floating point types
+
+int main(int, char **)
+{
+    char buffer[32];
+    double value = 0;
+    std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, 15);
+    std::from_chars(buffer, buffer + sizeof(buffer), value);
+    return 0;
+}
@@ -30,6 +30,9 @@
 #include <tango/client/eventconsumer.h>
 #include <tango/client/Database.h>
 #include <tango/client/DeviceAttribute.h>
+#include <tango/internal/attr_read_cache.h>
+#include <algorithm>
+#include <chrono>
 #include <thread>
 #include <iomanip>
 
@@ -487,6 +490,22 @@ ApiUtil::ApiUtil() :
             user_sub_hwm = sub_hwm;
         }
     }
+
+    //
+    // Check if the user has defined the number of threads executing callbacks in push sub-model
+    //
+
+    var.clear();
+    if(get_env_var("TANGO_CALLBACK_THREADS", var) == 0)
+    {
+        int cb_nb = -1;
+        std::istringstream iss(var);
+        iss >> cb_nb;
+        if(iss && cb_nb >= 0)
+        {
+            cb_thread_nb = static_cast<size_t>(cb_nb);
+        }
+    }
 }
 
 //+----------------------------------------------------------------------------------------------------------------
@@ -502,17 +521,19 @@ ApiUtil::ApiUtil() :
 ApiUtil::~ApiUtil()
 {
     //
-    // Release Asyn stuff
+    // Release Asyn stuff. The callback executor threads still use the request table, stop them first
     //
 
-    delete asyn_p_table;
-
     if(cb_thread_ptr != nullptr)
     {
         cb_thread_cmd.stop_thread();
         cb_thread_ptr->join(nullptr);
     }
 
+    cb_executor.reset();
+
+    delete asyn_p_table;
+
     //
     // Kill any remaining locking threads
     //
@@ -792,6 +813,164 @@ void ApiUtil::get_asynch_replies()
     }
 }
 
+//-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        ApiUtil::dispatch_asynch_replies()
+//
+// description :
+//        Used by the callback thread in push sub-model. Wait for the replies of the requests sent and not yet
+//        answered. Each reply is handed to the callback executor (or processed in place if there is no executor) as
+//        soon as it arrives. The method returns when there is no more pending request or when the thread is asked to
+//        stop. The ORB is polled (with a wait growing up to 20 mS) rather than blocked on, in order to notice a
+//        switch to the pull sub-model without taking the next reply.
+//
+//------------------------------------------------------------------------------------------------------------------
+
+void ApiUtil::dispatch_asynch_replies()
+{
+    constexpr std::chrono::milliseconds min_wait{1};
+    constexpr std::chrono::milliseconds max_wait{20};
+
+    std::chrono::milliseconds wait = min_wait;
+    while(asyn_p_table->get_cb_pending_nb() != 0 && !cb_thread_cmd.is_stopped())
+    {
+        try
+        {
+            if(!_orb->poll_next_response())
+            {
+                std::this_thread::sleep_for(wait);
+                wait = std::min(2 * wait, max_wait);
+                continue;
+            }
+            wait = min_wait;
+
+            CORBA::Request_ptr req;
+            _orb->get_next_response(req);
+
+            TgRequest &tg_req = asyn_p_table->get_request(req);
+
+            if(cb_executor == nullptr)
+            {
+                //
+                // Mark this request as "arrived" in both maps and process it
+                //
+
+                tg_req.arrived = true;
+                asyn_p_table->mark_as_arrived(req);
+
+                process_request(tg_req.dev, tg_req, req);
+            }
+            else
+            {
+                //
+                // The request is marked as posted, not as arrived, so that a concurrent get_asynch_replies() does not
+                // fire its callback too. The executor removes it from the maps once the callback is fired
+                //
+
+                TgRequest req_copy = tg_req;
+                asyn_p_table->mark_as_posted(req);
+                cb_executor->post(req_copy.dev,
+                                  [this, req_copy, req]() mutable { process_request(req_copy.dev, req_copy, req); });
+            }
+        }
+        catch(CORBA::BAD_INV_ORDER &e)
+        {
+            if(e.minor() != omni::BAD_INV_ORDER_RequestNotSentYet)
+            {
+                throw;
+            }
+        }
+    }
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        ApiUtil::get_asynch_cb_stats()
+//
+// description :
+//        Return the statistics of the callback executor used in push sub-model
+//
+//------------------------------------------------------------------------------------------------------------------
+
+CallBackStats ApiUtil::get_asynch_cb_stats()
+{
+    if(cb_executor == nullptr)
+    {
+        return CallBackStats{};
+    }
+
+    return cb_executor->get_stats();
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        ApiUtil::enable_attribute_read_cache()
+//
+// description :
+//        Enable/disable the process wide client attribute cache
+//
+//------------------------------------------------------------------------------------------------------------------
+
+void ApiUtil::enable_attribute_read_cache(bool enable)
+{
+    detail::AttributeReadCache::instance().enable(enable);
+}
+
+bool ApiUtil::is_attribute_read_cache_enabled()
+{
+    return detail::AttributeReadCache::instance().is_enabled();
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        ApiUtil::get_event_reconnection_stats()
+//
+// description :
+//        Return the statistics of the event re-subscriptions done by the event consumer keep alive thread
+//
+//------------------------------------------------------------------------------------------------------------------
+
+EventReconnectionStats ApiUtil::get_event_reconnection_stats()
+{
+    return EventConsumer::get_reconnection_stats();
+}
+
+//+-----------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        ApiUtil::subscribe_events()
+//
+// description :
+//        Subscribe to many events in one call. First, try using zmq. For events for which it fails with the error
+//        "Command Not Found", try using notifd
+//
+// argument :
+//        in/out :
+//            - requests : The event subscription requests
+//
+//------------------------------------------------------------------------------------------------------------------
+
+void ApiUtil::subscribe_events(std::vector<EventSubscriptionRequest> &requests)
+{
+    {
+        auto zmq_consumer = create_zmq_event_consumer();
+        zmq_consumer->subscribe_events(requests);
+    }
+
+    for(auto &req : requests)
+    {
+        if(req.errors.length() != 0 && std::string(req.errors[0].reason.in()) == API_CommandNotFound)
+        {
+            auto notifd_consumer = create_notifd_event_consumer();
+            notifd_consumer->subscribe_event(req);
+        }
+    }
+}
+
 void ApiUtil::process_request(Connection *connection, const TgRequest &tg_req, CORBA::Request_ptr &req)
 {
     switch(tg_req.req_type)
@@ -1019,11 +1198,29 @@ void ApiUtil::set_asynch_cb_sub_model(cb_sub_model mode)
         if(mode == PUSH_CALLBACK)
         {
             //
-            // In this case, delete the old object in case it is needed, create a new thread and start it
+            // In this case, wait for the old thread to exit in case it is needed (it may still use the executor),
+            // create a new thread and start it
             //
 
-            delete cb_thread_ptr;
-            cb_thread_ptr = nullptr;
+            if(cb_thread_ptr != nullptr)
+            {
+                cb_thread_ptr->join(nullptr);
+                cb_thread_ptr = nullptr;
+            }
+
+            //
+            // The executor is kept from one push period to the next one. Re-create it only if the user changed
+            // the thread number in between
+            //
+
+            if(cb_thread_nb == 0)
+            {
+                cb_executor.reset();
+            }
+            else if(cb_executor == nullptr || cb_executor->get_thread_nb() != cb_thread_nb)
+            {
+                cb_executor = std::make_unique<CallBackExecutor>(cb_thread_nb);
+            }
 
             cb_thread_cmd.start_thread();
 
@@ -121,6 +121,7 @@ void AsynReq::store_request(CORBA::Request_ptr req, CallBack *cb, Connection *de
     omni_mutex_lock sync(*this);
     cb_dev_table.insert(std::map<Connection *, TgRequest>::value_type(dev, tmp_req_dev));
     cb_req_table.insert(std::map<CORBA::Request_ptr, TgRequest>::value_type(req, tmp_req));
+    cb_pending_nb++;
 }
 
 //+----------------------------------------------------------------------------
@@ -238,19 +239,56 @@ Tango::TgRequest *AsynReq::get_request(Tango::Connection *dev)
 
 void AsynReq::mark_as_arrived(CORBA::Request_ptr req)
 {
-    std::multimap<Connection *, TgRequest>::iterator pos;
-
     omni_mutex_lock sync(*this);
-    for(pos = cb_dev_table.begin(); pos != cb_dev_table.end(); ++pos)
+
+    //
+    // Use the request map to find the device and only search in this device requests
+    //
+
+    auto pos_req = cb_req_table.find(req);
+    if(pos_req == cb_req_table.end())
+    {
+        return;
+    }
+
+    auto range = cb_dev_table.equal_range(pos_req->second.dev);
+    for(auto pos = range.first; pos != range.second; ++pos)
     {
         if(pos->second.request == req)
         {
-            pos->second.arrived = true;
+            if(!pos->second.arrived)
+            {
+                pos->second.arrived = true;
+                cb_pending_nb--;
+            }
             break;
         }
     }
 }
 
+//+----------------------------------------------------------------------------
+//
+// method :         AsynReq::mark_as_posted()
+//
+// description :     Mark a request as posted to the callback executor. Its
+//            reply is arrived but the request is kept as not arrived
+//            in the callback device map until the executor fires its
+//            callback and removes it
+//
+// argin(s) :        req : The CORBA request object
+//
+//-----------------------------------------------------------------------------
+
+void AsynReq::mark_as_posted(CORBA::Request_ptr req)
+{
+    omni_mutex_lock sync(*this);
+
+    if(cb_req_table.find(req) != cb_req_table.end() && cb_posted_requests.insert(req).second)
+    {
+        cb_pending_nb--;
+    }
+}
+
 //+----------------------------------------------------------------------------
 //
 // method :         AsynReq::remove_request()
@@ -341,10 +379,15 @@ void AsynReq::remove_request(Connection *dev, CORBA::Request_ptr req)
     std::map<CORBA::Request_ptr, TgRequest>::iterator pos_req;
 
     omni_mutex_lock sync(*this);
+    bool posted = cb_posted_requests.erase(req) != 0;
     for(pos = cb_dev_table.lower_bound(dev); pos != cb_dev_table.upper_bound(dev); ++pos)
     {
         if(pos->second.request == req)
         {
+            if(!pos->second.arrived && !posted)
+            {
+                cb_pending_nb--;
+            }
             CORBA::release(pos->second.request);
             cb_dev_table.erase(pos);
             break;
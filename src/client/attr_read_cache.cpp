@@ -0,0 +1,185 @@
+#include <tango/internal/attr_read_cache.h>
+#include <tango/internal/utils.h>
+
+#include <tango/client/DeviceProxy.h>
+
+namespace Tango::detail
+{
+
+AttributeReadCache &AttributeReadCache::instance()
+{
+    static AttributeReadCache cache;
+    return cache;
+}
+
+std::string AttributeReadCache::make_key(DeviceProxy *device, const std::string &attr_name)
+{
+    std::string key;
+
+    if(device->is_dbase_used())
+    {
+        key = device->get_db_host() + ':' + device->get_db_port();
+    }
+    else
+    {
+        key = device->get_dev_host() + ':' + device->get_dev_port();
+    }
+
+    key += '/';
+    key += device->dev_name();
+    key += '/';
+    key += attr_name;
+
+    return to_lower(std::move(key));
+}
+
+void AttributeReadCache::enable(bool on)
+{
+    enabled.store(on, std::memory_order_relaxed);
+    if(!on)
+    {
+        clear();
+    }
+}
+
+std::optional<DeviceAttribute> AttributeReadCache::get(const std::string &key, std::chrono::milliseconds max_age)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto pos = entries.find(key);
+    if(pos == entries.end() || clock::now() - pos->second.received > max_age)
+    {
+        misses.fetch_add(1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+
+    hits.fetch_add(1, std::memory_order_relaxed);
+    return pos->second.value;
+}
+
+void AttributeReadCache::store(const std::string &key, const DeviceAttribute &value)
+{
+    if(!is_enabled() || value.has_failed())
+    {
+        return;
+    }
+
+    Entry entry{value, clock::now()};
+
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.insert_or_assign(key, std::move(entry));
+}
+
+void AttributeReadCache::store_from_event(const std::string &key, const DeviceAttribute &value)
+{
+    if(!is_enabled() || value.has_failed())
+    {
+        return;
+    }
+
+    store(key, value);
+    event_updates.fetch_add(1, std::memory_order_relaxed);
+}
+
+DeviceAttribute AttributeReadCache::read(const std::string &key,
+                                         std::chrono::milliseconds max_age,
+                                         const std::function<DeviceAttribute()> &reader)
+{
+    std::shared_ptr<InFlight> flight;
+    bool leader = false;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto pos = entries.find(key);
+        if(pos != entries.end() && clock::now() - pos->second.received <= max_age)
+        {
+            hits.fetch_add(1, std::memory_order_relaxed);
+            return pos->second.value;
+        }
+
+        auto flight_pos = in_flight.find(key);
+        if(flight_pos == in_flight.end())
+        {
+            flight = std::make_shared<InFlight>();
+            in_flight.emplace(key, flight);
+            leader = true;
+        }
+        else
+        {
+            flight = flight_pos->second;
+        }
+    }
+
+    if(!leader)
+    {
+        coalesced.fetch_add(1, std::memory_order_relaxed);
+
+        std::unique_lock<std::mutex> lock(flight->mutex);
+        flight->cond.wait(lock, [&flight]() { return flight->done; });
+
+        if(flight->error)
+        {
+            std::rethrow_exception(flight->error);
+        }
+        return *flight->value;
+    }
+
+    misses.fetch_add(1, std::memory_order_relaxed);
+
+    std::optional<DeviceAttribute> value;
+    std::exception_ptr error;
+
+    try
+    {
+        value = reader();
+        store(key, *value);
+    }
+    catch(...)
+    {
+        error = std::current_exception();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        in_flight.erase(key);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(flight->mutex);
+        flight->done = true;
+        flight->error = error;
+        if(value.has_value())
+        {
+            flight->value = *value;
+        }
+    }
+    flight->cond.notify_all();
+
+    if(error)
+    {
+        std::rethrow_exception(error);
+    }
+
+    return std::move(*value);
+}
+
+void AttributeReadCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+}
+
+AttributeReadCache::Stats AttributeReadCache::get_stats() const
+{
+    Stats stats;
+
+    stats.hits = hits.load(std::memory_order_relaxed);
+    stats.misses = misses.load(std::memory_order_relaxed);
+    stats.coalesced = coalesced.load(std::memory_order_relaxed);
+    stats.event_updates = event_updates.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+} // namespace Tango::detail
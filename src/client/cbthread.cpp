@@ -40,7 +40,11 @@
 #include <tango/server/tango_clock.h>
 #include <tango/client/devasyn.h>
 #include <tango/client/ApiUtil.h>
+#include <tango/server/except.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 
 namespace Tango
@@ -68,15 +72,15 @@ void *CallBackThread::run_undetached(TANGO_UNUSED(void *ptr))
         {
             {
                 omni_mutex_lock sync(*asyn_ptr);
-                if(asyn_ptr->get_cb_request_nb_i() == 0)
+                if(asyn_ptr->get_cb_pending_nb_i() == 0)
                 {
                     asyn_ptr->wait();
                 }
             }
 
-            if(asyn_ptr->get_cb_request_nb() != 0)
+            if(asyn_ptr->get_cb_pending_nb() != 0)
             {
-                ApiUtil::instance()->get_asynch_replies(0);
+                ApiUtil::instance()->dispatch_asynch_replies();
             }
         }
         catch(omni_thread_fatal &)
@@ -95,4 +99,180 @@ void *CallBackThread::run_undetached(TANGO_UNUSED(void *ptr))
     return nullptr;
 }
 
+//+-------------------------------------------------------------------------
+//
+// method :         CallBackExecutor::CallBackExecutor
+//
+// description :     Constructor of the CallBackExecutor class. It creates
+//            and starts the executor threads
+//
+// argument : in :    - nb_threads : The executor thread number
+//
+//--------------------------------------------------------------------------
+
+CallBackExecutor::CallBackExecutor(size_t nb_threads)
+{
+    nb_threads = std::max(nb_threads, static_cast<size_t>(1));
+
+    workers.reserve(nb_threads);
+    for(size_t loop = 0; loop < nb_threads; ++loop)
+    {
+        auto *worker = new Worker(*this);
+        worker->start();
+        workers.push_back(worker);
+    }
+}
+
+//+-------------------------------------------------------------------------
+//
+// method :         CallBackExecutor::~CallBackExecutor
+//
+// description :     Ask all the executor threads to exit once their
+//            queue is empty and wait for them
+//
+//--------------------------------------------------------------------------
+
+CallBackExecutor::~CallBackExecutor()
+{
+    for(auto *worker : workers)
+    {
+        omni_mutex_lock sync(worker->mutex);
+        worker->stop = true;
+        worker->cond.signal();
+    }
+
+    for(auto *worker : workers)
+    {
+        worker->join(nullptr);
+    }
+}
+
+//+-------------------------------------------------------------------------
+//
+// method :         CallBackExecutor::post
+//
+// description :     Queue a callback. All the callbacks for the same
+//            connection are sent to the same thread to keep their
+//            ordering
+//
+// argument : in :    - con : The connection the reply belongs to
+//            - func : The callback to execute
+//
+//--------------------------------------------------------------------------
+
+void CallBackExecutor::post(Connection *con, std::function<void()> &&func)
+{
+    //
+    // Objects are aligned, drop the low order bits before hashing so that devices are spread over all the workers
+    //
+
+    auto key = reinterpret_cast<std::uintptr_t>(con) / alignof(std::max_align_t);
+    Worker *worker = workers[std::hash<std::uintptr_t>{}(key) % workers.size()];
+
+    omni_mutex_lock sync(worker->mutex);
+    worker->jobs.push_back(Job{std::move(func), clock::now()});
+    worker->cond.signal();
+}
+
+//+-------------------------------------------------------------------------
+//
+// method :         CallBackExecutor::get_stats
+//
+// description :     Return callback execution statistics
+//
+//--------------------------------------------------------------------------
+
+CallBackStats CallBackExecutor::get_stats()
+{
+    CallBackStats stats;
+
+    stats.executed = executed.load(std::memory_order_relaxed);
+    if(stats.executed != 0)
+    {
+        stats.mean_delay = std::chrono::microseconds(total_delay_us.load(std::memory_order_relaxed) / stats.executed);
+    }
+    stats.max_delay = std::chrono::microseconds(max_delay_us.load(std::memory_order_relaxed));
+    stats.last_delay = std::chrono::microseconds(last_delay_us.load(std::memory_order_relaxed));
+
+    for(auto *worker : workers)
+    {
+        omni_mutex_lock sync(worker->mutex);
+        stats.queued += worker->jobs.size();
+    }
+
+    return stats;
+}
+
+void CallBackExecutor::record_delay(clock::duration delay)
+{
+    auto delay_us = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(delay).count());
+
+    last_delay_us.store(delay_us, std::memory_order_relaxed);
+    total_delay_us.fetch_add(delay_us, std::memory_order_relaxed);
+
+    auto old_max = max_delay_us.load(std::memory_order_relaxed);
+    while(delay_us > old_max && !max_delay_us.compare_exchange_weak(old_max, delay_us, std::memory_order_relaxed))
+    {
+    }
+
+    executed.fetch_add(1, std::memory_order_relaxed);
+}
+
+//+-------------------------------------------------------------------------
+//
+// method :         CallBackExecutor::Worker::run_undetached
+//
+// description :     The executor thread code. Wait for callbacks to be
+//            queued and execute them in order
+//
+//--------------------------------------------------------------------------
+
+void *CallBackExecutor::Worker::run_undetached(TANGO_UNUSED(void *ptr))
+{
+    while(true)
+    {
+        Job job;
+
+        {
+            omni_mutex_lock sync(mutex);
+            while(jobs.empty() && !stop)
+            {
+                cond.wait();
+            }
+
+            if(jobs.empty())
+            {
+                break;
+            }
+
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+
+        executor.record_delay(clock::now() - job.enqueued);
+
+        try
+        {
+            job.func();
+        }
+        catch(DevFailed &e)
+        {
+            std::cerr << "CallBackExecutor: A Tango exception has been thrown by an asynchronous callback" << std::endl;
+            Except::print_exception(e);
+        }
+        catch(std::exception &e)
+        {
+            std::cerr << "CallBackExecutor: An exception has been thrown by an asynchronous callback: " << e.what()
+                      << std::endl;
+        }
+        catch(...)
+        {
+            std::cerr << "CallBackExecutor: An unknown exception has been thrown by an asynchronous callback"
+                      << std::endl;
+        }
+    }
+
+    return nullptr;
+}
+
 } // namespace Tango
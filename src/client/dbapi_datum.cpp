@@ -30,8 +30,8 @@
 
 #include <tango/server/tango_config.h>
 #include <tango/client/apiexcept.h>
+#include <tango/internal/number_conversion.h>
 
-#include <iomanip>
 #include <limits>
 #include <algorithm>
 #include <iostream>
@@ -42,6 +42,45 @@ using namespace CORBA;
 namespace Tango
 {
 
+namespace
+{
+
+//-----------------------------------------------------------------------------
+//
+// parse_float() - extract a float or a double, "nan" and "inf" being also accepted
+//
+//-----------------------------------------------------------------------------
+
+template <typename T>
+bool parse_float(const std::string &str, T &datum)
+{
+    if(detail::parse_number_prefix(str, datum))
+    {
+        return true;
+    }
+
+    if((TG_strcasecmp("nan", str.c_str()) == 0) || (TG_strcasecmp("-nan", str.c_str()) == 0))
+    {
+        datum = std::numeric_limits<T>::quiet_NaN();
+    }
+    else if(TG_strcasecmp("-inf", str.c_str()) == 0)
+    {
+        datum = -std::numeric_limits<T>::infinity();
+    }
+    else if((TG_strcasecmp("inf", str.c_str()) == 0) || (TG_strcasecmp("+inf", str.c_str()) == 0))
+    {
+        datum = std::numeric_limits<T>::infinity();
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace
+
 //-----------------------------------------------------------------------------
 //
 // DbDatum::DbDatum() - constructor to create DbDatum specifying name
@@ -152,11 +191,8 @@ bool DbDatum::is_empty()
 
 void DbDatum::operator<<(bool datum)
 {
-    std::ostringstream ostream;
-    ostream << std::boolalpha << datum;
-
     value_string.resize(1);
-    value_string[0] = std::string(ostream.str());
+    value_string[0] = datum ? "true" : "false";
 
     value_type = DEV_BOOLEAN;
     value_size = 1;
@@ -213,11 +249,8 @@ bool DbDatum::operator>>(bool &datum)
 
 void DbDatum::operator<<(short datum)
 {
-    std::ostringstream ostream;
-    ostream << datum;
-
     value_string.resize(1);
-    value_string[0] = std::string(ostream.str());
+    value_string[0] = detail::format_number(datum);
 
     value_type = DEV_SHORT;
     value_size = 1;
@@ -244,10 +277,7 @@ bool DbDatum::operator>>(short &datum) const
     }
     else
     {
-        std::istringstream istream(value_string[0]);
-
-        istream >> datum;
-        if(!istream)
+        if(!detail::parse_number_prefix(value_string[0], datum))
         {
             if(exceptions_flags.test(wrongtype_flag))
             {
@@ -273,11 +303,8 @@ bool DbDatum::operator>>(short &datum) const
 
 void DbDatum::operator<<(unsigned char datum)
 {
-    std::ostringstream ostream;
-    ostream << (short) datum; // to accept only numbers
-
     value_string.resize(1);
-    value_string[0] = std::string(ostream.str());
+    value_string[0] = detail::format_number(static_cast<short>(datum)); // to accept only numbers
 
     value_type = DEV_UCHAR;
     value_size = 1;
@@ -332,11 +359,8 @@ bool DbDatum::operator>>(unsigned char &datum) const
 
 void DbDatum::operator<<(unsigned short datum)
 {
-    std::ostringstream ostream;
-    ostream << datum;
-
     value_string.resize(1);
-    value_string[0] = std::string(ostream.str());
+    value_string[0] = detail::format_number(datum);
 
     value_type = DEV_USHORT;
     value_size = 1;
@@ -362,9 +386,7 @@ bool DbDatum::operator>>(unsigned short &datum) const
     }
     else
     {
-        std::istringstream istream(value_string[0]);
-        istream >> datum;
-        if(!istream)
+        if(!detail::parse_number_prefix(value_string[0], datum))
         {
             if(exceptions_flags.test(wrongtype_flag))
             {
@@ -391,11 +413,8 @@ bool DbDatum::operator>>(unsigned short &datum) const
 
 void DbDatum::operator<<(DevLong datum)
 {
-    std::ostringstream ostream;
-    ostream << datum;
-
     value_string.resize(1);
-    value_string[0] = std::string(ostream.str());
+    value_string[0] = detail::format_number(datum);
 
     value_type = DEV_LONG;
     value_size = 1;
@@ -421,9 +440,7 @@ bool DbDatum::operator>>(DevLong &datum) const
     }
     else
     {
-        std::istringstream istream(value_string[0]);
-        istream >> datum;
-        if(!istream)
+        if(!detail::parse_number_prefix(value_string[0], datum))
         {
             if(exceptions_flags.test(wrongtype_flag))
             {
@@ -450,11 +467,8 @@ bool DbDatum::operator>>(DevLong &datum) const
 
 void DbDatum::operator<<(DevULong datum)
 {
-    std::ostringstream ostream;
-    ostream << datum;
-
     value_string.resize(1);
-    value_string[0] = std::string(ostream.str());
+    value_string[0] = detail::format_number(datum);
 
     value_type = DEV_ULONG;
     value_size = 1;
@@ -480,9 +494,7 @@ bool DbDatum::operator>>(DevULong &datum) const
     }
     else
     {
-        std::istringstream istream(value_string[0]);
-        istream >> datum;
-        if(!istream)
+        if(!detail::parse_number_prefix(value_string[0], datum))
         {
             if(exceptions_flags.test(wrongtype_flag))
             {
@@ -510,11 +522,8 @@ bool DbDatum::operator>>(DevULong &datum) const
 
 void DbDatum::operator<<(DevLong64 datum)
 {
-    std::ostringstream ostream;
-    ostream << datum;
-
     value_string.resize(1);
-    value_string[0] = std::string(ostream.str());
+    value_string[0] = detail::format_number(datum);
 
     value_type = DEV_LONG64;
     value_size = 1;
@@ -540,9 +549,7 @@ bool DbDatum::operator>>(DevLong64 &datum) const
     }
     else
     {
-        std::istringstream istream(value_string[0]);
-        istream >> datum;
-        if(!istream)
+        if(!detail::parse_number_prefix(value_string[0], datum))
         {
             if(exceptions_flags.test(wrongtype_flag))
             {
@@ -569,11 +576,8 @@ bool DbDatum::operator>>(DevLong64 &datum) const
 
 void DbDatum::operator<<(DevULong64 datum)
 {
-    std::ostringstream ostream;
-    ostream << datum;
-
     value_string.resize(1);
-    value_string[0] = std::string(ostream.str());
+    value_string[0] = detail::format_number(datum);
 
     value_type = DEV_ULONG64;
     value_size = 1;
@@ -599,9 +603,7 @@ bool DbDatum::operator>>(DevULong64 &datum) const
     }
     else
     {
-        std::istringstream istream(value_string[0]);
-        istream >> datum;
-        if(!istream)
+        if(!detail::parse_number_prefix(value_string[0], datum))
         {
             if(exceptions_flags.test(wrongtype_flag))
             {
@@ -629,11 +631,8 @@ bool DbDatum::operator>>(DevULong64 &datum) const
 
 void DbDatum::operator<<(float datum)
 {
-    std::ostringstream ostream;
-    ostream << std::setprecision(TANGO_FLOAT_PRECISION) << datum;
-
     value_string.resize(1);
-    value_string[0] = std::string(ostream.str());
+    value_string[0] = detail::format_number(datum);
 
     value_type = DEV_FLOAT;
     value_size = 1;
@@ -659,37 +658,14 @@ bool DbDatum::operator>>(float &datum) const
     }
     else
     {
-        std::istringstream istream(value_string[0]);
-        istream >> datum;
-        if(!istream)
+        if(!parse_float(value_string[0], datum))
         {
-            if((TG_strcasecmp("nan", value_string[0].c_str()) == 0) ||
-               (TG_strcasecmp("-nan", value_string[0].c_str()) == 0))
-            {
-                datum = std::numeric_limits<float>::quiet_NaN();
-            }
-            else if(TG_strcasecmp("-inf", value_string[0].c_str()) == 0)
-            {
-                datum = -std::numeric_limits<float>::infinity();
-            }
-            else if((TG_strcasecmp("inf", value_string[0].c_str()) == 0) ||
-                    (TG_strcasecmp("+inf", value_string[0].c_str()) == 0))
-            {
-                datum = std::numeric_limits<float>::infinity();
-            }
-            else if(exceptions_flags.test(wrongtype_flag))
+            if(exceptions_flags.test(wrongtype_flag))
             {
                 TANGO_THROW_DETAILED_EXCEPTION(
                     ApiDataExcept, API_IncompatibleArgumentType, "Cannot extract, data in DbDatum is not a float");
             }
-            else
-            {
-                ret = false;
-            }
-        }
-        else
-        {
-            ret = true;
+            ret = false;
         }
     }
 
@@ -704,11 +680,8 @@ bool DbDatum::operator>>(float &datum) const
 
 void DbDatum::operator<<(double datum)
 {
-    std::ostringstream ostream;
-    ostream << std::setprecision(TANGO_FLOAT_PRECISION) << datum;
-
     value_string.resize(1);
-    value_string[0] = std::string(ostream.str());
+    value_string[0] = detail::format_number(datum);
 
     value_type = DEV_DOUBLE;
     value_size = 1;
@@ -734,37 +707,14 @@ bool DbDatum::operator>>(double &datum) const
     }
     else
     {
-        std::istringstream istream(value_string[0]);
-        istream >> std::setprecision(TANGO_FLOAT_PRECISION) >> datum;
-        if(!istream)
+        if(!parse_float(value_string[0], datum))
         {
-            if((TG_strcasecmp("nan", value_string[0].c_str()) == 0) ||
-               (TG_strcasecmp("-nan", value_string[0].c_str()) == 0))
-            {
-                datum = std::numeric_limits<double>::quiet_NaN();
-            }
-            else if(TG_strcasecmp("-inf", value_string[0].c_str()) == 0)
-            {
-                datum = -std::numeric_limits<double>::infinity();
-            }
-            else if((TG_strcasecmp("inf", value_string[0].c_str()) == 0) ||
-                    (TG_strcasecmp("+inf", value_string[0].c_str()) == 0))
-            {
-                datum = std::numeric_limits<double>::infinity();
-            }
-            else if(exceptions_flags.test(wrongtype_flag))
+            if(exceptions_flags.test(wrongtype_flag))
             {
                 TANGO_THROW_DETAILED_EXCEPTION(
                     ApiDataExcept, API_IncompatibleArgumentType, "Cannot extract, data in DbDatum is not a double");
             }
-            else
-            {
-                ret = false;
-            }
-        }
-        else
-        {
-            ret = true;
+            ret = false;
         }
     }
 
@@ -891,14 +841,10 @@ bool DbDatum::operator>>(const char *&datum) const
 
 void DbDatum::operator<<(const std::vector<short> &datum)
 {
-    std::ostringstream ostream;
     value_string.resize(datum.size());
     for(unsigned int i = 0; i < datum.size(); i++)
     {
-        ostream << datum[i];
-        value_string[i] = ostream.str();
-
-        ostream.str("");
+        value_string[i] = detail::format_number(datum[i]);
     }
     value_type = DEVVAR_SHORTARRAY;
     value_size = datum.size();
@@ -925,17 +871,10 @@ bool DbDatum::operator>>(std::vector<short> &datum) const
     }
     else
     {
-        std::stringstream iostream;
-
         datum.resize(value_string.size());
         for(unsigned int i = 0; i < value_string.size(); i++)
         {
-            iostream.seekp(0);
-            iostream.seekg(0);
-            iostream.clear();
-            iostream << value_string[i] << std::ends;
-            iostream >> datum[i];
-            if(!iostream)
+            if(!detail::parse_number_prefix(value_string[i], datum[i]))
             {
                 if(exceptions_flags.test(wrongtype_flag))
                 {
@@ -962,13 +901,10 @@ bool DbDatum::operator>>(std::vector<short> &datum) const
 
 void DbDatum::operator<<(const std::vector<unsigned short> &datum)
 {
-    std::ostringstream ostream;
     value_string.resize(datum.size());
     for(unsigned int i = 0; i < datum.size(); i++)
     {
-        ostream << datum[i];
-        value_string[i] = ostream.str();
-        ostream.str("");
+        value_string[i] = detail::format_number(datum[i]);
     }
     value_type = DEVVAR_USHORTARRAY;
     value_size = datum.size();
@@ -995,17 +931,10 @@ bool DbDatum::operator>>(std::vector<unsigned short> &datum) const
     }
     else
     {
-        std::stringstream iostream;
-
         datum.resize(value_string.size());
         for(unsigned int i = 0; i < value_string.size(); i++)
         {
-            iostream.seekp(0);
-            iostream.seekg(0);
-            iostream.clear();
-            iostream << value_string[i] << std::ends;
-            iostream >> datum[i];
-            if(!iostream)
+            if(!detail::parse_number_prefix(value_string[i], datum[i]))
             {
                 if(exceptions_flags.test(wrongtype_flag))
                 {
@@ -1032,14 +961,10 @@ bool DbDatum::operator>>(std::vector<unsigned short> &datum) const
 
 void DbDatum::operator<<(const std::vector<DevLong> &datum)
 {
-    std::ostringstream ostream;
-
     value_string.resize(datum.size());
     for(unsigned int i = 0; i < datum.size(); i++)
     {
-        ostream << datum[i];
-        value_string[i] = ostream.str();
-        ostream.str("");
+        value_string[i] = detail::format_number(datum[i]);
     }
     value_type = DEVVAR_LONGARRAY;
     value_size = datum.size();
@@ -1066,17 +991,10 @@ bool DbDatum::operator>>(std::vector<DevLong> &datum) const
     }
     else
     {
-        std::stringstream iostream;
-
         datum.resize(value_string.size());
         for(unsigned int i = 0; i < value_string.size(); i++)
         {
-            iostream.seekp(0);
-            iostream.seekg(0);
-            iostream.clear();
-            iostream << value_string[i] << std::ends;
-            iostream >> datum[i];
-            if(!iostream)
+            if(!detail::parse_number_prefix(value_string[i], datum[i]))
             {
                 if(exceptions_flags.test(wrongtype_flag))
                 {
@@ -1103,14 +1021,10 @@ bool DbDatum::operator>>(std::vector<DevLong> &datum) const
 
 void DbDatum::operator<<(const std::vector<DevULong> &datum)
 {
-    std::ostringstream ostream;
-
     value_string.resize(datum.size());
     for(unsigned int i = 0; i < datum.size(); i++)
     {
-        ostream << datum[i];
-        value_string[i] = ostream.str();
-        ostream.str("");
+        value_string[i] = detail::format_number(datum[i]);
     }
     value_type = DEVVAR_ULONGARRAY;
     value_size = datum.size();
@@ -1137,17 +1051,10 @@ bool DbDatum::operator>>(std::vector<DevULong> &datum) const
     }
     else
     {
-        std::stringstream iostream;
-
         datum.resize(value_string.size());
         for(unsigned int i = 0; i < value_string.size(); i++)
         {
-            iostream.seekp(0);
-            iostream.seekg(0);
-            iostream.clear();
-            iostream << value_string[i] << std::ends;
-            iostream >> datum[i];
-            if(!iostream)
+            if(!detail::parse_number_prefix(value_string[i], datum[i]))
             {
                 if(exceptions_flags.test(wrongtype_flag))
                 {
@@ -1174,14 +1081,10 @@ bool DbDatum::operator>>(std::vector<DevULong> &datum) const
 
 void DbDatum::operator<<(const std::vector<DevLong64> &datum)
 {
-    std::ostringstream ostream;
-
     value_string.resize(datum.size());
     for(unsigned int i = 0; i < datum.size(); i++)
     {
-        ostream << datum[i];
-        value_string[i] = ostream.str();
-        ostream.str("");
+        value_string[i] = detail::format_number(datum[i]);
     }
     value_type = DEVVAR_LONG64ARRAY;
     value_size = datum.size();
@@ -1208,17 +1111,10 @@ bool DbDatum::operator>>(std::vector<DevLong64> &datum) const
     }
     else
     {
-        std::stringstream iostream;
-
         datum.resize(value_string.size());
         for(unsigned int i = 0; i < value_string.size(); i++)
         {
-            iostream.seekp(0);
-            iostream.seekg(0);
-            iostream.clear();
-            iostream << value_string[i] << std::ends;
-            iostream >> datum[i];
-            if(!iostream)
+            if(!detail::parse_number_prefix(value_string[i], datum[i]))
             {
                 if(exceptions_flags.test(wrongtype_flag))
                 {
@@ -1245,14 +1141,10 @@ bool DbDatum::operator>>(std::vector<DevLong64> &datum) const
 
 void DbDatum::operator<<(const std::vector<DevULong64> &datum)
 {
-    std::ostringstream ostream;
-
     value_string.resize(datum.size());
     for(unsigned int i = 0; i < datum.size(); i++)
     {
-        ostream << datum[i];
-        value_string[i] = ostream.str();
-        ostream.str("");
+        value_string[i] = detail::format_number(datum[i]);
     }
     value_type = DEVVAR_ULONG64ARRAY;
     value_size = datum.size();
@@ -1279,17 +1171,10 @@ bool DbDatum::operator>>(std::vector<DevULong64> &datum) const
     }
     else
     {
-        std::stringstream iostream;
-
         datum.resize(value_string.size());
         for(unsigned int i = 0; i < value_string.size(); i++)
         {
-            iostream.seekp(0);
-            iostream.seekg(0);
-            iostream.clear();
-            iostream << value_string[i] << std::ends;
-            iostream >> datum[i];
-            if(!iostream)
+            if(!detail::parse_number_prefix(value_string[i], datum[i]))
             {
                 if(exceptions_flags.test(wrongtype_flag))
                 {
@@ -1316,14 +1201,10 @@ bool DbDatum::operator>>(std::vector<DevULong64> &datum) const
 
 void DbDatum::operator<<(const std::vector<float> &datum)
 {
-    std::ostringstream ostream;
-
     value_string.resize(datum.size());
     for(unsigned int i = 0; i < datum.size(); i++)
     {
-        ostream << std::setprecision(TANGO_FLOAT_PRECISION) << datum[i];
-        value_string[i] = ostream.str();
-        ostream.str("");
+        value_string[i] = detail::format_number(datum[i]);
     }
     value_type = DEVVAR_FLOATARRAY;
     value_size = datum.size();
@@ -1350,46 +1231,22 @@ bool DbDatum::operator>>(std::vector<float> &datum) const
     }
     else
     {
-        std::stringstream iostream;
-
         datum.resize(value_string.size());
         for(unsigned int i = 0; i < value_string.size(); i++)
         {
-            iostream.clear();
-            iostream.seekp(0);
-            iostream.seekg(0);
-            iostream << value_string[i] << std::ends;
-            iostream >> datum[i];
-            if(!iostream)
+            if(!parse_float(value_string[i], datum[i]))
             {
-                if((TG_strcasecmp("nan", value_string[i].c_str()) == 0) ||
-                   (TG_strcasecmp("-nan", value_string[i].c_str()) == 0))
-                {
-                    datum[i] = std::numeric_limits<float>::quiet_NaN();
-                }
-                else if(TG_strcasecmp("-inf", value_string[i].c_str()) == 0)
-                {
-                    datum[i] = -std::numeric_limits<float>::infinity();
-                }
-                else if((TG_strcasecmp("inf", value_string[i].c_str()) == 0) ||
-                        (TG_strcasecmp("+inf", value_string[i].c_str()) == 0))
-                {
-                    datum[i] = std::numeric_limits<float>::infinity();
-                }
-                else if(exceptions_flags.test(wrongtype_flag))
+                if(exceptions_flags.test(wrongtype_flag))
                 {
                     TangoSys_OMemStream desc;
                     desc << "Cannot extract float vector, elt number ";
                     desc << i + 1 << " is not a float" << std::ends;
                     TANGO_THROW_DETAILED_EXCEPTION(ApiDataExcept, API_IncompatibleArgumentType, desc.str());
                 }
-                else
-                {
-                    ret = false;
-                    break;
-                }
+                ret = false;
+                break;
             }
-        } // for (unsigned int i=0; i<value_string.size(); i++)
+        }
     }
 
     return ret;
@@ -1403,14 +1260,10 @@ bool DbDatum::operator>>(std::vector<float> &datum) const
 
 void DbDatum::operator<<(const std::vector<double> &datum)
 {
-    std::ostringstream ostream;
     value_string.resize(datum.size());
-
     for(unsigned int i = 0; i < datum.size(); i++)
     {
-        ostream << std::setprecision(TANGO_FLOAT_PRECISION) << datum[i];
-        value_string[i] = ostream.str();
-        ostream.str("");
+        value_string[i] = detail::format_number(datum[i]);
     }
 
     value_type = DEVVAR_DOUBLEARRAY;
@@ -1438,46 +1291,22 @@ bool DbDatum::operator>>(std::vector<double> &datum) const
     }
     else
     {
-        std::stringstream iostream;
-
         datum.resize(value_string.size());
         for(unsigned int i = 0; i < value_string.size(); i++)
         {
-            iostream.clear();
-            iostream.seekp(0);
-            iostream.seekg(0);
-            iostream << value_string[i] << std::ends;
-            iostream >> std::setprecision(TANGO_FLOAT_PRECISION) >> datum[i];
-            if(!iostream)
+            if(!parse_float(value_string[i], datum[i]))
             {
-                if((TG_strcasecmp("nan", value_string[i].c_str()) == 0) ||
-                   (TG_strcasecmp("-nan", value_string[i].c_str()) == 0))
-                {
-                    datum[i] = std::numeric_limits<double>::quiet_NaN();
-                }
-                else if(TG_strcasecmp("-inf", value_string[i].c_str()) == 0)
-                {
-                    datum[i] = -std::numeric_limits<double>::infinity();
-                }
-                else if((TG_strcasecmp("inf", value_string[i].c_str()) == 0) ||
-                        (TG_strcasecmp("+inf", value_string[i].c_str()) == 0))
-                {
-                    datum[i] = std::numeric_limits<double>::infinity();
-                }
-                else if(exceptions_flags.test(wrongtype_flag))
+                if(exceptions_flags.test(wrongtype_flag))
                 {
                     TangoSys_OMemStream desc;
                     desc << "Cannot extract double vector, elt number ";
                     desc << i + 1 << " is not a double" << std::ends;
                     TANGO_THROW_DETAILED_EXCEPTION(ApiDataExcept, API_IncompatibleArgumentType, desc.str());
                 }
-                else
-                {
-                    ret = false;
-                    break;
-                }
+                ret = false;
+                break;
             }
-        } // for (unsigned int i=0; i<value_string.size(); i++)
+        }
     }
     return ret;
 }
@@ -33,6 +33,7 @@
 #include <tango/server/device.h>
 #include <tango/internal/net.h>
 #include <tango/internal/utils.h>
+#include <tango/internal/attr_read_cache.h>
 
 #ifdef _TG_WINDOWS_
   #include <process.h>
@@ -823,13 +824,13 @@ Connection::Connection(const Connection &sou) :
     }
 
     timeout = sou.timeout;
-    connection_state = sou.connection_state;
+    connection_state = sou.connection_state.load();
     version = sou.version;
     server_version = sou.server_version;
-    source = sou.source;
+    source = sou.source.load();
 
     check_acc = sou.check_acc;
-    access = sou.access;
+    access = sou.access.load();
 
     tr_reco = sou.tr_reco;
     device_3 = sou.device_3;
@@ -886,13 +887,13 @@ Connection &Connection::operator=(const Connection &rval)
     }
 
     timeout = rval.timeout;
-    connection_state = rval.connection_state;
+    connection_state = rval.connection_state.load();
     version = rval.version;
     server_version = rval.server_version;
-    source = rval.source;
+    source = rval.source.load();
 
     check_acc = rval.check_acc;
-    access = rval.access;
+    access = rval.access.load();
 
     tr_reco = rval.tr_reco;
     device_3 = rval.device_3;
@@ -934,12 +935,11 @@ Connection &Connection::operator=(const Connection &rval)
 
 void Connection::check_and_reconnect()
 {
-    int local_connection_state;
-    {
-        ReaderLock guard(con_to_mon);
-        local_connection_state = connection_state;
-    }
-    if(local_connection_state != CONNECTION_OK)
+    //
+    // Fast path: the connection state is an atomic, no need to take the lock when the connection is OK
+    //
+
+    if(connection_state.load(std::memory_order_acquire) != CONNECTION_OK)
     {
         WriterLock guard(con_to_mon);
         if(connection_state != CONNECTION_OK)
@@ -951,13 +951,8 @@ void Connection::check_and_reconnect()
 
 void Connection::check_and_reconnect(Tango::DevSource &sou)
 {
-    int local_connection_state;
-    {
-        ReaderLock guard(con_to_mon);
-        local_connection_state = connection_state;
-        sou = source;
-    }
-    if(local_connection_state != CONNECTION_OK)
+    sou = source.load(std::memory_order_relaxed);
+    if(connection_state.load(std::memory_order_acquire) != CONNECTION_OK)
     {
         WriterLock guard(con_to_mon);
         if(connection_state != CONNECTION_OK)
@@ -969,13 +964,8 @@ void Connection::check_and_reconnect(Tango::DevSource &sou)
 
 void Connection::check_and_reconnect(Tango::AccessControlType &act)
 {
-    int local_connection_state;
-    {
-        ReaderLock guard(con_to_mon);
-        local_connection_state = connection_state;
-        act = access;
-    }
-    if(local_connection_state != CONNECTION_OK)
+    act = access.load(std::memory_order_relaxed);
+    if(connection_state.load(std::memory_order_acquire) != CONNECTION_OK)
     {
         WriterLock guard(con_to_mon);
         if(connection_state != CONNECTION_OK)
@@ -988,14 +978,9 @@ void Connection::check_and_reconnect(Tango::AccessControlType &act)
 
 void Connection::check_and_reconnect(Tango::DevSource &sou, Tango::AccessControlType &act)
 {
-    int local_connection_state;
-    {
-        ReaderLock guard(con_to_mon);
-        local_connection_state = connection_state;
-        act = access;
-        sou = source;
-    }
-    if(local_connection_state != CONNECTION_OK)
+    act = access.load(std::memory_order_relaxed);
+    sou = source.load(std::memory_order_relaxed);
+    if(connection_state.load(std::memory_order_acquire) != CONNECTION_OK)
     {
         WriterLock guard(con_to_mon);
         if(connection_state != CONNECTION_OK)
@@ -1014,8 +999,7 @@ void Connection::set_connection_state(int con)
 
 Tango::DevSource Connection::get_source()
 {
-    ReaderLock guard(con_to_mon);
-    return source;
+    return source.load(std::memory_order_relaxed);
 }
 
 void Connection::set_source(Tango::DevSource sou)
@@ -1504,8 +1488,9 @@ ClntIdent Connection::get_client_identification() const
     // the client identification struct to be returned
     ClntIdent ci;
 
-    // the pid of the cpp server (acting as a client) or the pure cpp client within which this code is executed
-    TangoSys_Pid pid = ApiUtil::instance()->get_client_pid();
+    // the pid of the cpp server (acting as a client) or the pure cpp client within which this code is executed.
+    // ApiUtil::instance() takes a process wide mutex, the pid does not change so get it only once.
+    static const TangoSys_Pid pid = ApiUtil::instance()->get_client_pid();
 
     if(version >= 4 && server_version >= 6)
     {
@@ -1541,13 +1526,7 @@ ClntIdent Connection::get_client_identification() const
 
 bool Connection::is_connected()
 {
-    bool connected = true;
-    ReaderLock guard(con_to_mon);
-    if(connection_state != CONNECTION_OK)
-    {
-        connected = false;
-    }
-    return connected;
+    return connection_state.load(std::memory_order_acquire) == CONNECTION_OK;
 }
 
 //-----------------------------------------------------------------------------
@@ -6315,6 +6294,81 @@ DeviceAttribute DeviceProxy::read_attribute(const std::string &attr_string)
     TANGO_TELEMETRY_TRACE_END();
 }
 
+//-----------------------------------------------------------------------------
+//
+// DeviceProxy::read_attribute_cached() - return a single attribute, from the
+// client attribute cache if the cached value is recent enough
+//
+//-----------------------------------------------------------------------------
+
+DeviceAttribute DeviceProxy::read_attribute_cached(const std::string &attr_string, std::chrono::milliseconds max_age)
+{
+    auto &cache = detail::AttributeReadCache::instance();
+    if(!cache.is_enabled())
+    {
+        return read_attribute(attr_string);
+    }
+
+    std::string key = detail::AttributeReadCache::make_key(this, attr_string);
+    return cache.read(key, max_age, [this, &attr_string]() { return read_attribute(attr_string); });
+}
+
+//-----------------------------------------------------------------------------
+//
+// DeviceProxy::read_attributes_cached() - return attributes, from the client
+// attribute cache for the ones with recent enough cached value
+//
+//-----------------------------------------------------------------------------
+
+std::vector<DeviceAttribute> *DeviceProxy::read_attributes_cached(const std::vector<std::string> &attr_string_list,
+                                                                  std::chrono::milliseconds max_age)
+{
+    auto &cache = detail::AttributeReadCache::instance();
+    if(!cache.is_enabled())
+    {
+        return read_attributes(attr_string_list);
+    }
+
+    auto dev_attr = std::make_unique<std::vector<DeviceAttribute>>(attr_string_list.size());
+    std::vector<std::string> keys;
+    std::vector<std::string> missing_names;
+    std::vector<size_t> missing_idx;
+
+    keys.reserve(attr_string_list.size());
+    for(size_t i = 0; i < attr_string_list.size(); ++i)
+    {
+        keys.push_back(detail::AttributeReadCache::make_key(this, attr_string_list[i]));
+
+        auto cached = cache.get(keys.back(), max_age);
+        if(cached.has_value())
+        {
+            (*dev_attr)[i] = std::move(*cached);
+        }
+        else
+        {
+            missing_names.push_back(attr_string_list[i]);
+            missing_idx.push_back(i);
+        }
+    }
+
+    //
+    // Read all the attributes not found in the cache in one call
+    //
+
+    if(!missing_names.empty())
+    {
+        std::unique_ptr<std::vector<DeviceAttribute>> fresh(read_attributes(missing_names));
+
+        for(size_t i = 0; i < missing_idx.size(); ++i)
+        {
+            cache.store(keys[missing_idx[i]], (*fresh)[i]);
+            (*dev_attr)[missing_idx[i]] = std::move((*fresh)[i]);
+        }
+    }
+
+    return dev_attr.release();
+}
+
 void DeviceProxy::read_attribute(const char *attr_str, DeviceAttribute &dev_attr)
 {
     TANGO_TELEMETRY_TRACE_BEGIN((Tango::telemetry::Attributes{{"tango.operation.target", dev_name()},
@@ -7756,6 +7810,74 @@ std::vector<std::string> *DeviceProxy::polling_status()
     return poll_stat;
 }
 
+//-----------------------------------------------------------------------------
+//
+// DeviceProxy::read_polled_snapshot() - read the last polled value of the
+//                                    attributes polled since the seq call
+//
+//-----------------------------------------------------------------------------
+
+std::vector<DeviceAttribute> *DeviceProxy::read_polled_snapshot(DevULong64 &seq)
+{
+    DeviceData dout, din;
+    std::string cmd("PolledAttrSnapshot");
+
+    std::vector<std::string> args;
+    args.push_back(device_name);
+    if(seq != 0)
+    {
+        args.push_back(std::to_string(seq));
+    }
+    din << args;
+
+    auto &admin_device = get_admin_device();
+    //
+    // In case of connection failed error, do a re-try
+    //
+
+    try
+    {
+        dout = admin_device.command_inout(cmd, din);
+    }
+    catch(Tango::CommunicationFailed &)
+    {
+        dout = admin_device.command_inout(cmd, din);
+    }
+
+    const DevEncoded *snapshot;
+    dout >> snapshot;
+
+    if(::strcmp(snapshot->encoded_format.in(), POLLED_SNAPSHOT_FORMAT) != 0)
+    {
+        TangoSys_OMemStream o;
+        o << "Unexpected data format " << snapshot->encoded_format.in() << " returned by the " << cmd << " command";
+        TANGO_THROW_EXCEPTION(API_IncompatibleCmdArgumentType, o.str());
+    }
+
+    //
+    // Unmarshall the sequence number and the attribute values
+    //
+
+    cdrMemoryStream buf(const_cast<CORBA::Octet *>(snapshot->encoded_data.get_buffer()),
+                        snapshot->encoded_data.length());
+    CORBA::Boolean b = buf.unmarshalBoolean();
+    buf.setByteSwapFlag(b);
+
+    CORBA::ULongLong new_seq;
+    AttributeValueList_5 values;
+    new_seq <<= buf;
+    values <<= buf;
+
+    auto *dev_attr = new std::vector<DeviceAttribute>(values.length());
+    for(CORBA::ULong i = 0; i < values.length(); i++)
+    {
+        ApiUtil::attr_to_device(&(values[i]), 5, &(*dev_attr)[i]);
+    }
+
+    seq = new_seq;
+    return dev_attr;
+}
+
 //-----------------------------------------------------------------------------
 //
 // DeviceProxy::is_polled() - return true if the object "obj_name" is polled.
@@ -8624,6 +8746,68 @@ TimeVal DeviceProxy::get_last_event_date(int event_id)
     return es->get_last_event_date(event_id);
 }
 
+//+----------------------------------------------------------------------------
+//
+// method :       DeviceProxy::set_event_delta_encoding()
+//
+// description :  Enable/disable delta encoded change events for the next
+//                subscriptions done with this proxy
+//
+// argument : in : delta   : The flag
+//
+//-----------------------------------------------------------------------------
+void DeviceProxy::set_event_delta_encoding(bool delta)
+{
+    if(ext_proxy == nullptr)
+    {
+        ext_proxy = std::make_unique<DeviceProxyExt>();
+    }
+    ext_proxy->event_delta = delta;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method :       DeviceProxy::get_event_delta_encoding()
+//
+// description :  Returns true if delta encoded change events are enabled
+//
+//-----------------------------------------------------------------------------
+bool DeviceProxy::get_event_delta_encoding() const
+{
+    return ext_proxy != nullptr && ext_proxy->event_delta;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method :       DeviceProxy::set_shm_transport()
+//
+// description :  Enable/disable the shm transport for the next event
+//                subscriptions done with this proxy
+//
+// argument : in : shm   : The flag
+//
+//-----------------------------------------------------------------------------
+void DeviceProxy::set_shm_transport(bool shm)
+{
+    if(ext_proxy == nullptr)
+    {
+        ext_proxy = std::make_unique<DeviceProxyExt>();
+    }
+    ext_proxy->shm_transport = shm;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method :       DeviceProxy::get_shm_transport()
+//
+// description :  Returns true if the shm transport is enabled
+//
+//-----------------------------------------------------------------------------
+bool DeviceProxy::get_shm_transport() const
+{
+    return ext_proxy != nullptr && ext_proxy->shm_transport;
+}
+
 //-----------------------------------------------------------------------------
 //
 // DeviceProxy::get_device_db - get database
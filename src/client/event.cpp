@@ -38,10 +38,16 @@
 
 #include <tango/common/pointer_with_lock.h>
 
+#include <tango/internal/event_delta.h>
 #include <tango/internal/utils.h>
+#include <tango/internal/worker_pool.h>
 
+#include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #ifdef _TG_WINDOWS_
   #include <process.h>
@@ -393,6 +399,26 @@ void base_attr_to_device(const T *attr_value, Tango::DeviceAttribute *dev_attr)
         att_union_to_device(&attr_value->zvalue, dev_attr);
     }
 }
+
+//+-----------------------------------------------------------------------------------------------------------------
+//
+// function :
+//        append_error()
+//
+// description :
+//        Add one error at the end of an error stack
+//
+//------------------------------------------------------------------------------------------------------------------
+
+void append_error(Tango::DevErrorList &errors, const char *reason, const std::string &desc, const char *origin)
+{
+    CORBA::ULong nb = errors.length();
+    errors.length(nb + 1);
+    errors[nb].severity = Tango::ERR;
+    errors[nb].reason = Tango::string_dup(reason);
+    errors[nb].desc = Tango::string_dup(desc.c_str());
+    errors[nb].origin = Tango::string_dup(origin);
+}
 } // namespace
 
 namespace Tango
@@ -409,6 +435,10 @@ int EventConsumer::subscribe_event_id = 0;
 std::vector<std::string> EventConsumer::env_var_fqdn_prefix;
 std::map<std::string, std::string> EventConsumer::alias_map;
 
+omni_mutex EventConsumer::reconnection_stats_mutex;
+EventReconnectionStats EventConsumer::reconnection_stats;
+std::chrono::microseconds EventConsumer::reconnection_total_duration{0};
+
 KeepAliveThCmd EventConsumer::cmd;
 
 //+--------------------------------------------------------------------------------------------------------------------
@@ -658,6 +688,28 @@ void EventConsumer::shutdown_keep_alive_thread()
     }
 }
 
+//+----------------------------------------------------------------------------
+//
+// method :         EventConsumer::get_reconnection_stats()
+//
+// description :     Return the statistics of the event re-subscriptions
+//                  done by the KeepAliveThread
+//
+//-----------------------------------------------------------------------------
+
+EventReconnectionStats EventConsumer::get_reconnection_stats()
+{
+    omni_mutex_lock sync(reconnection_stats_mutex);
+
+    EventReconnectionStats stats = reconnection_stats;
+    if(stats.reconnections != 0)
+    {
+        stats.mean_duration = reconnection_total_duration / stats.reconnections;
+    }
+
+    return stats;
+}
+
 //+------------------------------------------------------------------------------------------------------------------
 //
 // method :
@@ -1133,6 +1185,67 @@ void EventConsumer::attr_to_device(const ZmqAttributeValue_5 *attr_value_5, Devi
     dev_attr->data_type = attr_value_5->data_type;
 }
 
+//+------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        EventConsumer::fwd_event_to_device()
+//
+// description :
+//        Unmarshal the attribute value received in an event from a forwarded attribute root attribute (not unmarshalled
+//        by the event consumer thread). The message is not modified: it is still forwarded after this call.
+//
+// argument :
+//        in :
+//            - event_data : The ZMQ message with the event data
+//            - endian : The sender byte order, as received in the event endian frame
+//        out :
+//            - dev_attr : The DeviceAttribute initialized with a copy of the attribute value
+//
+// return :
+//        True if the message has been correctly unmarshalled
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+bool EventConsumer::fwd_event_to_device(const zmq::message_t &event_data,
+                                        unsigned char endian,
+                                        DeviceAttribute &dev_attr)
+{
+    //
+    // The data are preceded by 4 extra bytes. Copy the data in a 8 bytes aligned buffer for 64 bits data
+    //
+
+    if(event_data.size() <= sizeof(CORBA::Long))
+    {
+        return false;
+    }
+
+    size_t data_size = event_data.size() - sizeof(CORBA::Long);
+    std::vector<CORBA::Double> buffer((data_size + sizeof(CORBA::Double) - 1) / sizeof(CORBA::Double));
+    ::memcpy(buffer.data(), static_cast<const char *>(event_data.data()) + sizeof(CORBA::Long), data_size);
+
+    try
+    {
+        TangoCdrMemoryStream event_data_cdr(buffer.data(), data_size);
+        event_data_cdr.setByteSwapFlag(endian != 0u);
+        event_data_cdr.set_un_marshal_type(TangoCdrMemoryStream::UN_ATT);
+
+        ZmqAttributeValue_5 zav5;
+        zav5.operator<<=(event_data_cdr);
+
+        DeviceAttribute tmp_attr;
+        base_attr_to_device(&zav5, &tmp_attr);
+        tmp_attr.data_type = zav5.data_type;
+
+        dev_attr.deep_copy(tmp_attr);
+    }
+    catch(...)
+    {
+        return false;
+    }
+
+    return true;
+}
+
 //+------------------------------------------------------------------------------------------------------------------
 //
 // method :
@@ -1388,6 +1501,601 @@ int EventConsumer::subscribe_event(DeviceProxy *device, EventType event, int eve
     return (subscribe_event(device, "dummy", event, nullptr, ev_queue, filters, stateless));
 }
 
+//+------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        EventConsumer::subscribe_event()
+//
+// description :
+//        Method to subscribe to the event described by a subscription request. Errors are not thrown but returned
+//        in the request
+//
+// argument :
+//        in/out :
+//            - request : The subscription request
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+void EventConsumer::subscribe_event(EventSubscriptionRequest &request)
+{
+    request.event_id = 0;
+    request.errors.length(0);
+
+    try
+    {
+        std::vector<std::string> filters;
+
+        if(request.event == INTERFACE_CHANGE_EVENT)
+        {
+            if(request.callback != nullptr)
+            {
+                request.event_id =
+                    subscribe_event(request.device, request.event, request.callback, request.stateless);
+            }
+            else
+            {
+                request.event_id =
+                    subscribe_event(request.device, request.event, request.event_queue_size, request.stateless);
+            }
+        }
+        else if(request.callback != nullptr)
+        {
+            request.event_id = subscribe_event(
+                request.device, request.attr_name, request.event, request.callback, filters, request.stateless);
+        }
+        else
+        {
+            request.event_id = subscribe_event(
+                request.device, request.attr_name, request.event, request.event_queue_size, filters, request.stateless);
+        }
+    }
+    catch(DevFailed &e)
+    {
+        request.errors = e.errors;
+    }
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        EventConsumer::subscribe_events()
+//
+// description :
+//        Method to subscribe to many events in one call. The requests are grouped per device server and the
+//        subscription of all the events of one device server is done with one ZmqEventBulkSubscribe command sent
+//        to its admin device. Commands to different device servers are sent in parallel. Attribute values for the
+//        synchronous events are then read with one read_attributes call per device. The writer lock is taken only
+//        once the commands and the reads are done, to connect the events and fire the synchronous events.
+//        Errors are not thrown but returned in each request
+//
+// argument :
+//        in/out :
+//            - requests : The subscription requests
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+void EventConsumer::subscribe_events(std::vector<EventSubscriptionRequest> &requests)
+{
+    //
+    // Subscription from within an event callback and notifd event system are done one event at a time
+    //
+
+    bool one_by_one = false;
+    if(thread_id != 0)
+    {
+        omni_thread::ensure_self se;
+        if(omni_thread::self()->id() == thread_id)
+        {
+            one_by_one = true;
+        }
+    }
+
+    std::string cmd_name;
+    get_subscription_command_name(cmd_name);
+    if(cmd_name.find("Zmq") == std::string::npos)
+    {
+        one_by_one = true;
+    }
+
+    if(one_by_one)
+    {
+        for(auto &req : requests)
+        {
+            subscribe_event(req);
+        }
+        return;
+    }
+
+    //
+    // Check requests and build the list of devices
+    //
+
+    struct DeviceInfo
+    {
+        DeviceProxy *device;
+        std::string device_name;
+        std::string dev_name;
+        std::string adm_name;
+        std::shared_ptr<DeviceProxy> adm_dev;
+        bool known{false};
+        DevErrorList errors;
+        size_t group{0};
+    };
+
+    struct ServerGroup
+    {
+        std::string adm_name;
+        std::shared_ptr<DeviceProxy> adm_dev;
+        std::vector<size_t> requests;
+        bool bulk_cmd_supported{true};
+        DevErrorList errors;
+    };
+
+    size_t nb_req = requests.size();
+    std::vector<BulkSubscriptionData> bulk(nb_req);
+    std::vector<std::string> obj_names(nb_req);
+    std::vector<std::string> event_names(nb_req);
+    std::vector<size_t> req_device(nb_req);
+    std::vector<bool> valid(nb_req, true);
+
+    std::vector<DeviceInfo> devices;
+    std::map<DeviceProxy *, size_t> device_idx;
+
+    for(size_t loop = 0; loop < nb_req; ++loop)
+    {
+        EventSubscriptionRequest &req = requests[loop];
+        req.event_id = 0;
+        req.errors.length(0);
+
+        if(req.device == nullptr)
+        {
+            append_error(req.errors,
+                         API_InvalidArgs,
+                         "DeviceProxy* must be a valid and non-null pointer.",
+                         "EventConsumer::subscribe_events()");
+            valid[loop] = false;
+            continue;
+        }
+        else if(req.callback == nullptr && req.event_queue_size < 0)
+        {
+            append_error(
+                req.errors, API_InvalidArgs, "Event queue size must be positive", "EventConsumer::subscribe_events()");
+            valid[loop] = false;
+            continue;
+        }
+
+        obj_names[loop] = req.event == INTERFACE_CHANGE_EVENT ? std::string("dummy") : req.attr_name;
+        event_names[loop] = EventName[req.event];
+
+        auto ite = device_idx.find(req.device);
+        if(ite == device_idx.end())
+        {
+            DeviceInfo dev_info;
+            dev_info.device = req.device;
+            dev_info.device_name = detail::build_device_trl(req.device, env_var_fqdn_prefix);
+            dev_info.dev_name = req.device->dev_name();
+            ite = device_idx.emplace(req.device, devices.size()).first;
+            devices.push_back(std::move(dev_info));
+        }
+        req_device[loop] = ite->second;
+    }
+
+    //
+    // Get admin device for devices already connected to the event system
+    //
+
+    {
+        ReaderLock r(map_modification_lock);
+        for(auto &dev_info : devices)
+        {
+            auto ipos = device_channel_map.find(dev_info.device_name);
+            if(ipos != device_channel_map.end())
+            {
+                auto evt_it = channel_map.find(ipos->second);
+                if(evt_it != channel_map.end())
+                {
+                    AutoTangoMonitor _mon(evt_it->second.channel_monitor);
+                    dev_info.adm_dev = evt_it->second.adm_device_proxy;
+                    dev_info.adm_name = evt_it->second.full_adm_name;
+                    dev_info.known = dev_info.adm_dev != nullptr;
+                }
+            }
+        }
+    }
+
+    //
+    // Get admin device name for the other devices (in parallel)
+    //
+
+    auto get_adm_name = [&devices](size_t idx)
+    {
+        DeviceInfo &dev_info = devices[idx];
+        if(dev_info.known)
+        {
+            return;
+        }
+
+        try
+        {
+            dev_info.adm_name = dev_info.device->adm_name();
+        }
+        catch(...)
+        {
+            std::string desc = "Can't subscribe to event for device " + dev_info.device_name +
+                               "\nCheck that device server is running...";
+            append_error(dev_info.errors, API_CantConnectToDevice, desc, "EventConsumer::subscribe_events()");
+        }
+    };
+
+    detail::for_each_in_parallel(devices.size(), EVENT_SUBSCRIBE_MAX_THREADS, get_adm_name);
+
+    //
+    // Group requests per device server
+    //
+
+    std::vector<ServerGroup> groups;
+    std::map<std::string, size_t> group_idx;
+
+    for(auto &dev_info : devices)
+    {
+        if(dev_info.errors.length() != 0)
+        {
+            continue;
+        }
+
+        std::string key = detail::to_lower(dev_info.adm_name);
+        auto ite = group_idx.find(key);
+        if(ite == group_idx.end())
+        {
+            ServerGroup grp;
+            grp.adm_name = dev_info.adm_name;
+            ite = group_idx.emplace(key, groups.size()).first;
+            groups.push_back(std::move(grp));
+        }
+
+        dev_info.group = ite->second;
+        if(dev_info.known && groups[dev_info.group].adm_dev == nullptr)
+        {
+            groups[dev_info.group].adm_dev = dev_info.adm_dev;
+        }
+    }
+
+    for(size_t loop = 0; loop < nb_req; ++loop)
+    {
+        if(!valid[loop])
+        {
+            continue;
+        }
+
+        DeviceInfo &dev_info = devices[req_device[loop]];
+        if(dev_info.errors.length() != 0)
+        {
+            requests[loop].errors = dev_info.errors;
+        }
+        else
+        {
+            groups[dev_info.group].requests.push_back(loop);
+        }
+    }
+
+    //
+    // Send one ZmqEventBulkSubscribe command per device server (in parallel)
+    //
+
+    auto subscribe_server = [&groups, &devices, &requests, &req_device, &obj_names, &event_names, &bulk](size_t idx)
+    {
+        ServerGroup &grp = groups[idx];
+
+        try
+        {
+            if(grp.adm_dev == nullptr)
+            {
+                grp.adm_dev = std::make_shared<DeviceProxy>(grp.adm_name);
+            }
+        }
+        catch(...)
+        {
+            std::string desc = "Can't subscribe to event for device server " + grp.adm_name +
+                               "\nCheck that device server is running...";
+            append_error(grp.errors, API_CantConnectToDevice, desc, "EventConsumer::subscribe_events()");
+            return;
+        }
+
+        std::vector<std::string> cmd_args;
+        cmd_args.reserve(1 + (grp.requests.size() * 3));
+        cmd_args.push_back(std::to_string(DevVersion));
+        for(auto req_idx : grp.requests)
+        {
+            cmd_args.push_back(devices[req_device[req_idx]].dev_name);
+            cmd_args.push_back(detail::to_lower(obj_names[req_idx]));
+            cmd_args.push_back(event_names[req_idx]);
+        }
+
+        try
+        {
+            DeviceData din;
+            din << cmd_args;
+            DeviceData dout = grp.adm_dev->command_inout("ZmqEventBulkSubscribe", din);
+
+            const DevVarLongStringArray *res;
+            dout >> res;
+
+            size_t nb_event = grp.requests.size();
+            size_t lg_idx = nb_event << 1;
+            size_t str_idx = 0;
+            if(res->lvalue.length() < lg_idx)
+            {
+                TANGO_THROW_DETAILED_EXCEPTION(EventSystemExcept,
+                                               API_InvalidArgs,
+                                               "Received too little data from the ZmqEventBulkSubscribe command");
+            }
+
+            for(size_t loop = 0; loop < nb_event; ++loop)
+            {
+                size_t req_idx = grp.requests[loop];
+                size_t nb_lg = res->lvalue[loop << 1];
+                size_t nb_str = res->lvalue[(loop << 1) + 1];
+
+                if(lg_idx + nb_lg > res->lvalue.length() || str_idx + nb_str > res->svalue.length())
+                {
+                    TANGO_THROW_DETAILED_EXCEPTION(EventSystemExcept,
+                                                   API_InvalidArgs,
+                                                   "Received too little data from the ZmqEventBulkSubscribe command");
+                }
+
+                if(nb_lg == 0)
+                {
+                    std::string desc = nb_str != 0 ? std::string(res->svalue[str_idx].in()) : std::string();
+                    append_error(requests[req_idx].errors,
+                                 API_DSFailedRegisteringEvent,
+                                 "Device server send exception while trying to register event: " + desc,
+                                 "EventConsumer::subscribe_events()");
+                }
+                else
+                {
+                    auto *sub_data = new DevVarLongStringArray();
+                    sub_data->lvalue.length(nb_lg);
+                    for(size_t i = 0; i < nb_lg; ++i)
+                    {
+                        sub_data->lvalue[i] = res->lvalue[lg_idx + i];
+                    }
+                    sub_data->svalue.length(nb_str);
+                    for(size_t i = 0; i < nb_str; ++i)
+                    {
+                        sub_data->svalue[i] = Tango::string_dup(res->svalue[str_idx + i].in());
+                    }
+                    bulk[req_idx].dd << sub_data;
+                    bulk[req_idx].adm_dev = grp.adm_dev;
+                    bulk[req_idx].adm_name = grp.adm_name;
+                }
+
+                lg_idx += nb_lg;
+                str_idx += nb_str;
+            }
+        }
+        catch(DevFailed &e)
+        {
+            std::string reason(e.errors[0].reason.in());
+            if(reason == API_CommandNotFound)
+            {
+                grp.bulk_cmd_supported = false;
+            }
+            else
+            {
+                grp.errors = e.errors;
+                append_error(grp.errors,
+                             API_DSFailedRegisteringEvent,
+                             "Device server send exception while trying to register event",
+                             "EventConsumer::subscribe_events()");
+            }
+        }
+    };
+
+    detail::for_each_in_parallel(groups.size(), EVENT_SUBSCRIBE_MAX_THREADS, subscribe_server);
+
+    //
+    // Device servers too old for the bulk command: subscribe one event at a time
+    //
+
+    for(auto &grp : groups)
+    {
+        if(!grp.bulk_cmd_supported)
+        {
+            for(auto req_idx : grp.requests)
+            {
+                subscribe_event(requests[req_idx]);
+                valid[req_idx] = false;
+            }
+        }
+        else if(grp.errors.length() != 0)
+        {
+            for(auto req_idx : grp.requests)
+            {
+                requests[req_idx].errors = grp.errors;
+            }
+        }
+    }
+
+    //
+    // Read the attribute values for the synchronous events, one read_attributes call per device (in parallel).
+    // This is done before taking the locks below, which block the event reception and the other subscriptions. The
+    // values read for the root attributes of forwarded attributes are not used (they are read again when their
+    // synchronous event is fired)
+    //
+
+    std::vector<std::vector<size_t>> dev_reads(devices.size());
+    for(size_t loop = 0; loop < nb_req; ++loop)
+    {
+        EventType event = requests[loop].event;
+        if(valid[loop] && requests[loop].errors.length() == 0 &&
+           (event == CHANGE_EVENT || event == ALARM_EVENT || event == ARCHIVE_EVENT || event == USER_EVENT ||
+            event == PERIODIC_EVENT))
+        {
+            dev_reads[req_device[loop]].push_back(loop);
+        }
+    }
+
+    auto read_device = [&devices, &dev_reads, &obj_names, &bulk](size_t idx)
+    {
+        std::vector<size_t> &reads = dev_reads[idx];
+        if(reads.empty())
+        {
+            return;
+        }
+
+        std::vector<std::string> att_names;
+        std::vector<size_t> att_pos;
+        std::map<std::string, size_t> name_idx;
+        for(auto req_idx : reads)
+        {
+            std::string lower_name = detail::to_lower(obj_names[req_idx]);
+            auto ite = name_idx.find(lower_name);
+            if(ite == name_idx.end())
+            {
+                ite = name_idx.emplace(lower_name, att_names.size()).first;
+                att_names.push_back(obj_names[req_idx]);
+            }
+            att_pos.push_back(ite->second);
+        }
+
+        try
+        {
+            std::unique_ptr<std::vector<DeviceAttribute>> values(devices[idx].device->read_attributes(att_names));
+            for(size_t loop = 0; loop < reads.size(); ++loop)
+            {
+                auto da = std::make_unique<DeviceAttribute>();
+                da->deep_copy((*values)[att_pos[loop]]);
+                bulk[reads[loop]].initial_value = std::move(da);
+            }
+        }
+        catch(...)
+        {
+            //
+            // Attributes will be read one by one while firing the synchronous events
+            //
+        }
+    };
+
+    detail::for_each_in_parallel(devices.size(), EVENT_SUBSCRIBE_MAX_THREADS, read_device);
+
+    //
+    // Connect the events. As in subscribe_event(), take the writer lock and ask the main ZMQ thread to delay
+    // incoming events until the synchronous events are fired
+    //
+
+    DelayEvent de(this);
+    WriterLock w(map_modification_lock);
+
+    std::vector<EventQueue *> ev_queues(nb_req, nullptr);
+    std::vector<size_t> connected;
+    std::vector<std::string> filters;
+
+    for(size_t loop = 0; loop < nb_req; ++loop)
+    {
+        if(!valid[loop])
+        {
+            continue;
+        }
+
+        EventSubscriptionRequest &req = requests[loop];
+        if(req.callback == nullptr)
+        {
+            ev_queues[loop] = new EventQueue(req.event_queue_size);
+        }
+
+        int event_id = get_new_event_id();
+
+        try
+        {
+            if(req.errors.length() != 0)
+            {
+                throw DevFailed(req.errors);
+            }
+
+            connect_event(req.device,
+                          obj_names[loop],
+                          req.event,
+                          req.callback,
+                          ev_queues[loop],
+                          filters,
+                          event_names[loop],
+                          event_id,
+                          &bulk[loop]);
+
+            req.event_id = event_id;
+            connected.push_back(loop);
+        }
+        catch(DevFailed &e)
+        {
+            if(!req.stateless)
+            {
+                req.errors = e.errors;
+                delete ev_queues[loop];
+                ev_queues[loop] = nullptr;
+                continue;
+            }
+
+            //
+            // Stateless subscription: store the connection data in the vector of not yet connected events
+            //
+
+            EventNotConnected conn_params;
+            conn_params.device = req.device;
+            conn_params.attribute = obj_names[loop];
+            conn_params.event_type = req.event;
+            conn_params.event_name = EventName[req.event];
+            conn_params.callback = req.callback;
+            conn_params.ev_queue = ev_queues[loop];
+            conn_params.filters = filters;
+            conn_params.last_heartbeat = Tango::get_current_system_datetime();
+            conn_params.event_id = event_id;
+
+            add_not_connected_event(e, conn_params);
+
+            req.event_id = event_id;
+            req.errors.length(0);
+        }
+    }
+
+    if(connected.empty())
+    {
+        return;
+    }
+
+    //
+    // Give ZMQ some time to propagate the subscriptions to the publishers (once for all the events)
+    //
+
+#ifndef _TG_WINDOWS_
+    std::this_thread::sleep_for(std::chrono::nanoseconds(1000000));
+#else
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+#endif
+
+    //
+    // Fire the synchronous events
+    //
+
+    for(auto req_idx : connected)
+    {
+        EventSubscriptionRequest &req = requests[req_idx];
+        BulkSubscriptionData &bulk_data = bulk[req_idx];
+
+        device_name = bulk_data.device_name;
+        obj_name_lower = bulk_data.obj_name_lower;
+
+        get_fire_sync_event(req.device,
+                            req.callback,
+                            ev_queues[req_idx],
+                            req.event,
+                            event_names[req_idx],
+                            obj_names[req_idx],
+                            *bulk_data.callback_struct,
+                            bulk_data.callback_key,
+                            &bulk_data);
+    }
+}
+
 //+-------------------------------------------------------------------------------------------------------------------
 //
 // method :
@@ -1406,6 +2114,8 @@ int EventConsumer::subscribe_event(DeviceProxy *device, EventType event, int eve
 //            - filters : Eventual event filter strings
 //            - event_name : The event name
 //          - event_id  : the unique event ID
+//            - bulk : Data for an event subscribed with subscribe_events() (nullptr otherwise). In this case, the
+//                     admin device command has already been executed and the synchronous event is not fired
 //
 //--------------------------------------------------------------------------------------------------------------------
 
@@ -1416,7 +2126,8 @@ void EventConsumer::connect_event(DeviceProxy *device,
                                   EventQueue *ev_queue,
                                   const std::vector<std::string> &filters,
                                   std::string &event_name,
-                                  int event_id)
+                                  int event_id,
+                                  BulkSubscriptionData *bulk)
 {
     TANGO_LOG_DEBUG << "Tango::EventConsumer::connect_event(" << device_name << "," << obj_name << "," << event
                     << ")\n";
@@ -1452,7 +2163,12 @@ void EventConsumer::connect_event(DeviceProxy *device,
 
     std::string adm_name;
 
-    if(ipos == device_channel_map.end())
+    if(ipos == device_channel_map.end() && bulk != nullptr)
+    {
+        adm_name = bulk->adm_name;
+        adm_dev = bulk->adm_dev;
+    }
+    else if(ipos == device_channel_map.end())
     {
         try
         {
@@ -1487,7 +2203,15 @@ void EventConsumer::connect_event(DeviceProxy *device,
 
     Tango::DeviceData dd;
     bool zmq_used;
-    get_subscription_info(adm_dev, device, obj_name_lower, event_name, dd, zmq_used);
+    if(bulk != nullptr)
+    {
+        dd = bulk->dd;
+        zmq_used = true;
+    }
+    else
+    {
+        get_subscription_info(adm_dev, device, obj_name_lower, event_name, dd, zmq_used);
+    }
 
     const DevVarLongStringArray *dvlsa;
     int idl_version = detail::INVALID_IDL_VERSION;
@@ -1540,6 +2264,14 @@ void EventConsumer::connect_event(DeviceProxy *device,
     if(iter != event_callback_map.end())
     {
         add_new_callback(device, iter, callback, ev_queue, event_id);
+        if(bulk != nullptr)
+        {
+            bulk->callback_struct = &iter->second;
+            bulk->callback_key = received_from_admin.event_name;
+            bulk->device_name = device_name;
+            bulk->obj_name_lower = obj_name_lower;
+            return;
+        }
         get_fire_sync_event(
             device, callback, ev_queue, event, event_name, obj_name, iter->second, received_from_admin.event_name);
         return;
@@ -1613,12 +2345,34 @@ void EventConsumer::connect_event(DeviceProxy *device,
         new_event_callback.fully_qualified_event_name = device_name + '/' + obj_name_lower + '.' + event_name;
     }
 
+    //
+    // The server may grant a delta encoded change event (see DeviceProxy::set_event_delta_encoding())
+    //
+
+    if(detail::is_delta_event_name(received_from_admin.event_name))
+    {
+        new_event_callback.fully_qualified_event_name =
+            device_name + '/' + obj_name_lower + '.' + detail::add_delta_prefix(event_name);
+        new_event_callback.delta_decoder = std::make_shared<detail::EventDeltaDecoder>();
+    }
+
+    //
+    // Same for the shm transport (see DeviceProxy::set_shm_transport())
+    //
+
+    if(detail::is_shm_event_name(received_from_admin.event_name))
+    {
+        new_event_callback.fully_qualified_event_name =
+            device_name + '/' + obj_name_lower + '.' + detail::add_shm_prefix(event_name);
+        new_event_callback.shm = true;
+    }
+
     new_event_callback.device_idl = idl_version;
     new_event_callback.ctr = 0;
     new_event_callback.discarded_event = false;
     if(zmq_used)
     {
-        new_event_callback.endpoint = dvlsa->svalue[(valid_endpoint_nb << 1) + 1].in();
+        new_event_callback.endpoint = ZmqEventConsumer::get_connect_endpoint(dvlsa, (valid_endpoint_nb << 1) + 1);
     }
 
     connect_event_system(
@@ -1695,6 +2449,15 @@ void EventConsumer::connect_event(DeviceProxy *device,
     }
     iter = ret.first;
 
+    if(bulk != nullptr)
+    {
+        bulk->callback_struct = &iter->second;
+        bulk->callback_key = local_callback_key;
+        bulk->device_name = device_name;
+        bulk->obj_name_lower = obj_name_lower;
+        return;
+    }
+
     //
     // Read the attribute/pipe by a simple synchronous call.This is necessary for the first point in "change" mode
     // Force callback execution when it is done
@@ -2991,6 +3754,8 @@ void EventConsumer::add_new_callback(
 //            - obj_name : The attribute/pipe name
 //            - cb :
 //            - callback_key :
+//            - bulk : Data for an event subscribed with subscribe_events() (nullptr otherwise). It may contain the
+//                     attribute value already read
 //
 //-------------------------------------------------------------------------------------------------------------------
 
@@ -3001,18 +3766,23 @@ void EventConsumer::get_fire_sync_event(DeviceProxy *device,
                                         std::string &event_name,
                                         const std::string &obj_name,
                                         EventCallBackStruct &cb,
-                                        std::string &callback_key)
+                                        std::string &callback_key,
+                                        BulkSubscriptionData *bulk)
 {
     //
     // A small mS sleep here! This is required in case there is a push_event in the read_attribute (or pipe)
-    // method on the device side. This sleep gives time to ZMQ to send its subscription message
+    // method on the device side. This sleep gives time to ZMQ to send its subscription message.
+    // For bulk subscription, the sleep is done once for all the events
     //
 
+    if(bulk == nullptr)
+    {
 #ifndef _TG_WINDOWS_
-    std::this_thread::sleep_for(std::chrono::nanoseconds(500000));
+        std::this_thread::sleep_for(std::chrono::nanoseconds(500000));
 #else
-    std::this_thread::sleep_for(std::chrono::milliseconds(25));
+        std::this_thread::sleep_for(std::chrono::milliseconds(25));
 #endif
+    }
 
     if((event == CHANGE_EVENT) || (event == ALARM_EVENT) || (event == ARCHIVE_EVENT) || (event == USER_EVENT) ||
        (event == PERIODIC_EVENT))
@@ -3051,8 +3821,15 @@ void EventConsumer::get_fire_sync_event(DeviceProxy *device,
             }
             else
             {
-                da = new DeviceAttribute();
-                *da = device->read_attribute(obj_name.c_str());
+                if(bulk != nullptr && bulk->initial_value != nullptr)
+                {
+                    da = bulk->initial_value.release();
+                }
+                else
+                {
+                    da = new DeviceAttribute();
+                    *da = device->read_attribute(obj_name.c_str());
+                }
                 if(da->has_failed())
                 {
                     err = da->get_err_stack();
@@ -3304,6 +4081,25 @@ void EventConsumer::get_subscription_info(const std::shared_ptr<Tango::DevicePro
             zmq_used = true;
             std::stringstream ss;
             ss << DevVersion;
+
+            //
+            // Ask for delta encoded change event. Servers not supporting it ignore the release suffix
+            //
+
+            bool delta = device->get_event_delta_encoding() && event_name == EventName[CHANGE_EVENT];
+            if(delta)
+            {
+                ss << EVENT_DELTA_OPTION;
+            }
+
+            //
+            // Ask for the shm transport if the ring of the device server can be mapped (same host and user)
+            //
+
+            else if(device->get_shm_transport() && query_shm_ring(*adm_dev))
+            {
+                ss << EVENT_SHM_OPTION;
+            }
             subscriber_info.push_back(ss.str());
         }
 
@@ -40,7 +40,9 @@
 #include <tango/common/pointer_with_lock.h>
 
 #include <tango/internal/utils.h>
+#include <tango/internal/worker_pool.h>
 
+#include <algorithm>
 #include <cstdio>
 
 #ifdef _TG_WINDOWS_
@@ -54,6 +56,32 @@ using namespace CORBA;
 namespace Tango
 {
 
+namespace
+{
+
+// The event name sent to the server when subscribing again, with the delta prefix for a delta encoded change event
+// or the shm prefix for an event received through the shm transport
+std::string get_subscription_event_name(const EventCallBackStruct &evt_cb)
+{
+    if(evt_cb.delta_decoder != nullptr)
+    {
+        return detail::add_delta_prefix(evt_cb.event_name);
+    }
+
+    return evt_cb.shm ? detail::add_shm_prefix(evt_cb.event_name) : evt_cb.event_name;
+}
+
+// True if one of the events received from the channel goes through the shm transport
+bool is_shm_channel(const std::map<std::string, EventCallBackStruct> &callbacks, const std::string &channel_name)
+{
+    return std::any_of(callbacks.begin(),
+                       callbacks.end(),
+                       [&channel_name](const auto &elem)
+                       { return elem.second.shm && elem.second.channel_name == channel_name; });
+}
+
+} // anonymous namespace
+
 /************************************************************************/
 /*                                                                           */
 /*             EventConsumerKeepAlive class                                 */
@@ -188,12 +216,21 @@ bool EventConsumerKeepAliveThread::reconnect_to_zmq_channel(const EvChanIte &ipo
 
                     ipos->second.adm_device_proxy = std::make_shared<DeviceProxy>(new_adm_name);
 
+                    //
+                    // The restarted device server has a new ring for its shm transport
+                    //
+
+                    if(is_shm_channel(event_consumer->event_callback_map, ipos->first))
+                    {
+                        event_consumer->query_shm_ring(*ipos->second.adm_device_proxy);
+                    }
+
                     DeviceData subscriber_in, subscriber_out;
                     std::vector<std::string> subscriber_info;
                     subscriber_info.push_back(epos->second.get_device_proxy().dev_name());
                     subscriber_info.push_back(epos->second.obj_name);
                     subscriber_info.emplace_back("subscribe");
-                    subscriber_info.push_back(epos->second.event_name);
+                    subscriber_info.push_back(get_subscription_event_name(epos->second));
                     subscriber_info.emplace_back("0");
 
                     subscriber_in << subscriber_info;
@@ -502,7 +539,8 @@ void EventConsumerKeepAliveThread::reconnect_to_zmq_event(const EvChanIte &ipos,
 
                         const DevVarLongStringArray *dvlsa;
                         dd >> dvlsa;
-                        epos->second.endpoint = dvlsa->svalue[(ipos->second.valid_endpoint << 1) + 1].in();
+                        epos->second.endpoint = ZmqEventConsumer::get_connect_endpoint(
+                            dvlsa, (ipos->second.valid_endpoint << 1) + 1);
 
                         TANGO_LOG_DEBUG << "Reconnected to ZMQ event" << std::endl;
                     }
@@ -610,6 +648,7 @@ void *EventConsumerKeepAliveThread::run_undetached(TANGO_UNUSED(void *arg))
 
             EvChanIte ipos;
             EvCbIte epos;
+            std::vector<ChannelResubscription> resubscriptions;
 
             renamed_channels.reserve(event_consumer->channel_map.size());
 
@@ -645,7 +684,7 @@ void *EventConsumerKeepAliveThread::run_undetached(TANGO_UNUSED(void *arg))
                     if(heartbeat_skipped || ipos->second.heartbeat_skipped || ipos->second.event_system_failed)
                     {
                         ipos->second.heartbeat_skipped = true;
-                        main_reconnect(event_consumer, notifd_event_consumer, epos, ipos);
+                        main_reconnect(event_consumer, notifd_event_consumer, epos, ipos, resubscriptions);
                         if(ipos->first != ipos->second.full_adm_name)
                         {
                             // Channel name has changed after reconnection.
@@ -675,6 +714,15 @@ void *EventConsumerKeepAliveThread::run_undetached(TANGO_UNUSED(void *arg))
                     au->print_error_message(ss.str().c_str());
                 }
             }
+
+            //
+            // Re-subscribe the events of all the channels just reconnected
+            //
+
+            if(!resubscriptions.empty())
+            {
+                bulk_re_subscribe(event_consumer, notifd_event_consumer, resubscriptions);
+            }
         }
 
         {
@@ -937,7 +985,7 @@ void EventConsumerKeepAliveThread::confirm_subscription(PointerWithLock<EventCon
                 {
                     cmd_params.push_back(epos->second.get_device_proxy().dev_name());
                     cmd_params.push_back(epos->second.obj_name);
-                    cmd_params.push_back(epos->second.event_name);
+                    cmd_params.push_back(get_subscription_event_name(epos->second));
 
                     vd.push_back(distance(event_consumer->event_callback_map.begin(), epos));
                 }
@@ -1050,14 +1098,20 @@ void EventConsumerKeepAliveThread::confirm_subscription(PointerWithLock<EventCon
 //            - notifd_event_consumer : The notifd event consumer object
 //            - epos : Iterator on the EventCallback map
 //            - ipos : Iterator on the EventChannel map
+//        out :
+//            - resubscriptions : The ZMQ channels with events to be re-subscribed (by bulk_re_subscribe())
 //
 //--------------------------------------------------------------------------------------------------------------------
 
 void EventConsumerKeepAliveThread::main_reconnect(PointerWithLock<EventConsumer> &event_consumer,
                                                   PointerWithLock<EventConsumer> &notifd_event_consumer,
                                                   std::map<std::string, EventCallBackStruct>::iterator &epos,
-                                                  const std::map<std::string, EventChannelStruct>::iterator &ipos)
+                                                  const std::map<std::string, EventChannelStruct>::iterator &ipos,
+                                                  std::vector<ChannelResubscription> &resubscriptions)
 {
+    const auto start = std::chrono::steady_clock::now();
+    ChannelResubscription *resub = nullptr;
+
     //
     // First, try to reconnect
     //
@@ -1281,7 +1335,30 @@ void EventConsumerKeepAliveThread::main_reconnect(PointerWithLock<EventConsumer>
 
                 if(!ipos->second.event_system_failed)
                 {
-                    re_subscribe_after_reconnect(event_consumer, notifd_event_consumer, epos, ipos, domain_name);
+                    if(ipos->second.channel_type == ZMQ)
+                    {
+                        //
+                        // ZMQ events are re-subscribed later, all at once for this channel
+                        //
+
+                        if(resub == nullptr)
+                        {
+                            resub = &resubscriptions.emplace_back();
+                            resub->channel = ipos;
+                            resub->adm_device_proxy = ipos->second.adm_device_proxy;
+                            resub->start = start;
+                        }
+
+                        resub->events.push_back(epos);
+                        resub->domain_names.push_back(domain_name);
+                        resub->cmd_params.push_back(epos->second.get_device_proxy().dev_name());
+                        resub->cmd_params.push_back(epos->second.obj_name);
+                        resub->cmd_params.push_back(get_subscription_event_name(epos->second));
+                    }
+                    else
+                    {
+                        re_subscribe_after_reconnect(event_consumer, notifd_event_consumer, epos, ipos, domain_name);
+                    }
                 }
                 // release callback monitor
                 epos->second.callback_monitor->rel_monitor();
@@ -1313,6 +1390,7 @@ void EventConsumerKeepAliveThread::main_reconnect(PointerWithLock<EventConsumer>
 //            - epos : Iterator on the EventCallback map
 //            - ipos : Iterator on the EventChannel map
 //            - domain_name :
+//            - already_subscribed : Set to true if the event has already been re-subscribed by the bulk command
 //
 //--------------------------------------------------------------------------------------------------------------------
 
@@ -1321,40 +1399,50 @@ void EventConsumerKeepAliveThread::re_subscribe_after_reconnect(
     PointerWithLock<EventConsumer> &notifd_event_consumer,
     const std::map<std::string, EventCallBackStruct>::iterator &epos,
     const std::map<std::string, EventChannelStruct>::iterator &ipos,
-    const std::string &domain_name)
+    const std::string &domain_name,
+    bool already_subscribed)
 {
-    DeviceData subscriber_in;
-    std::vector<std::string> subscriber_info;
     auto &device = epos->second.get_device_proxy();
-    subscriber_info.push_back(device.dev_name());
-    subscriber_info.push_back(epos->second.obj_name);
-    subscriber_info.emplace_back("subscribe");
-    subscriber_info.push_back(epos->second.event_name);
-    if(ipos->second.channel_type == ZMQ)
-    {
-        subscriber_info.emplace_back("0");
-    }
-    subscriber_in << subscriber_info;
 
     bool ds_failed = false;
 
-    try
+    if(already_subscribed)
     {
+        ipos->second.heartbeat_skipped = false;
+        ipos->second.last_subscribed = Tango::get_current_system_datetime();
+    }
+    else
+    {
+        DeviceData subscriber_in;
+        std::vector<std::string> subscriber_info;
+        subscriber_info.push_back(device.dev_name());
+        subscriber_info.push_back(epos->second.obj_name);
+        subscriber_info.emplace_back("subscribe");
+        subscriber_info.push_back(get_subscription_event_name(epos->second));
         if(ipos->second.channel_type == ZMQ)
         {
-            ipos->second.adm_device_proxy->command_inout("ZmqEventSubscriptionChange", subscriber_in);
+            subscriber_info.emplace_back("0");
         }
-        else
+        subscriber_in << subscriber_info;
+
+        try
         {
-            ipos->second.adm_device_proxy->command_inout("EventSubscriptionChange", subscriber_in);
-        }
+            if(ipos->second.channel_type == ZMQ)
+            {
+                ipos->second.adm_device_proxy->command_inout("ZmqEventSubscriptionChange", subscriber_in);
+            }
+            else
+            {
+                ipos->second.adm_device_proxy->command_inout("EventSubscriptionChange", subscriber_in);
+            }
 
-        ipos->second.heartbeat_skipped = false;
-        ipos->second.last_subscribed = Tango::get_current_system_datetime();
-    }
-    catch(...)
-    {
-        ds_failed = true;
+            ipos->second.heartbeat_skipped = false;
+            ipos->second.last_subscribed = Tango::get_current_system_datetime();
+        }
+        catch(...)
+        {
+            ds_failed = true;
+        }
     }
 
     if(!ds_failed)
@@ -1663,6 +1751,183 @@ void EventConsumerKeepAliveThread::re_subscribe_after_reconnect(
     }
 }
 
+//---------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        EventConsumerKeepAliveThread::send_bulk_subscription
+//
+// description :
+//        Re-subscribe all the events of one reconnected channel with one ZmqEventBulkSubscribe command sent to the
+//        device server admin device. Executed by several threads at the same time (one channel per thread).
+//        It only uses data stored in the ChannelResubscription structure.
+//
+// argument :
+//        in/out :
+//            - resub : The channel re-subscription data
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+void EventConsumerKeepAliveThread::send_bulk_subscription(ChannelResubscription &resub)
+{
+    resub.subscribed.assign(resub.events.size(), false);
+
+    try
+    {
+        DeviceData sub_cmd_in, sub_cmd_out;
+        sub_cmd_in << resub.cmd_params;
+
+        sub_cmd_out = resub.adm_device_proxy->command_inout("ZmqEventBulkSubscribe", sub_cmd_in);
+
+        const DevVarLongStringArray *result;
+        sub_cmd_out >> result;
+
+        //
+        // No long data returned for an event which has not been subscribed
+        //
+
+        for(size_t loop = 0; loop < resub.events.size() && (loop << 1) < result->lvalue.length(); ++loop)
+        {
+            resub.subscribed[loop] = (result->lvalue[loop << 1] != 0);
+        }
+    }
+    catch(Tango::DevFailed &e)
+    {
+        std::string reason(e.errors[0].reason.in());
+        if(reason == API_CommandNotFound)
+        {
+            //
+            // Server running a Tango release without the ZmqEventBulkSubscribe command.
+            // Events will be re-subscribed one by one
+            //
+
+            resub.bulk_cmd_supported = false;
+        }
+        else
+        {
+            resub.failed = true;
+        }
+    }
+    catch(...)
+    {
+        resub.failed = true;
+    }
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        EventConsumerKeepAliveThread::bulk_re_subscribe
+//
+// description :
+//        Re-subscribe the events of all the ZMQ channels reconnected during this keep alive thread loop.
+//        The re-subscription commands are sent in parallel to the different device servers (one command per
+//        server). Then, for each event, the callbacks are fired with the value read from the re-connected server.
+//
+// argument :
+//        in :
+//            - event_consumer : The ZMQ event consumer object
+//            - notifd_event_consumer : The notifd event consumer object
+//            - resubscriptions : The reconnected channels with their events
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+void EventConsumerKeepAliveThread::bulk_re_subscribe(PointerWithLock<EventConsumer> &event_consumer,
+                                                     PointerWithLock<EventConsumer> &notifd_event_consumer,
+                                                     std::vector<ChannelResubscription> &resubscriptions)
+{
+    //
+    // Send the commands, in parallel to the different device servers (up to EVENT_RESUBSCRIBE_MAX_THREADS)
+    //
+
+    detail::for_each_in_parallel(resubscriptions.size(),
+                                 EVENT_RESUBSCRIBE_MAX_THREADS,
+                                 [&resubscriptions](size_t idx) { send_bulk_subscription(resubscriptions[idx]); });
+
+    //
+    // Fire the callbacks and update statistics
+    //
+
+    for(auto &resub : resubscriptions)
+    {
+        const EvChanIte &ipos = resub.channel;
+        size_t nb_ok = 0;
+        size_t nb_failed = 0;
+
+        try
+        {
+            ipos->second.channel_monitor->get_monitor();
+        }
+        catch(...)
+        {
+            ApiUtil *au = ApiUtil::instance();
+            std::stringstream ss;
+
+            ss << "EventConsumerKeepAliveThread::bulk_re_subscribe() timeout on channel monitor of " << ipos->first;
+            au->print_error_message(ss.str().c_str());
+            continue;
+        }
+
+        for(size_t loop = 0; loop < resub.events.size(); ++loop)
+        {
+            const EvCbIte &epos = resub.events[loop];
+
+            if(resub.failed || (resub.bulk_cmd_supported && !resub.subscribed[loop]))
+            {
+                nb_failed++;
+                continue;
+            }
+
+            try
+            {
+                epos->second.callback_monitor->get_monitor();
+
+                re_subscribe_after_reconnect(event_consumer,
+                                             notifd_event_consumer,
+                                             epos,
+                                             ipos,
+                                             resub.domain_names[loop],
+                                             resub.bulk_cmd_supported);
+
+                epos->second.callback_monitor->rel_monitor();
+                nb_ok++;
+            }
+            catch(...)
+            {
+                ApiUtil *au = ApiUtil::instance();
+                std::stringstream ss;
+
+                ss << "EventConsumerKeepAliveThread::bulk_re_subscribe() timeout on callback monitor of "
+                   << epos->first;
+                au->print_error_message(ss.str().c_str());
+            }
+        }
+
+        ipos->second.channel_monitor->rel_monitor();
+
+        if(resub.failed)
+        {
+            continue;
+        }
+
+        auto duration =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - resub.start);
+
+        omni_mutex_lock sync(EventConsumer::reconnection_stats_mutex);
+
+        EventReconnectionStats &stats = EventConsumer::reconnection_stats;
+        stats.reconnections++;
+        stats.resubscribed_events += nb_ok;
+        stats.failed_events += nb_failed;
+        if(resub.bulk_cmd_supported)
+        {
+            stats.bulk_commands++;
+        }
+        stats.last_duration = duration;
+        stats.max_duration = std::max(stats.max_duration, duration);
+        EventConsumer::reconnection_total_duration += duration;
+    }
+}
+
 //---------------------------------------------------------------------------------------------------------------------
 //
 // method :
@@ -31,12 +31,25 @@
 
 #include <tango/client/event.h>
 #include <tango/server/logging.h>
+#include <tango/internal/metrics.h>
 
 #include <iostream>
 
 namespace Tango
 {
 
+namespace
+{
+
+// Number of events stored in all the event queues of the process
+detail::Gauge &queued_events()
+{
+    static auto &gauge = detail::MetricsRegistry::instance().gauge(detail::METRIC_EVENTS_QUEUED);
+    return gauge;
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////
 // EventQueue class implementation
 ////////////////////////////////////////////////////////////////////////////
@@ -99,6 +112,7 @@ EventQueue::~EventQueue()
     omni_mutex_lock l(modification_mutex);
 
     long nb = nb_elt;
+    queued_events().add(-nb_elt);
 
     //
     // check whether the events are not attribute configuration events
@@ -450,6 +464,7 @@ void EventQueue::inc_indexes()
         // unlimited buffer size
         insert_elt++;
         nb_elt++;
+        queued_events().add(1);
     }
     else
     {
@@ -464,6 +479,13 @@ void EventQueue::inc_indexes()
         if(nb_elt != max_elt)
         {
             nb_elt++;
+            queued_events().add(1);
+        }
+        else
+        {
+            // the oldest event has been overwritten
+            static auto &dropped = detail::MetricsRegistry::instance().counter(detail::METRIC_EVENTS_DROPPED);
+            dropped.add();
         }
     }
 }
@@ -620,6 +642,7 @@ void EventQueue::get_events(EventDataList &event_list)
     // empty the event queue now
     event_buffer.clear();
     insert_elt = 0;
+    queued_events().add(-nb_elt);
     nb_elt = 0;
 
     TANGO_LOG_DEBUG << "EventQueue::get_events() : size = " << event_list.size() << std::endl;
@@ -689,6 +712,7 @@ void EventQueue::get_events(AttrConfEventDataList &event_list)
     // empty the event queue now
     conf_event_buffer.clear();
     insert_elt = 0;
+    queued_events().add(-nb_elt);
     nb_elt = 0;
 
     TANGO_LOG_DEBUG << "EventQueue::get_events() : size = " << event_list.size() << std::endl;
@@ -758,6 +782,7 @@ void EventQueue::get_events(DataReadyEventDataList &event_list)
     // empty the event queue now
     ready_event_buffer.clear();
     insert_elt = 0;
+    queued_events().add(-nb_elt);
     nb_elt = 0;
 
     TANGO_LOG_DEBUG << "EventQueue::get_events() : size = " << event_list.size() << std::endl;
@@ -839,6 +864,7 @@ void EventQueue::get_events(DevIntrChangeEventDataList &event_list)
 
     dev_inter_event_buffer.clear();
     insert_elt = 0;
+    queued_events().add(-nb_elt);
     nb_elt = 0;
 
     TANGO_LOG_DEBUG << "EventQueue::get_events() : size = " << event_list.size() << std::endl;
@@ -920,6 +946,7 @@ void EventQueue::get_events(PipeEventDataList &event_list)
 
     pipe_event_buffer.clear();
     insert_elt = 0;
+    queued_events().add(-nb_elt);
     nb_elt = 0;
 
     TANGO_LOG_DEBUG << "EventQueue::get_events() : size = " << event_list.size() << std::endl;
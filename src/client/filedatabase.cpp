@@ -26,9 +26,14 @@
 #include <tango/server/except.h>
 #include <tango/client/apiexcept.h>
 
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
 #include <iostream>
+#include <map>
 #include <numeric>
 #include <algorithm>
+#include <unordered_map>
 // DbInfo                              done
 // DbImportDevice
 // DbExportDevice
@@ -112,77 +117,172 @@ bool equalsIgnoreCase(const string &s1, const string &s2)
     return ret;
 }
 
-Tango::t_device *search_device(Tango::t_server &s, string &name)
+char *to_corba_string(CORBA::ULong val)
+{
+    auto str = std::to_string(val);
+    return Tango::string_dup(str.c_str());
+}
+
+string lower_name(const string &name)
 {
-    for(unsigned int j = 0; j < s.devices.size(); j++)
+    string lower(name);
+    std::transform(lower.begin(), lower.end(), lower.begin(), chartolower);
+    return lower;
+}
+
+// Journal is compacted when larger than the file, but not before reaching this size
+constexpr std::streamoff k_min_compaction_size = 64 * 1024;
+
+// First word of the journal, followed by the stamp of the file the journal applies to
+constexpr const char *k_journal_header = "TANGO_FILEDATABASE_JOURNAL";
+
+// Size and modification time of the file, to detect a file modified after its journal was started
+string get_file_stamp(const string &file_name)
+{
+    std::error_code ec;
+    auto size = std::filesystem::file_size(file_name, ec);
+    if(ec)
     {
-        if(equalsIgnoreCase(s.devices[j]->name, name))
-        {
-            return s.devices[j];
-        }
+        return "unknown";
+    }
+    auto mtime = std::filesystem::last_write_time(file_name, ec);
+    if(ec)
+    {
+        return "unknown";
     }
 
-    return nullptr;
+    std::stringstream ss;
+    ss << size << ' ' << mtime.time_since_epoch().count();
+    return ss.str();
 }
 
-Tango::t_tango_class *search_class(Tango::t_server &s, string &name)
+} // anonymous namespace
+
+namespace Tango
+{
+
+//
+// Case insensitive indexes of the objects of the file. Lookups return the first object
+// with a given name, like the linear searches they replace. Attribute properties are
+// never removed, the properties of the devices, classes and free objects are removed
+// from their index when deleted.
+//
+
+template <class T>
+using NameIndex = std::unordered_map<std::string, T *>;
+
+class FileDatabaseExt
 {
-    for(unsigned int i = 0; i < s.classes.size(); i++)
+  public:
+    explicit FileDatabaseExt(const std::string &file_name) :
+        journal_name(file_name + ".journal")
     {
-        if(equalsIgnoreCase(s.classes[i]->name, name))
+    }
+
+    NameIndex<t_device> devices;
+    NameIndex<t_tango_class> classes;
+    NameIndex<t_free_object> free_objects;
+    // Properties of each device, class and free object, keyed by their address
+    std::unordered_map<const void *, NameIndex<t_property>> properties;
+    // Attribute properties of each device and class, keyed by their address
+    std::unordered_map<const void *, NameIndex<t_attribute_property>> attribute_properties;
+
+    std::string journal_name;
+    std::ofstream journal;
+    std::streamoff journal_size{0};
+    std::streamoff file_size{0};
+    // Stamp of the file matching the content in memory, written in the journal header
+    std::string file_stamp;
+    bool replaying{false};
+
+    template <class T>
+    static T *search(const NameIndex<T> &index, const string &name)
+    {
+        auto it = index.find(lower_name(name));
+        return it == index.end() ? nullptr : it->second;
+    }
+
+    template <class T>
+    static void add(NameIndex<T> &index, T *obj)
+    {
+        index.emplace(lower_name(obj->name), obj);
+    }
+
+    t_property *search_prop(const void *owner, const string &name)
+    {
+        auto it = properties.find(owner);
+        if(it == properties.end())
         {
-            return s.classes[i];
+            return nullptr;
         }
+        auto prop = it->second.find(lower_name(name));
+        return prop == it->second.end() ? nullptr : prop->second;
     }
-    return nullptr;
-}
 
-Tango::t_free_object *search_free_object(Tango::t_server &s, string &name)
-{
-    for(unsigned int i = 0; i < s.free_objects.size(); i++)
+    template <class T>
+    void add_prop(T *owner, t_property *prop)
     {
-        if(equalsIgnoreCase(s.free_objects[i]->name, name))
+        owner->properties.push_back(prop);
+        properties[owner].emplace(lower_name(prop->name), prop);
+    }
+
+    // Delete the property of the given object, if any
+    template <class T>
+    void delete_prop(T *owner, const string &name)
+    {
+        auto it = properties.find(owner);
+        if(it == properties.end())
+        {
+            return;
+        }
+        auto prop = it->second.find(lower_name(name));
+        if(prop == it->second.end())
         {
-            return s.free_objects[i];
+            return;
+        }
+
+        auto &prop_list = owner->properties;
+        prop_list.erase(std::find(prop_list.begin(), prop_list.end(), prop->second));
+        delete prop->second;
+
+        // A file can define the same property twice, the next one is now the first one
+        auto next = std::find_if(prop_list.begin(), prop_list.end(), hasName<t_property>(name));
+        if(next != prop_list.end())
+        {
+            prop->second = *next;
+        }
+        else
+        {
+            it->second.erase(prop);
         }
     }
-    return nullptr;
-}
 
-Tango::t_attribute_property *search_dev_attr_prop(Tango::t_device *d, const string &name)
-{
-    for(unsigned int i = 0; i < d->attribute_properties.size(); i++)
+    t_attribute_property *search_attr_prop(const void *owner, const string &name)
     {
-        if(equalsIgnoreCase(d->attribute_properties[i]->attribute_name, name))
+        auto it = attribute_properties.find(owner);
+        if(it == attribute_properties.end())
         {
-            return d->attribute_properties[i];
+            return nullptr;
         }
+        auto prop = it->second.find(lower_name(name));
+        return prop == it->second.end() ? nullptr : prop->second;
     }
-    return nullptr;
-}
 
-Tango::t_attribute_property *search_class_attr_prop(Tango::t_tango_class *d, const string &name)
-{
-    for(unsigned int i = 0; i < d->attribute_properties.size(); i++)
+    // Return the attribute property of the given attribute, created if needed
+    template <class T>
+    t_attribute_property *get_attr_prop(T *owner, const string &name)
     {
-        if(equalsIgnoreCase(d->attribute_properties[i]->attribute_name, name))
+        t_attribute_property *&attr_prop = attribute_properties[owner][lower_name(name)];
+        if(attr_prop == nullptr)
         {
-            return d->attribute_properties[i];
+            attr_prop = new t_attribute_property;
+            attr_prop->attribute_name = name;
+            owner->attribute_properties.push_back(attr_prop);
         }
+        return attr_prop;
     }
-    return nullptr;
-}
+};
 
-char *to_corba_string(CORBA::ULong val)
-{
-    auto str = std::to_string(val);
-    return Tango::string_dup(str.c_str());
-}
-
-} // anonymous namespace
-
-namespace Tango
-{
 const char *FileDatabase::lexical_word_null = "NULL";
 const char *FileDatabase::lexical_word_number = "NUMBER";
 const char *FileDatabase::lexical_word_string = "STRING";
@@ -206,21 +306,28 @@ bool hasAttributeName<T>::operator()(T *obj)
     return (equalsIgnoreCase(obj->attribute_name, attribute_name));
 }
 
-FileDatabaseExt::FileDatabaseExt() { }
-
 FileDatabase::FileDatabase(const std::string &file_name) :
-    ext(new FileDatabaseExt)
+    ext(new FileDatabaseExt(file_name))
 {
     TANGO_LOG_DEBUG << "FILEDATABASE: FileDatabase constructor" << endl;
     filename = file_name;
 
     parse_res_file(filename);
+    read_ptr = nullptr;
+    read_end = nullptr;
+    ext->file_stamp = get_file_stamp(filename);
+    replay_journal();
 }
 
 FileDatabase::~FileDatabase()
 {
     TANGO_LOG_DEBUG << "FILEDATABASE: FileDatabase destructor" << endl;
-    //    write_file();
+
+    // Compact the pending updates in the file
+    if(ext->journal_size > 0)
+    {
+        write_file();
+    }
 
     std::vector<t_device *>::iterator i;
     for(i = m_server.devices.begin(); i != m_server.devices.end(); ++i)
@@ -276,12 +383,12 @@ FileDatabase::~FileDatabase()
 // ****************************************************
 // read the next character in the file
 // ****************************************************
-void FileDatabase ::read_char(ifstream &f)
+void FileDatabase ::read_char()
 {
     CurrentChar = NextChar;
-    if(!f.eof())
+    if(read_ptr != read_end)
     {
-        f.get(NextChar);
+        NextChar = *read_ptr++;
     }
     else
     {
@@ -334,57 +441,57 @@ int FileDatabase ::class_lex(const string &tmp_word)
 // ****************************************************
 // Go to the next line                                */
 // ****************************************************
-void FileDatabase ::jump_line(ifstream &f)
+void FileDatabase ::jump_line()
 {
     while(CurrentChar != '\n' && CurrentChar != 0)
     {
-        read_char(f);
+        read_char();
     }
-    read_char(f);
+    read_char();
 }
 
-void FileDatabase ::jump_space(ifstream &f)
+void FileDatabase ::jump_space()
 {
     while((CurrentChar <= 32) && (CurrentChar > 0))
     {
-        read_char(f);
+        read_char();
     }
 }
 
 // ****************************************************
 // Read the next word in the file                           */
 // ****************************************************
-string FileDatabase ::read_word(ifstream &f)
+string FileDatabase ::read_word()
 {
     string ret_word;
 
     /* Jump space and comments */
-    jump_space(f);
+    jump_space();
     while(CurrentChar == '#')
     {
-        jump_line(f);
-        jump_space(f);
+        jump_line();
+        jump_space();
     }
 
     /* Jump C like comments */
     if(CurrentChar == '/')
     {
-        read_char(f);
+        read_char();
         if(CurrentChar == '*')
         {
             bool end = false;
-            read_char(f);
+            read_char();
             while(end)
             {
                 while(CurrentChar != '*')
                 {
-                    read_char(f);
+                    read_char();
                 }
-                read_char(f);
+                read_char();
                 end = (CurrentChar == '/');
             }
-            read_char(f);
-            jump_space(f);
+            read_char();
+            jump_space();
         }
         else
         {
@@ -406,21 +513,21 @@ string FileDatabase ::read_word(ifstream &f)
         else
         {
             ret_word += CurrentChar;
-            read_char(f);
+            read_char();
             ret_word += CurrentChar;
         }
-        read_char(f);
+        read_char();
         return ret_word;
     }
 
     /* Treat string */
     if(CurrentChar == '"')
     {
-        read_char(f);
+        read_char();
         while(CurrentChar != '"' && CurrentChar != 0 && CurrentChar != '\n')
         {
             ret_word += CurrentChar;
-            read_char(f);
+            read_char();
         }
         if(CurrentChar == 0 || CurrentChar == '\n')
         {
@@ -430,7 +537,7 @@ string FileDatabase ::read_word(ifstream &f)
             desc << " in file " << filename << "." << ends;
             TANGO_THROW_DETAILED_EXCEPTION(ApiConnExcept, API_DatabaseFileError, desc.str());
         }
-        read_char(f);
+        read_char();
         return ret_word;
     }
 
@@ -442,7 +549,7 @@ string FileDatabase ::read_word(ifstream &f)
             break;
         }
         ret_word += CurrentChar;
-        read_char(f);
+        read_char();
     }
 
     if(ret_word.length() == 0)
@@ -457,33 +564,33 @@ string FileDatabase ::read_word(ifstream &f)
 // Read the next word in the file
 // And allow / inside
 // ****************************************************
-string FileDatabase::read_full_word(ifstream &f)
+string FileDatabase::read_full_word()
 {
     string ret_word;
 
     StartLine = CrtLine;
-    jump_space(f);
+    jump_space();
 
     /* Treat special character */
     if(CurrentChar == ',' || CurrentChar == '\\')
     {
         ret_word += CurrentChar;
-        read_char(f);
+        read_char();
         return ret_word;
     }
 
     /* Treat string */
     if(CurrentChar == '"')
     {
-        read_char(f);
+        read_char();
         while(CurrentChar != '"' && CurrentChar != 0)
         {
             if(CurrentChar == '\\')
             {
-                read_char(f);
+                read_char();
             }
             ret_word += CurrentChar;
-            read_char(f);
+            read_char();
         }
         if(CurrentChar == 0)
         {
@@ -493,7 +600,7 @@ string FileDatabase::read_full_word(ifstream &f)
             desc << " in file " << filename << "." << ends;
             TANGO_THROW_DETAILED_EXCEPTION(ApiConnExcept, API_DatabaseFileError, desc.str());
         }
-        read_char(f);
+        read_char();
         if(ret_word.length() == 0)
         {
             ret_word = string(lexical_word_null);
@@ -505,7 +612,7 @@ string FileDatabase::read_full_word(ifstream &f)
     while(CurrentChar > 32 && CurrentChar != '\\' && CurrentChar != ',')
     {
         ret_word += CurrentChar;
-        read_char(f);
+        read_char();
     }
 
     if(ret_word.length() == 0)
@@ -529,7 +636,7 @@ void FileDatabase::CHECK_LEX(int lt, int le)
     }
 }
 
-vector<string> FileDatabase::parse_resource_value(ifstream &f)
+vector<string> FileDatabase::parse_resource_value()
 {
     int lex;
     vector<string> ret;
@@ -539,13 +646,13 @@ vector<string> FileDatabase::parse_resource_value(ifstream &f)
 
     while((lex == _TG_COMA || lex == _TG_ASLASH) && word != "")
     {
-        word = read_full_word(f);
+        word = read_full_word();
         lex = class_lex(word);
 
         /* allow ... ,\ syntax */
         if(lex == _TG_ASLASH)
         {
-            word = read_full_word(f);
+            word = read_full_word();
             lex = class_lex(word);
         }
 
@@ -553,7 +660,7 @@ vector<string> FileDatabase::parse_resource_value(ifstream &f)
 
         ret.push_back(word);
 
-        word = read_word(f);
+        word = read_word();
         lex = class_lex(word);
     }
 
@@ -596,12 +703,29 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
         TANGO_THROW_DETAILED_EXCEPTION(ApiConnExcept, API_DatabaseFileError, desc.str());
     }
 
+    /* READ IT IN ONE GO              */
+
+    // The size may be smaller than the file size in text mode
+    string content;
+    f.seekg(0, ios::end);
+    std::streamoff file_size = f.tellg();
+    f.seekg(0, ios::beg);
+    if(file_size > 0)
+    {
+        content.resize(static_cast<std::size_t>(file_size));
+        f.read(&content[0], file_size);
+        content.resize(static_cast<std::size_t>(f.gcount()));
+    }
+    f.close();
+    read_ptr = content.data();
+    read_end = content.data() + content.size();
+    ext->file_size = file_size;
+
     /* CHECK BEGINING OF CONFIG FILE  */
 
-    word = read_word(f);
+    word = read_word();
     if(word == "")
     {
-        f.close();
         return file_name + " is empty...";
     }
     lex = class_lex(word);
@@ -618,19 +742,19 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
 
             /* Domain */
             domain = word;
-            word = read_word(f);
+            word = read_word();
             lex = class_lex(word);
 
             // TANGO_LOG << "DOMAIN " << domain << endl;;
             CHECK_LEX(lex, _TG_SLASH);
 
             /* Family */
-            word = read_word(f);
+            word = read_word();
             lex = class_lex(word);
             CHECK_LEX(lex, _TG_STRING);
             family = word;
             // TANGO_LOG << "FAMILI " << family << endl;
-            word = read_word(f);
+            word = read_word();
             lex = class_lex(word);
 
             switch(lex)
@@ -638,23 +762,23 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
             case _TG_SLASH:
 
                 /* Member */
-                word = read_word(f);
+                word = read_word();
                 lex = class_lex(word);
                 CHECK_LEX(lex, _TG_STRING);
                 member = word;
-                word = read_word(f);
+                word = read_word();
                 lex = class_lex(word);
 
                 switch(lex)
                 {
                 case _TG_SLASH:
                     /* We have a 4 fields name */
-                    word = read_word(f);
+                    word = read_word();
                     lex = class_lex(word);
                     CHECK_LEX(lex, _TG_STRING);
                     name = word;
 
-                    word = read_word(f);
+                    word = read_word();
                     lex = class_lex(word);
 
                     switch(lex)
@@ -663,12 +787,13 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
                     {
                         /* Device definition */
                         m_server.instance_name = family;
-                        vector<string> values = parse_resource_value(f);
+                        vector<string> values = parse_resource_value();
                         lex = class_lex(word);
                         // TANGO_LOG << "Class name : " << name << endl;
                         un_class = new t_tango_class;
                         un_class->name = name;
                         m_server.classes.push_back(un_class);
+                        FileDatabaseExt::add(ext->classes, un_class);
                         if(equalsIgnoreCase(member, "device"))
                         {
                             /* Device definition */
@@ -679,6 +804,7 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
                                 un_device->name = values[n];
                                 m_server.devices.push_back(un_device);
                                 un_class->devices.push_back(un_device);
+                                FileDatabaseExt::add(ext->devices, un_device);
                             }
                         }
                     }
@@ -687,42 +813,35 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
                     case _TG_ARROW:
                     {
                         /* We have an attribute property definition */
-                        word = read_word(f);
+                        word = read_word();
                         lex = class_lex(word);
                         CHECK_LEX(lex, _TG_STRING);
                         prop_name = word;
                         // TANGO_LOG << "Attribute property: " << prop_name << endl;
 
                         /* jump : */
-                        word = read_word(f);
+                        word = read_word();
                         lex = class_lex(word);
                         CHECK_LEX(lex, _TG_COLON);
 
                         /* Resource value */
-                        vector<string> values = parse_resource_value(f);
+                        vector<string> values = parse_resource_value();
                         lex = class_lex(word);
 
                         /* Device attribute definition */
 
                         // TANGO_LOG << "    " << domain << "/" << family << "/" << member << endl;
                         string device_name = domain + "/" + family + "/" + member;
-                        t_device *d = search_device(m_server, device_name);
+                        t_device *d = FileDatabaseExt::search(ext->devices, device_name);
 
-                        t_attribute_property *un_dev_attr_prop = search_dev_attr_prop(d, name);
-                        if(un_dev_attr_prop == nullptr)
-                        {
-                            un_dev_attr_prop = new t_attribute_property;
-                            un_dev_attr_prop->attribute_name = name;
-                            d->attribute_properties.push_back(un_dev_attr_prop);
-                        }
-                        t_property *prop = new t_property;
-                        prop->name = prop_name;
-                        for(unsigned int n = 0; n < values.size(); n++)
+                        if(d != nullptr)
                         {
-                            // TANGO_LOG << "     <" << values[n] << ">" << endl;
-                            prop->value.push_back(values[n]);
+                            t_attribute_property *un_dev_attr_prop = ext->get_attr_prop(d, name);
+                            t_property *prop = new t_property;
+                            prop->name = prop_name;
+                            prop->value = std::move(values);
+                            un_dev_attr_prop->properties.push_back(prop);
                         }
-                        un_dev_attr_prop->properties.push_back(prop);
                     }
                     break;
 
@@ -739,18 +858,18 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
                 {
                     /* We have a device property or attribute class definition */
 
-                    word = read_word(f);
+                    word = read_word();
                     lex = class_lex(word);
                     CHECK_LEX(lex, _TG_STRING);
                     prop_name = word;
 
                     /* jump : */
-                    word = read_word(f);
+                    word = read_word();
                     lex = class_lex(word);
                     CHECK_LEX(lex, _TG_COLON);
 
                     /* Resource value */
-                    vector<string> values = parse_resource_value(f);
+                    vector<string> values = parse_resource_value();
                     lex = class_lex(word);
 
                     if(equalsIgnoreCase(domain, "class"))
@@ -759,24 +878,14 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
                         // TANGO_LOG << "Class attribute property definition" << endl;
                         // TANGO_LOG << "      family,member,prop_name,values :" << family <<","<<member<< ","
                         // <<prop_name<<","<< endl;
-                        t_tango_class *c = search_class(m_server, family);
+                        t_tango_class *c = FileDatabaseExt::search(ext->classes, family);
 
                         if(c != nullptr)
                         {
-                            t_attribute_property *un_class_attr_prop = search_class_attr_prop(c, member);
-                            if(un_class_attr_prop == nullptr)
-                            {
-                                un_class_attr_prop = new t_attribute_property;
-                                un_class_attr_prop->attribute_name = member;
-                                c->attribute_properties.push_back(un_class_attr_prop);
-                            }
+                            t_attribute_property *un_class_attr_prop = ext->get_attr_prop(c, member);
                             t_property *prop = new t_property;
                             prop->name = prop_name;
-                            for(unsigned int n = 0; n < values.size(); n++)
-                            {
-                                // TANGO_LOG << "     <" << values[n] << ">" << endl;
-                                prop->value.push_back(values[n]);
-                            }
+                            prop->value = std::move(values);
                             un_class_attr_prop->properties.push_back(prop);
 
                             // put_tango_class_attr_prop(family,member,prop_name,values);
@@ -788,18 +897,14 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
                         // TANGO_LOG << "Device property definition " << prop_name << endl;
                         // TANGO_LOG << "    " << domain << "/" << family << "/" << member << endl;
                         string device_name = domain + "/" + family + "/" + member;
-                        t_device *d = search_device(m_server, device_name);
+                        t_device *d = FileDatabaseExt::search(ext->devices, device_name);
 
                         if(d != nullptr)
                         {
                             t_property *un_dev_prop = new t_property;
                             un_dev_prop->name = prop_name;
-                            for(unsigned int n = 0; n < values.size(); n++)
-                            {
-                                // TANGO_LOG << "     <" << values[n] << ">" << endl;
-                                un_dev_prop->value.push_back(values[n]);
-                            }
-                            d->properties.push_back(un_dev_prop);
+                            un_dev_prop->value = std::move(values);
+                            ext->add_prop(d, un_dev_prop);
                         }
                     }
                 }
@@ -818,15 +923,15 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
             {
                 /* We have a class property */
                 /* Member */
-                word = read_word(f);
+                word = read_word();
                 lex = class_lex(word);
                 CHECK_LEX(lex, _TG_STRING);
                 member = word;
-                word = read_word(f);
+                word = read_word();
                 lex = class_lex(word);
 
                 /* Resource value */
-                vector<string> values = parse_resource_value(f);
+                vector<string> values = parse_resource_value();
                 lex = class_lex(word);
 
                 /* Class resource */
@@ -834,24 +939,19 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
                 {
                     // TANGO_LOG << "Tango resource class " << endl;
                     {
-                        un_class = search_class(m_server, family);
+                        un_class = FileDatabaseExt::search(ext->classes, family);
                         if(un_class != nullptr)
                         {
                             t_property *un_prop = new t_property;
                             un_prop->name = member;
-                            // TANGO_LOG << "Proprieta : " << member << endl;
-                            for(unsigned int n = 0; n < values.size(); n++)
-                            {
-                                // TANGO_LOG << "    " << member << "[" << n << "] = " << values[n] << endl;
-                                un_prop->value.push_back(values[n]);
-                            }
-                            un_class->properties.push_back(un_prop);
+                            un_prop->value = std::move(values);
+                            ext->add_prop(un_class, un_prop);
                         }
                     }
                 }
                 else if(equalsIgnoreCase(domain, "free"))
                 {
-                    t_free_object *obj = search_free_object(m_server, family);
+                    t_free_object *obj = FileDatabaseExt::search(ext->free_objects, family);
 
                     // We add free objects on demand.
                     if(obj == nullptr)
@@ -859,16 +959,13 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
                         obj = new t_free_object;
                         obj->name = family;
                         m_server.free_objects.push_back(obj);
+                        FileDatabaseExt::add(ext->free_objects, obj);
                     }
 
                     t_property *prop = new t_property;
                     prop->name = member;
-
-                    for(unsigned int n = 0; n < values.size(); n++)
-                    {
-                        prop->value.push_back(values[n]);
-                    }
-                    obj->properties.push_back(prop);
+                    prop->value = std::move(values);
+                    ext->add_prop(obj, prop);
                 }
                 else
                 {
@@ -897,7 +994,6 @@ std::string FileDatabase::parse_res_file(const std::string &file_name)
         eof = (word == lexical_word_null);
     }
 
-    f.close();
     return "";
 }
 
@@ -1056,6 +1152,13 @@ void FileDatabase ::write_file()
     */
 
     f.open(f_name.c_str());
+    if(!f.good())
+    {
+        // Keep the journal, the updates are still in it
+        TANGO_LOG_DEBUG << "FILEDATABASE: could not open " << f_name << " for writing" << endl;
+        return;
+    }
+
     vector<t_tango_class *>::const_iterator it;
     for(it = m_server.classes.begin(); it != m_server.classes.end(); ++it)
     {
@@ -1067,18 +1170,18 @@ void FileDatabase ::write_file()
         ++iterator_d;
         for(auto itd = iterator_d; itd != (*it)->devices.end(); ++itd)
         {
-            f << ",\\" << endl;
+            f << ",\\" << '\n';
             f << margin_s << "\"" << (*itd)->name << "\"";
         }
-        f << endl;
+        f << '\n';
     }
-    f << endl;
+    f << '\n';
 
     for(it = m_server.classes.begin(); it != m_server.classes.end(); ++it)
     {
-        f << "#############################################" << endl;
-        f << "# CLASS " << (*it)->name << endl;
-        f << endl;
+        f << "#############################################" << '\n';
+        f << "# CLASS " << (*it)->name << '\n';
+        f << '\n';
         for(auto itp = (*it)->properties.begin(); itp != (*it)->properties.end(); ++itp)
         {
             f << "CLASS/" << (*it)->name << "->" << (*itp)->name << ": ";
@@ -1103,16 +1206,16 @@ void FileDatabase ::write_file()
                 ++iterator_s;
                 for(auto its = iterator_s; its != (*itp)->value.end(); ++its)
                 {
-                    f << ",\\" << endl;
+                    f << ",\\" << '\n';
                     f << margin_s;
                     write_string_value(*its, f);
                 }
             }
-            f << endl;
+            f << '\n';
         }
-        f << endl;
-        f << "# CLASS " << (*it)->name << " attribute properties" << endl;
-        f << endl;
+        f << '\n';
+        f << "# CLASS " << (*it)->name << " attribute properties" << '\n';
+        f << '\n';
         for(auto itap = (*it)->attribute_properties.begin(); itap != (*it)->attribute_properties.end(); ++itap)
         {
             for(auto itp = (*itap)->properties.begin(); itp != (*itap)->properties.end(); ++itp)
@@ -1126,21 +1229,21 @@ void FileDatabase ::write_file()
                     ++iterator_s;
                     for(auto its = iterator_s; its != (*itp)->value.end(); ++its)
                     {
-                        f << ",\\" << endl;
+                        f << ",\\" << '\n';
                         string margin_s(margin, ' ');
                         f << margin_s;
                         write_string_value(*its, f);
                     }
                 }
-                f << endl;
+                f << '\n';
             }
         }
-        f << endl;
+        f << '\n';
     }
-    f << endl;
+    f << '\n';
     for(auto ite = m_server.devices.begin(); ite != m_server.devices.end(); ++ite)
     {
-        f << "# DEVICE " << (*ite)->name << " properties " << endl << endl;
+        f << "# DEVICE " << (*ite)->name << " properties " << '\n' << '\n';
         for(auto itp = (*ite)->properties.begin(); itp != (*ite)->properties.end(); ++itp)
         {
             f << (*ite)->name << "->" << (*itp)->name << ": ";
@@ -1152,16 +1255,16 @@ void FileDatabase ::write_file()
                 ++iterator_s;
                 for(auto its = iterator_s; its != (*itp)->value.end(); ++its)
                 {
-                    f << ",\\" << endl;
+                    f << ",\\" << '\n';
                     string margin_s(margin, ' ');
                     f << margin_s;
                     write_string_value(*its, f);
                 }
             }
-            f << endl;
+            f << '\n';
         }
-        f << endl;
-        f << "# DEVICE " << (*ite)->name << " attribute properties" << endl << endl;
+        f << '\n';
+        f << "# DEVICE " << (*ite)->name << " attribute properties" << '\n' << '\n';
         for(auto itap = (*ite)->attribute_properties.begin(); itap != (*ite)->attribute_properties.end(); ++itap)
         {
             for(auto itp = (*itap)->properties.begin(); itp != (*itap)->properties.end(); ++itp)
@@ -1175,13 +1278,13 @@ void FileDatabase ::write_file()
                     ++iterator_s;
                     for(auto its = iterator_s; its != (*itp)->value.end(); ++its)
                     {
-                        f << ",\\" << endl;
+                        f << ",\\" << '\n';
                         string margin_s(margin, ' ');
                         f << margin_s;
                         write_string_value(*its, f);
                     }
                 }
-                f << endl;
+                f << '\n';
             }
         }
     }
@@ -1202,7 +1305,7 @@ void FileDatabase ::write_file()
                 ++its;
                 for(; its != prop->value.end(); ++its)
                 {
-                    f << ",\\" << endl;
+                    f << ",\\" << '\n';
                     f << margin_s;
                     write_string_value(*its, f);
                 }
@@ -1211,7 +1314,188 @@ void FileDatabase ::write_file()
         }
     }
 
+    f.flush();
+    bool written = f.good();
+    ext->file_size = f.tellp();
+    f.close();
+    ext->file_stamp = get_file_stamp(f_name);
+
+    //
+    // The file now holds all the updates, clear the journal
+    //
+
+    if(ext->journal.is_open())
+    {
+        ext->journal.close();
+    }
+    ext->journal.clear();
+    if(written)
+    {
+        std::remove(ext->journal_name.c_str());
+        ext->journal_size = 0;
+    }
+}
+
+//-----------------------------------------------------------------------------
+//
+// method :            FileDatabase::journal_update() -
+//
+// description :     Append a Put/Delete call to the journal instead of rewriting the
+//                   whole file. The file is rewritten (and the journal cleared) when the
+//                   journal gets larger than the file, keeping the cost of the updates
+//                   proportional to their size.
+//
+// argument : in : command : The name of the FileDatabase method
+//                 args : The method argument
+//
+//-----------------------------------------------------------------------------
+
+void FileDatabase::journal_update(const char *command, const DevVarStringArray &args)
+{
+    if(ext->replaying)
+    {
+        return;
+    }
+
+    std::ofstream &journal = ext->journal;
+    if(!journal.is_open())
+    {
+        journal.clear();
+        journal.open(ext->journal_name.c_str(), ios::out | ios::app | ios::binary);
+
+        journal.seekp(0, ios::end);
+        if(journal.tellp() == 0)
+        {
+            journal << k_journal_header << ' ' << ext->file_stamp << '\n';
+        }
+    }
+
+    // Each record is the command name, the number of strings and each string preceded by its length
+    journal << command << '\n' << args.length() << '\n';
+    for(CORBA::ULong i = 0; i < args.length(); ++i)
+    {
+        const char *str = args[i].in();
+        std::size_t len = ::strlen(str);
+        journal << len << ' ';
+        journal.write(str, len);
+        journal << '\n';
+    }
+    journal.flush();
+
+    if(!journal.good())
+    {
+        TANGO_LOG_DEBUG << "FILEDATABASE: could not write " << ext->journal_name << ", rewriting the file" << endl;
+        write_file();
+        return;
+    }
+
+    ext->journal_size = journal.tellp();
+    if(ext->journal_size > std::max(ext->file_size, k_min_compaction_size))
+    {
+        write_file();
+    }
+}
+
+//-----------------------------------------------------------------------------
+//
+// method :            FileDatabase::replay_journal() -
+//
+// description :     Apply the updates of the journal left by a previous instance (which
+//                   crashed before compacting it) and compact it into the file. A truncated
+//                   last record (a crash while writing it) is ignored. A journal started on
+//                   another version of the file (e.g. edited by hand after the crash) is not
+//                   replayed but renamed to <file>.journal.rejected.
+//
+//-----------------------------------------------------------------------------
+
+void FileDatabase::replay_journal()
+{
+    using DbMethod = CORBA::Any_var (FileDatabase::*)(CORBA::Any &);
+    static const std::map<std::string, DbMethod> methods{
+        {"DbPutDeviceProperty", &FileDatabase::DbPutDeviceProperty},
+        {"DbDeleteDeviceProperty", &FileDatabase::DbDeleteDeviceProperty},
+        {"DbPutDeviceAttributeProperty", &FileDatabase::DbPutDeviceAttributeProperty},
+        {"DbDeleteDeviceAttributeProperty", &FileDatabase::DbDeleteDeviceAttributeProperty},
+        {"DbPutClassProperty", &FileDatabase::DbPutClassProperty},
+        {"DbDeleteClassProperty", &FileDatabase::DbDeleteClassProperty},
+        {"DbPutClassAttributeProperty", &FileDatabase::DbPutClassAttributeProperty},
+        {"DbPutProperty", &FileDatabase::DbPutProperty},
+        {"DbDeleteProperty", &FileDatabase::DbDeleteProperty}};
+
+    ifstream f(ext->journal_name.c_str(), ios::in | ios::binary);
+    if(!f.good())
+    {
+        return;
+    }
+
+    string header;
+    std::getline(f, header);
+    if(header != string(k_journal_header) + ' ' + ext->file_stamp)
+    {
+        f.close();
+        string rejected_name = ext->journal_name + ".rejected";
+        TANGO_LOG << "FILEDATABASE: " << filename << " was modified after " << ext->journal_name
+                  << " was written, its updates are not applied (journal renamed to " << rejected_name << ")" << endl;
+        std::remove(rejected_name.c_str());
+        std::rename(ext->journal_name.c_str(), rejected_name.c_str());
+        return;
+    }
+
+    TANGO_LOG_DEBUG << "FILEDATABASE: replaying " << ext->journal_name << endl;
+
+    ext->replaying = true;
+    try
+    {
+        string command;
+        while(std::getline(f, command))
+        {
+            auto method = methods.find(command);
+            std::size_t nb_strings = 0;
+            if(method == methods.end() || !(f >> nb_strings) || f.get() != '\n')
+            {
+                break;
+            }
+
+            vector<string> strings;
+            for(std::size_t i = 0; i < nb_strings; ++i)
+            {
+                std::size_t len = 0;
+                if(!(f >> len) || f.get() != ' ')
+                {
+                    break;
+                }
+                string str(len, '\0');
+                if(!f.read(&str[0], len) || f.get() != '\n')
+                {
+                    break;
+                }
+                strings.push_back(std::move(str));
+            }
+            if(strings.size() != nb_strings)
+            {
+                break;
+            }
+
+            auto *args = new DevVarStringArray;
+            args->length(nb_strings);
+            for(std::size_t i = 0; i < nb_strings; ++i)
+            {
+                (*args)[i] = Tango::string_dup(strings[i].c_str());
+            }
+            CORBA::Any any;
+            any <<= args;
+            (this->*(method->second))(any);
+        }
+    }
+    catch(...)
+    {
+        ext->replaying = false;
+        throw;
+    }
+    ext->replaying = false;
+
     f.close();
+    write_file();
 }
 
 CORBA::Any_var FileDatabase ::DbGetDeviceProperty(CORBA::Any &send)
@@ -1236,63 +1520,48 @@ CORBA::Any_var FileDatabase ::DbGetDeviceProperty(CORBA::Any &send)
 
     if(data_in->length() >= 2)
     {
-        unsigned long nb_defined_dev = m_server.devices.size();
-        unsigned long i;
         int seq_length = 2;
 
-        for(i = 0; i < nb_defined_dev; i++)
+        t_device *dev = FileDatabaseExt::search(ext->devices, (*data_in)[0].in());
+        if(dev != nullptr)
         {
-            if(equalsIgnoreCase((*data_in)[0].in(), m_server.devices[i]->name))
+            for(unsigned int j = 1; j < data_in->length(); j++)
             {
-                for(unsigned int j = 1; j < data_in->length(); j++)
+                t_property *prop = ext->search_prop(dev, (*data_in)[j].in());
+                if(prop != nullptr)
                 {
-                    unsigned long m;
-
-                    unsigned long nb_defined_prop = m_server.devices[i]->properties.size();
-                    for(m = 0; m < nb_defined_prop; m++)
-                    {
-                        // if ( strcmp((*data_in)[j], m_server.devices[i]->properties[m]->name.c_str()) == 0 )
-                        if(equalsIgnoreCase((*data_in)[j].in(), m_server.devices[i]->properties[m]->name))
-                        {
-                            int num_val = 0;
-
-                            num_prop++;
-                            num_val = m_server.devices[i]->properties[m]->value.size();
-                            seq_length = seq_length + 2 + m_server.devices[i]->properties[m]->value.size();
-                            data_out->length(seq_length);
-                            (*data_out)[index] = Tango::string_dup(m_server.devices[i]->properties[m]->name.c_str());
-                            index++;
-                            (*data_out)[index] = to_corba_string(num_val);
-                            index++;
-                            for(int k = 0; k < num_val; k++)
-                            {
-                                (*data_out)[index] =
-                                    Tango::string_dup(m_server.devices[i]->properties[m]->value[k].c_str());
-                                index++;
-                            }
-                            break;
-                        }
-                    }
+                    int num_val = 0;
 
-                    if(m == nb_defined_prop)
+                    num_prop++;
+                    num_val = prop->value.size();
+                    seq_length = seq_length + 2 + prop->value.size();
+                    data_out->length(seq_length);
+                    (*data_out)[index] = Tango::string_dup(prop->name.c_str());
+                    index++;
+                    (*data_out)[index] = to_corba_string(num_val);
+                    index++;
+                    for(int k = 0; k < num_val; k++)
                     {
-                        seq_length = seq_length + 3;
-                        data_out->length(seq_length);
-                        (*data_out)[index] = Tango::string_dup((*data_in)[j].in());
-                        index++;
-                        (*data_out)[index] = Tango::string_dup("0");
-                        index++;
-                        (*data_out)[index] = Tango::string_dup(" ");
+                        (*data_out)[index] = Tango::string_dup(prop->value[k].c_str());
                         index++;
                     }
                 }
-                break;
+                else
+                {
+                    seq_length = seq_length + 3;
+                    data_out->length(seq_length);
+                    (*data_out)[index] = Tango::string_dup((*data_in)[j].in());
+                    index++;
+                    (*data_out)[index] = Tango::string_dup("0");
+                    index++;
+                    (*data_out)[index] = Tango::string_dup(" ");
+                    index++;
+                }
             }
         }
-
-        if(i == nb_defined_dev)
+        else
         {
-            for(i = 0; i < num_prop; i++)
+            for(unsigned long i = 0; i < num_prop; i++)
             {
                 seq_length = seq_length + 3;
                 data_out->length(seq_length);
@@ -1329,29 +1598,24 @@ CORBA::Any_var FileDatabase ::DbPutDeviceProperty(CORBA::Any &send)
     if((*data_in).length() > 1)
     {
         int index = 0;
-        std::vector<t_device *>::iterator it;
-        it = find_if(m_server.devices.begin(), m_server.devices.end(), hasName<t_device>(string((*data_in)[index])));
+        t_device *dev = FileDatabaseExt::search(ext->devices, (*data_in)[index].in());
         index++;
-        if(it == m_server.devices.end())
+        if(dev == nullptr)
         {
             TANGO_LOG_DEBUG << "Nome device " << (*data_in)[0] << " non trovato. " << endl;
             return any;
         }
-        t_device &device_trovato = *(*(it));
 
         sscanf((*data_in)[1], "%6u", &n_properties);
         index++;
         for(unsigned int i = 0; i < n_properties; i++)
         {
-            std::vector<t_property *>::iterator prop_it;
-            prop_it = find_if(device_trovato.properties.begin(),
-                              device_trovato.properties.end(),
-                              hasName<t_property>(string((*data_in)[index])));
+            t_property *found_prop = ext->search_prop(dev, (*data_in)[index].in());
             index++;
-            if(prop_it != device_trovato.properties.end())
+            if(found_prop != nullptr)
             {
                 /* we found a  property */
-                t_property &prop = (*(*prop_it));
+                t_property &prop = *found_prop;
                 sscanf((*data_in)[index], "%6d", &n_values);
                 index++;
                 prop.value.resize(n_values);
@@ -1373,12 +1637,12 @@ CORBA::Any_var FileDatabase ::DbPutDeviceProperty(CORBA::Any &send)
                     temp_property->value.emplace_back((*data_in)[index]);
                     index++;
                 }
-                device_trovato.properties.push_back(temp_property);
+                ext->add_prop(dev, temp_property);
             }
         }
     }
 
-    write_file();
+    journal_update("DbPutDeviceProperty", *data_in);
     return any;
 }
 
@@ -1393,30 +1657,19 @@ CORBA::Any_var FileDatabase ::DbDeleteDeviceProperty(CORBA::Any &send)
     // for(unsigned int i = 0; i < (*data_in).length(); i++)
     //     TANGO_LOG << "(*data_in)[" << i << "] = " << (*data_in)[i] << endl;
 
-    std::vector<t_device *>::iterator it;
-    it = find_if(m_server.devices.begin(), m_server.devices.end(), hasName<t_device>(string((*data_in)[0])));
+    t_device *dev = FileDatabaseExt::search(ext->devices, (*data_in)[0].in());
 
-    if(it != m_server.devices.end())
+    if(dev != nullptr)
     {
         for(unsigned int i = 1; i < (*data_in).length(); i++)
         {
-            t_device &device_trovato = *(*(it));
-            std::vector<t_property *>::iterator itp;
-            itp = find_if(device_trovato.properties.begin(),
-                          device_trovato.properties.end(),
-                          hasName<t_property>(string((*data_in)[i])));
-
-            if(itp != device_trovato.properties.end())
-            {
-                delete *itp;
-                device_trovato.properties.erase(itp, itp + 1);
-            }
+            ext->delete_prop(dev, (*data_in)[i].in());
         }
     }
 
     CORBA::Any_var any = new CORBA::Any;
 
-    write_file();
+    journal_update("DbDeleteDeviceProperty", *data_in);
     return any;
 }
 
@@ -1443,11 +1696,9 @@ CORBA::Any_var FileDatabase ::DbGetDeviceAttributeProperty(CORBA::Any &send)
     (*data_out)[index] = to_corba_string(num_attr);
     index++;
 
-    std::vector<t_device *>::iterator dev_it;
-    dev_it = find_if(m_server.devices.begin(), m_server.devices.end(), hasName<t_device>(string((*data_in)[0])));
-    if(dev_it != m_server.devices.end())
+    t_device *dev = FileDatabaseExt::search(ext->devices, (*data_in)[0].in());
+    if(dev != nullptr)
     {
-        // TANGO_LOG << "Device " << (*dev_it)->name << " trovato." << endl;
         for(unsigned int k = 0; k < num_attr; k++)
         {
             data_out->length(index + 2);
@@ -1455,36 +1706,27 @@ CORBA::Any_var FileDatabase ::DbGetDeviceAttributeProperty(CORBA::Any &send)
             index++; // attribute name
             (*data_out)[index] = Tango::string_dup("0");
             index++; // number of properties
-            for(unsigned int j = 0; j < (*dev_it)->attribute_properties.size(); j++)
+
+            t_attribute_property *attr_prop = ext->search_attr_prop(dev, (*data_in)[k + 1].in());
+            if(attr_prop != nullptr)
             {
-                if(equalsIgnoreCase((*dev_it)->attribute_properties[j]->attribute_name, (*data_in)[k + 1].in()))
-                {
-                    // TANGO_LOG << "Proprieta' " << (*dev_it)->attribute_properties[j]->attribute_name << " trovata."
-                    // << endl;
-                    auto num_prop = (*dev_it)->attribute_properties[j]->properties.size();
+                auto num_prop = attr_prop->properties.size();
 
-                    (*data_out)[index - 1] = to_corba_string(num_prop);
+                (*data_out)[index - 1] = to_corba_string(num_prop);
+
+                for(unsigned int l = 0; l < num_prop; l++)
+                {
+                    const t_property &prop = *attr_prop->properties[l];
+                    data_out->length(index + 1 + 1 + prop.value.size());
+                    (*data_out)[index] = Tango::string_dup(prop.name.c_str());
+                    index++;
+                    (*data_out)[index] = to_corba_string(prop.value.size());
+                    index++;
 
-                    for(unsigned int l = 0; l < num_prop; l++)
+                    for(const auto &value : prop.value)
                     {
-                        data_out->length(index + 1 + 1 +
-                                         (*dev_it)->attribute_properties[j]->properties[l]->value.size());
-                        (*data_out)[index] =
-                            Tango::string_dup((*dev_it)->attribute_properties[j]->properties[l]->name.c_str());
-                        index++;
-                        auto num_attr_prop = (*dev_it)->attribute_properties[j]->properties[l]->value.size();
-                        (*data_out)[index] = to_corba_string(num_attr_prop);
+                        (*data_out)[index] = Tango::string_dup(value.c_str());
                         index++;
-
-                        for(unsigned int ii = 0; ii < (*dev_it)->attribute_properties[j]->properties[l]->value.size();
-                            ii++)
-                        {
-                            // TANGO_LOG << ii << " = " <<
-                            // (*dev_it)->attribute_properties[j]->properties[l]->value[ii].c_str() << endl;
-                            (*data_out)[index] =
-                                Tango::string_dup((*dev_it)->attribute_properties[j]->properties[l]->value[ii].c_str());
-                            index++;
-                        }
                     }
                 }
             }
@@ -1525,32 +1767,16 @@ CORBA::Any_var FileDatabase ::DbPutDeviceAttributeProperty(CORBA::Any &send)
 
     unsigned int index = 0;
 
-    std::vector<t_device *>::iterator dev_it;
-    dev_it = find_if(m_server.devices.begin(), m_server.devices.end(), hasName<t_device>(string((*data_in)[index])));
+    t_device *dev = FileDatabaseExt::search(ext->devices, (*data_in)[index].in());
     index++;
-    if(dev_it != m_server.devices.end())
+    if(dev != nullptr)
     {
         sscanf((*data_in)[index], "%6u", &num_attr);
         index++;
         for(unsigned int j = 0; j < num_attr; j++)
         {
-            t_attribute_property *temp_attribute_property;
-            std::vector<t_attribute_property *>::iterator attr_prop_it;
-            attr_prop_it = find_if((*dev_it)->attribute_properties.begin(),
-                                   (*dev_it)->attribute_properties.end(),
-                                   hasAttributeName<t_attribute_property>(string((*data_in)[index])));
-            if(attr_prop_it != (*dev_it)->attribute_properties.end())
-            {
-                temp_attribute_property = (*attr_prop_it);
-            }
-            else
-            {
-                // the property is not yet in the file: we add it
-                temp_attribute_property = new t_attribute_property;
-                temp_attribute_property->attribute_name = string((*data_in)[index]);
-                (*dev_it)->attribute_properties.push_back(temp_attribute_property);
-            }
-            // if (equalsIgnoreCase((*dev_it)->attribute_properties[j]->attribute_name, (*data_in)[index].in()))
+            // the property is added if it is not yet in the file
+            t_attribute_property *temp_attribute_property = ext->get_attr_prop(dev, (*data_in)[index].in());
 
             index++;
             sscanf((*data_in)[index], "%6u", &num_prop);
@@ -1579,7 +1805,7 @@ CORBA::Any_var FileDatabase ::DbPutDeviceAttributeProperty(CORBA::Any &send)
                         // );index++;
                         if(index >= data_in->length())
                         {
-                            write_file();
+                            journal_update("DbPutDeviceAttributeProperty", *data_in);
                             return any;
                         }
                         exist = true;
@@ -1602,14 +1828,14 @@ CORBA::Any_var FileDatabase ::DbPutDeviceAttributeProperty(CORBA::Any &send)
                     temp_attribute_property->properties.push_back(new_prop);
                     if(index >= data_in->length())
                     {
-                        write_file();
+                        journal_update("DbPutDeviceAttributeProperty", *data_in);
                         return any;
                     }
                 }
             }
         }
     }
-    write_file();
+    journal_update("DbPutDeviceAttributeProperty", *data_in);
     return any;
 }
 
@@ -1624,12 +1850,11 @@ CORBA::Any_var FileDatabase ::DbDeleteDeviceAttributeProperty(CORBA::Any &send)
     // for(unsigned int i = 0; i < (*data_in).length(); i++)
     //     TANGO_LOG << "(*data_in)[" << i << "] = " << (*data_in)[i] << endl;
 
-    std::vector<t_device *>::iterator it;
-    it = find_if(m_server.devices.begin(), m_server.devices.end(), hasName<t_device>(string((*data_in)[0])));
+    t_device *dev = FileDatabaseExt::search(ext->devices, (*data_in)[0].in());
 
-    if(it != m_server.devices.end())
+    if(dev != nullptr)
     {
-        t_device &device_trovato = *(*(it));
+        t_device &device_trovato = *dev;
         for(unsigned int j = 0; j < device_trovato.attribute_properties.size(); j++)
         {
             if(equalsIgnoreCase(device_trovato.attribute_properties[j]->attribute_name, (*data_in)[1].in()))
@@ -1652,7 +1877,7 @@ CORBA::Any_var FileDatabase ::DbDeleteDeviceAttributeProperty(CORBA::Any &send)
     }
 
     CORBA::Any_var any = new CORBA::Any;
-    write_file();
+    journal_update("DbDeleteDeviceAttributeProperty", *data_in);
     return any;
 }
 
@@ -1700,60 +1925,46 @@ CORBA::Any_var FileDatabase ::DbGetClassProperty(CORBA::Any &send)
     (*data_out)[index] = to_corba_string(num_prop);
     index++;
 
-    unsigned long nb_classes_defined = m_server.classes.size();
-    unsigned long i;
+    t_tango_class *cl = FileDatabaseExt::search(ext->classes, (*data_in)[0].in());
 
-    for(i = 0; i < nb_classes_defined; i++)
+    if(cl != nullptr)
     {
-        if(equalsIgnoreCase((*data_in)[0].in(), m_server.classes[i]->name))
+        for(unsigned int j = 1; j < (*data_in).length();
+            j++) // at index 0 is the name of the class, property names are following
         {
-            // m_server.classes[i] is the class we are looking for
-            for(unsigned int j = 1; j < (*data_in).length();
-                j++) // at index 0 is the name of the class, property names are following
+            t_property *prop = ext->search_prop(cl, (*data_in)[j].in());
+            if(prop != nullptr)
             {
-                unsigned long nb_prop_defined = m_server.classes[i]->properties.size();
-                unsigned long m;
-                for(m = 0; m < nb_prop_defined; m++)
-                {
-                    if(equalsIgnoreCase((*data_in)[j].in(), m_server.classes[i]->properties[m]->name))
-                    {
-                        auto num_val = m_server.classes[i]->properties[m]->value.size();
-                        seq_length = seq_length + 2 + num_val;
-                        (*data_out).length(seq_length);
-                        (*data_out)[index] = Tango::string_dup((*data_in)[j]);
-                        index++;
-                        (*data_out)[index] = to_corba_string(num_val);
-                        index++;
-                        for(unsigned int n = 0; n < num_val; n++)
-                        {
-                            (*data_out)[index] =
-                                Tango::string_dup(m_server.classes[i]->properties[m]->value[n].c_str());
-                            index++;
-                        }
-                        break;
-                    }
-                }
-
-                if(m == nb_prop_defined)
+                auto num_val = prop->value.size();
+                seq_length = seq_length + 2 + num_val;
+                (*data_out).length(seq_length);
+                (*data_out)[index] = Tango::string_dup((*data_in)[j]);
+                index++;
+                (*data_out)[index] = to_corba_string(num_val);
+                index++;
+                for(unsigned int n = 0; n < num_val; n++)
                 {
-                    // The requested property does not exist in the specified class
-                    seq_length = seq_length + 2;
-                    data_out->length(seq_length);
-                    // The requested property name is returned, followed by a 0,
-                    // meaning the length of this property value is 0 ( <=> class property not found )
-                    (*data_out)[index] = Tango::string_dup((*data_in)[j].in());
-                    index++;
-                    (*data_out)[index] = Tango::string_dup("0");
+                    (*data_out)[index] = Tango::string_dup(prop->value[n].c_str());
                     index++;
                 }
             }
-            break;
+            else
+            {
+                // The requested property does not exist in the specified class
+                seq_length = seq_length + 2;
+                data_out->length(seq_length);
+                // The requested property name is returned, followed by a 0,
+                // meaning the length of this property value is 0 ( <=> class property not found )
+                (*data_out)[index] = Tango::string_dup((*data_in)[j].in());
+                index++;
+                (*data_out)[index] = Tango::string_dup("0");
+                index++;
+            }
         }
     }
-
-    if(i == nb_classes_defined)
+    else
     {
-        for(i = 0; i < num_prop; i++)
+        for(unsigned int i = 0; i < num_prop; i++)
         {
             seq_length = seq_length + 2;
             data_out->length(seq_length);
@@ -1786,30 +1997,24 @@ CORBA::Any_var FileDatabase ::DbPutClassProperty(CORBA::Any &send)
     if((*data_in).length() > 1)
     {
         unsigned int index = 0;
-        std::vector<t_tango_class *>::iterator it;
-        it = find_if(
-            m_server.classes.begin(), m_server.classes.end(), hasName<t_tango_class>(string((*data_in)[index])));
+        t_tango_class *cl = FileDatabaseExt::search(ext->classes, (*data_in)[index].in());
         index++;
-        if(it == m_server.classes.end())
+        if(cl == nullptr)
         {
             TANGO_LOG_DEBUG << "Nome classe " << (*data_in)[0] << " non trovato. " << endl;
             return any;
         }
-        t_tango_class &classe_trovata = *(*(it));
 
         sscanf((*data_in)[index], "%6u", &n_properties);
         index++;
         for(unsigned int i = 0; i < n_properties; i++)
         {
-            std::vector<t_property *>::iterator prop_it;
-            prop_it = find_if(classe_trovata.properties.begin(),
-                              classe_trovata.properties.end(),
-                              hasName<t_property>(string((*data_in)[index])));
-            if(prop_it != classe_trovata.properties.end())
+            t_property *found_prop = ext->search_prop(cl, (*data_in)[index].in());
+            if(found_prop != nullptr)
             {
                 /* we found a  property */
                 index++;
-                t_property &prop = (*(*prop_it));
+                t_property &prop = *found_prop;
                 sscanf((*data_in)[index], "%6d", &n_values);
                 index++;
                 prop.value.resize(n_values);
@@ -1833,17 +2038,17 @@ CORBA::Any_var FileDatabase ::DbPutClassProperty(CORBA::Any &send)
                     temp_property->value.emplace_back((*data_in)[index]);
                     index++;
                 }
-                classe_trovata.properties.push_back(temp_property);
+                ext->add_prop(cl, temp_property);
                 if(index >= data_in->length())
                 {
-                    write_file();
+                    journal_update("DbPutClassProperty", *data_in);
                     return any;
                 }
             }
         }
     }
 
-    write_file();
+    journal_update("DbPutClassProperty", *data_in);
     return any;
 }
 
@@ -1858,29 +2063,18 @@ CORBA::Any_var FileDatabase ::DbDeleteClassProperty(CORBA::Any &send)
     //    for(unsigned int i = 0; i < (*data_in).length(); i++)
     //        TANGO_LOG << "(*data_in)[" << i << "] = " << (*data_in)[i] << endl;
 
-    std::vector<t_tango_class *>::iterator it;
-    it = find_if(m_server.classes.begin(), m_server.classes.end(), hasName<t_tango_class>(string((*data_in)[0])));
+    t_tango_class *cl = FileDatabaseExt::search(ext->classes, (*data_in)[0].in());
 
-    if(it != m_server.classes.end())
+    if(cl != nullptr)
     {
         for(unsigned int i = 1; i < (*data_in).length(); i++)
         {
-            t_tango_class &classe_trovata = *(*(it));
-            std::vector<t_property *>::iterator itp;
-            itp = find_if(classe_trovata.properties.begin(),
-                          classe_trovata.properties.end(),
-                          hasName<t_property>(string((*data_in)[i])));
-
-            if(itp != classe_trovata.properties.end())
-            {
-                delete *itp;
-                classe_trovata.properties.erase(itp, itp + 1);
-            }
+            ext->delete_prop(cl, (*data_in)[i].in());
         }
     }
 
     CORBA::Any_var any = new CORBA::Any;
-    write_file();
+    journal_update("DbDeleteClassProperty", *data_in);
     return any;
 }
 
@@ -1902,9 +2096,8 @@ CORBA::Any_var FileDatabase ::DbGetClassAttributeProperty(CORBA::Any &send)
     (*data_out)[1] = to_corba_string(num_attr);
     index++;
 
-    std::vector<t_tango_class *>::iterator it;
-    it = find_if(m_server.classes.begin(), m_server.classes.end(), hasName<t_tango_class>(string((*data_in)[0])));
-    if(it == m_server.classes.end())
+    t_tango_class *cl = FileDatabaseExt::search(ext->classes, (*data_in)[0].in());
+    if(cl == nullptr)
     {
         TANGO_LOG_DEBUG << "Nome classe " << (*data_in)[0] << " non trovato. " << endl;
         data_out->length(index + (num_attr * 2));
@@ -1919,8 +2112,6 @@ CORBA::Any_var FileDatabase ::DbGetClassAttributeProperty(CORBA::Any &send)
 
         return any;
     }
-    t_tango_class &classe_trovata = *(*(it));
-
     for(unsigned int k = 0; k < num_attr; k++)
     {
         data_out->length(index + 2);
@@ -1929,39 +2120,24 @@ CORBA::Any_var FileDatabase ::DbGetClassAttributeProperty(CORBA::Any &send)
         (*data_out)[index] = Tango::string_dup("0");
         index++;
 
-        for(unsigned int j = 0; j < classe_trovata.attribute_properties.size(); j++)
+        t_attribute_property *attr_prop = ext->search_attr_prop(cl, (*data_in)[k + 1].in());
+        if(attr_prop != nullptr)
         {
-            if(equalsIgnoreCase(classe_trovata.attribute_properties[j]->attribute_name, (*data_in)[k + 1].in()))
+            auto num_prop = attr_prop->properties.size();
+            (*data_out)[index - 1] = to_corba_string(num_prop);
+            for(unsigned int l = 0; l < num_prop; l++)
             {
-                auto num_prop = classe_trovata.attribute_properties[j]->properties.size();
-                // data_out->length(index + 2*num_prop);
-                (*data_out)[index - 1] = to_corba_string(num_prop);
-                for(unsigned int l = 0; l < classe_trovata.attribute_properties[j]->properties.size(); l++)
-                {
-                    data_out->length(index + 1 + 1 +
-                                     classe_trovata.attribute_properties[j]->properties[l]->value.size());
-                    (*data_out)[index] =
-                        Tango::string_dup(classe_trovata.attribute_properties[j]->properties[l]->name.c_str());
-                    index++;
+                const t_property &prop = *attr_prop->properties[l];
+                data_out->length(index + 1 + 1 + prop.value.size());
+                (*data_out)[index] = Tango::string_dup(prop.name.c_str());
+                index++;
+                (*data_out)[index] = to_corba_string(prop.value.size());
+                index++;
 
-                    auto num_attr_prop = classe_trovata.attribute_properties[j]->properties[l]->value.size();
-                    (*data_out)[index] = to_corba_string(num_attr_prop);
+                for(const auto &value : prop.value)
+                {
+                    (*data_out)[index] = Tango::string_dup(value.c_str());
                     index++;
-                    //(*data_out)[index] =
-                    // Tango::string_dup(classe_trovata.attribute_properties[j]->properties[l]->name.c_str());index++;
-                    // string temp_value("");
-                    if(classe_trovata.attribute_properties[j]->properties[l]->value.size() > 0)
-                    {
-                        // temp_value += classe_trovata.attribute_properties[j]->properties[l]->value[0];
-                        for(unsigned int m = 0; m < classe_trovata.attribute_properties[j]->properties[l]->value.size();
-                            m++)
-                        {
-                            (*data_out)[index] = Tango::string_dup(
-                                classe_trovata.attribute_properties[j]->properties[l]->value[m].c_str());
-                            index++;
-                            // temp_value +=  "\n" + classe_trovata.attribute_properties[j]->properties[l]->value[m];
-                        }
-                    }
                 }
             }
         }
@@ -1988,10 +2164,9 @@ CORBA::Any_var FileDatabase ::DbPutClassAttributeProperty(CORBA::Any &send)
 
     send >>= data_in;
 
-    std::vector<t_tango_class *>::iterator it;
-    it = find_if(m_server.classes.begin(), m_server.classes.end(), hasName<t_tango_class>(string((*data_in)[index])));
+    t_tango_class *cl = FileDatabaseExt::search(ext->classes, (*data_in)[index].in());
     index++;
-    if(it == m_server.classes.end())
+    if(cl == nullptr)
     {
         TANGO_LOG_DEBUG << "FILEDATABASE:  DbPutClassAttributeProperty class " << string((*data_in)[0]) << " not found."
                         << endl;
@@ -2000,27 +2175,11 @@ CORBA::Any_var FileDatabase ::DbPutClassAttributeProperty(CORBA::Any &send)
     {
         sscanf((*data_in)[index], "%6u", &num_attr);
         index++;
-        t_tango_class &classe_trovata = *(*(it));
-        t_attribute_property *temp_attribute_property;
-        std::vector<t_attribute_property *>::iterator attr_prop_it;
 
         for(unsigned int j = 0; j < num_attr; j++)
         {
-            // search an attribute property for this attribute
-            attr_prop_it = find_if(classe_trovata.attribute_properties.begin(),
-                                   classe_trovata.attribute_properties.end(),
-                                   hasAttributeName<t_attribute_property>(string((*data_in)[index])));
-            if(attr_prop_it != classe_trovata.attribute_properties.end())
-            {
-                temp_attribute_property = (*attr_prop_it);
-            }
-            else
-            {
-                // the property is not yet in the file: we add it
-                temp_attribute_property = new t_attribute_property;
-                temp_attribute_property->attribute_name = string((*data_in)[index]);
-                classe_trovata.attribute_properties.push_back(temp_attribute_property);
-            }
+            // the property is added if it is not yet in the file
+            t_attribute_property *temp_attribute_property = ext->get_attr_prop(cl, (*data_in)[index].in());
             index++;
             sscanf((*data_in)[index], "%6u", &num_prop);
             index++;
@@ -2048,7 +2207,7 @@ CORBA::Any_var FileDatabase ::DbPutClassAttributeProperty(CORBA::Any &send)
                         //);index++;
                         if(index >= data_in->length())
                         {
-                            write_file();
+                            journal_update("DbPutClassAttributeProperty", *data_in);
                             return any;
                         }
                         exist = true;
@@ -2071,7 +2230,7 @@ CORBA::Any_var FileDatabase ::DbPutClassAttributeProperty(CORBA::Any &send)
                     temp_attribute_property->properties.push_back(new_prop);
                     if(index >= data_in->length())
                     {
-                        write_file();
+                        journal_update("DbPutClassAttributeProperty", *data_in);
                         return any;
                     }
                 }
@@ -2079,7 +2238,7 @@ CORBA::Any_var FileDatabase ::DbPutClassAttributeProperty(CORBA::Any &send)
         }
     }
 
-    write_file();
+    journal_update("DbPutClassAttributeProperty", *data_in);
     return any;
 }
 
@@ -2102,22 +2261,16 @@ CORBA::Any_var FileDatabase ::DbGetDeviceList(CORBA::Any &send)
     {
         if(equalsIgnoreCase((*data_in)[0].in(), m_server.name + "/" + m_server.instance_name))
         {
-            unsigned int i;
-            for(i = 0; i < m_server.classes.size(); i++)
+            t_tango_class *cl = FileDatabaseExt::search(ext->classes, (*data_in)[1].in());
+            if(cl != nullptr)
             {
-                // if ( strcmp((*data_in)[1], m_server.classes[i]->name.c_str()) == 0 )
-                if(equalsIgnoreCase((*data_in)[1].in(), m_server.classes[i]->name))
+                data_out->length(cl->devices.size());
+                for(unsigned int j = 0; j < cl->devices.size(); j++)
                 {
-                    data_out->length(m_server.classes[i]->devices.size());
-                    for(unsigned int j = 0; j < m_server.classes[i]->devices.size(); j++)
-                    {
-                        (*data_out)[j] = Tango::string_dup(m_server.classes[i]->devices[j]->name.c_str());
-                    }
-                    break;
+                    (*data_out)[j] = Tango::string_dup(cl->devices[j]->name.c_str());
                 }
             }
-
-            if(i == m_server.classes.size())
+            else
             {
                 delete data_out;
 
@@ -2325,7 +2478,6 @@ CORBA::Any_var FileDatabase::DbGetProperty(CORBA::Any &send)
 
     auto *data_out = new DevVarStringArray;
 
-    const auto &free_objects = m_server.free_objects;
     const char *obj_name = (*data_in)[0].in();
 
     unsigned long num_prop = data_in->length() - 1;
@@ -2350,13 +2502,10 @@ CORBA::Any_var FileDatabase::DbGetProperty(CORBA::Any &send)
     (*data_out)[out_index] = to_corba_string(num_prop);
     out_index++;
 
-    auto obj = std::find_if(free_objects.begin(), free_objects.end(), hasName<t_free_object>(obj_name));
-    std::vector<t_property *> empty_prop_list;
-
     // If the free object isn't in the database, then we pretend we are
     // referencing a free object with no properties.  This is the same behaviour
     // as TangoDatabase.
-    const auto &prop_list = obj != free_objects.end() ? (*obj)->properties : empty_prop_list;
+    t_free_object *obj = FileDatabaseExt::search(ext->free_objects, obj_name);
 
     for(CORBA::ULong j = 1; j < data_in->length(); ++j)
     {
@@ -2364,9 +2513,9 @@ CORBA::Any_var FileDatabase::DbGetProperty(CORBA::Any &send)
         (*data_out)[out_index] = Tango::string_dup(prop_name);
         out_index++;
 
-        auto prop = std::find_if(prop_list.begin(), prop_list.end(), hasName<t_property>(prop_name));
+        t_property *prop = obj != nullptr ? ext->search_prop(obj, prop_name) : nullptr;
 
-        if(prop == prop_list.end())
+        if(prop == nullptr)
         {
             (*data_out)[out_index] = Tango::string_dup("0");
             out_index++;
@@ -2378,7 +2527,7 @@ CORBA::Any_var FileDatabase::DbGetProperty(CORBA::Any &send)
         }
         else
         {
-            const auto &value = (*prop)->value;
+            const auto &value = prop->value;
             size_t value_len = value.size();
             if(value_len > 1)
             {
@@ -2437,18 +2586,17 @@ CORBA::Any_var FileDatabase::DbPutProperty(CORBA::Any &send)
         TANGO_THROW_EXCEPTION(API_InvalidCorbaAny, ss.str().c_str());
     }
 
-    auto &free_objects = m_server.free_objects;
     const char *obj_name = (*data_in)[0].in();
 
-    auto obj = std::find_if(free_objects.begin(), free_objects.end(), hasName<t_free_object>(obj_name));
+    t_free_object *obj = FileDatabaseExt::search(ext->free_objects, obj_name);
 
-    if(obj == free_objects.end())
+    if(obj == nullptr)
     {
-        obj = free_objects.insert(free_objects.end(), new t_free_object{obj_name, {}});
+        obj = new t_free_object{obj_name, {}};
+        m_server.free_objects.push_back(obj);
+        FileDatabaseExt::add(ext->free_objects, obj);
     }
 
-    auto &prop_list = (*obj)->properties;
-
     unsigned int n_properties = 0;
     sscanf((*data_in)[1], "%6u", &n_properties);
     unsigned int index = 2;
@@ -2458,18 +2606,19 @@ CORBA::Any_var FileDatabase::DbPutProperty(CORBA::Any &send)
         const char *prop_name = (*data_in)[index].in();
         index++;
 
-        auto prop = std::find_if(prop_list.begin(), prop_list.end(), hasName<t_property>(prop_name));
+        t_property *prop = ext->search_prop(obj, prop_name);
 
-        if(prop == prop_list.end())
+        if(prop == nullptr)
         {
-            prop = prop_list.insert(prop_list.end(), new t_property{prop_name, {}});
+            prop = new t_property{prop_name, {}};
+            ext->add_prop(obj, prop);
         }
 
         unsigned int n_values = 0;
         sscanf((*data_in)[index], "%6u", &n_values);
         index++;
 
-        auto &value = (*prop)->value;
+        auto &value = prop->value;
         value.resize(n_values);
 
         for(unsigned int j = 0; j < n_values; j++)
@@ -2479,7 +2628,7 @@ CORBA::Any_var FileDatabase::DbPutProperty(CORBA::Any &send)
         }
     }
 
-    write_file();
+    journal_update("DbPutProperty", *data_in);
 
     return {};
 }
@@ -2516,34 +2665,21 @@ CORBA::Any_var FileDatabase::DbDeleteProperty(CORBA::Any &send)
         TANGO_THROW_EXCEPTION(API_InvalidArgs, ss.str().c_str());
     }
 
-    auto &free_objects = m_server.free_objects;
     const char *obj_name = (*data_in)[0].in();
 
-    auto obj = std::find_if(free_objects.begin(), free_objects.end(), hasName<t_free_object>(obj_name));
+    t_free_object *obj = FileDatabaseExt::search(ext->free_objects, obj_name);
 
-    if(obj == free_objects.end())
+    if(obj == nullptr)
     {
         return {};
     }
 
-    auto &prop_list = (*obj)->properties;
-
     for(CORBA::ULong i = 1; i < data_in->length(); ++i)
     {
-        const char *prop_name = (*data_in)[i].in();
-
-        auto prop = std::find_if(prop_list.begin(), prop_list.end(), hasName<t_property>(prop_name));
-
-        if(prop == prop_list.end())
-        {
-            continue;
-        }
-
-        delete *prop;
-        prop_list.erase(prop);
+        ext->delete_prop(obj, (*data_in)[i].in());
     }
 
-    write_file();
+    journal_update("DbDeleteProperty", *data_in);
 
     return {};
 }
@@ -2619,22 +2755,17 @@ void FileDatabase::write_event_channel_ior(const string &ior_string)
     // Do we already have this info in file?
     //
 
-    unsigned int i;
+    t_tango_class *cl = FileDatabaseExt::search(ext->classes, NOTIFD_CHANNEL);
 
-    for(i = 0; i < m_server.classes.size(); i++)
+    if(cl != nullptr)
     {
-        if(equalsIgnoreCase(NOTIFD_CHANNEL, m_server.classes[i]->name))
-        {
-            //
-            // Yes, we have it, simply replace the old IOR by the new one (as device name!)
-            //
+        //
+        // Yes, we have it, simply replace the old IOR by the new one (as device name!)
+        //
 
-            m_server.classes[i]->devices[0]->name = ior_string;
-            break;
-        }
+        cl->devices[0]->name = ior_string;
     }
-
-    if(i == m_server.classes.size())
+    else
     {
         //
         // Add the pseudo notifd channel class
@@ -2647,6 +2778,7 @@ void FileDatabase::write_event_channel_ior(const string &ior_string)
         tg_cl->name = NOTIFD_CHANNEL;
 
         m_server.classes.push_back(tg_cl);
+        FileDatabaseExt::add(ext->classes, tg_cl);
     }
 }
 
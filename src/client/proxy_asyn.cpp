@@ -145,12 +145,12 @@ long Connection::command_inout_asynch(const std::string &command, const DeviceDa
 
     if(version >= 4)
     {
-        request->add_in_arg() <<= source;
+        request->add_in_arg() <<= source.load();
         request->add_in_arg() <<= get_client_identification();
     }
     else if(version >= 2)
     {
-        request->add_in_arg() <<= source;
+        request->add_in_arg() <<= source.load();
     }
 
     request->set_return_type(CORBA::_tc_any);
@@ -824,7 +824,7 @@ long DeviceProxy::read_attributes_asynch(const std::vector<std::string> &attr_na
     {
         request = Connection::device_5->_request("read_attributes_5");
         request->add_in_arg() <<= names;
-        request->add_in_arg() <<= source;
+        request->add_in_arg() <<= source.load();
         request->add_in_arg() <<= get_client_identification();
         request->set_return_type(Tango::_tc_AttributeValueList_5);
     }
@@ -832,7 +832,7 @@ long DeviceProxy::read_attributes_asynch(const std::vector<std::string> &attr_na
     {
         request = Connection::device_4->_request("read_attributes_4");
         request->add_in_arg() <<= names;
-        request->add_in_arg() <<= source;
+        request->add_in_arg() <<= source.load();
         request->add_in_arg() <<= get_client_identification();
         request->set_return_type(Tango::_tc_AttributeValueList_4);
     }
@@ -840,14 +840,14 @@ long DeviceProxy::read_attributes_asynch(const std::vector<std::string> &attr_na
     {
         request = Connection::device_3->_request("read_attributes_3");
         request->add_in_arg() <<= names;
-        request->add_in_arg() <<= source;
+        request->add_in_arg() <<= source.load();
         request->set_return_type(Tango::_tc_AttributeValueList_3);
     }
     else if(version == 2)
     {
         request = device_2->_request("read_attributes_2");
         request->add_in_arg() <<= names;
-        request->add_in_arg() <<= source;
+        request->add_in_arg() <<= source.load();
         request->set_return_type(Tango::_tc_AttributeValueList);
     }
     else
@@ -129,12 +129,12 @@ void Connection::command_inout_asynch(const std::string &command, const DeviceDa
 
     if(version >= 4)
     {
-        req_seq[0]->add_in_arg() <<= source;
+        req_seq[0]->add_in_arg() <<= source.load();
         req_seq[0]->add_in_arg() <<= get_client_identification();
     }
     else if(version >= 2)
     {
-        req_seq[0]->add_in_arg() <<= source;
+        req_seq[0]->add_in_arg() <<= source.load();
     }
 
     req_seq[0]->set_return_type(CORBA::_tc_any);
@@ -1161,7 +1161,7 @@ void DeviceProxy::read_attributes_asynch(const std::vector<std::string> &attr_na
     {
         req_seq[0] = Connection::device_5->_request("read_attributes_5");
         req_seq[0]->add_in_arg() <<= names;
-        req_seq[0]->add_in_arg() <<= source;
+        req_seq[0]->add_in_arg() <<= source.load();
         req_seq[0]->add_in_arg() <<= get_client_identification();
         req_seq[0]->set_return_type(Tango::_tc_AttributeValueList_5);
     }
@@ -1169,7 +1169,7 @@ void DeviceProxy::read_attributes_asynch(const std::vector<std::string> &attr_na
     {
         req_seq[0] = Connection::device_4->_request("read_attributes_4");
         req_seq[0]->add_in_arg() <<= names;
-        req_seq[0]->add_in_arg() <<= source;
+        req_seq[0]->add_in_arg() <<= source.load();
         req_seq[0]->add_in_arg() <<= get_client_identification();
         req_seq[0]->set_return_type(Tango::_tc_AttributeValueList_4);
     }
@@ -1177,14 +1177,14 @@ void DeviceProxy::read_attributes_asynch(const std::vector<std::string> &attr_na
     {
         req_seq[0] = Connection::device_3->_request("read_attributes_3");
         req_seq[0]->add_in_arg() <<= names;
-        req_seq[0]->add_in_arg() <<= source;
+        req_seq[0]->add_in_arg() <<= source.load();
         req_seq[0]->set_return_type(Tango::_tc_AttributeValueList_3);
     }
     else if(version == 2)
     {
         req_seq[0] = device_2->_request("read_attributes_2");
         req_seq[0]->add_in_arg() <<= names;
-        req_seq[0]->add_in_arg() <<= source;
+        req_seq[0]->add_in_arg() <<= source.load();
         req_seq[0]->set_return_type(Tango::_tc_AttributeValueList);
     }
     else
@@ -32,6 +32,9 @@
 
 #include <tango/internal/net.h>
 #include <tango/internal/utils.h>
+#include <tango/internal/attr_read_cache.h>
+#include <tango/internal/event_delta.h>
+#include <tango/internal/shm_ring.h>
 #include <tango/client/eventconsumer.h>
 #include <tango/client/event.h>
 #include <tango/server/auto_tango_monitor.h>
@@ -40,6 +43,7 @@
 
 #include <omniORB4/internal/giopStream.h>
 #include <tango/internal/perf_mon.h>
+#include <tango/internal/metrics.h>
 
 #ifdef _TG_WINDOWS_
   #include <winsock2.h>
@@ -128,7 +132,7 @@ struct PerfMonSample
     }
 };
 
-DoubleBuffer<PerfMonSample> g_perf_mon;
+SampleCollector<PerfMonSample> g_perf_mon;
 
 // Used to pass the sample into `push_zmq_event` from `run_undetached`
 PerfMonSample *g_current_perf_mon_sample = nullptr;
@@ -279,14 +283,13 @@ void *ZmqEventConsumer::run_undetached(TANGO_UNUSED(void *arg))
         // If `!do_sample_next_event` at the start of the loop, then we are not in
         // the middle of producing a performance sample, so we check with the
         // global variables if performance sampling is enabled.
-        if(!do_sample_next_event && g_perf_mon.lock.try_lock())
+        if(!do_sample_next_event)
         {
-            do_sample_next_event = g_perf_mon.enabled;
-            if(!g_perf_mon.enabled)
+            do_sample_next_event = g_perf_mon.is_enabled();
+            if(!do_sample_next_event)
             {
                 last_event_sampled_timestamp = {};
             }
-            g_perf_mon.lock.unlock();
         }
 
         //
@@ -375,8 +378,7 @@ void *ZmqEventConsumer::run_undetached(TANGO_UNUSED(void *arg))
             // pushing this one.
             bool do_sample_this_event = do_sample_next_event;
             do_sample_next_event = false;
-            SamplePusher<PerfMonSample> pusher{
-                do_sample_this_event, perf_mon_sample, *g_perf_mon.front, g_perf_mon.lock};
+            SamplePusher<PerfMonSample> pusher{do_sample_this_event, perf_mon_sample, g_perf_mon};
             TimeBlockMicros time_block{do_sample_this_event, &perf_mon_sample.process_micros};
 
             if(do_sample_this_event)
@@ -706,6 +708,28 @@ void ZmqEventConsumer::process_event(zmq::message_t &received_event_name,
     }
     receiv_call = &c_info_var.in();
 
+    //
+    // For an event received through the shm transport, the second byte of the endian message tells if the data
+    // message holds the location of the event data in the ring of the device server. The event data are then copied
+    // from the ring: they are modified in place while being decoded and the decoded value refers to them until the
+    // callbacks have been executed, while the slot may be reused at any time. An event whose data have already been
+    // overwritten is dropped and reported as missed with the next event.
+    //
+
+    if(received_endian.size() >= 2 && ((unsigned char *) received_endian.data())[1] == 1)
+    {
+        zmq::message_t shm_event_data;
+        if(!read_shm_event_data(event_data, shm_event_data))
+        {
+            TANGO_LOG_DEBUG << "Dropping event " << event_name << ", its data are not in the shm ring any more"
+                            << std::endl;
+            return;
+        }
+
+        push_zmq_event(event_name, endian, shm_event_data, receiv_call->call_is_except, receiv_call->ctr);
+        return;
+    }
+
     //
     // Call the event method
     //
@@ -713,6 +737,124 @@ void ZmqEventConsumer::process_event(zmq::message_t &received_event_name,
     push_zmq_event(event_name, endian, event_data, receiv_call->call_is_except, receiv_call->ctr);
 }
 
+//-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        ZmqEventConsumer::read_shm_event_data()
+//
+// description :
+//        Copy the data of an event received through the shm transport from the ring of the device server. The ring
+//        has been mapped when subscribing to the event (see query_shm_ring())
+//
+// argument :
+//        in :
+//            - ref_mess : The data message (the location of the data in the ring)
+//        out :
+//            - event_data : The event data
+//
+// return :
+//        False if the ring is not mapped or if the data have already been overwritten in the ring
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+bool ZmqEventConsumer::read_shm_event_data(const zmq::message_t &ref_mess, zmq::message_t &event_data)
+{
+    const size_t ref_size = detail::SHM_RING_REF_WORDS * sizeof(std::uint32_t);
+    if(ref_mess.size() != ref_size)
+    {
+        return false;
+    }
+
+    std::uint32_t words[detail::SHM_RING_REF_WORDS];
+    ::memcpy(words, ref_mess.data(), ref_size);
+    detail::ShmRingRef ref = detail::shm_ring_ref_from_words(words);
+
+    std::shared_ptr<detail::ShmRingReader> ring;
+    {
+        std::lock_guard<std::mutex> lg(shm_rings_mutex);
+        for(const auto &elem : shm_rings)
+        {
+            if(elem.second != nullptr && elem.second->get_key() == ref.key)
+            {
+                ring = elem.second;
+                break;
+            }
+        }
+    }
+
+    if(ring == nullptr)
+    {
+        return false;
+    }
+
+    bool valid = ring->read(ref,
+                            [&event_data](const char *data, size_t size)
+                            {
+                                event_data.rebuild(size);
+                                ::memcpy(event_data.data(), data, size);
+                            });
+
+    static auto &shm_values = detail::MetricsRegistry::instance().counter(detail::METRIC_CLIENT_SHM_VALUES);
+    static auto &overwritten = detail::MetricsRegistry::instance().counter(detail::METRIC_CLIENT_SHM_OVERWRITTEN);
+    (valid ? shm_values : overwritten).add();
+
+    return valid;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        ZmqEventConsumer::query_shm_ring()
+//
+// description :
+//        Ask a device server admin device for the ring of its shm transport and map it, if not already done. The
+//        ring replaces the one mapped for the previous run of the device server
+//
+// argument :
+//        in :
+//            - adm_dev : The device server admin device
+//
+// return :
+//        False if the device server does not have a ring or if the ring cannot be mapped (the device server runs on
+//        another host or for another user)
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+bool ZmqEventConsumer::query_shm_ring(DeviceProxy &adm_dev)
+{
+    std::string ring_name;
+    std::uint64_t key = 0;
+    try
+    {
+        DeviceData dd = adm_dev.command_inout("QueryShmTransport");
+        const DevVarLongStringArray *ring_info;
+        dd >> ring_info;
+        if(ring_info->lvalue.length() < 2 || ring_info->svalue.length() < 1)
+        {
+            return false;
+        }
+
+        key = (static_cast<std::uint64_t>(static_cast<DevULong>(ring_info->lvalue[0])) << 32) |
+              static_cast<DevULong>(ring_info->lvalue[1]);
+        ring_name = ring_info->svalue[0].in();
+    }
+    catch(DevFailed &e)
+    {
+        TANGO_LOG_DEBUG << "The shm transport is not available for " << adm_dev.dev_name() << ": "
+                        << e.errors[0].desc << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lg(shm_rings_mutex);
+    std::shared_ptr<detail::ShmRingReader> &ring = shm_rings[adm_dev.dev_name()];
+    if(ring == nullptr || ring->get_key() != key)
+    {
+        ring = detail::ShmRingReader::open(ring_name, key);
+    }
+
+    return ring != nullptr;
+}
+
 //-------------------------------------------------------------------------------------------------------------------
 //
 // method :
@@ -1555,6 +1697,8 @@ void ZmqEventConsumer::connect_event_channel(const std::string &channel_name,
         }
     }
 
+    std::string heartbeat_endpoint = get_connect_endpoint(ev_svr_data, valid_endpoint << 1);
+
     //
     // Create and connect the REQ socket used to send message to the ZMQ main thread
     //
@@ -1603,8 +1747,8 @@ void ZmqEventConsumer::connect_event_channel(const std::string &channel_name,
         buffer[length] = 0;
         length++;
 
-        ::strcpy(&(buffer[length]), ev_svr_data->svalue[valid_endpoint << 1].in());
-        length = length + ::strlen(ev_svr_data->svalue[valid_endpoint << 1].in()) + 1;
+        ::strcpy(&(buffer[length]), heartbeat_endpoint.c_str());
+        length = length + heartbeat_endpoint.size() + 1;
 
         std::string sub(event_channel_name);
         sub = sub + '.' + HEARTBEAT_EVENT_NAME;
@@ -1666,7 +1810,7 @@ void ZmqEventConsumer::connect_event_channel(const std::string &channel_name,
         evt_ch.last_heartbeat = Tango::get_current_system_datetime();
         evt_ch.heartbeat_skipped = false;
         evt_ch.event_system_failed = false;
-        evt_ch.endpoint = ev_svr_data->svalue[valid_endpoint << 1].in();
+        evt_ch.endpoint = heartbeat_endpoint;
         evt_ch.valid_endpoint = valid_endpoint;
 
         // We may need to update key in channel_map entry but to avoid iterator
@@ -1687,7 +1831,7 @@ void ZmqEventConsumer::connect_event_channel(const std::string &channel_name,
 
         new_event_channel_struct.event_system_failed = false;
         set_channel_type(new_event_channel_struct);
-        new_event_channel_struct.endpoint = ev_svr_data->svalue[valid_endpoint << 1].in();
+        new_event_channel_struct.endpoint = heartbeat_endpoint;
         new_event_channel_struct.valid_endpoint = valid_endpoint;
 
         channel_map[channel_name] = new_event_channel_struct;
@@ -1934,7 +2078,7 @@ void ZmqEventConsumer::connect_event_system(TANGO_UNUSED(const std::string &devi
         bool mcast_transport = false;
         ApiUtil *au = ApiUtil::instance();
 
-        std::string endpoint(ev_svr_data->svalue[(valid_end << 1) + 1].in());
+        std::string endpoint = get_connect_endpoint(ev_svr_data, (valid_end << 1) + 1);
         if(endpoint.find(MCAST_PROT) != std::string::npos)
         {
             mcast_transport = true;
@@ -2294,9 +2438,15 @@ void ZmqEventConsumer::push_zmq_event(
             evt_cb.ctr = ds_ctr;
             evt_cb.event_count++;
 
+            static auto &received = detail::MetricsRegistry::instance().counter(detail::METRIC_EVENTS_RECEIVED);
+            received.add();
+
             if(err_missed_event)
             {
                 evt_cb.missed_event_count++;
+
+                static auto &missed = detail::MetricsRegistry::instance().counter(detail::METRIC_EVENTS_MISSED);
+                missed.add(static_cast<std::uint64_t>(missed_event - 1));
             }
 
             //
@@ -2645,6 +2795,41 @@ void ZmqEventConsumer::push_zmq_event(
                                 {
                                     dev_attr->set_name(a_name);
                                 }
+
+                                //
+                                // For a delta encoded change event, rebuild the full value from the previous one
+                                //
+
+                                if(evt_cb.delta_decoder != nullptr)
+                                {
+                                    CORBA::ULong delta_kind;
+                                    DevVarULongArray delta_runs;
+                                    delta_kind <<= event_data_cdr;
+                                    delta_runs <<= event_data_cdr;
+
+                                    if(err_missed_event)
+                                    {
+                                        evt_cb.delta_decoder->reset();
+                                    }
+
+                                    if(!evt_cb.delta_decoder->decode(
+                                           static_cast<detail::EventDeltaKind>(delta_kind), delta_runs, *dev_attr))
+                                    {
+                                        delete dev_attr;
+                                        dev_attr = nullptr;
+
+                                        TangoSys_OMemStream o;
+                                        o << "Received a delta encoded event for " << ev_name
+                                          << " without the previous value. Waiting for the next full value"
+                                          << std::ends;
+
+                                        errors.length(1);
+                                        errors[0].reason = Tango::string_dup(API_WrongEventData);
+                                        errors[0].origin = Tango::string_dup(TANGO_EXCEPTION_ORIGIN);
+                                        errors[0].desc = Tango::string_dup(o.str().c_str());
+                                        errors[0].severity = Tango::ERR;
+                                    }
+                                }
                             }
                             catch(...)
                             {
@@ -2754,6 +2939,21 @@ void ZmqEventConsumer::push_zmq_event(
                 }
             }
 
+            //
+            // Feed the client attribute cache with the attribute value received
+            //
+
+            if(dev_attr != nullptr && errors.length() == 0 && !evt_cb.callback_list.empty())
+            {
+                auto &cache = detail::AttributeReadCache::instance();
+                DeviceProxy *device = evt_cb.callback_list.front().device;
+                if(cache.is_enabled() && device != nullptr)
+                {
+                    cache.store_from_event(detail::AttributeReadCache::make_key(device, dev_attr->get_name()),
+                                           *dev_attr);
+                }
+            }
+
             FwdEventData *missed_event_data = nullptr;
             FwdAttrConfEventData *missed_conf_event_data = nullptr;
             DataReadyEventData *missed_ready_event_data = nullptr;
@@ -2871,6 +3071,7 @@ void ZmqEventConsumer::push_zmq_event(
                                                                       cb_nb,
                                                                       cb_ctr,
                                                                       callback);
+                            event_dat->set_zmq_endian(endian);
 
                             if(g_current_perf_mon_sample != nullptr && first_callback &&
                                event_dat->attr_value != nullptr)
@@ -3232,6 +3433,79 @@ void ZmqEventConsumer::zmq_specific(DeviceData &dd,
     }
 }
 
+//--------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        ZmqEventConsumer::get_connect_endpoint()
+//
+// description :
+//        Return the endpoint to connect to for one of the endpoints returned by the ZMQEventSubscriptionChange DS
+//      admin device command. When the server runs on the same host and has also bound its publisher sockets to ipc
+//      endpoints (the server pid is then returned in the 7th long), the ipc endpoint is returned instead of the tcp
+//      one. Otherwise, the returned endpoint is used as it is.
+//
+// argument :
+//        in :
+//            - ev_svr_data : The data returned by the ZMQEventSubscriptionChange command
+//          - index : The endpoint index in the string part of ev_svr_data
+//
+// return :
+//      The endpoint to connect to
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+std::string ZmqEventConsumer::get_connect_endpoint(const DevVarLongStringArray *ev_svr_data, size_t index)
+{
+    std::string endpoint(ev_svr_data->svalue[index].in());
+
+#ifndef _TG_WINDOWS_
+    if(ev_svr_data->lvalue.length() < 7 || ev_svr_data->lvalue[6] == 0 ||
+       endpoint.find(MCAST_PROT) != std::string::npos)
+    {
+        return endpoint;
+    }
+
+    std::string ip, port;
+    try
+    {
+        detail::split_endpoint(endpoint, ip, port);
+    }
+    catch(Tango::DevFailed &)
+    {
+        return endpoint;
+    }
+
+    //
+    // Is the server running on this host?
+    //
+
+    bool local_host = ip.find("127.") == 0;
+    if(!local_host)
+    {
+        std::vector<std::string> adrs;
+        ApiUtil::instance()->get_ip_from_if(adrs);
+        local_host = std::find(adrs.begin(), adrs.end(), ip) != adrs.end();
+    }
+
+    if(local_host)
+    {
+        std::string ipc_endpoint = detail::get_local_ipc_endpoint(ev_svr_data->lvalue[6], port);
+
+        //
+        // 6 is the length of ipc://
+        //
+
+        if(!ipc_endpoint.empty() && ::access(ipc_endpoint.c_str() + 6, F_OK) == 0)
+        {
+            TANGO_LOG_DEBUG << "Using local endpoint " << ipc_endpoint << " for " << endpoint << std::endl;
+            return ipc_endpoint;
+        }
+    }
+#endif
+
+    return endpoint;
+}
+
 //--------------------------------------------------------------------------------------------------------------------
 //
 // method :
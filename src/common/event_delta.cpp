@@ -0,0 +1,398 @@
+#include <tango/internal/event_delta.h>
+
+#include <tango/client/DeviceAttribute.h>
+#include <tango/server/tango_clock.h>
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+namespace
+{
+
+template <typename Seq>
+using elt_type_t = std::remove_pointer_t<decltype(std::declval<Seq &>().get_buffer())>;
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// function :
+//        build_runs()
+//
+// description :
+//        Compare the new value with the previous one (bit per bit, NaN are equal) and build the runs of changed
+//        elements. Two changed elements separated by less unchanged elements than the size of one run are sent in the
+//        same run.
+//
+// return :
+//        The number of changed elements sent
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+template <typename Seq>
+std::size_t build_runs(const Seq &seq, const std::vector<unsigned char> &previous, Tango::DevVarULongArray &runs)
+{
+    using T = elt_type_t<Seq>;
+    constexpr std::size_t max_gap = std::max<std::size_t>(1, (2 * sizeof(CORBA::ULong)) / sizeof(T));
+
+    const std::size_t nb = seq.length();
+    const T *cur = seq.get_buffer();
+    const T *prev = reinterpret_cast<const T *>(previous.data());
+    auto same = [&](std::size_t i) { return ::memcmp(&cur[i], &prev[i], sizeof(T)) == 0; };
+
+    std::vector<CORBA::ULong> run_data;
+    std::size_t nb_changed = 0;
+    std::size_t i = 0;
+
+    while(i < nb)
+    {
+        if(same(i))
+        {
+            ++i;
+            continue;
+        }
+
+        std::size_t end = i + 1;
+        for(std::size_t j = end; j < nb && j - end <= max_gap; ++j)
+        {
+            if(!same(j))
+            {
+                end = j + 1;
+            }
+        }
+
+        run_data.push_back(static_cast<CORBA::ULong>(i));
+        run_data.push_back(static_cast<CORBA::ULong>(end - i));
+        nb_changed += end - i;
+        i = end;
+    }
+
+    runs.length(run_data.size());
+    std::copy(run_data.begin(), run_data.end(), runs.get_buffer());
+
+    return nb_changed;
+}
+
+template <typename Seq, typename Setter>
+Tango::detail::EventDeltaKind encode_seq(
+    const Seq &seq, bool full, std::vector<unsigned char> &previous, Tango::DevVarULongArray &runs, Setter set_changed)
+{
+    using T = elt_type_t<Seq>;
+    const std::size_t nb = seq.length();
+    Tango::detail::EventDeltaKind kind = Tango::detail::EventDeltaKind::FULL;
+
+    if(!full && previous.size() == nb * sizeof(T))
+    {
+        std::size_t nb_changed = build_runs(seq, previous, runs);
+
+        //
+        // Not worth it if the delta is not at least two times smaller than the value
+        //
+
+        if((nb_changed * sizeof(T) + runs.length() * sizeof(CORBA::ULong)) * 2 < nb * sizeof(T))
+        {
+            Seq changed(nb_changed);
+            changed.length(nb_changed);
+            T *dest = changed.get_buffer();
+            const T *src = seq.get_buffer();
+            for(CORBA::ULong loop = 0; loop < runs.length(); loop += 2)
+            {
+                ::memcpy(dest, src + runs[loop], runs[loop + 1] * sizeof(T));
+                dest += runs[loop + 1];
+            }
+
+            set_changed(changed);
+            kind = Tango::detail::EventDeltaKind::DELTA;
+        }
+    }
+
+    if(kind == Tango::detail::EventDeltaKind::FULL)
+    {
+        runs.length(0);
+    }
+
+    const auto *bytes = reinterpret_cast<const unsigned char *>(seq.get_buffer());
+    previous.assign(bytes, bytes + nb * sizeof(T));
+
+    return kind;
+}
+
+template <typename Seq>
+bool decode_seq(Tango::detail::EventDeltaKind kind,
+                const Tango::DevVarULongArray &runs,
+                typename Seq::_var_type &seq,
+                std::vector<unsigned char> &current)
+{
+    using T = elt_type_t<Seq>;
+    const T *received = seq->get_buffer();
+    const std::size_t received_nb = seq->length();
+
+    if(kind == Tango::detail::EventDeltaKind::FULL)
+    {
+        const auto *bytes = reinterpret_cast<const unsigned char *>(received);
+        current.assign(bytes, bytes + received_nb * sizeof(T));
+        return true;
+    }
+
+    if(current.empty())
+    {
+        return false;
+    }
+
+    const std::size_t nb = current.size() / sizeof(T);
+    T *cur = reinterpret_cast<T *>(current.data());
+    std::size_t offset = 0;
+
+    for(CORBA::ULong loop = 0; loop + 1 < runs.length(); loop += 2)
+    {
+        std::size_t start = runs[loop];
+        std::size_t len = runs[loop + 1];
+        if(start + len > nb || offset + len > received_nb)
+        {
+            current.clear();
+            return false;
+        }
+
+        ::memcpy(cur + start, received + offset, len * sizeof(T));
+        offset += len;
+    }
+
+    T *buf = Seq::allocbuf(nb);
+    ::memcpy(buf, cur, nb * sizeof(T));
+    seq = new Seq(nb, nb, buf, true);
+
+    return true;
+}
+
+} // anonymous namespace
+
+namespace Tango::detail
+{
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        EventDeltaEncoder::encode()
+//
+// description :
+//        Encode the value to be sent with a delta encoded change event
+//
+// argument :
+//        in :
+//            - value : The attribute value sent to the clients
+//        out :
+//            - changed : The changed elements (for a DELTA)
+//            - runs : The (start, length) runs of the changed elements (for a DELTA)
+//
+// return :
+//        The kind of value to send: the full value or the changed elements only
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+EventDeltaKind EventDeltaEncoder::encode(const AttributeValue_5 &value, AttrValUnion &changed, DevVarULongArray &runs)
+{
+    const AttrValUnion &val = value.value;
+
+    bool full = full_requested.exchange(false);
+    full = full || value.data_format == SCALAR || val._d() != data_type || value.r_dim.dim_x != dim_x ||
+           value.r_dim.dim_y != dim_y || events_since_full >= EVENT_DELTA_FULL_PERIOD;
+
+    data_type = val._d();
+    dim_x = value.r_dim.dim_x;
+    dim_y = value.r_dim.dim_y;
+
+    EventDeltaKind kind = EventDeltaKind::FULL;
+    runs.length(0);
+
+    switch(val._d())
+    {
+    case ATT_BOOL:
+        kind = encode_seq(val.bool_att_value(),
+                          full,
+                          previous,
+                          runs,
+                          [&changed](const DevVarBooleanArray &seq) { changed.bool_att_value(seq); });
+        break;
+
+    case ATT_SHORT:
+        kind = encode_seq(val.short_att_value(),
+                          full,
+                          previous,
+                          runs,
+                          [&changed](const DevVarShortArray &seq) { changed.short_att_value(seq); });
+        break;
+
+    case ATT_LONG:
+        kind = encode_seq(val.long_att_value(),
+                          full,
+                          previous,
+                          runs,
+                          [&changed](const DevVarLongArray &seq) { changed.long_att_value(seq); });
+        break;
+
+    case ATT_LONG64:
+        kind = encode_seq(val.long64_att_value(),
+                          full,
+                          previous,
+                          runs,
+                          [&changed](const DevVarLong64Array &seq) { changed.long64_att_value(seq); });
+        break;
+
+    case ATT_FLOAT:
+        kind = encode_seq(val.float_att_value(),
+                          full,
+                          previous,
+                          runs,
+                          [&changed](const DevVarFloatArray &seq) { changed.float_att_value(seq); });
+        break;
+
+    case ATT_DOUBLE:
+        kind = encode_seq(val.double_att_value(),
+                          full,
+                          previous,
+                          runs,
+                          [&changed](const DevVarDoubleArray &seq) { changed.double_att_value(seq); });
+        break;
+
+    case ATT_UCHAR:
+        kind = encode_seq(val.uchar_att_value(),
+                          full,
+                          previous,
+                          runs,
+                          [&changed](const DevVarCharArray &seq) { changed.uchar_att_value(seq); });
+        break;
+
+    case ATT_USHORT:
+        kind = encode_seq(val.ushort_att_value(),
+                          full,
+                          previous,
+                          runs,
+                          [&changed](const DevVarUShortArray &seq) { changed.ushort_att_value(seq); });
+        break;
+
+    case ATT_ULONG:
+        kind = encode_seq(val.ulong_att_value(),
+                          full,
+                          previous,
+                          runs,
+                          [&changed](const DevVarULongArray &seq) { changed.ulong_att_value(seq); });
+        break;
+
+    case ATT_ULONG64:
+        kind = encode_seq(val.ulong64_att_value(),
+                          full,
+                          previous,
+                          runs,
+                          [&changed](const DevVarULong64Array &seq) { changed.ulong64_att_value(seq); });
+        break;
+
+    default:
+        previous.clear();
+        break;
+    }
+
+    events_since_full = kind == EventDeltaKind::FULL ? 0 : events_since_full + 1;
+
+    return kind;
+}
+
+void EventDeltaEncoder::subscribe(bool new_subscriber)
+{
+    last_subscription = Tango::get_current_system_datetime();
+    if(new_subscriber)
+    {
+        reset();
+    }
+}
+
+bool EventDeltaEncoder::is_subscribed() const
+{
+    time_t last = last_subscription;
+    return last != 0 && Tango::get_current_system_datetime() - last < EVENT_RESUBSCRIBE_PERIOD;
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        EventDeltaDecoder::decode()
+//
+// description :
+//        Rebuild the attribute value received with a delta encoded change event. For a FULL value, the value is only
+//        memorized. For a DELTA, the changed elements are copied in the memorized value which then replaces the
+//        received one in the DeviceAttribute.
+//
+// argument :
+//        in :
+//            - kind : The kind of value received
+//            - runs : The (start, length) runs of the changed elements
+//        in/out :
+//            - dev_attr : The DeviceAttribute built from the received event
+//
+// return :
+//        False if the value can't be rebuilt
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+bool EventDeltaDecoder::decode(EventDeltaKind kind, const DevVarULongArray &runs, DeviceAttribute &dev_attr)
+{
+    int type = dev_attr.get_type();
+    if(kind == EventDeltaKind::DELTA && type != data_type)
+    {
+        reset();
+        return false;
+    }
+    data_type = type;
+
+    bool ret = kind == EventDeltaKind::FULL;
+
+    switch(type)
+    {
+    case DEV_BOOLEAN:
+        ret = decode_seq<DevVarBooleanArray>(kind, runs, dev_attr.BooleanSeq, current);
+        break;
+
+    case DEV_SHORT:
+        ret = decode_seq<DevVarShortArray>(kind, runs, dev_attr.ShortSeq, current);
+        break;
+
+    case DEV_LONG:
+        ret = decode_seq<DevVarLongArray>(kind, runs, dev_attr.LongSeq, current);
+        break;
+
+    case DEV_LONG64:
+        ret = decode_seq<DevVarLong64Array>(kind, runs, dev_attr.Long64Seq, current);
+        break;
+
+    case DEV_FLOAT:
+        ret = decode_seq<DevVarFloatArray>(kind, runs, dev_attr.FloatSeq, current);
+        break;
+
+    case DEV_DOUBLE:
+        ret = decode_seq<DevVarDoubleArray>(kind, runs, dev_attr.DoubleSeq, current);
+        break;
+
+    case DEV_UCHAR:
+        ret = decode_seq<DevVarCharArray>(kind, runs, dev_attr.UCharSeq, current);
+        break;
+
+    case DEV_USHORT:
+        ret = decode_seq<DevVarUShortArray>(kind, runs, dev_attr.UShortSeq, current);
+        break;
+
+    case DEV_ULONG:
+        ret = decode_seq<DevVarULongArray>(kind, runs, dev_attr.ULongSeq, current);
+        break;
+
+    case DEV_ULONG64:
+        ret = decode_seq<DevVarULong64Array>(kind, runs, dev_attr.ULong64Seq, current);
+        break;
+
+    default:
+        current.clear();
+        break;
+    }
+
+    return ret;
+}
+
+} // namespace Tango::detail
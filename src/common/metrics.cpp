@@ -0,0 +1,378 @@
+#include <tango/internal/metrics.h>
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(_MSC_VER)
+  #include <intrin.h>
+#endif
+
+namespace Tango::detail
+{
+
+namespace
+{
+
+std::atomic<std::size_t> g_next_thread_shard{0};
+
+unsigned log2_floor(std::uint64_t value) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return 63u - static_cast<unsigned>(__builtin_clzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    unsigned result = 0;
+    while(value >>= 1)
+    {
+        ++result;
+    }
+    return result;
+#endif
+}
+
+void json_dump_string(std::ostream &os, const std::string &str)
+{
+    os << '"';
+    for(char c : str)
+    {
+        switch(c)
+        {
+        case '"':
+            os << "\\\"";
+            break;
+        case '\\':
+            os << "\\\\";
+            break;
+        default:
+            if(static_cast<unsigned char>(c) < 0x20)
+            {
+                os << ' ';
+            }
+            else
+            {
+                os << c;
+            }
+            break;
+        }
+    }
+    os << '"';
+}
+
+void json_dump_metric(std::ostream &os, bool &first, const std::string &name, const MetricLabels &labels)
+{
+    if(!first)
+    {
+        os << ",";
+    }
+    first = false;
+
+    os << "{\"name\":";
+    json_dump_string(os, name);
+    os << ",\"labels\":{";
+    for(std::size_t i = 0; i < labels.size(); ++i)
+    {
+        if(i != 0)
+        {
+            os << ",";
+        }
+        json_dump_string(os, labels[i].first);
+        os << ":";
+        json_dump_string(os, labels[i].second);
+    }
+    os << "}";
+}
+
+} // namespace
+
+std::size_t metrics_shard_index() noexcept
+{
+    // Threads are given a shard in turn, the first threads created (e.g. the ORB threads) do not share a shard
+    thread_local const std::size_t index =
+        g_next_thread_shard.fetch_add(1, std::memory_order_relaxed) % METRICS_SHARDS;
+    return index;
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// Counter
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+std::uint64_t Counter::value() const noexcept
+{
+    std::uint64_t result = 0;
+    for(const auto &shard : shards)
+    {
+        result += shard.value.load(std::memory_order_relaxed);
+    }
+    return result;
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// Histogram
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+std::size_t Histogram::bucket_index(std::uint64_t value) noexcept
+{
+    constexpr std::uint64_t sub_buckets = std::uint64_t{1} << SUB_BUCKET_BITS;
+
+    if(value < sub_buckets)
+    {
+        return static_cast<std::size_t>(value);
+    }
+
+    const unsigned exponent = std::min(log2_floor(value), MAX_BITS - 1);
+    if(exponent == MAX_BITS - 1 && value >= (std::uint64_t{1} << MAX_BITS))
+    {
+        return BUCKETS - 1;
+    }
+
+    const unsigned shift = exponent - SUB_BUCKET_BITS;
+    const std::size_t sub_bucket = static_cast<std::size_t>((value >> shift) & (sub_buckets - 1));
+    return (static_cast<std::size_t>(shift + 1) << SUB_BUCKET_BITS) + sub_bucket;
+}
+
+std::uint64_t Histogram::bucket_upper_bound(std::size_t index) noexcept
+{
+    constexpr std::size_t sub_buckets = std::size_t{1} << SUB_BUCKET_BITS;
+
+    if(index < sub_buckets)
+    {
+        return index;
+    }
+
+    const unsigned shift = static_cast<unsigned>(index >> SUB_BUCKET_BITS) - 1;
+    const std::uint64_t lower = static_cast<std::uint64_t>(sub_buckets + (index & (sub_buckets - 1))) << shift;
+    return lower + (std::uint64_t{1} << shift) - 1;
+}
+
+Histogram::Histogram(std::size_t nb_shards) :
+    nb_shards(std::max<std::size_t>(nb_shards, 1)),
+    shards(new Shard[this->nb_shards])
+{
+}
+
+void Histogram::record(std::uint64_t value) noexcept
+{
+    auto &shard = shards[metrics_shard_index() % nb_shards];
+
+    shard.buckets[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+    shard.sum.fetch_add(value, std::memory_order_relaxed);
+
+    std::uint64_t max = shard.max.load(std::memory_order_relaxed);
+    while(value > max && !shard.max.compare_exchange_weak(max, value, std::memory_order_relaxed))
+    {
+    }
+}
+
+HistogramSnapshot Histogram::snapshot() const
+{
+    HistogramSnapshot result;
+    for(std::size_t index = 0; index < nb_shards; ++index)
+    {
+        const Shard &shard = shards[index];
+        for(std::size_t i = 0; i < BUCKETS; ++i)
+        {
+            std::uint64_t nb = shard.buckets[i].load(std::memory_order_relaxed);
+            result.buckets[i] += nb;
+            result.count += nb;
+        }
+        result.sum += shard.sum.load(std::memory_order_relaxed);
+        result.max = std::max(result.max, shard.max.load(std::memory_order_relaxed));
+    }
+    return result;
+}
+
+std::uint64_t HistogramSnapshot::quantile(double q) const noexcept
+{
+    if(count == 0)
+    {
+        return 0;
+    }
+
+    // rank of the value in [1, count]
+    auto rank = static_cast<std::uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(count)));
+    rank = std::clamp<std::uint64_t>(rank, 1, count);
+
+    std::uint64_t seen = 0;
+    for(std::size_t i = 0; i < buckets.size(); ++i)
+    {
+        seen += buckets[i];
+        if(seen >= rank)
+        {
+            return std::min(Histogram::bucket_upper_bound(i), max);
+        }
+    }
+    return max;
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// MetricsRegistry
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+MetricsRegistry &MetricsRegistry::instance()
+{
+    // Never destroyed: the metrics can be updated by threads still running when the process exits
+    static auto *registry = new MetricsRegistry;
+    return *registry;
+}
+
+template <typename M, typename... Args>
+M &MetricsRegistry::get_or_create(std::map<Key, std::unique_ptr<M>> &metrics,
+                                  const std::string &name,
+                                  const MetricLabels &labels,
+                                  Args... args)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto &metric = metrics[Key{name, labels}];
+    if(!metric)
+    {
+        metric = std::make_unique<M>(args...);
+    }
+    return *metric;
+}
+
+template <typename M>
+void MetricsRegistry::remove_from(std::map<Key, std::unique_ptr<M>> &metrics,
+                                  const std::string &label,
+                                  const std::string &value)
+{
+    for(auto ite = metrics.begin(); ite != metrics.end();)
+    {
+        const MetricLabels &labels = ite->first.second;
+        if(std::find(labels.begin(), labels.end(), std::make_pair(label, value)) != labels.end())
+        {
+            ite = metrics.erase(ite);
+        }
+        else
+        {
+            ++ite;
+        }
+    }
+}
+
+Counter &MetricsRegistry::counter(const std::string &name, const MetricLabels &labels)
+{
+    return get_or_create(counters, name, labels);
+}
+
+Gauge &MetricsRegistry::gauge(const std::string &name, const MetricLabels &labels)
+{
+    return get_or_create(gauges, name, labels);
+}
+
+Histogram &MetricsRegistry::histogram(const std::string &name, const MetricLabels &labels, std::size_t nb_shards)
+{
+    return get_or_create(histograms, name, labels, nb_shards);
+}
+
+void MetricsRegistry::remove(const std::string &label, const std::string &value)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    remove_from(counters, label, value);
+    remove_from(gauges, label, value);
+    remove_from(histograms, label, value);
+}
+
+void MetricsRegistry::for_each_counter(
+    const std::function<void(const std::string &, const MetricLabels &, std::uint64_t)> &f) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for(const auto &[key, metric] : counters)
+    {
+        f(key.first, key.second, metric->value());
+    }
+}
+
+void MetricsRegistry::for_each_gauge(
+    const std::function<void(const std::string &, const MetricLabels &, std::int64_t)> &f) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for(const auto &[key, metric] : gauges)
+    {
+        f(key.first, key.second, metric->value());
+    }
+}
+
+void MetricsRegistry::for_each_histogram(
+    const std::function<void(const std::string &, const MetricLabels &, const HistogramSnapshot &)> &f) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    for(const auto &[key, metric] : histograms)
+    {
+        f(key.first, key.second, metric->snapshot());
+    }
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        MetricsRegistry::json_dump()
+//
+// description :
+//        Write the metrics as a JSON object holding three arrays: "counters", "gauges" and "histograms". The
+//        histograms are summarized by their count, sum, max and some quantiles, followed by their non empty
+//        buckets as [upper bound, count] pairs.
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+void MetricsRegistry::json_dump(std::ostream &os) const
+{
+    bool first = true;
+
+    os << "{\"counters\":[";
+    for_each_counter(
+        [&os, &first](const std::string &name, const MetricLabels &labels, std::uint64_t value)
+        {
+            json_dump_metric(os, first, name, labels);
+            os << ",\"value\":" << value << "}";
+        });
+
+    first = true;
+    os << "],\"gauges\":[";
+    for_each_gauge(
+        [&os, &first](const std::string &name, const MetricLabels &labels, std::int64_t value)
+        {
+            json_dump_metric(os, first, name, labels);
+            os << ",\"value\":" << value << "}";
+        });
+
+    first = true;
+    os << "],\"histograms\":[";
+    for_each_histogram(
+        [&os, &first](const std::string &name, const MetricLabels &labels, const HistogramSnapshot &snapshot)
+        {
+            json_dump_metric(os, first, name, labels);
+            os << ",\"count\":" << snapshot.count << ",\"sum\":" << snapshot.sum << ",\"max\":" << snapshot.max;
+            os << ",\"p50\":" << snapshot.quantile(0.5) << ",\"p90\":" << snapshot.quantile(0.9)
+               << ",\"p99\":" << snapshot.quantile(0.99);
+            os << ",\"buckets\":[";
+            bool first_bucket = true;
+            for(std::size_t i = 0; i < snapshot.buckets.size(); ++i)
+            {
+                if(snapshot.buckets[i] == 0)
+                {
+                    continue;
+                }
+                if(!first_bucket)
+                {
+                    os << ",";
+                }
+                first_bucket = false;
+                os << "[" << Histogram::bucket_upper_bound(i) << "," << snapshot.buckets[i] << "]";
+            }
+            os << "]}";
+        });
+    os << "]}";
+}
+
+} // namespace Tango::detail
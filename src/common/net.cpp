@@ -1,16 +1,24 @@
 #include <tango/internal/net.h>
+#include <tango/internal/utils.h>
 #include <tango/server/except.h>
 #include <tango/server/exception_reason_consts.h>
+#include <tango/server/logging.h>
 
 #ifdef _TG_WINDOWS_
   #include <ws2tcpip.h>
 #else
   #include <arpa/inet.h>
+  #include <dirent.h>
   #include <netdb.h>
   #include <sys/socket.h>
   #include <netinet/in.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
 #endif /* _TG_WINDOWS_ */
 
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
 #include <sstream>
 
 namespace Tango::detail
@@ -141,6 +149,107 @@ void split_endpoint(const std::string &endpoint, std::string &name, std::string
     port = port_temp;
 }
 
+std::string get_local_ipc_dir(TANGO_UNUSED(bool create))
+{
+#ifdef _TG_WINDOWS_
+    return "";
+#else
+    std::string dir;
+    const char *runtime_dir = std::getenv("XDG_RUNTIME_DIR");
+    if(runtime_dir != nullptr && runtime_dir[0] == '/')
+    {
+        dir = runtime_dir;
+    }
+    else
+    {
+        std::stringstream o;
+        o << "/tmp/tango-" << ::getuid();
+        dir = o.str();
+
+        if(create && ::mkdir(dir.c_str(), S_IRWXU) != 0 && errno != EEXIST)
+        {
+            TANGO_LOG_DEBUG << "Can't create the ipc directory " << dir << ": " << std::strerror(errno) << std::endl;
+            return "";
+        }
+    }
+
+    //
+    // The directory (and not a link to it) must belong to the current user, without access for the other users
+    //
+
+    struct stat st;
+    if(::lstat(dir.c_str(), &st) != 0 || !S_ISDIR(st.st_mode) || st.st_uid != ::getuid() ||
+       (st.st_mode & (S_IRWXG | S_IRWXO)) != 0)
+    {
+        return "";
+    }
+
+    return dir;
+#endif
+}
+
+std::string get_local_ipc_endpoint(long pid, const std::string &port)
+{
+    std::string dir = get_local_ipc_dir();
+    if(dir.empty())
+    {
+        return "";
+    }
+
+    std::stringstream o;
+    o << "ipc://" << dir << "/tango-zmq-" << pid << "-" << port;
+
+    return o.str();
+}
+
+void remove_stale_local_ipc_files()
+{
+#ifndef _TG_WINDOWS_
+    const char *prefix = "tango-zmq-";
+    const std::size_t prefix_size = std::strlen(prefix);
+
+    std::string dir_name = get_local_ipc_dir(true);
+    if(dir_name.empty())
+    {
+        return;
+    }
+
+    DIR *dir = ::opendir(dir_name.c_str());
+    if(dir == nullptr)
+    {
+        return;
+    }
+
+    while(struct dirent *entry = ::readdir(dir))
+    {
+        if(std::strncmp(entry->d_name, prefix, prefix_size) != 0)
+        {
+            continue;
+        }
+
+        char *end = nullptr;
+        long pid = std::strtol(entry->d_name + prefix_size, &end, 10);
+        if(end == entry->d_name + prefix_size || *end != '-' || is_process_running(pid))
+        {
+            continue;
+        }
+
+        //
+        // Only remove the files of the current user
+        //
+
+        std::string path = dir_name + '/' + entry->d_name;
+        struct stat st;
+        if(::lstat(path.c_str(), &st) == 0 && st.st_uid == ::getuid())
+        {
+            ::unlink(path.c_str());
+        }
+    }
+
+    ::closedir(dir);
+#endif
+}
+
 std::string qualify_host_address(std::string name, const std::string &port)
 {
     auto invalid_args_assert = [&name, &port](bool cond)
@@ -0,0 +1,195 @@
+#include <tango/internal/number_conversion.h>
+
+#include <charconv>
+#include <locale>
+#include <sstream>
+#include <type_traits>
+
+namespace
+{
+
+bool is_space(char c)
+{
+    return c == ' ' || (c >= '\t' && c <= '\r');
+}
+
+bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+template <typename T>
+const char *parse_float_with_stream(const char *first, const char *last, T &value)
+{
+    std::istringstream str(std::string(first, last));
+    str.imbue(std::locale::classic());
+    if(!(str >> value))
+    {
+        return nullptr;
+    }
+    return str.eof() ? last : first + static_cast<std::ptrdiff_t>(str.tellg());
+}
+
+template <typename T>
+const char *parse_float(const char *first, const char *last, T &value)
+{
+#if defined(TANGO_HAS_FLOAT_CHARCONV)
+    auto [ptr, ec] = std::from_chars(first, last, value);
+    if(ec == std::errc::result_out_of_range)
+    {
+        // The streams accept the values too small to be represented (giving 0) but not the too large ones
+        return parse_float_with_stream(first, last, value);
+    }
+    return ec == std::errc{} ? ptr : nullptr;
+#else
+    return parse_float_with_stream(first, last, value);
+#endif
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// function :
+//        parse()
+//
+// description :
+//        Parse the number at the beginning of [first, last) with the syntax accepted by the streams
+//
+// return :
+//        A pointer to the first character following the number or nullptr if there is no valid number
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+const char *parse(const char *first, const char *last, T &value)
+{
+    while(first != last && is_space(*first))
+    {
+        ++first;
+    }
+
+    bool negative = false;
+    const char *number = first;
+    if(first != last && (*first == '+' || *first == '-'))
+    {
+        negative = *first == '-';
+        ++first;
+        // std::from_chars() does not accept a plus sign
+        if(!negative)
+        {
+            number = first;
+        }
+    }
+
+    // Reject what std::from_chars() accepts but not the streams: a second sign, "nan" and "inf"
+    if(first == last || !(is_digit(*first) || (std::is_floating_point_v<T> && *first == '.')))
+    {
+        return nullptr;
+    }
+
+    T result{};
+    const char *ptr = nullptr;
+    if constexpr(std::is_floating_point_v<T>)
+    {
+        ptr = parse_float(number, last, result);
+        // The streams reject a number followed by an incomplete exponent ("1e" or "1e+")
+        if(ptr != nullptr && ptr != last && (*ptr == 'e' || *ptr == 'E'))
+        {
+            ptr = nullptr;
+        }
+    }
+    else if constexpr(std::is_unsigned_v<T>)
+    {
+        auto res = std::from_chars(first, last, result);
+        if(res.ec == std::errc{})
+        {
+            ptr = res.ptr;
+            if(negative)
+            {
+                result = static_cast<T>(0 - result);
+            }
+        }
+    }
+    else
+    {
+        auto res = std::from_chars(number, last, result);
+        if(res.ec == std::errc{})
+        {
+            ptr = res.ptr;
+        }
+    }
+
+    if(ptr != nullptr)
+    {
+        value = result;
+    }
+    return ptr;
+}
+
+} // namespace
+
+namespace Tango::detail
+{
+
+template <typename T>
+bool parse_number_prefix(std::string_view str, T &value)
+{
+    return parse(str.data(), str.data() + str.size(), value) != nullptr;
+}
+
+template <typename T>
+bool parse_number(std::string_view str, T &value)
+{
+    T result{};
+    const char *end = str.data() + str.size();
+    if(parse(str.data(), end, result) != end)
+    {
+        return false;
+    }
+    value = result;
+    return true;
+}
+
+template <typename T>
+std::string format_number(T value)
+{
+    if constexpr(std::is_floating_point_v<T>)
+    {
+#if defined(TANGO_HAS_FLOAT_CHARCONV)
+        // Same as printf("%.*g"), which the streams use
+        char buffer[64];
+        auto res = std::to_chars(
+            buffer, buffer + sizeof(buffer), value, std::chars_format::general, TANGO_FLOAT_PRECISION);
+        return std::string(buffer, res.ptr);
+#else
+        std::ostringstream str;
+        str.imbue(std::locale::classic());
+        str.precision(TANGO_FLOAT_PRECISION);
+        str << value;
+        return str.str();
+#endif
+    }
+    else
+    {
+        char buffer[32];
+        auto res = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        return std::string(buffer, res.ptr);
+    }
+}
+
+#define TANGO_INSTANTIATE_NUMBER_CONVERSION(T)                   \
+    template bool parse_number_prefix<T>(std::string_view, T &); \
+    template bool parse_number<T>(std::string_view, T &);        \
+    template std::string format_number<T>(T);
+
+TANGO_INSTANTIATE_NUMBER_CONVERSION(short)
+TANGO_INSTANTIATE_NUMBER_CONVERSION(unsigned short)
+TANGO_INSTANTIATE_NUMBER_CONVERSION(DevLong)
+TANGO_INSTANTIATE_NUMBER_CONVERSION(DevULong)
+TANGO_INSTANTIATE_NUMBER_CONVERSION(DevLong64)
+TANGO_INSTANTIATE_NUMBER_CONVERSION(DevULong64)
+TANGO_INSTANTIATE_NUMBER_CONVERSION(float)
+TANGO_INSTANTIATE_NUMBER_CONVERSION(double)
+
+#undef TANGO_INSTANTIATE_NUMBER_CONVERSION
+
+} // namespace Tango::detail
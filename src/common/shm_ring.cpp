@@ -0,0 +1,366 @@
+#include <tango/internal/shm_ring.h>
+#include <tango/internal/utils.h>
+#include <tango/server/except.h>
+#include <tango/server/exception_reason_consts.h>
+#include <tango/server/logging.h>
+
+#ifndef _TG_WINDOWS_
+  #include <dirent.h>
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <random>
+#include <sstream>
+
+namespace Tango::detail
+{
+
+namespace
+{
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "The shm ring needs lock free 64 bits atomics");
+
+constexpr std::uint64_t SHM_RING_MAGIC = 0x4d48534f474e4154; // "TANGOSHM"
+constexpr std::uint32_t SHM_RING_VERSION = 1;
+constexpr std::size_t SHM_RING_ALIGN = 64;
+constexpr const char *SHM_RING_PREFIX = "tango-shm-";
+
+//
+// Segment layout: the header, then the slots. Each slot starts with its sequence number, its data being aligned on
+// SHM_RING_ALIGN bytes
+//
+
+struct RingHeader
+{
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t nb_slots;
+    std::uint64_t slot_size;
+    std::uint64_t key;
+    alignas(SHM_RING_ALIGN) std::atomic<std::uint64_t> next_ticket;
+};
+
+constexpr std::size_t round_up(std::size_t size)
+{
+    return (size + SHM_RING_ALIGN - 1) & ~(SHM_RING_ALIGN - 1);
+}
+
+constexpr std::size_t HEADER_SIZE = round_up(sizeof(RingHeader));
+constexpr std::size_t SLOT_HEADER_SIZE = SHM_RING_ALIGN;
+
+std::size_t slot_stride(std::size_t slot_size)
+{
+    return SLOT_HEADER_SIZE + round_up(slot_size);
+}
+
+std::size_t segment_size(std::size_t nb_slots, std::size_t slot_size)
+{
+    return HEADER_SIZE + nb_slots * slot_stride(slot_size);
+}
+
+std::uint64_t new_key()
+{
+    std::random_device rd;
+    std::uint64_t key = 0;
+    while(key == 0)
+    {
+        key = (static_cast<std::uint64_t>(rd()) << 32) | rd();
+    }
+    return key;
+}
+
+} // anonymous namespace
+
+void shm_ring_ref_to_words(const ShmRingRef &ref, std::uint32_t *words)
+{
+    words[0] = static_cast<std::uint32_t>(ref.key >> 32);
+    words[1] = static_cast<std::uint32_t>(ref.key);
+    words[2] = ref.slot;
+    words[3] = static_cast<std::uint32_t>(ref.seq >> 32);
+    words[4] = static_cast<std::uint32_t>(ref.seq);
+    words[5] = static_cast<std::uint32_t>(ref.size >> 32);
+    words[6] = static_cast<std::uint32_t>(ref.size);
+}
+
+ShmRingRef shm_ring_ref_from_words(const std::uint32_t *words)
+{
+    ShmRingRef ref;
+    ref.key = (static_cast<std::uint64_t>(words[0]) << 32) | words[1];
+    ref.slot = words[2];
+    ref.seq = (static_cast<std::uint64_t>(words[3]) << 32) | words[4];
+    ref.size = (static_cast<std::uint64_t>(words[5]) << 32) | words[6];
+    return ref;
+}
+
+std::string get_shm_ring_name(long pid)
+{
+    std::stringstream ss;
+    ss << '/' << SHM_RING_PREFIX << pid;
+    return ss.str();
+}
+
+void remove_stale_shm_rings()
+{
+#ifdef __linux__
+    //
+    // The shared memory segments are only listed in /dev/shm on Linux
+    //
+
+    DIR *dir = ::opendir("/dev/shm");
+    if(dir == nullptr)
+    {
+        return;
+    }
+
+    const std::size_t prefix_size = std::strlen(SHM_RING_PREFIX);
+    while(struct dirent *entry = ::readdir(dir))
+    {
+        if(std::strncmp(entry->d_name, SHM_RING_PREFIX, prefix_size) != 0)
+        {
+            continue;
+        }
+
+        char *end = nullptr;
+        long pid = std::strtol(entry->d_name + prefix_size, &end, 10);
+        if(end == entry->d_name + prefix_size || *end != '\0' || is_process_running(pid))
+        {
+            continue;
+        }
+
+        //
+        // Only remove the segments of the current user
+        //
+
+        struct stat st;
+        std::string path("/dev/shm/");
+        path += entry->d_name;
+        if(::lstat(path.c_str(), &st) != 0 || st.st_uid != ::getuid())
+        {
+            continue;
+        }
+
+        TANGO_LOG_DEBUG << "Removing stale shared memory segment " << entry->d_name << std::endl;
+        std::string name("/");
+        name += entry->d_name;
+        ::shm_unlink(name.c_str());
+    }
+
+    ::closedir(dir);
+#endif
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// ShmRingWriter
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+ShmRingWriter::ShmRingWriter(const std::string &seg_name, std::size_t slots, std::size_t size) :
+    name(seg_name),
+    key(new_key()),
+    nb_slots(slots),
+    slot_size(size),
+    mapped_size(segment_size(slots, size))
+{
+#ifdef _TG_WINDOWS_
+    TANGO_THROW_EXCEPTION(API_NotSupported, "The shm transport is not supported on Windows");
+#else
+    if(nb_slots == 0 || slot_size == 0 || nb_slots > UINT32_MAX)
+    {
+        TANGO_THROW_EXCEPTION(API_InvalidArgs, "Wrong number of slots or slot size for the shm ring");
+    }
+
+    ::shm_unlink(name.c_str());
+
+    //
+    // Create the segment. Only the current user can map it, the clients of the other users get the events through
+    // the network
+    //
+
+    int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+    if(fd == -1)
+    {
+        std::stringstream ss;
+        ss << "Can't create the shared memory segment " << name << ": " << std::strerror(errno);
+        TANGO_THROW_EXCEPTION(API_SystemCallFailed, ss.str());
+    }
+
+    void *ptr = MAP_FAILED;
+    if(::fchmod(fd, S_IRUSR | S_IWUSR) == 0 && ::ftruncate(fd, static_cast<off_t>(mapped_size)) == 0)
+    {
+        ptr = ::mmap(nullptr, mapped_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+
+    int err = errno;
+    ::close(fd);
+
+    if(ptr == MAP_FAILED)
+    {
+        ::shm_unlink(name.c_str());
+
+        std::stringstream ss;
+        ss << "Can't map the shared memory segment " << name << " (" << mapped_size
+           << " bytes): " << std::strerror(err);
+        TANGO_THROW_EXCEPTION(API_SystemCallFailed, ss.str());
+    }
+
+    base = static_cast<char *>(ptr);
+
+    auto *header = new(base) RingHeader;
+    header->version = SHM_RING_VERSION;
+    header->nb_slots = static_cast<std::uint32_t>(nb_slots);
+    header->slot_size = slot_size;
+    header->key = key;
+    header->next_ticket.store(0, std::memory_order_relaxed);
+
+    for(std::size_t slot = 0; slot < nb_slots; ++slot)
+    {
+        new(base + HEADER_SIZE + slot * slot_stride(slot_size)) std::atomic<std::uint64_t>(0);
+    }
+
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = SHM_RING_MAGIC;
+#endif
+}
+
+ShmRingWriter::~ShmRingWriter()
+{
+#ifndef _TG_WINDOWS_
+    if(base != nullptr)
+    {
+        ::munmap(base, mapped_size);
+        ::shm_unlink(name.c_str());
+    }
+#endif
+}
+
+std::optional<ShmRingRef> ShmRingWriter::publish(const void *data, std::size_t size)
+{
+    if(base == nullptr || size > slot_size)
+    {
+        return std::nullopt;
+    }
+
+    auto *header = reinterpret_cast<RingHeader *>(base);
+
+    //
+    // Take the next slot. A slot still being written by another thread (which took it one turn of the ring before)
+    // is skipped
+    //
+
+    for(std::size_t attempt = 0; attempt < nb_slots; ++attempt)
+    {
+        std::uint64_t ticket = header->next_ticket.fetch_add(1, std::memory_order_relaxed);
+        auto slot = static_cast<std::uint32_t>(ticket % nb_slots);
+        char *slot_ptr = base + HEADER_SIZE + slot * slot_stride(slot_size);
+        auto *seq = reinterpret_cast<std::atomic<std::uint64_t> *>(slot_ptr);
+
+        std::uint64_t current = seq->load(std::memory_order_relaxed);
+        if((current & 1) != 0 || !seq->compare_exchange_strong(current, current | 1, std::memory_order_relaxed))
+        {
+            continue;
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+
+        std::memcpy(slot_ptr + SLOT_HEADER_SIZE, data, size);
+
+        ShmRingRef ref;
+        ref.key = key;
+        ref.slot = slot;
+        ref.seq = (ticket + 1) << 1;
+        ref.size = size;
+
+        seq->store(ref.seq, std::memory_order_release);
+        return ref;
+    }
+
+    return std::nullopt;
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// ShmRingReader
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+std::shared_ptr<ShmRingReader> ShmRingReader::open(TANGO_UNUSED(const std::string &seg_name),
+                                                   TANGO_UNUSED(std::uint64_t seg_key))
+{
+#ifdef _TG_WINDOWS_
+    return nullptr;
+#else
+    int fd = ::shm_open(seg_name.c_str(), O_RDONLY, 0);
+    if(fd == -1)
+    {
+        TANGO_LOG_DEBUG << "Can't open the shared memory segment " << seg_name << ": " << std::strerror(errno)
+                        << std::endl;
+        return nullptr;
+    }
+
+    struct stat st;
+    void *ptr = MAP_FAILED;
+    if(::fstat(fd, &st) == 0 && static_cast<std::size_t>(st.st_size) >= HEADER_SIZE)
+    {
+        ptr = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+
+    if(ptr == MAP_FAILED)
+    {
+        return nullptr;
+    }
+
+    std::shared_ptr<ShmRingReader> reader(new ShmRingReader());
+    reader->name = seg_name;
+    reader->mapped_size = static_cast<std::size_t>(st.st_size);
+    reader->base = static_cast<const char *>(ptr);
+
+    const auto *header = reinterpret_cast<const RingHeader *>(reader->base);
+    if(header->magic != SHM_RING_MAGIC || header->version != SHM_RING_VERSION || header->key != seg_key ||
+       header->nb_slots == 0 || segment_size(header->nb_slots, header->slot_size) > reader->mapped_size)
+    {
+        TANGO_LOG_DEBUG << "The shared memory segment " << seg_name << " is not the expected one" << std::endl;
+        return nullptr;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    reader->key = header->key;
+    reader->nb_slots = header->nb_slots;
+    reader->slot_size = header->slot_size;
+
+    return reader;
+#endif
+}
+
+ShmRingReader::~ShmRingReader()
+{
+#ifndef _TG_WINDOWS_
+    if(base != nullptr)
+    {
+        ::munmap(const_cast<char *>(base), mapped_size);
+    }
+#endif
+}
+
+const std::atomic<std::uint64_t> *ShmRingReader::get_slot_seq(const ShmRingRef &ref) const
+{
+    if(ref.key != key || ref.slot >= nb_slots || ref.size > slot_size)
+    {
+        return nullptr;
+    }
+
+    return reinterpret_cast<const std::atomic<std::uint64_t> *>(base + HEADER_SIZE + ref.slot * slot_stride(slot_size));
+}
+
+const char *ShmRingReader::get_slot_data(std::uint32_t slot) const
+{
+    return base + HEADER_SIZE + slot * slot_stride(slot_size) + SLOT_HEADER_SIZE;
+}
+
+} // namespace Tango::detail
@@ -5,7 +5,10 @@
 #include <tango/client/ApiUtil.h>
 
 #include <tango/internal/utils.h>
+#include <tango/internal/number_conversion.h>
 
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <variant>
 #include <regex>
@@ -55,6 +58,15 @@ const std::string Configuration::DEFAULT_HTTP_LOGS_ENDPOINT{"http://localhost:43
 
 const std::string Configuration::DEFAULT_CONSOLE_LOGS_ENDPOINT{"cout"};
 
+//-----------------------------------------------------------------------------------------
+//! The default endpoint to which metrics are exported
+//-----------------------------------------------------------------------------------------
+const std::string Configuration::DEFAULT_GRPC_METRICS_ENDPOINT{"grpc://localhost:4317"};
+
+const std::string Configuration::DEFAULT_HTTP_METRICS_ENDPOINT{"http://localhost:4318/v1/metrics"};
+
+const std::string Configuration::DEFAULT_CONSOLE_METRICS_ENDPOINT{"cout"};
+
 //-----------------------------------------------------------------------------------------
 //! The default batch size for traces
 //-----------------------------------------------------------------------------------------
@@ -76,6 +88,11 @@ const std::size_t Configuration::DEFAULT_MAX_BATCH_QUEUE_SIZE = 2048;
 //-----------------------------------------------------------------------------------------
 const std::size_t Configuration::DEFAULT_BATCH_SCHEDULE_DELAY = 2500;
 
+//-----------------------------------------------------------------------------------------
+//! The default delay (in ms) between two exports of the metrics: 10000
+//-----------------------------------------------------------------------------------------
+const std::size_t Configuration::DEFAULT_METRICS_EXPORT_INTERVAL = 10000;
+
 // TODO: offer a way to specify the endpoint by Tango property (only env. var. so far)
 Configuration::Configuration(std::string id, std::string name_space, ServerClientDetails details) :
     id(id),
@@ -100,6 +117,18 @@ Configuration::Configuration(std::string id, std::string name_space, ServerClien
 
     traces_endpoint = get_traces_endpoint_from_env(traces_exporter);
     logs_endpoint = get_logs_endpoint_from_env(logs_exporter);
+
+    metrics_exporter = get_exporter_from_env(telemetry::kEnvVarTelemetryMetricsExporter, Exporter::none);
+    metrics_endpoint = get_metrics_endpoint_from_env(metrics_exporter);
+    metrics_export_interval_in_milliseconds = static_cast<std::size_t>(
+        get_number_from_env(kEnvVarTelemetryMetricsExportInterval,
+                            static_cast<double>(DEFAULT_METRICS_EXPORT_INTERVAL),
+                            static_cast<double>(std::numeric_limits<std::uint32_t>::max())));
+
+    traces_sampler_ratio = get_number_from_env(kEnvVarTelemetryTracesSamplerRatio, 1.0, 1.0);
+    traces_sampler_rules = get_sampling_rules_from_env(kEnvVarTelemetryTracesSamplerRules);
+    traces_sampler_parent_based = detail::get_boolean_env_var(kEnvVarTelemetryTracesSamplerParentBased, true);
+    traces_max_rate = get_number_from_env(kEnvVarTelemetryTracesMaxRate, 0.0, std::numeric_limits<double>::infinity());
 }
 
 Configuration::Configuration() :
@@ -183,12 +212,111 @@ Configuration::Exporter Configuration::to_exporter(std::string_view str)
 }
 
 /// @throw Tango::API_InvalidArgs
-Configuration::Exporter Configuration::get_exporter_from_env(const char *env_var)
+double Configuration::get_number_from_env(const char *env_var, double default_value, double max_value)
+{
+    std::string contents;
+    int ret = ApiUtil::instance()->get_env_var(env_var, contents);
+
+    if(ret != 0)
+    {
+        return default_value;
+    }
+
+    double value;
+    if(!detail::parse_number(contents, value) || !(value >= 0.0 && value <= max_value))
+    {
+        std::stringstream sstr;
+        sstr << "Environment variable: " << env_var << ", with contents " << contents
+             << ", can not be parsed as a number in [0, " << max_value << "].";
+        TANGO_THROW_EXCEPTION(Tango::API_InvalidArgs, sstr.str());
+    }
+
+    return value;
+}
+
+bool Configuration::SamplingRule::matches(std::string_view span_name) const noexcept
+{
+    //
+    // Glob matching with '*' as the only wildcard: on a mismatch, backtrack to the last '*' and let it match one more
+    // character of the span name
+    //
+
+    std::size_t op = 0;
+    std::size_t name = 0;
+    std::size_t star = std::string::npos;
+    std::size_t star_name = 0;
+
+    while(name < span_name.size())
+    {
+        if(op < operation.size() && operation[op] == '*')
+        {
+            star = op++;
+            star_name = name;
+        }
+        else if(op < operation.size() && operation[op] == span_name[name])
+        {
+            ++op;
+            ++name;
+        }
+        else if(star != std::string::npos)
+        {
+            op = star + 1;
+            name = ++star_name;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    while(op < operation.size() && operation[op] == '*')
+    {
+        ++op;
+    }
+
+    return op == operation.size();
+}
+
+/// @throw Tango::API_InvalidArgs
+std::vector<Configuration::SamplingRule> Configuration::get_sampling_rules_from_env(const char *env_var)
+{
+    std::string contents;
+    int ret = ApiUtil::instance()->get_env_var(env_var, contents);
+
+    std::vector<SamplingRule> rules;
+    if(ret != 0)
+    {
+        return rules;
+    }
+
+    std::stringstream sstr(contents);
+    std::string item;
+    while(std::getline(sstr, item, ','))
+    {
+        auto pos = item.find('=');
+        double ratio = 0.0;
+        if(pos == 0 || pos == std::string::npos || !detail::parse_number(item.substr(pos + 1), ratio) ||
+           ratio < 0.0 || ratio > 1.0)
+        {
+            std::stringstream err;
+            err << "Environment variable: " << env_var << ", with contents " << contents
+                << ", can not be parsed as sampling rules - expecting e.g. "
+                << "*::read_attribute*=0.01,*::command_inout*=0.1";
+            TANGO_THROW_EXCEPTION(Tango::API_InvalidArgs, err.str());
+        }
+        rules.push_back({item.substr(0, pos), ratio});
+    }
+
+    return rules;
+}
+
+/// @throw Tango::API_InvalidArgs
+Configuration::Exporter Configuration::get_exporter_from_env(const char *env_var, Exporter default_exporter)
 {
     std::string exp;
     int ret = ApiUtil::instance()->get_env_var(env_var, exp);
 
-    Exporter exporter_type = ret != 0 ? kDefaultExporter : to_exporter(detail::to_lower(exp));
+    Exporter exporter_type = ret != 0 ? default_exporter : to_exporter(detail::to_lower(exp));
 
     switch(exporter_type)
     {
@@ -332,4 +460,37 @@ std::string Configuration::get_logs_endpoint_from_env(Exporter exporter_type)
     return endpoint;
 }
 
+std::string Configuration::get_metrics_endpoint_from_env(Exporter exporter_type)
+{
+    std::string endpoint;
+
+    // get metrics endpoint from env. variable.
+    int ret = ApiUtil::instance()->get_env_var(kEnvVarTelemetryMetricsEndPoint, endpoint);
+
+    // use default endpoint if none provided
+    if(ret != 0)
+    {
+        switch(exporter_type)
+        {
+        case Exporter::grpc:
+            endpoint = Configuration::DEFAULT_GRPC_METRICS_ENDPOINT;
+            break;
+        case Exporter::http:
+            endpoint = Configuration::DEFAULT_HTTP_METRICS_ENDPOINT;
+            break;
+        case Exporter::console:
+            endpoint = Configuration::DEFAULT_CONSOLE_METRICS_ENDPOINT;
+            break;
+        case Exporter::none:
+            return {};
+        default:
+            TANGO_ASSERT_ON_DEFAULT(exporter_type);
+        }
+    }
+
+    ensure_valid_endpoint(kEnvVarTelemetryMetricsEndPoint, exporter_type, endpoint);
+
+    return endpoint;
+}
+
 } // namespace Tango::telemetry
@@ -1,6 +1,7 @@
 #include <tango/common/git_revision.h>
 
 #include <tango/internal/utils.h>
+#include <tango/internal/metrics.h>
 
 #include <tango/common/telemetry/telemetry.h>
 #include <tango/common/telemetry/configuration.h>
@@ -8,9 +9,16 @@
 #include <tango/server/utils.h>
 #include <tango/client/ApiUtil.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <regex>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 
 #include <opentelemetry/trace/span.h>
 #include <opentelemetry/trace/scope.h>
@@ -21,6 +29,8 @@
 #include <opentelemetry/sdk/version/version.h>
 #include <opentelemetry/sdk/resource/resource.h>
 #include <opentelemetry/sdk/trace/processor.h>
+#include <opentelemetry/sdk/trace/sampler.h>
+#include <opentelemetry/sdk/trace/samplers/trace_id_ratio.h>
 #include <opentelemetry/sdk/trace/batch_span_processor_options.h>
 #include <opentelemetry/sdk/trace/batch_span_processor_factory.h>
 #include <opentelemetry/sdk/trace/simple_processor_factory.h>
@@ -46,6 +56,16 @@
 #include <opentelemetry/exporters/otlp/otlp_grpc_log_record_exporter_factory.h>
 #include <opentelemetry/exporters/otlp/otlp_http_log_record_exporter_factory.h>
 
+#include <opentelemetry/metrics/meter.h>
+#include <opentelemetry/metrics/observer_result.h>
+#include <opentelemetry/sdk/metrics/meter_provider.h>
+#include <opentelemetry/sdk/metrics/export/periodic_exporting_metric_reader_factory.h>
+#include <opentelemetry/sdk/metrics/export/periodic_exporting_metric_reader_options.h>
+#include <opentelemetry/sdk/metrics/view/view_registry.h>
+#include <opentelemetry/exporters/ostream/metric_exporter_factory.h>
+#include <opentelemetry/exporters/otlp/otlp_grpc_metric_exporter_factory.h>
+#include <opentelemetry/exporters/otlp/otlp_http_metric_exporter_factory.h>
+
 namespace
 {
 
@@ -388,6 +408,425 @@ inline static opentelemetry::trace::SpanKind to_opentelemetry_span_kind(const Sp
     }
 }
 
+//-----------------------------------------------------------------------------------------
+// SpanRateLimiter
+//-----------------------------------------------------------------------------------------
+// Limits the number of spans sampled per second by the process. This is a lock free
+// implementation of the generic cell rate algorithm: each accepted span pushes a theoretical
+// arrival time forward by 1/max_rate and a span is rejected when this time would get more than
+// one second (or one interval if longer) ahead of now - bursts of max_rate spans are allowed.
+//-----------------------------------------------------------------------------------------
+class SpanRateLimiter final
+{
+  public:
+    //-------------------------------------------------------------------------------------
+    // SpanRateLimiter::SpanRateLimiter: a max_rate of 0 means no limit
+    //-------------------------------------------------------------------------------------
+    explicit SpanRateLimiter(double max_rate) noexcept :
+        interval{max_rate > 0.0 ? std::max<std::int64_t>(static_cast<std::int64_t>(1e9 / max_rate), 1) : 0},
+        max_advance{std::max<std::int64_t>(interval, 1'000'000'000)}
+    {
+    }
+
+    //-------------------------------------------------------------------------------------
+    // SpanRateLimiter::try_acquire: returns true if a new span can be sampled
+    //-------------------------------------------------------------------------------------
+    bool try_acquire() noexcept
+    {
+        if(interval == 0)
+        {
+            return true;
+        }
+
+        const std::int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch())
+                                     .count();
+
+        std::int64_t arrival_time = theoretical_arrival_time.load(std::memory_order_relaxed);
+        while(true)
+        {
+            const std::int64_t next_arrival_time = std::max(arrival_time, now) + interval;
+            if(next_arrival_time - now > max_advance)
+            {
+                return false;
+            }
+
+            if(theoretical_arrival_time.compare_exchange_weak(
+                   arrival_time, next_arrival_time, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+    }
+
+  private:
+    // the minimum delay between two spans (in ns)
+    const std::int64_t interval;
+    // how far the theoretical arrival time can be ahead of now (in ns)
+    const std::int64_t max_advance;
+    // the time (in ns) at which the next span would be accepted if the spans were regularly spaced
+    std::atomic<std::int64_t> theoretical_arrival_time{0};
+};
+
+//-----------------------------------------------------------------------------------------
+// get_span_rate_limiter: the rate limiter shared by the interfaces of the process
+//-----------------------------------------------------------------------------------------
+// The limit is a per process one: all the interfaces configured with the same max rate (i.e.,
+// all of them unless configured by hand, the rate coming from the TANGO_TELEMETRY_TRACES_MAX_RATE
+// env. var.) share the same limiter. The limiters live until the process exits.
+//-----------------------------------------------------------------------------------------
+static SpanRateLimiter &get_span_rate_limiter(double max_rate)
+{
+    static std::mutex limiters_mutex;
+    static std::map<double, SpanRateLimiter> limiters;
+
+    std::lock_guard<std::mutex> lock(limiters_mutex);
+    return limiters.try_emplace(max_rate, max_rate).first->second;
+}
+
+//-----------------------------------------------------------------------------------------
+// TangoSampler
+//-----------------------------------------------------------------------------------------
+// The head sampler of the traces (i.e., the decision is taken when a span is started):
+//  - if parent based, a span with a valid (local or remote) parent follows the parent decision
+//  - otherwise the trace id ratio of the first sampling rule matching the span name (or the
+//    default ratio) applies - the decision is a function of the trace id so that all the spans
+//    of a trace get the same one
+//  - finally, the sampled root spans (i.e., without a valid parent) are subject to the per
+//    process rate limit - the other spans follow their parent so that the traces stay complete
+// A span which is not sampled is neither recorded nor exported.
+//-----------------------------------------------------------------------------------------
+class TangoSampler final : public opentelemetry::sdk::trace::Sampler
+{
+  public:
+    //-------------------------------------------------------------------------------------
+    // TangoSampler::TangoSampler
+    //-------------------------------------------------------------------------------------
+    explicit TangoSampler(const Configuration &cfg) :
+        default_sampler{cfg.traces_sampler_ratio},
+        parent_based{cfg.traces_sampler_parent_based},
+        rate_limiter{get_span_rate_limiter(cfg.traces_max_rate)}
+    {
+        for(const auto &rule : cfg.traces_sampler_rules)
+        {
+            rules.push_back(
+                {rule, std::make_unique<opentelemetry::sdk::trace::TraceIdRatioBasedSampler>(rule.ratio)});
+        }
+    }
+
+    //-------------------------------------------------------------------------------------
+    // TangoSampler::ShouldSample
+    //-------------------------------------------------------------------------------------
+    opentelemetry::sdk::trace::SamplingResult
+        ShouldSample(const opentelemetry::trace::SpanContext &parent_context,
+                     opentelemetry::trace::TraceId trace_id,
+                     opentelemetry::nostd::string_view name,
+                     opentelemetry::trace::SpanKind span_kind,
+                     const opentelemetry::common::KeyValueIterable &attributes,
+                     const opentelemetry::trace::SpanContextKeyValueIterable &links) noexcept override
+    {
+        using opentelemetry::sdk::trace::Decision;
+
+        bool root = !parent_context.IsValid();
+        bool sampled{false};
+        if(parent_based && !root)
+        {
+            sampled = parent_context.IsSampled();
+        }
+        else
+        {
+            auto result =
+                get_ratio_sampler(name).ShouldSample(parent_context, trace_id, name, span_kind, attributes, links);
+            sampled = result.decision == Decision::RECORD_AND_SAMPLE;
+        }
+
+        if(sampled && root && !rate_limiter.try_acquire())
+        {
+            sampled = false;
+        }
+
+        return {sampled ? Decision::RECORD_AND_SAMPLE : Decision::DROP, nullptr, parent_context.trace_state()};
+    }
+
+    //-------------------------------------------------------------------------------------
+    // TangoSampler::GetDescription
+    //-------------------------------------------------------------------------------------
+    opentelemetry::nostd::string_view GetDescription() const noexcept override
+    {
+        return "TangoSampler";
+    }
+
+  private:
+    //-------------------------------------------------------------------------------------
+    // TangoSampler::get_ratio_sampler: the sampler of the first rule matching the span name
+    //-------------------------------------------------------------------------------------
+    opentelemetry::sdk::trace::TraceIdRatioBasedSampler &get_ratio_sampler(opentelemetry::nostd::string_view name)
+    {
+        std::string_view span_name{name.data(), name.size()};
+        for(auto &rule : rules)
+        {
+            if(rule.matches(span_name))
+            {
+                return *rule.sampler;
+            }
+        }
+        return default_sampler;
+    }
+
+    struct Rule : Configuration::SamplingRule
+    {
+        std::unique_ptr<opentelemetry::sdk::trace::TraceIdRatioBasedSampler> sampler;
+    };
+
+    // the per operation samplers
+    std::vector<Rule> rules;
+    // the sampler used when no rule matches the span name
+    opentelemetry::sdk::trace::TraceIdRatioBasedSampler default_sampler;
+    // follow the parent decision?
+    bool parent_based;
+    // the per process rate limiter
+    SpanRateLimiter &rate_limiter;
+};
+
+//-----------------------------------------------------------------------------------------
+// METRICS-EXPORT
+//-----------------------------------------------------------------------------------------
+//-----------------------------------------------------------------------------------------
+// MetricsExport: periodically exports the kernel metrics of the process (see
+// Tango::detail::MetricsRegistry) through observable instruments. The counters and gauges
+// are exported as is, the histograms as a count, a sum and some quantiles.
+//-----------------------------------------------------------------------------------------
+class MetricsExport final
+{
+  public:
+    explicit MetricsExport(Configuration cfg)
+    {
+        std::unique_ptr<opentelemetry::sdk::metrics::PushMetricExporter> exporter;
+
+        switch(cfg.metrics_exporter)
+        {
+        case Configuration::Exporter::grpc:
+#if defined(TANGO_TELEMETRY_USE_GRPC)
+        {
+            opentelemetry::exporter::otlp::OtlpGrpcMetricExporterOptions opts;
+            opts.endpoint = cfg.extract_grpc_host_port(cfg.metrics_endpoint);
+            opts.use_ssl_credentials = false;
+            exporter = opentelemetry::exporter::otlp::OtlpGrpcMetricExporterFactory::Create(opts);
+        }
+#endif
+        break;
+        case Configuration::Exporter::http:
+#if defined(TANGO_TELEMETRY_USE_HTTP)
+        {
+            opentelemetry::exporter::otlp::OtlpHttpMetricExporterOptions opts;
+            opts.url = cfg.metrics_endpoint;
+            exporter = opentelemetry::exporter::otlp::OtlpHttpMetricExporterFactory::Create(opts);
+        }
+#endif
+        break;
+        case Configuration::Exporter::console:
+            if(cfg.metrics_endpoint == "cout")
+            {
+                exporter = opentelemetry::exporter::metrics::OStreamMetricExporterFactory::Create(std::cout);
+            }
+            else if(cfg.metrics_endpoint == "cerr")
+            {
+                exporter = opentelemetry::exporter::metrics::OStreamMetricExporterFactory::Create(std::cerr);
+            }
+            else
+            {
+                TANGO_ASSERT(false);
+            }
+            break;
+        case Configuration::Exporter::none:
+            TANGO_ASSERT("Invalid exporter type: none");
+        default:
+            TANGO_ASSERT_ON_DEFAULT(cfg.metrics_exporter);
+        }
+
+        TANGO_ASSERT(exporter);
+
+        opentelemetry::sdk::metrics::PeriodicExportingMetricReaderOptions opts;
+        opts.export_interval_millis =
+            std::chrono::milliseconds(std::max<std::size_t>(cfg.metrics_export_interval_in_milliseconds, 1));
+        opts.export_timeout_millis = std::min(opts.export_timeout_millis, opts.export_interval_millis);
+
+        auto *api_util = Tango::ApiUtil::instance();
+
+        std::string tango_host;
+        api_util->get_env_var("TANGO_HOST", tango_host);
+
+        // the metrics are the ones of the process, not of the interface owner
+        std::string service_name = cfg.is_a(Configuration::Kind::Server) ? std::get<0>(cfg.details).class_name
+                                                                         : std::get<1>(cfg.details).name;
+        auto resource = opentelemetry::sdk::resource::Resource::Create(opentelemetry::sdk::resource::ResourceAttributes{
+            {"service.namespace", cfg.name_space.empty() ? "tango" : cfg.name_space},
+            {"service.name", service_name},
+            {"tango.process.id", api_util->get_client_pid()},
+            {"tango.process.kind", api_util->in_server() ? "server" : "client"},
+            {"tango.host", tango_host}});
+
+        provider = std::make_shared<opentelemetry::sdk::metrics::MeterProvider>(
+            std::make_unique<opentelemetry::sdk::metrics::ViewRegistry>(), resource);
+        provider->AddMetricReader(
+            opentelemetry::sdk::metrics::PeriodicExportingMetricReaderFactory::Create(std::move(exporter), opts));
+
+        auto meter = provider->GetMeter("tango.cpp", git_revision());
+
+        for(const char *name : {detail::METRIC_REQUEST_ERRORS,
+                                detail::METRIC_EVENTS_PUSHED,
+                                detail::METRIC_EVENTS_RECEIVED,
+                                detail::METRIC_EVENTS_MISSED,
+                                detail::METRIC_EVENTS_DROPPED})
+        {
+            add_instrument(meter->CreateInt64ObservableCounter(name), observe_counters, name);
+        }
+
+        add_instrument(meter->CreateInt64ObservableGauge(detail::METRIC_EVENTS_QUEUED),
+                       observe_gauges,
+                       detail::METRIC_EVENTS_QUEUED);
+
+        for(const char *name : {detail::METRIC_REQUEST_DURATION,
+                                detail::METRIC_POLLING_LATENESS,
+                                detail::METRIC_EVENT_PUSH_DURATION})
+        {
+            const std::string base{name};
+            add_instrument(meter->CreateInt64ObservableCounter(base + ".count"), observe_histogram_counts, name);
+            add_instrument(meter->CreateInt64ObservableCounter(base + ".sum", "", "us"), observe_histogram_sums, name);
+            add_instrument(
+                meter->CreateInt64ObservableGauge(base + ".quantile", "", "us"), observe_histogram_quantiles, name);
+        }
+    }
+
+    ~MetricsExport()
+    {
+        // export the last values before the instruments are removed
+        provider->Shutdown();
+    }
+
+    MetricsExport(const MetricsExport &) = delete;
+    MetricsExport &operator=(const MetricsExport &) = delete;
+
+  private:
+    using InstrumentPtr = opentelemetry::nostd::shared_ptr<opentelemetry::metrics::ObservableInstrument>;
+
+    // the callback state is the name of the metric, one of the detail::METRIC_xxx constants
+    void add_instrument(InstrumentPtr instrument,
+                        opentelemetry::metrics::ObservableCallbackPtr callback,
+                        const char *name)
+    {
+        instrument->AddCallback(callback, const_cast<char *>(name));
+        instruments.push_back(std::move(instrument));
+    }
+
+    static void observe(opentelemetry::metrics::ObserverResult &result,
+                        std::int64_t value,
+                        const detail::MetricLabels &labels)
+    {
+        using ObserverPtr = opentelemetry::nostd::shared_ptr<opentelemetry::metrics::ObserverResultT<int64_t>>;
+
+        std::map<std::string, std::string> attributes(labels.begin(), labels.end());
+        opentelemetry::nostd::get<ObserverPtr>(result)->Observe(value, attributes);
+    }
+
+    static void observe_counters(opentelemetry::metrics::ObserverResult result, void *state)
+    {
+        const std::string name{static_cast<const char *>(state)};
+        detail::MetricsRegistry::instance().for_each_counter(
+            [&result, &name](const std::string &metric, const detail::MetricLabels &labels, std::uint64_t value)
+            {
+                if(metric == name)
+                {
+                    observe(result, static_cast<std::int64_t>(value), labels);
+                }
+            });
+    }
+
+    static void observe_gauges(opentelemetry::metrics::ObserverResult result, void *state)
+    {
+        const std::string name{static_cast<const char *>(state)};
+        detail::MetricsRegistry::instance().for_each_gauge(
+            [&result, &name](const std::string &metric, const detail::MetricLabels &labels, std::int64_t value)
+            {
+                if(metric == name)
+                {
+                    observe(result, value, labels);
+                }
+            });
+    }
+
+    template <typename F>
+    static void observe_histograms(void *state, const F &f)
+    {
+        const std::string name{static_cast<const char *>(state)};
+        detail::MetricsRegistry::instance().for_each_histogram(
+            [&f, &name](const std::string &metric,
+                        const detail::MetricLabels &labels,
+                        const detail::HistogramSnapshot &snapshot)
+            {
+                if(metric == name)
+                {
+                    f(labels, snapshot);
+                }
+            });
+    }
+
+    static void observe_histogram_counts(opentelemetry::metrics::ObserverResult result, void *state)
+    {
+        observe_histograms(state,
+                           [&result](const detail::MetricLabels &labels, const detail::HistogramSnapshot &snapshot)
+                           { observe(result, static_cast<std::int64_t>(snapshot.count), labels); });
+    }
+
+    static void observe_histogram_sums(opentelemetry::metrics::ObserverResult result, void *state)
+    {
+        observe_histograms(state,
+                           [&result](const detail::MetricLabels &labels, const detail::HistogramSnapshot &snapshot)
+                           { observe(result, static_cast<std::int64_t>(snapshot.sum), labels); });
+    }
+
+    static void observe_histogram_quantiles(opentelemetry::metrics::ObserverResult result, void *state)
+    {
+        observe_histograms(
+            state,
+            [&result](const detail::MetricLabels &labels, const detail::HistogramSnapshot &snapshot)
+            {
+                for(const auto &[quantile, q] :
+                    {std::pair{"0.5", 0.5}, std::pair{"0.9", 0.9}, std::pair{"0.99", 0.99}, std::pair{"1", 1.0}})
+                {
+                    auto quantile_labels = labels;
+                    quantile_labels.emplace_back("quantile", quantile);
+                    observe(result, static_cast<std::int64_t>(snapshot.quantile(q)), quantile_labels);
+                }
+            });
+    }
+
+    std::shared_ptr<opentelemetry::sdk::metrics::MeterProvider> provider;
+
+    // destroyed before the provider, which removes their callbacks
+    std::vector<InstrumentPtr> instruments;
+};
+
+//-----------------------------------------------------------------------------------------
+// Return the export of the metrics, which is shared by the interfaces having a metrics
+// exporter: the first one configures it and it stops when the last one is destroyed
+//-----------------------------------------------------------------------------------------
+std::shared_ptr<MetricsExport> get_metrics_export(const Configuration &cfg)
+{
+    static std::mutex mutex;
+    static std::weak_ptr<MetricsExport> current;
+
+    const std::lock_guard<std::mutex> lock(mutex);
+
+    auto result = current.lock();
+    if(!result)
+    {
+        result = std::make_shared<MetricsExport>(cfg);
+        current = result;
+    }
+    return result;
+}
+
 //-----------------------------------------------------------------------------------------
 // INTERFACE-IMPLEMENTATION
 //-----------------------------------------------------------------------------------------
@@ -406,6 +845,11 @@ class InterfaceImplementation final
         init_tracer_provider();
         // init the global propagator
         init_global_propagator();
+        // export the kernel metrics
+        if(cfg.enabled && cfg.metrics_exporter != Configuration::Exporter::none)
+        {
+            metrics_export = get_metrics_export(cfg);
+        }
     }
 
     //-------------------------------------------------------------------------------------
@@ -560,10 +1004,16 @@ class InterfaceImplementation final
         auto resource = opentelemetry::sdk::resource::Resource::Create(resource_attributes);
 
         TANGO_ASSERT(processor);
-        provider = StdUniqueToNostdShared(
-            opentelemetry::sdk::trace::TracerProviderFactory::Create(std::move(processor), resource));
+        provider = StdUniqueToNostdShared(opentelemetry::sdk::trace::TracerProviderFactory::Create(
+            std::move(processor), resource, std::make_unique<TangoSampler>(cfg)));
 
         tracer = provider->GetTracer(tracer_name, tracer_version);
+
+        // a span can only be sampled if it can follow a sampled parent or if one of the ratios is not 0
+        spans_sampleable = cfg.traces_sampler_parent_based || cfg.traces_sampler_ratio > 0.0 ||
+                           std::any_of(cfg.traces_sampler_rules.begin(),
+                                       cfg.traces_sampler_rules.end(),
+                                       [](const Configuration::SamplingRule &rule) { return rule.ratio > 0.0; });
     }
 
     //-------------------------------------------------------------------------------------
@@ -632,25 +1082,10 @@ class InterfaceImplementation final
     //-------------------------------------------------------------------------------------
     SpanPtr start_span(const std::string &name, const Attributes &attributes, const Span::Kind &kind) noexcept
     {
-        std::map<std::string, opentelemetry::common::AttributeValue> otel_attributes;
-
-        for(const auto &attribute : attributes)
-        {
-            std::visit(
-                [&](auto &&arg)
-                {
-                    // Convert each type to opentelemetry::trace::AttributeValue and add to convertedAttributes
-                    otel_attributes[attribute.first] = opentelemetry::common::AttributeValue(arg);
-                },
-                attribute.second);
-        }
-
-        auto otel_span = get_tracer()->StartSpan(
+        return start_span(
             name,
-            otel_attributes,
+            attributes,
             {{}, {}, opentelemetry::trace::SpanContext(false, false), to_opentelemetry_span_kind(kind)});
-
-        return instantiate_span(otel_span);
     }
 
     //-------------------------------------------------------------------------------------
@@ -660,22 +1095,18 @@ class InterfaceImplementation final
                        const Attributes &attributes,
                        const opentelemetry::trace::StartSpanOptions &options) noexcept
     {
-        std::map<std::string, opentelemetry::common::AttributeValue> otel_attributes;
+        auto span = instantiate_span(get_tracer()->StartSpan(name, options));
 
-        for(const auto &attribute : attributes)
+        // the sampler does not look at the attributes: only convert them for the spans actually recorded
+        if(span->is_recording())
         {
-            std::visit(
-                [&](auto &&arg)
-                {
-                    // Convert each type to opentelemetry::trace::AttributeValue and add to convertedAttributes
-                    otel_attributes[attribute.first] = opentelemetry::common::AttributeValue(arg);
-                },
-                attribute.second);
+            for(const auto &attribute : attributes)
+            {
+                span->set_attribute(attribute.first, attribute.second);
+            }
         }
 
-        auto otel_span = get_tracer()->StartSpan(name, otel_attributes, options);
-
-        return instantiate_span(otel_span);
+        return span;
     }
 
     //-------------------------------------------------------------------------------------
@@ -717,6 +1148,12 @@ class InterfaceImplementation final
     // the actual opentelemetry tracer attached to this interface
     opentelemetry::nostd::shared_ptr<opentelemetry::trace::Tracer> tracer;
 
+    // false if the sampler can't sample any span (or if the traces are not exported)
+    bool spans_sampleable{false};
+
+    // the export of the kernel metrics (shared by the interfaces)
+    std::shared_ptr<MetricsExport> metrics_export;
+
     // the global propagator initialization flag (singleton)
     static bool global_propagator_initialized;
 
@@ -1073,6 +1510,14 @@ bool Interface::is_enabled() const noexcept
     return impl->cfg.enabled;
 }
 
+//-----------------------------------------------------------------------------------------
+// Interface::may_sample_spans
+//-----------------------------------------------------------------------------------------
+bool Interface::may_sample_spans() const noexcept
+{
+    return impl->cfg.enabled && impl->spans_sampleable;
+}
+
 //-----------------------------------------------------------------------------------------
 // Interface::enable
 //-----------------------------------------------------------------------------------------
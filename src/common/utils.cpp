@@ -11,13 +11,23 @@
 #include <tango/client/Database.h>
 #include <tango/client/DeviceProxy.h>
 
+#ifndef _TG_WINDOWS_
+  #include <signal.h>
+#endif
+
 #include <algorithm>
+#include <cerrno>
+#include <cstring>
 
 namespace
 {
 const char *const EVENT_COMPAT = "idl";
 const char *const EVENT_COMPAT_IDL5 = "idl5_";
 const int EVENT_COMPAT_IDL5_SIZE = 5; // strlen of previous string
+const char *const EVENT_DELTA = "delta_";
+const int EVENT_DELTA_SIZE = 6; // strlen of previous string
+const char *const EVENT_SHM = "shm_";
+const int EVENT_SHM_SIZE = 4; // strlen of previous string
 } // anonymous namespace
 
 namespace Tango::detail
@@ -263,6 +273,15 @@ bool get_boolean_env_var(const char *env_var, bool default_value)
     return result.value();
 }
 
+bool is_process_running(TANGO_UNUSED(long pid))
+{
+#ifdef _TG_WINDOWS_
+    return true;
+#else
+    return ::kill(static_cast<pid_t>(pid), 0) == 0 || errno != ESRCH;
+#endif
+}
+
 void stringify_any(std::ostream &os, const CORBA::Any &any)
 {
     CORBA::TypeCode_var tc_al;
@@ -714,7 +733,74 @@ std::string get_event_name(std::string fq_event_name)
     TANGO_ASSERT(pos != std::string::npos);
 
     std::string event_name = fq_event_name.substr(pos + 1);
-    return detail::remove_idl_prefix(event_name);
+    return detail::remove_shm_prefix(detail::remove_delta_prefix(detail::remove_idl_prefix(event_name)));
+}
+
+std::string add_delta_prefix(std::string event_name)
+{
+    std::string::size_type pos = event_name.find(EVENT_COMPAT) == 0 ? EVENT_COMPAT_IDL5_SIZE : 0;
+    event_name.insert(pos, EVENT_DELTA);
+
+    return event_name;
+}
+
+std::string remove_delta_prefix(std::string event_name)
+{
+    std::string::size_type pos = event_name.find(EVENT_COMPAT) == 0 ? EVENT_COMPAT_IDL5_SIZE : 0;
+    if(event_name.compare(pos, EVENT_DELTA_SIZE, EVENT_DELTA) == 0)
+    {
+        event_name.erase(pos, EVENT_DELTA_SIZE);
+    }
+
+    return event_name;
+}
+
+bool is_delta_event_name(const std::string &event_name)
+{
+    std::string::size_type pos = event_name.rfind('.');
+    pos = pos == std::string::npos ? 0 : pos + 1;
+    if(event_name.compare(pos, std::strlen(EVENT_COMPAT), EVENT_COMPAT) == 0)
+    {
+        pos += EVENT_COMPAT_IDL5_SIZE;
+    }
+
+    return event_name.compare(pos, EVENT_DELTA_SIZE, EVENT_DELTA) == 0;
+}
+
+// Position of the shm prefix in a string like `idl5_shm_change` or a fully qualified event name ending with it
+static std::string::size_type get_shm_prefix_pos(const std::string &event_name)
+{
+    std::string::size_type pos = event_name.rfind('.');
+    pos = pos == std::string::npos ? 0 : pos + 1;
+    if(event_name.compare(pos, std::strlen(EVENT_COMPAT), EVENT_COMPAT) == 0)
+    {
+        pos += EVENT_COMPAT_IDL5_SIZE;
+    }
+
+    return pos;
+}
+
+std::string add_shm_prefix(std::string event_name)
+{
+    event_name.insert(get_shm_prefix_pos(event_name), EVENT_SHM);
+
+    return event_name;
+}
+
+std::string remove_shm_prefix(std::string event_name)
+{
+    std::string::size_type pos = get_shm_prefix_pos(event_name);
+    if(event_name.compare(pos, EVENT_SHM_SIZE, EVENT_SHM) == 0)
+    {
+        event_name.erase(pos, EVENT_SHM_SIZE);
+    }
+
+    return event_name;
+}
+
+bool is_shm_event_name(const std::string &event_name)
+{
+    return event_name.compare(get_shm_prefix_pos(event_name), EVENT_SHM_SIZE, EVENT_SHM) == 0;
 }
 
 } // namespace Tango::detail
@@ -0,0 +1,133 @@
+#include <tango/internal/worker_pool.h>
+
+#include <tango/common/omnithread_wrapper.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace Tango::detail
+{
+
+struct WorkerPool::Loop
+{
+    const std::function<void(std::size_t)> *func{nullptr};
+    std::size_t nb{0};
+    std::atomic<std::size_t> next{0};
+
+    std::mutex done_mutex;
+    std::condition_variable done_cond;
+    std::size_t done{0};
+};
+
+WorkerPool &WorkerPool::instance()
+{
+    // Never deleted: the pool threads wait on its condition until the process exits
+    static WorkerPool *pool = new WorkerPool;
+    return *pool;
+}
+
+void WorkerPool::for_each(std::size_t nb, std::size_t max_parallel, const std::function<void(std::size_t)> &func)
+{
+    std::size_t nb_loop_threads = std::min(nb, max_parallel);
+    if(nb_loop_threads <= 1)
+    {
+        for(std::size_t idx = 0; idx < nb; ++idx)
+        {
+            func(idx);
+        }
+        return;
+    }
+
+    auto loop = std::make_shared<Loop>();
+    loop->func = &func;
+    loop->nb = nb;
+
+    post(loop, nb_loop_threads - 1);
+    run(*loop);
+
+    //
+    // Wait for the iterations taken by the pool threads. Once they are done, func is not used any more: a pool thread
+    // taking a ticket of this loop later finds no iteration left
+    //
+
+    {
+        std::unique_lock<std::mutex> lk(loop->done_mutex);
+        loop->done_cond.wait(lk, [&loop]() { return loop->done == loop->nb; });
+    }
+
+    withdraw(loop);
+}
+
+std::size_t WorkerPool::get_nb_threads()
+{
+    std::lock_guard<std::mutex> lg(lock);
+    return nb_threads;
+}
+
+void WorkerPool::post(const std::shared_ptr<Loop> &loop, std::size_t nb_helpers)
+{
+    std::lock_guard<std::mutex> lg(lock);
+    for(std::size_t i = 0; i < nb_helpers; ++i)
+    {
+        tickets.push_back(loop);
+    }
+
+    //
+    // Create the threads needed to take the tickets which the idle threads will not take
+    //
+
+    while(tickets.size() > nb_idle && nb_threads < WORKER_POOL_MAX_THREADS)
+    {
+        std::thread(&WorkerPool::worker_loop, this).detach();
+        nb_threads++;
+        nb_idle++;
+    }
+
+    work_cond.notify_all();
+}
+
+void WorkerPool::withdraw(const std::shared_ptr<Loop> &loop)
+{
+    std::lock_guard<std::mutex> lg(lock);
+    tickets.erase(std::remove(tickets.begin(), tickets.end(), loop), tickets.end());
+}
+
+void WorkerPool::worker_loop()
+{
+    omni_thread::ensure_self auto_self;
+
+    std::unique_lock<std::mutex> lk(lock);
+    while(true)
+    {
+        // The thread is counted as idle by post() when it is created
+        work_cond.wait(lk, [this]() { return !tickets.empty(); });
+
+        std::shared_ptr<Loop> loop = std::move(tickets.front());
+        tickets.pop_front();
+        nb_idle--;
+        lk.unlock();
+
+        run(*loop);
+        loop.reset();
+
+        lk.lock();
+        nb_idle++;
+    }
+}
+
+void WorkerPool::run(Loop &loop)
+{
+    for(std::size_t idx = loop.next++; idx < loop.nb; idx = loop.next++)
+    {
+        (*loop.func)(idx);
+
+        std::lock_guard<std::mutex> lg(loop.done_mutex);
+        if(++loop.done == loop.nb)
+        {
+            loop.done_cond.notify_all();
+        }
+    }
+}
+
+} // namespace Tango::detail
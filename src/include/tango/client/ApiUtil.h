@@ -35,6 +35,8 @@
 #include <tango/client/devapi.h>
 #include <tango/client/devasyn.h>
 
+#include <chrono>
+#include <cstdint>
 #include <string>
 #include <map>
 #include <memory>
@@ -42,6 +44,47 @@
 
 namespace Tango
 {
+class DeviceProxy;
+class CallBack;
+
+/**
+ * One event subscription for ApiUtil::subscribe_events()
+ *
+ * The event is received with the callback when it is not null, otherwise events are stored in an event queue of
+ * event_queue_size elements. The event_id and errors members are set by ApiUtil::subscribe_events().
+ *
+ * @headerfile tango.h
+ * @ingroup Client
+ */
+struct EventSubscriptionRequest
+{
+    DeviceProxy *device{nullptr};    ///< The device
+    std::string attr_name;           ///< The attribute (or pipe) name. Unused for interface change event
+    EventType event{CHANGE_EVENT};   ///< The event type
+    CallBack *callback{nullptr};     ///< The callback
+    int event_queue_size{0};         ///< The event queue size (used when callback is null)
+    bool stateless{false};           ///< Stateless subscription flag
+    int event_id{0};                 ///< The event identifier (0 when the subscription failed)
+    DevErrorList errors;             ///< The error stack when the subscription failed
+};
+
+/**
+ * Statistics about the event re-subscriptions done after a device server restart or a network failure
+ *
+ * @headerfile tango.h
+ * @ingroup Client
+ */
+struct EventReconnectionStats
+{
+    std::uint64_t reconnections{0};             ///< Number of event channels (servers) re-subscribed
+    std::uint64_t resubscribed_events{0};       ///< Number of events re-subscribed
+    std::uint64_t failed_events{0};             ///< Number of events the server refused to re-subscribe
+    std::uint64_t bulk_commands{0};             ///< Number of bulk re-subscription commands sent
+    std::chrono::microseconds last_duration{0}; ///< Re-subscription time of the last reconnected channel
+    std::chrono::microseconds max_duration{0};  ///< Max re-subscription time of one channel
+    std::chrono::microseconds mean_duration{0}; ///< Mean re-subscription time of one channel
+};
+
 /****************************************************************************************
  *                                                                                         *
  *                     The ApiUtil class                                                    *
@@ -163,6 +206,88 @@ class ApiUtil
         return auto_cb;
     }
 
+    /**
+     * Set the number of threads executing callbacks in push sub-model
+     *
+     * In the push sub-model, replies are received by a dedicated thread which hands the callbacks to a pool of
+     * executor threads. Callbacks for the same device are always executed by the same thread, in reply arrival
+     * order. Setting this number to 0 executes the callbacks directly in the reply receiving thread. The default is 1
+     * and can also be set with the TANGO_CALLBACK_THREADS environment variable. The new value is taken into account
+     * the next time the push sub-model is selected.
+     *
+     * @param [in] nb The callback executor thread number
+     */
+    void set_asynch_cb_thread_nb(size_t nb)
+    {
+        cb_thread_nb = nb;
+    }
+
+    /**
+     * Get the number of threads executing callbacks in push sub-model
+     *
+     * @return The callback executor thread number
+     */
+    size_t get_asynch_cb_thread_nb()
+    {
+        return cb_thread_nb;
+    }
+
+    /**
+     * Get push sub-model callback statistics
+     *
+     * Return the number of callbacks executed and waiting for execution together with the delay between the reply
+     * arrival and the callback execution. All values are 0 if no executor thread is used.
+     *
+     * @return The callback statistics
+     */
+    CallBackStats get_asynch_cb_stats();
+
+    /**
+     * Enable or disable the client attribute cache
+     *
+     * The client attribute cache is shared by all the DeviceProxy instances of the process. It is used by the
+     * DeviceProxy::read_attribute_cached() and DeviceProxy::read_attributes_cached() methods and fed by the
+     * attribute value events received by the process. Disabling the cache discards all its content.
+     *
+     * @param [in] enable Set to true to enable the cache
+     */
+    void enable_attribute_read_cache(bool enable);
+
+    /**
+     * Check if the client attribute cache is enabled
+     *
+     * @return True if the client attribute cache is enabled
+     */
+    bool is_attribute_read_cache_enabled();
+
+    /**
+     * Get event re-subscription statistics
+     *
+     * When the heartbeat of a device server is lost, the event consumer keep alive thread re-subscribes all the
+     * events of this server once it is back, using one bulk command per server and several servers in parallel.
+     * This method returns the number of channels and events re-subscribed and the time taken to do it.
+     *
+     * @return The event re-subscription statistics
+     */
+    EventReconnectionStats get_event_reconnection_stats();
+
+    /**
+     * Subscribe to many events in one call
+     *
+     * The subscriptions are grouped per device server. All the subscriptions to events of one device server are done
+     * with one command sent to its admin device, the commands to different device servers being sent in parallel.
+     * The attribute values sent to the callbacks (or event queues) at subscription time are read with one
+     * read_attributes call per device. This is much faster than calling DeviceProxy::subscribe_event() for each
+     * event when subscribing to thousands of events.
+     *
+     * This method does not throw exceptions for individual subscriptions. For each request, the event identifier
+     * is set if the subscription succeeded (or for a stateless subscription). Otherwise, the event identifier is
+     * set to 0 and the error stack is returned in the errors member.
+     *
+     * @param [in,out] requests The event subscriptions
+     */
+    void subscribe_events(std::vector<EventSubscriptionRequest> &requests);
+
     /// @privatesection
 
     CORBA::ORB_var get_orb()
@@ -289,6 +414,8 @@ class ApiUtil
         return asyn_p_table;
     }
 
+    void dispatch_asynch_replies();
+
     //
     // Conv. between AttributeValuexxx and DeviceAttribute
     //
@@ -319,6 +446,8 @@ class ApiUtil
     cb_sub_model auto_cb;
     CbThreadCmd cb_thread_cmd;
     CallBackThread *cb_thread_ptr;
+    std::unique_ptr<CallBackExecutor> cb_executor;
+    size_t cb_thread_nb{1};
 
     AsynReq *asyn_p_table;
 
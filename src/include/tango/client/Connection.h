@@ -35,6 +35,7 @@
 #include <tango/client/DeviceData.h>
 #include <tango/server/readers_writers_lock.h>
 
+#include <atomic>
 #include <chrono>
 #include <optional>
 
@@ -147,7 +148,9 @@ class Connection
 
     int timeout;
 
-    int connection_state;
+    // connection_state, source and access are atomics so that check_and_reconnect() can read them without taking
+    // the con_to_mon lock when the connection is OK. They are still written with the lock held.
+    std::atomic<int> connection_state;
 
     // the idl version of the peer
     int version;
@@ -163,10 +166,10 @@ class Connection
     // in the tracing information. See ClntIdent in tango.idl v6 for details.
     ClntIdent get_client_identification() const;
 
-    Tango::DevSource source;
+    std::atomic<Tango::DevSource> source;
 
     bool check_acc;
-    AccessControlType access;
+    std::atomic<AccessControlType> access;
 
     virtual std::string get_corba_name(bool) = 0;
     virtual std::string build_corba_name() = 0;
@@ -150,6 +150,8 @@ class DeviceProxy : public Tango::Connection
 
         bool nethost_alias{false};
         std::string orig_tango_host;
+        bool event_delta{false};
+        bool shm_transport{false};
     };
 
     std::unique_ptr<DeviceProxyExt> ext_proxy;
@@ -717,6 +719,37 @@ class DeviceProxy : public Tango::Connection
         return read_attribute(str);
     }
 
+    /**
+     * Read a single attribute through the client attribute cache
+     *
+     * Return the value of the attribute from the process wide client attribute cache if it has been received less
+     * than max_age ago. Otherwise, read the attribute from the device and store the result in the cache. When
+     * several threads of the process read the same attribute at the same time, only one request is sent to the
+     * device and all the threads get its result. The cache is also updated with the values received by the change,
+     * periodic, archive and alarm events subscribed in this process.
+     * The cache is disabled by default (see ApiUtil::enable_attribute_read_cache()). When it is disabled, this
+     * method is equivalent to read_attribute().
+     *
+     * @param [in] att_name Attribute name
+     * @param [in] max_age Maximum age of a cached value which can be returned
+     * @return The attribute value in a DeviceAttribute instance
+     * @throws ConnectionFailed, CommunicationFailed
+     */
+    DeviceAttribute read_attribute_cached(const std::string &att_name, std::chrono::milliseconds max_age);
+    /**
+     * Read the list of specified attributes through the client attribute cache
+     *
+     * Return the values younger than max_age found in the client attribute cache and read all the other ones from
+     * the device in a single call. See read_attribute_cached() for details about the cache.
+     *
+     * @param [in] att_names Attribute names
+     * @param [in] max_age Maximum age of a cached value which can be returned
+     * @return A std::vector of DeviceAttribute instances with one element for each read attribute
+     * @throws ConnectionFailed, CommunicationFailed
+     */
+    std::vector<DeviceAttribute> *read_attributes_cached(const std::vector<std::string> &att_names,
+                                                         std::chrono::milliseconds max_age);
+
     /**
      * Write the specified attributes
      *
@@ -1381,6 +1414,24 @@ class DeviceProxy : public Tango::Connection
      * @return The polling status
      */
     virtual std::vector<std::string> *polling_status();
+    /**
+     * Read the last polled value of the polled attributes
+     *
+     * Return in one call the last value stored in the polling buffer of each polled attribute of the device.
+     * The values are returned by the device server administration device without executing any attribute
+     * read method. When @p seq is not 0, only the attributes polled since the call which returned @p seq are
+     * returned. In both cases, @p seq is updated with the sequence number to pass to the next call.
+     *
+     * Forwarded attributes are not returned. The device must support Tango IDL release 5 or above.
+     *
+     * This method allocates memory for the vector of DeviceAttribute objects returned to the caller. It is the caller
+     * responsibility to delete this memory.
+     *
+     * @param [in,out] seq The sequence number returned by the previous call or 0 to get all the polled attributes
+     * @return The attribute values
+     * @throws ConnectionFailed, CommunicationFailed, DevFailed from device
+     */
+    std::vector<DeviceAttribute> *read_polled_snapshot(DevULong64 &seq);
     /**
      * Poll a command
      *
@@ -1746,6 +1797,47 @@ class DeviceProxy : public Tango::Connection
      * @throws EventSystemFailed
      */
     virtual bool is_event_queue_empty(int event_id);
+    /**
+     * Enable delta encoded change events
+     *
+     * When enabled, the change events subscribed afterwards with subscribe_event() on this DeviceProxy instance are
+     * delta encoded: for numeric spectrum and image attributes, the device server sends only the elements which
+     * changed since the previous event and the full value is rebuilt before the callback is executed. The received
+     * events are the same as without delta encoding. If a delta is received without the previous value (for instance
+     * after missed events), the event is reported as an error and the next full value sent by the server
+     * resynchronises the subscription. This is silently ignored by device servers not supporting it and for devices
+     * implementing IDL release lower than 5.
+     *
+     * @param [in] delta True to enable delta encoded change events
+     */
+    void set_event_delta_encoding(bool delta);
+    /**
+     * Check if delta encoded change events are enabled
+     *
+     * @return true if change events subscribed with this DeviceProxy instance are delta encoded
+     */
+    bool get_event_delta_encoding() const;
+    /**
+     * Enable the shm transport
+     *
+     * When enabled and when the device runs in a device server on the same host started with the TANGO_SHM_TRANSPORT
+     * environment variable set, the values of the attribute events subscribed afterwards with subscribe_event() on
+     * this DeviceProxy instance (except delta encoded change events) are received through a shared memory ring
+     * written by the device server instead of through the network. The admin device is asked for its ring when
+     * subscribing and the received values are the same as without it. Otherwise, the events are received through
+     * the network as usual. An event whose value has already been overwritten in the ring when it is read (the ring
+     * is too small for the rate of the events) is reported as a missed event. This requires devices implementing IDL
+     * release 5 or more. Only the user running the device server can map its ring.
+     *
+     * @param [in] shm True to enable the shm transport
+     */
+    void set_shm_transport(bool shm);
+    /**
+     * Check if the shm transport is enabled
+     *
+     * @return true if the shm transport is enabled for this DeviceProxy instance
+     */
+    bool get_shm_transport() const;
     //@}
 
     /** @name Property related methods */
@@ -37,9 +37,17 @@
 
 #include <tango/common/omnithread_wrapper.h>
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <vector>
+
 namespace Tango
 {
 class AsynReq;
+class Connection;
 
 class CbThreadCmd : public omni_mutex
 {
@@ -96,6 +104,94 @@ class CallBackThread : public omni_thread
     AsynReq *asyn_ptr;
 };
 
+//=============================================================================
+//
+//            The CallBackExecutor class
+//
+// description :    Pool of threads executing the user callbacks in the
+//            push sub-model. The CallBackThread only receives the
+//            replies and hands each of them to the executor. All the
+//            callbacks of one Connection are queued to the same
+//            worker thread so that they are fired in reply arrival
+//            order for that device.
+//
+//=============================================================================
+
+/**
+ * Statistics about the callbacks executed in the asynchronous callback push sub-model
+ *
+ * @headerfile tango.h
+ * @ingroup Client
+ */
+struct CallBackStats
+{
+    std::uint64_t executed{0};                 ///< Number of callbacks already executed
+    std::uint64_t queued{0};                   ///< Number of callbacks waiting for an executor thread
+    std::chrono::microseconds mean_delay{0};   ///< Mean delay between reply arrival and callback execution
+    std::chrono::microseconds max_delay{0};    ///< Max delay between reply arrival and callback execution
+    std::chrono::microseconds last_delay{0};   ///< Delay of the last executed callback
+};
+
+class CallBackExecutor
+{
+  public:
+    explicit CallBackExecutor(size_t nb_threads);
+    ~CallBackExecutor();
+
+    CallBackExecutor(const CallBackExecutor &) = delete;
+    CallBackExecutor &operator=(const CallBackExecutor &) = delete;
+
+    void post(Connection *, std::function<void()> &&);
+
+    size_t get_thread_nb() const
+    {
+        return workers.size();
+    }
+
+    CallBackStats get_stats();
+
+  private:
+    using clock = std::chrono::steady_clock;
+
+    struct Job
+    {
+        std::function<void()> func;
+        clock::time_point enqueued;
+    };
+
+    class Worker : public omni_thread
+    {
+      public:
+        explicit Worker(CallBackExecutor &ex) :
+            executor(ex),
+            cond(&mutex)
+        {
+        }
+
+        void *run_undetached(void *) override;
+
+        void start()
+        {
+            start_undetached();
+        }
+
+        CallBackExecutor &executor;
+        omni_mutex mutex;
+        omni_condition cond;
+        std::deque<Job> jobs;
+        bool stop{false};
+    };
+
+    void record_delay(clock::duration);
+
+    std::vector<Worker *> workers;
+
+    std::atomic<std::uint64_t> executed{0};
+    std::atomic<std::uint64_t> total_delay_us{0};
+    std::atomic<std::uint64_t> max_delay_us{0};
+    std::atomic<std::uint64_t> last_delay_us{0};
+};
+
 } // namespace Tango
 
 #endif /* _CBTHREAD_ */
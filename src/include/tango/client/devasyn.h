@@ -26,6 +26,7 @@
 #define _DEVASYN_H
 
 #include <map>
+#include <set>
 #include <string>
 
 #include <tango/client/Connection.h>
@@ -254,7 +255,19 @@ class AsynReq : public omni_mutex
         return cb_req_table.size();
     }
 
+    size_t get_cb_pending_nb()
+    {
+        omni_mutex_lock sync(*this);
+        return cb_pending_nb;
+    }
+
+    size_t get_cb_pending_nb_i()
+    {
+        return cb_pending_nb;
+    }
+
     void mark_as_arrived(CORBA::Request_ptr req);
+    void mark_as_posted(CORBA::Request_ptr req);
 
     std::multimap<Connection *, TgRequest> &get_cb_dev_table()
     {
@@ -281,6 +294,10 @@ class AsynReq : public omni_mutex
 
     std::multimap<Connection *, TgRequest> cb_dev_table;
     std::map<CORBA::Request_ptr, TgRequest> cb_req_table;
+    size_t cb_pending_nb{0}; // Callback requests with reply not yet arrived
+    // Callback requests with reply handed to the callback executor. They are not marked as arrived, so that
+    // the replies already arrived are not fired a second time by a get_asynch_replies() call
+    std::set<CORBA::Request_ptr> cb_posted_requests;
 
     std::vector<long> cancelled_request;
 
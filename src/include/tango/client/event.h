@@ -139,9 +139,20 @@ class FwdEventData : public EventData
         return event_data;
     }
 
+    void set_zmq_endian(unsigned char _e)
+    {
+        zmq_endian = _e;
+    }
+
+    unsigned char get_zmq_endian()
+    {
+        return zmq_endian;
+    }
+
   private:
     const AttributeValue_5 *av_5{nullptr};
     zmq::message_t *event_data{nullptr};
+    unsigned char zmq_endian{0}; // Byte order of the sender of the ZMQ message (as in the event endian frame)
 };
 
 /********************************************************************************
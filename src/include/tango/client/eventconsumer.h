@@ -48,8 +48,10 @@
 
 #include <zmq.hpp>
 
+#include <chrono>
 #include <map>
 #include <iostream>
+#include <mutex>
 
 namespace Tango
 {
@@ -67,6 +69,12 @@ class EventConsumerKeepAliveThread;
 class Database;
 class FwdEventData;
 
+namespace detail
+{
+class EventDeltaDecoder;
+class ShmRingReader;
+} // namespace detail
+
 #ifndef _USRDLL
 extern "C"
 {
@@ -427,6 +435,8 @@ typedef struct event_callback_zmq
     std::string endpoint;
     bool discarded_event;
     bool fwd_att;
+    std::shared_ptr<detail::EventDeltaDecoder> delta_decoder; // Only for delta encoded change events
+    bool shm{false};                                          // Event received through the shm transport
 } EventCallBackZmq;
 
 typedef struct event_callback : public EventCallBackBase, public EventCallBackZmq
@@ -480,6 +490,25 @@ typedef struct channel_struct : public EventChannelBase, public EventChannelZmq
 typedef std::map<std::string, EventChannelStruct>::iterator EvChanIte;
 typedef std::map<std::string, EventCallBackStruct>::iterator EvCbIte;
 
+//
+// Data exchanged between EventConsumer::subscribe_events() and EventConsumer::connect_event() for one event
+// subscribed in bulk. The admin device command result is received before connect_event() is called and the
+// synchronous event is fired once all the events have been connected.
+//
+
+struct BulkSubscriptionData
+{
+    std::shared_ptr<DeviceProxy> adm_dev;
+    std::string adm_name;
+    DeviceData dd;
+    std::unique_ptr<DeviceAttribute> initial_value;
+
+    EventCallBackStruct *callback_struct{nullptr};
+    std::string callback_key;
+    std::string device_name;
+    std::string obj_name_lower;
+};
+
 /********************************************************************************
  *                                                                                 *
  *                         EventConsumer class                                        *
@@ -504,7 +533,8 @@ class EventConsumer
                        EventQueue *,
                        const std::vector<std::string> &,
                        std::string &,
-                       int event_id);
+                       int event_id,
+                       BulkSubscriptionData *bulk = nullptr);
     void connect(DeviceProxy *, const std::string &, DeviceData &, const std::string &, bool &);
 
     void shutdown();
@@ -527,6 +557,8 @@ class EventConsumer
                         bool stateless = false);
     int subscribe_event(DeviceProxy *device, EventType event, CallBack *callback, bool stateless = false);
     int subscribe_event(DeviceProxy *device, EventType event, int event_queue_size, bool stateless = false);
+    void subscribe_event(EventSubscriptionRequest &request);
+    void subscribe_events(std::vector<EventSubscriptionRequest> &requests);
 
     void unsubscribe_event(int event_id);
     virtual void get_subscribed_event_ids(DeviceProxy *, std::vector<int> &) = 0;
@@ -556,6 +588,9 @@ class EventConsumer
         return map_modification_lock;
     }
 
+    static EventReconnectionStats get_reconnection_stats();
+    static bool fwd_event_to_device(const zmq::message_t &, unsigned char, DeviceAttribute &);
+
     static KeepAliveThCmd cmd;
     static EventConsumerKeepAliveThread *keep_alive_thread;
 
@@ -589,6 +624,10 @@ class EventConsumer
     static std::vector<std::string> env_var_fqdn_prefix;
     static std::map<std::string, std::string> alias_map; // key - real host name, value - alias
 
+    static omni_mutex reconnection_stats_mutex;
+    static EventReconnectionStats reconnection_stats;
+    static std::chrono::microseconds reconnection_total_duration;
+
     std::string device_name;
     std::string obj_name_lower;
     int thread_id;
@@ -601,7 +640,8 @@ class EventConsumer
                              std::string &,
                              const std::string &,
                              EventCallBackStruct &,
-                             std::string &);
+                             std::string &,
+                             BulkSubscriptionData *bulk = nullptr);
 
     virtual void connect_event_channel(const std::string &, Database *, bool, DeviceData &) = 0;
 
@@ -625,6 +665,11 @@ class EventConsumer
     virtual void set_channel_type(EventChannelStruct &) = 0;
     virtual void zmq_specific(DeviceData &, std::string &, DeviceProxy *, const std::string &) = 0;
 
+    virtual bool query_shm_ring(DeviceProxy &)
+    {
+        return false;
+    }
+
     virtual ReceivedFromAdmin initialize_received_from_admin(const Tango::DevVarLongStringArray *pArray,
                                                              const std::string &local_callback_key,
                                                              const std::string &adm_name,
@@ -733,6 +778,7 @@ class ZmqEventConsumer : public EventConsumer, public omni_thread
 
     void query_event_system(std::ostream &os) override;
     static void enable_perf_mon(Tango::DevBoolean enabled);
+    static std::string get_connect_endpoint(const DevVarLongStringArray *, size_t);
 
     enum UserDataEventType
     {
@@ -770,6 +816,7 @@ class ZmqEventConsumer : public EventConsumer, public omni_thread
     }
 
     void zmq_specific(DeviceData &, std::string &, DeviceProxy *, const std::string &) override;
+    bool query_shm_ring(DeviceProxy &) override;
 
     ReceivedFromAdmin initialize_received_from_admin(const Tango::DevVarLongStringArray *pArray,
                                                      const std::string &local_callback_key,
@@ -798,6 +845,10 @@ class ZmqEventConsumer : public EventConsumer, public omni_thread
     ZmqDevPipeData zdpd;
     DevErrorList_var del;
 
+    std::map<std::string, std::shared_ptr<detail::ShmRingReader>> shm_rings; // Rings of the shm transport (by admin
+                                                                             // device name)
+    std::mutex shm_rings_mutex;                                              // Protects shm_rings
+
     int old_poll_nb;
     TangoMonitor subscription_monitor;
     omni_mutex sock_bound_mutex;
@@ -811,6 +862,7 @@ class ZmqEventConsumer : public EventConsumer, public omni_thread
     bool process_ctrl(zmq::message_t &, zmq::pollitem_t *, int &);
     void process_heartbeat(zmq::message_t &, zmq::message_t &, zmq::message_t &);
     void process_event(zmq::message_t &, zmq::message_t &, zmq::message_t &, zmq::message_t &);
+    bool read_shm_event_data(const zmq::message_t &, zmq::message_t &);
 
     void multi_tango_host(zmq::socket_t *, SocketCmd, const std::string &);
 
@@ -896,6 +948,24 @@ class EventConsumerKeepAliveThread : public omni_thread
     KeepAliveThCmd &shared_cmd;
 
   private:
+    //
+    // Events of one reconnected ZMQ channel waiting to be re-subscribed. All of them are re-subscribed with one
+    // admin device command, several channels being re-subscribed in parallel
+    //
+
+    struct ChannelResubscription
+    {
+        EvChanIte channel;
+        std::shared_ptr<DeviceProxy> adm_device_proxy;
+        std::vector<EvCbIte> events;
+        std::vector<std::string> domain_names;
+        std::vector<std::string> cmd_params;
+        std::vector<bool> subscribed;
+        bool bulk_cmd_supported{true};
+        bool failed{false};
+        std::chrono::steady_clock::time_point start;
+    };
+
     void *run_undetached(void *arg) override;
     bool reconnect_to_channel(const EvChanIte &, PointerWithLock<EventConsumer> &);
     void reconnect_to_event(const EvChanIte &, PointerWithLock<EventConsumer> &);
@@ -909,12 +979,18 @@ class EventConsumerKeepAliveThread : public omni_thread
     void main_reconnect(PointerWithLock<EventConsumer> &,
                         PointerWithLock<EventConsumer> &,
                         std::map<std::string, EventCallBackStruct>::iterator &,
-                        const std::map<std::string, EventChannelStruct>::iterator &);
+                        const std::map<std::string, EventChannelStruct>::iterator &,
+                        std::vector<ChannelResubscription> &);
     void re_subscribe_after_reconnect(PointerWithLock<EventConsumer> &,
                                       PointerWithLock<EventConsumer> &,
                                       const std::map<std::string, EventCallBackStruct>::iterator &,
                                       const std::map<std::string, EventChannelStruct>::iterator &,
-                                      const std::string &);
+                                      const std::string &,
+                                      bool already_subscribed = false);
+    void bulk_re_subscribe(PointerWithLock<EventConsumer> &,
+                           PointerWithLock<EventConsumer> &,
+                           std::vector<ChannelResubscription> &);
+    static void send_bulk_subscription(ChannelResubscription &);
 };
 
 /********************************************************************************
@@ -116,13 +116,7 @@ class hasAttributeName
     bool operator()(T *obj);
 };
 
-class FileDatabaseExt
-{
-  public:
-    FileDatabaseExt();
-
-    ~FileDatabaseExt() = default;
-};
+class FileDatabaseExt;
 
 class FileDatabase
 {
@@ -181,21 +175,27 @@ class FileDatabase
     CORBA::Any_var DbPutClassPipeProperty(CORBA::Any &);
     CORBA::Any_var DbPutDevicePipeProperty(CORBA::Any &);
 
+    // Rewrite the whole file from memory and clear the journal. The Put/Delete
+    // calls only append to the journal (<file>.journal) which is replayed when the
+    // file is parsed and compacted with this method once it gets large.
     void write_file();
 
   private:
     std::string filename;
     t_server m_server;
 
-    void read_char(std::ifstream &f);
+    void read_char();
     int class_lex(const std::string &word);
-    void jump_line(std::ifstream &f);
-    void jump_space(std::ifstream &f);
-    std::string read_word(std::ifstream &f);
+    void jump_line();
+    void jump_space();
+    std::string read_word();
     void CHECK_LEX(int lt, int le);
-    std::vector<std::string> parse_resource_value(std::ifstream &f);
+    std::vector<std::string> parse_resource_value();
+
+    std::string read_full_word();
 
-    std::string read_full_word(std::ifstream &f);
+    void journal_update(const char *command, const DevVarStringArray &args);
+    void replay_journal();
 
     static const char *lexical_word_null;
     static const char *lexical_word_number;
@@ -212,6 +212,9 @@ class FileDatabase
     int StartLine;
     char CurrentChar;
     char NextChar;
+    // Part of the file content still to be parsed
+    const char *read_ptr{nullptr};
+    const char *read_end{nullptr};
 
     std::string word;
 
@@ -118,11 +118,16 @@ const char *const NoClass = "noclass";
 const char *const LOCAL_POLL_REQUEST = "_local";
 const int LOCAL_REQUEST_STR_SIZE = 6;
 
+const char *const POLLED_SNAPSHOT_FORMAT = "PolledAttrSnapshot";
+
 const int MIN_POLL_PERIOD = 5;
 
 const int DEFAULT_TIMEOUT = 3200;
 const int DEFAULT_POLL_OLD_FACTOR = 4;
 
+const int FWD_ATT_READ_MAX_THREADS = 8;
+const int READ_PLAN_CACHE_SIZE = 8;
+
 const int TG_IMP_MINOR_TO = 10;
 const int TG_IMP_MINOR_DEVFAILED = 11;
 const int TG_IMP_MINOR_NON_DEVFAILED = 12;
@@ -151,6 +156,8 @@ const char *const DEFAULT_OMNI_CONF_FILE = "/etc/omniORB.cfg";
 
 const int EVENT_HEARTBEAT_PERIOD = 10;
 const int EVENT_RESUBSCRIBE_PERIOD = 600;
+const int EVENT_RESUBSCRIBE_MAX_THREADS = 8;
+const int EVENT_SUBSCRIBE_MAX_THREADS = 8;
 const int DEFAULT_EVENT_PERIOD = 1000;
 const char *const HEARTBEAT = "Event heartbeat";
 
@@ -172,6 +179,9 @@ const int PUB_HWM = 1000;
 const int SUB_HWM = 1000;
 const int SUB_SEND_HWM = 10000;
 const int DEFAULT_LINGER = 0;
+const char *const EVENT_DELTA_OPTION = ":delta"; // Client release suffix asking for delta encoded change events
+const int EVENT_DELTA_FULL_PERIOD = 100;          // Max number of delta encoded events between two full values
+const char *const EVENT_SHM_OPTION = ":shm";      // Client release suffix asking for events through the shm transport
 
 //
 // Event when using a file as database stuff
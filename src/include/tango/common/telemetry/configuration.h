@@ -6,7 +6,9 @@
 #if defined(TANGO_USE_TELEMETRY)
 
   #include <string>
+  #include <string_view>
   #include <variant>
+  #include <vector>
 
 namespace Tango::telemetry
 {
@@ -65,7 +67,7 @@ class Configuration
 
     using ServerClientDetails = std::variant<Server, Client>;
 
-    ///! Available exporter types for logs and traces
+    ///! Available exporter types for logs, traces and metrics
     ///!
     ///! \see Configuration::get_exporter_from_env
     enum class Exporter
@@ -99,6 +101,34 @@ class Configuration
     //! queue
     std::size_t batch_schedule_delay_in_milliseconds{Configuration::DEFAULT_BATCH_SCHEDULE_DELAY};
 
+    //! The sampling rule of the traces: the ratio (in [0, 1]) of the traces sampled for the operations whose span
+    //! name matches \p operation. The operation is either the exact span name (e.g.
+    //! "Tango::Device_5Impl::read_attributes_5") or a pattern in which '*' stands for any sequence of characters
+    //! (e.g. "*::read_attribute*").
+    struct SamplingRule
+    {
+        std::string operation;
+        double ratio;
+
+        //! Returns true if \p span_name matches the operation of the rule
+        bool matches(std::string_view span_name) const noexcept;
+    };
+
+    //! The ratio (in [0, 1]) of the traces sampled when no sampling rule applies - 1 samples all the traces
+    double traces_sampler_ratio{1.0};
+
+    //! The per operation sampling rules - the first rule matching the span name gives the sampling ratio
+    std::vector<SamplingRule> traces_sampler_rules;
+
+    //! Set to true (the default) for a span to be sampled if and only if its parent span (local or remote) is
+    //! sampled. The sampling ratios then only apply to the root spans.
+    bool traces_sampler_parent_based{true};
+
+    //! The maximum number of root spans (i.e., spans without a valid parent) sampled per second by the process - 0
+    //! (the default) means no limit. The root spans started above this rate are dropped, the other spans follow the
+    //! decision taken for their root span so that the sampled traces stay complete.
+    double traces_max_rate{0.0};
+
     //! Get the 'kind' of the configuration.
     //! \see Configuration::Kind.
     Configuration::Kind get_kind() const noexcept;
@@ -141,6 +171,16 @@ class Configuration
     std::string traces_endpoint, logs_endpoint;
     Exporter traces_exporter, logs_exporter;
 
+    //! The exporter (none by default) and the data collector endpoint for the kernel metrics
+    //!
+    //! The metrics are the ones of the process (see Tango::detail::MetricsRegistry), they are exported by the first
+    //! enabled interface having a metrics exporter.
+    std::string metrics_endpoint;
+    Exporter metrics_exporter;
+
+    //! The delay (in ms) between two exports of the metrics
+    std::size_t metrics_export_interval_in_milliseconds{Configuration::DEFAULT_METRICS_EXPORT_INTERVAL};
+
   private:
     //! Get the traces endpoint from the dedicated env. variable and the given exporter type
     //! Uses a defaults value in case the env. variable is undefined.
@@ -167,10 +207,18 @@ class Configuration
     //! \see Configuration::DEFAULT_GRPC_LOGS_ENDPOINT and Configuration::DEFAULT_HTTP_LOGS_ENDPOINT.
     std::string get_logs_endpoint_from_env(Exporter exporter_type);
 
+    //! Get the metrics endpoint from the dedicated env. variable and the given exporter type
+    //!
+    //! \returns A std::string containing the metrics endpoint.
+    //!
+    //! \see Interface::kEnvVarTelemetryMetricsEndPoint.
+    //! \see Configuration::DEFAULT_GRPC_METRICS_ENDPOINT and Configuration::DEFAULT_HTTP_METRICS_ENDPOINT.
+    std::string get_metrics_endpoint_from_env(Exporter exporter_type);
+
     //! Fetch the exporter type from the given env. variable
     //!
-    //! Defaults to Configuration::kDefaultExporter
-    Exporter get_exporter_from_env(const char *env_var);
+    //! Defaults to \p default_exporter
+    Exporter get_exporter_from_env(const char *env_var, Exporter default_exporter = kDefaultExporter);
 
     //! Check that endpoint describes a valid endpoint for the given exporter type, throws on error
     void ensure_valid_endpoint(const char *env_var, Configuration::Exporter exporter_type, const std::string &endpoint);
@@ -200,6 +248,17 @@ class Configuration
     //! Parse the given string as Exporter, throws on error
     Exporter to_exporter(std::string_view str);
 
+    //! Fetch a non negative number from the given env. variable, throws if it is not a number or if it is larger
+    //! than \p max_value
+    //!
+    //! Returns \p default_value if the env. variable is undefined
+    double get_number_from_env(const char *env_var, double default_value, double max_value);
+
+    //! Fetch the sampling rules from the given env. variable, throws on error
+    //!
+    //! The rules are a comma separated list of "operation=ratio" items, e.g. "read_attribute=0.01,command_inout=0.1"
+    std::vector<SamplingRule> get_sampling_rules_from_env(const char *env_var);
+
     //-----------------------------------------------------------------------------------------------------------------
     //! The default gRPC endpoint to which the telemetry data is exported: grpc://localhost:4317
     //-----------------------------------------------------------------------------------------------------------------
@@ -230,6 +289,13 @@ class Configuration
     //-----------------------------------------------------------------------------------------------------------------
     static const std::string DEFAULT_CONSOLE_LOGS_ENDPOINT;
 
+    //-----------------------------------------------------------------------------------------------------------------
+    //! The default endpoints to which the metrics are exported
+    //-----------------------------------------------------------------------------------------------------------------
+    static const std::string DEFAULT_GRPC_METRICS_ENDPOINT;
+    static const std::string DEFAULT_HTTP_METRICS_ENDPOINT;
+    static const std::string DEFAULT_CONSOLE_METRICS_ENDPOINT;
+
     //-----------------------------------------------------------------------------------------------------------------
     //! The default batch size for traces
     //-----------------------------------------------------------------------------------------------------------------
@@ -250,6 +316,11 @@ class Configuration
     //! in the queue (common to traces and logs)
     //-----------------------------------------------------------------------------------------------------------------
     static const std::size_t DEFAULT_BATCH_SCHEDULE_DELAY;
+
+    //-----------------------------------------------------------------------------------------------------------------
+    //! The default delay (in ms) between two exports of the metrics
+    //-----------------------------------------------------------------------------------------------------------------
+    static const std::size_t DEFAULT_METRICS_EXPORT_INTERVAL;
 };
 
 std::string to_string(Configuration::Exporter exporter_type);
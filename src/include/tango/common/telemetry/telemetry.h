@@ -63,6 +63,33 @@ constexpr const char *kEnvVarTelemetryTracesExporter = "TANGO_TELEMETRY_TRACES_E
 
 constexpr const char *kEnvVarTelemetryLogsExporter = "TANGO_TELEMETRY_LOGS_EXPORTER";
 
+//---------------------------------------------------------------------------------------------------------------------
+//! Traces sampling env. variables: the ratio of the sampled traces (a number in [0, 1]), the per operation sampling
+//! rules (e.g., "*::read_attribute*=0.01,*::command_inout*=0.1"), whether the spans follow the sampling decision of
+//! their parent and the maximum number of root spans sampled per second by the process (0 for no limit).
+//!
+//! \see Configuration::traces_sampler_ratio
+//---------------------------------------------------------------------------------------------------------------------
+constexpr const char *kEnvVarTelemetryTracesSamplerRatio = "TANGO_TELEMETRY_TRACES_SAMPLER_RATIO";
+
+constexpr const char *kEnvVarTelemetryTracesSamplerRules = "TANGO_TELEMETRY_TRACES_SAMPLER_RULES";
+
+constexpr const char *kEnvVarTelemetryTracesSamplerParentBased = "TANGO_TELEMETRY_TRACES_SAMPLER_PARENT_BASED";
+
+constexpr const char *kEnvVarTelemetryTracesMaxRate = "TANGO_TELEMETRY_TRACES_MAX_RATE";
+
+//---------------------------------------------------------------------------------------------------------------------
+//! Metrics env. variables: the exporter of the kernel metrics (none by default), the url to which they are sent and
+//! the delay (in ms) between two exports.
+//!
+//! \see Configuration::metrics_exporter
+//---------------------------------------------------------------------------------------------------------------------
+constexpr const char *kEnvVarTelemetryMetricsExporter = "TANGO_TELEMETRY_METRICS_EXPORTER";
+
+constexpr const char *kEnvVarTelemetryMetricsEndPoint = "TANGO_TELEMETRY_METRICS_ENDPOINT";
+
+constexpr const char *kEnvVarTelemetryMetricsExportInterval = "TANGO_TELEMETRY_METRICS_EXPORT_INTERVAL";
+
 //---------------------------------------------------------------------------------------------------------------------
 //! AttributeValue
 //!
@@ -381,6 +408,17 @@ class Interface
     //-----------------------------------------------------------------------------------------------------------------
     bool is_enabled() const noexcept;
 
+    //-----------------------------------------------------------------------------------------------------------------
+    //! Check if a span started with this interface could be sampled.
+    //!
+    //! This is a cheap check (no span is started) allowing the caller to skip the construction of the span
+    //! attributes. It returns false if the interface is disabled, if the traces are not exported or if the sampling
+    //! ratios are all 0 without parent based sampling. A true result does not mean that the next span is sampled.
+    //!
+    //! \returns: false if no span can be sampled, returns true otherwise.
+    //-----------------------------------------------------------------------------------------------------------------
+    bool may_sample_spans() const noexcept;
+
     //-----------------------------------------------------------------------------------------------------------------
     //! Enable the interface.
     //!
@@ -522,9 +560,13 @@ class Interface
     Tango::telemetry::Scope
         scope(Tango::telemetry::SpanPtr &span, const char *file = "unknown-source-file", int line = -1)
     {
-        span->set_attribute("code.filepath", Tango::logging_detail::basename(file));
-        span->set_attribute("code.lineno", std::to_string(line));
-        span->set_attribute("thread.id", thread_id_to_string());
+        // don't pay for the location of a span dropped by the sampler
+        if(span->is_recording())
+        {
+            span->set_attribute("code.filepath", Tango::logging_detail::basename(file));
+            span->set_attribute("code.lineno", std::to_string(line));
+            span->set_attribute("thread.id", thread_id_to_string());
+        }
         return Tango::telemetry::Scope(span);
     }
 
@@ -0,0 +1,116 @@
+#ifndef _INTERNAL_ATTR_READ_CACHE_H
+#define _INTERNAL_ATTR_READ_CACHE_H
+
+#include <tango/client/DeviceAttribute.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace Tango
+{
+class DeviceProxy;
+} // namespace Tango
+
+namespace Tango::detail
+{
+
+/// @brief Process wide client cache of attribute values
+///
+/// Values are stored per (device, attribute) and are returned by
+/// DeviceProxy::read_attribute_cached() when they are younger than the
+/// maximum age requested by the caller. The age is measured from the
+/// moment the value was received by this process, so that it does not
+/// depend on the clock of the device server host.
+///
+/// The cache is fed by the reads done through it and by the change,
+/// periodic, archive and alarm events received by the ZmqEventConsumer.
+///
+/// Concurrent reads of the same attribute which cannot be served from the
+/// cache are coalesced: only one thread sends the request to the device,
+/// the others wait for its result (single-flight).
+class AttributeReadCache
+{
+  public:
+    using clock = std::chrono::steady_clock;
+
+    struct Stats
+    {
+        std::uint64_t hits{0};
+        std::uint64_t misses{0};
+        std::uint64_t coalesced{0};
+        std::uint64_t event_updates{0};
+    };
+
+    static AttributeReadCache &instance();
+
+    /// @brief Build the cache key for an attribute of the device behind the proxy
+    static std::string make_key(DeviceProxy *device, const std::string &attr_name);
+
+    void enable(bool on);
+
+    bool is_enabled() const
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Return a copy of the cached value if it is younger than max_age
+    std::optional<DeviceAttribute> get(const std::string &key, std::chrono::milliseconds max_age);
+
+    /// @brief Store a value. Values reporting an error are not stored
+    void store(const std::string &key, const DeviceAttribute &value);
+
+    /// @brief Store a value received with an event
+    void store_from_event(const std::string &key, const DeviceAttribute &value);
+
+    /// @brief Return the cached value or call reader
+    ///
+    /// If another thread is already executing reader for the same key, wait
+    /// for its result instead of calling reader again. Exceptions thrown by
+    /// reader are forwarded to all the waiting threads.
+    DeviceAttribute
+        read(const std::string &key, std::chrono::milliseconds max_age, const std::function<DeviceAttribute()> &reader);
+
+    void clear();
+
+    Stats get_stats() const;
+
+  private:
+    struct Entry
+    {
+        DeviceAttribute value;
+        clock::time_point received;
+    };
+
+    struct InFlight
+    {
+        std::mutex mutex;
+        std::condition_variable cond;
+        bool done{false};
+        std::optional<DeviceAttribute> value;
+        std::exception_ptr error;
+    };
+
+    std::atomic<bool> enabled{false};
+
+    std::mutex mutex;
+    std::unordered_map<std::string, Entry> entries;
+    std::unordered_map<std::string, std::shared_ptr<InFlight>> in_flight;
+
+    std::atomic<std::uint64_t> hits{0};
+    std::atomic<std::uint64_t> misses{0};
+    std::atomic<std::uint64_t> coalesced{0};
+    std::atomic<std::uint64_t> event_updates{0};
+};
+
+} // namespace Tango::detail
+
+#endif // _INTERNAL_ATTR_READ_CACHE_H
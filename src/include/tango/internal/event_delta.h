@@ -0,0 +1,93 @@
+#ifndef _INTERNAL_EVENT_DELTA_H
+#define _INTERNAL_EVENT_DELTA_H
+
+#include <tango/common/tango_const.h>
+
+#include <atomic>
+#include <ctime>
+#include <mutex>
+#include <vector>
+
+namespace Tango
+{
+class DeviceAttribute;
+} // namespace Tango
+
+namespace Tango::detail
+{
+
+/// @brief Kind of value sent with a delta encoded change event
+///
+/// A delta encoded change event is a usual IDL 5 change event followed by the kind of value and a
+/// sequence of (start, length) runs. For a DELTA, the attribute value holds only the elements of
+/// these runs, which have to be copied in the previous value to rebuild the new one.
+enum class EventDeltaKind : CORBA::ULong
+{
+    FULL = 0,
+    DELTA = 1
+};
+
+/// @brief Server side encoding of the delta encoded change events of one attribute
+///
+/// Only the values of the numeric spectrum and image attributes are delta encoded. A full value is
+/// sent for the first event, after an error, when the data type or the dimensions change, when the
+/// delta would not be much smaller than the value and at least every EVENT_DELTA_FULL_PERIOD events.
+/// The mutex has to be held from the call to encode() until the event has been sent.
+class EventDeltaEncoder
+{
+  public:
+    /// @brief Encode the value. For a DELTA, `changed` holds the changed elements and `runs` their location
+    EventDeltaKind encode(const AttributeValue_5 &value, AttrValUnion &changed, DevVarULongArray &runs);
+
+    /// @brief Send a full value with the next event
+    void reset()
+    {
+        full_requested = true;
+    }
+
+    /// @brief Memorize a delta encoded change event subscription
+    void subscribe(bool new_subscriber);
+
+    /// @brief Return true if a client subscribed to the delta encoded change event recently
+    bool is_subscribed() const;
+
+    std::mutex &get_mutex()
+    {
+        return mutex;
+    }
+
+  private:
+    std::mutex mutex;
+    std::atomic<bool> full_requested{true};
+    std::atomic<time_t> last_subscription{0};
+    std::vector<unsigned char> previous;
+    long data_type{-1};
+    long dim_x{0};
+    long dim_y{0};
+    int events_since_full{0};
+};
+
+/// @brief Client side decoding of the delta encoded change events of one subscription
+class EventDeltaDecoder
+{
+  public:
+    /// @brief Rebuild the value of a received event in `dev_attr`
+    ///
+    /// Returns false if a DELTA is received without a previous value (first event or missed events).
+    bool decode(EventDeltaKind kind, const DevVarULongArray &runs, DeviceAttribute &dev_attr);
+
+    /// @brief Forget the previous value
+    void reset()
+    {
+        current.clear();
+        data_type = -1;
+    }
+
+  private:
+    std::vector<unsigned char> current;
+    int data_type{-1};
+};
+
+} // namespace Tango::detail
+
+#endif // _INTERNAL_EVENT_DELTA_H
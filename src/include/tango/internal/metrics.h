@@ -0,0 +1,239 @@
+#ifndef TANGO_INTERNAL_METRICS_H
+#define TANGO_INTERNAL_METRICS_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Tango::detail
+{
+
+// Kernel metrics: counters, gauges and latency histograms, always collected.
+//
+// The metrics are created by the MetricsRegistry, which owns them until the process exits (the metrics of a device
+// are removed with the device), and are then updated through a reference kept by the instrumented code (the registry
+// lookups take a mutex). The updates are lock free: the threads are spread over cache line aligned shards of the
+// counters and histograms, which are summed when the metrics are read.
+
+/// @brief Histogram of the duration of the requests executed by a device (in us) - labels: device, operation
+constexpr const char *METRIC_REQUEST_DURATION = "tango.server.request.duration";
+/// @brief Number of requests which ended with an exception - labels: device, operation
+constexpr const char *METRIC_REQUEST_ERRORS = "tango.server.request.errors";
+/// @brief Histogram of the delay between the date at which a polled object should be polled and the date at which
+/// it is actually polled (in us) - labels: device
+constexpr const char *METRIC_POLLING_LATENESS = "tango.server.polling.lateness";
+/// @brief Number of events pushed by the server - labels: event
+constexpr const char *METRIC_EVENTS_PUSHED = "tango.server.events.pushed";
+/// @brief Histogram of the time spent to push an event (in us)
+constexpr const char *METRIC_EVENT_PUSH_DURATION = "tango.server.event.push.duration";
+/// @brief Number of event data marshalled by the server
+constexpr const char *METRIC_EVENTS_MARSHALLED = "tango.server.events.marshalled";
+/// @brief Number of events which reused the attribute value marshalled for another event of the same poll cycle
+constexpr const char *METRIC_EVENTS_MARSHALLING_SAVED = "tango.server.events.marshalling.saved";
+/// @brief Number of bytes the server did not marshal thanks to the reused attribute values
+constexpr const char *METRIC_EVENTS_MARSHALLING_SAVED_BYTES = "tango.server.events.marshalling.saved_bytes";
+/// @brief Number of events received by the client
+constexpr const char *METRIC_EVENTS_RECEIVED = "tango.client.events.received";
+/// @brief Number of events the client detected as missed (from the event counter)
+constexpr const char *METRIC_EVENTS_MISSED = "tango.client.events.missed";
+/// @brief Number of events stored in the client event queues (subscriptions with an event queue)
+constexpr const char *METRIC_EVENTS_QUEUED = "tango.client.events.queued";
+/// @brief Number of events dropped because an event queue was full
+constexpr const char *METRIC_EVENTS_DROPPED = "tango.client.events.dropped";
+/// @brief Number of attribute reads and events received by the client through the shm transport
+constexpr const char *METRIC_CLIENT_SHM_VALUES = "tango.client.shm.values";
+/// @brief Number of attribute reads (then done through the network) and events (then missed) for which the client
+/// found the value already overwritten in the ring of the shm transport
+constexpr const char *METRIC_CLIENT_SHM_OVERWRITTEN = "tango.client.shm.overwritten";
+
+constexpr std::size_t METRICS_SHARDS = 8;
+
+/// @brief Return the shard updated by the calling thread (in [0, METRICS_SHARDS))
+std::size_t metrics_shard_index() noexcept;
+
+/// @brief A monotonic counter
+class Counter
+{
+  public:
+    void add(std::uint64_t n = 1) noexcept
+    {
+        shards[metrics_shard_index()].value.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    std::uint64_t value() const noexcept;
+
+  private:
+    struct alignas(64) Shard
+    {
+        std::atomic<std::uint64_t> value{0};
+    };
+
+    std::array<Shard, METRICS_SHARDS> shards;
+};
+
+/// @brief A value which goes up and down, e.g. a queue depth
+class Gauge
+{
+  public:
+    void set(std::int64_t v) noexcept
+    {
+        current.store(v, std::memory_order_relaxed);
+    }
+
+    void add(std::int64_t n) noexcept
+    {
+        current.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    std::int64_t value() const noexcept
+    {
+        return current.load(std::memory_order_relaxed);
+    }
+
+  private:
+    std::atomic<std::int64_t> current{0};
+};
+
+struct HistogramSnapshot;
+
+/// @brief A log-linear histogram of unsigned values
+///
+/// The values below 2^SUB_BUCKET_BITS have their own bucket, the larger ones are spread over 2^SUB_BUCKET_BITS
+/// buckets per power of two, so that the relative error on the quantiles is less than 1 / 2^SUB_BUCKET_BITS. The
+/// values larger than 2^MAX_BITS are counted in the last bucket.
+class Histogram
+{
+  public:
+    static constexpr unsigned SUB_BUCKET_BITS = 3;
+    static constexpr unsigned MAX_BITS = 32;
+    static constexpr std::size_t BUCKETS = std::size_t{MAX_BITS - SUB_BUCKET_BITS + 1} << SUB_BUCKET_BITS;
+    static constexpr std::size_t SHARDS = 4;
+
+    /// @brief Create an empty histogram updated through nb_shards shards
+    ///
+    /// Each shard holds all the buckets (about 2 kB): the histograms which are not updated concurrently, e.g. those
+    /// of a device, use only one.
+    explicit Histogram(std::size_t nb_shards = SHARDS);
+
+    void record(std::uint64_t value) noexcept;
+
+    HistogramSnapshot snapshot() const;
+
+    /// @brief Return the index of the bucket holding value
+    static std::size_t bucket_index(std::uint64_t value) noexcept;
+
+    /// @brief Return the largest value held by the bucket
+    static std::uint64_t bucket_upper_bound(std::size_t index) noexcept;
+
+  private:
+    struct alignas(64) Shard
+    {
+        std::array<std::atomic<std::uint64_t>, BUCKETS> buckets{};
+        std::atomic<std::uint64_t> sum{0};
+        std::atomic<std::uint64_t> max{0};
+    };
+
+    std::size_t nb_shards;
+    std::unique_ptr<Shard[]> shards;
+};
+
+/// @brief The content of a Histogram at a given time
+struct HistogramSnapshot
+{
+    std::uint64_t count{0};
+    std::uint64_t sum{0};
+    std::uint64_t max{0};
+    std::array<std::uint64_t, Histogram::BUCKETS> buckets{};
+
+    /// @brief Return an upper bound of the q-quantile (q in [0, 1]), 0 if the histogram is empty
+    std::uint64_t quantile(double q) const noexcept;
+};
+
+using MetricLabels = std::vector<std::pair<std::string, std::string>>;
+
+/// @brief The metrics of the process
+///
+/// A metric is identified by its name and its labels. Asking twice for the same metric returns the same object.
+class MetricsRegistry
+{
+  public:
+    static MetricsRegistry &instance();
+
+    Counter &counter(const std::string &name, const MetricLabels &labels = {});
+    Gauge &gauge(const std::string &name, const MetricLabels &labels = {});
+    Histogram &histogram(const std::string &name,
+                         const MetricLabels &labels = {},
+                         std::size_t nb_shards = Histogram::SHARDS);
+
+    /// @brief Remove the metrics having the given label value, e.g. those of a deleted device
+    ///
+    /// The references to these metrics must not be used any more.
+    void remove(const std::string &label, const std::string &value);
+
+    // Visit the metrics sorted by name and labels - the visitors must not create metrics
+    void for_each_counter(const std::function<void(const std::string &, const MetricLabels &, std::uint64_t)> &f) const;
+    void for_each_gauge(const std::function<void(const std::string &, const MetricLabels &, std::int64_t)> &f) const;
+    void for_each_histogram(
+        const std::function<void(const std::string &, const MetricLabels &, const HistogramSnapshot &)> &f) const;
+
+    /// @brief Write all the metrics as a JSON object
+    void json_dump(std::ostream &os) const;
+
+  private:
+    using Key = std::pair<std::string, MetricLabels>;
+
+    template <typename M, typename... Args>
+    M &get_or_create(std::map<Key, std::unique_ptr<M>> &metrics,
+                     const std::string &name,
+                     const MetricLabels &labels,
+                     Args... args);
+
+    template <typename M>
+    static void remove_from(std::map<Key, std::unique_ptr<M>> &metrics,
+                            const std::string &label,
+                            const std::string &value);
+
+    mutable std::mutex mutex;
+    std::map<Key, std::unique_ptr<Counter>> counters;
+    std::map<Key, std::unique_ptr<Gauge>> gauges;
+    std::map<Key, std::unique_ptr<Histogram>> histograms;
+};
+
+/// @brief Record the time elapsed between the construction and the destruction of the object in a histogram (in us)
+class HistogramTimer
+{
+  public:
+    explicit HistogramTimer(Histogram &histogram) noexcept :
+        histogram(histogram),
+        start(std::chrono::steady_clock::now())
+    {
+    }
+
+    HistogramTimer(const HistogramTimer &) = delete;
+    HistogramTimer &operator=(const HistogramTimer &) = delete;
+
+    ~HistogramTimer()
+    {
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        histogram.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()));
+    }
+
+  private:
+    Histogram &histogram;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace Tango::detail
+
+#endif // TANGO_INTERNAL_METRICS_H
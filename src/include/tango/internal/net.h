@@ -36,6 +36,23 @@ std::string get_port_from_endpoint(const std::string &endpoint);
 /// Returns the name and port from `tcp://$name:$port
 void split_endpoint(const std::string &endpoint, std::string &name, std::string &port);
 
+/// Returns the directory of the files of the `ipc://` endpoints of the current user:
+/// `$XDG_RUNTIME_DIR` or `/tmp/tango-$uid` (created if `create` is true)
+///
+/// Returns an empty string if the directory does not exist, does not belong to the current
+/// user or can be accessed by other users.
+std::string get_local_ipc_dir(bool create = false);
+
+/// Returns the `ipc://` endpoint bound by the device server process `pid` next to its tcp
+/// endpoint using `port`, when the local ipc event transport is enabled
+///
+/// Returns an empty string if there is no ipc directory, see get_local_ipc_dir().
+std::string get_local_ipc_endpoint(long pid, const std::string &port);
+
+/// Removes the files of the `ipc://` endpoints left by the device server processes of the
+/// current user which no longer exist (e.g. after a crash)
+void remove_stale_local_ipc_files();
+
 /// Returns the ip address/hostname of a CORBA URI
 ///
 /// Returns `myhost` when given giop:tcp:myhost:12345.
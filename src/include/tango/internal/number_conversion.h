@@ -0,0 +1,38 @@
+#ifndef _INTERNAL_NUMBER_CONVERSION_H
+#define _INTERNAL_NUMBER_CONVERSION_H
+
+#include <tango/common/tango_const.h>
+
+#include <string>
+#include <string_view>
+
+namespace Tango::detail
+{
+
+// Conversions between numbers and strings used for the properties.
+//
+// They give the same results as the stream operators in the classic locale (with a precision of
+// TANGO_FLOAT_PRECISION for the floating point numbers) whatever the global locale is, but are much faster as they
+// are based on std::from_chars() and std::to_chars(). They are instantiated for short, unsigned short, DevLong,
+// DevULong, DevLong64, DevULong64, float and double.
+
+/// @brief Parse the number at the beginning of `str`, like `std::istream >> value`
+///
+/// Leading white spaces are skipped and the characters following the number are ignored. Like for the streams, a
+/// minus sign is accepted for the unsigned types, the value wrapping around. Return false, leaving `value`
+/// unchanged, if `str` does not start with a number or if the number is out of range. "nan" and "inf" are not
+/// numbers.
+template <typename T>
+bool parse_number_prefix(std::string_view str, T &value);
+
+/// @brief Parse `str` which must hold a number, optionally preceded by white spaces
+template <typename T>
+bool parse_number(std::string_view str, T &value);
+
+/// @brief Format `value` like `std::ostream << value`
+template <typename T>
+std::string format_number(T value);
+
+} // namespace Tango::detail
+
+#endif // _INTERNAL_NUMBER_CONVERSION_H
@@ -1,69 +1,19 @@
 #ifndef TANGO_INTERNAL_PERF_MON_H
 #define TANGO_INTERNAL_PERF_MON_H
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
 #include <mutex>
 #include <ostream>
 #include <chrono>
 #include <ratio>
+#include <vector>
 
 namespace Tango
 {
-template <typename T>
-struct RingBuffer
-{
-    static constexpr const size_t size = 256;
-    T buffer[size];
-    size_t index = 0;
-    bool first_pass = true;
-
-    void reset()
-    {
-        index = 0;
-        first_pass = true;
-    }
-
-    void push(const T &v)
-    {
-        buffer[index] = v;
-        index = (index + 1) % size;
-        if(index == 0)
-        {
-            first_pass = false;
-        }
-    }
-
-    void json_dump(std::ostream &os)
-    {
-        os << "[";
-        bool first = true;
-        auto print_elem = [&first, &os, this](size_t i)
-        {
-            if(!first)
-            {
-                os << ",";
-            }
-
-            buffer[i].json_dump(os);
-
-            first = false;
-        };
-
-        if(!first_pass)
-        {
-            for(size_t i = index; i < size; ++i)
-            {
-                print_elem(i);
-            }
-        }
-
-        for(size_t i = 0; i < index; ++i)
-        {
-            print_elem(i);
-        }
-        os << "]";
-    }
-};
-
 using PerfClock = std::chrono::steady_clock;
 
 static constexpr const std::int64_t k_invalid_duration = std::numeric_limits<std::int64_t>::min();
@@ -73,14 +23,16 @@ inline std::int64_t duration_micros(PerfClock::time_point start, PerfClock::time
     return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
 }
 
+template <typename T>
+class SampleCollector;
+
 template <typename T>
 struct SamplePusher
 {
-    SamplePusher(bool enabled, T &sample, RingBuffer<T> &buffer, std::mutex &mutex) :
+    SamplePusher(bool enabled, T &sample, SampleCollector<T> &collector) :
         enabled(enabled),
         sample(sample),
-        buffer(buffer),
-        mutex(mutex)
+        collector(collector)
     {
     }
 
@@ -88,20 +40,14 @@ struct SamplePusher
     {
         if(enabled)
         {
-            if(mutex.try_lock())
-            {
-                buffer.push(sample);
-                mutex.unlock();
-            }
-
+            collector.push(sample);
             sample = T{};
         }
     }
 
     bool enabled;
     T &sample;
-    RingBuffer<T> &buffer;
-    std::mutex &mutex;
+    SampleCollector<T> &collector;
 };
 
 struct TimeBlockMicros
@@ -159,47 +105,182 @@ struct TimeBlockMicros
     std::int64_t *slot;
 };
 
+// Collects the performance samples pushed by any number of threads.
+//
+// Each thread pushes its samples in its own single producer/single consumer ring, so that pushing a sample never
+// takes a lock (the first sample pushed by a thread registers its ring). The rings are drained and their samples
+// merged by date when the samples are dumped. When the ring of a thread is full, its new samples are dropped until
+// the next dump. The ring of a thread which exits is reused by the next new thread, with the samples not dumped yet.
+//
+// A thread remembers its ring in a thread local variable per sample type: there must be a single collector per
+// sample type.
 template <typename T>
-struct DoubleBuffer
+class SampleCollector
 {
+  public:
+    static constexpr const size_t k_ring_size = 256;
+
+    SampleCollector() = default;
+    SampleCollector(const SampleCollector &) = delete;
+    SampleCollector &operator=(const SampleCollector &) = delete;
+
+    bool is_enabled() const noexcept
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    void enable(bool v)
+    {
+        std::lock_guard<std::mutex> lg{lock};
+        if(v && !is_enabled())
+        {
+            // Start from an empty set of samples
+            for(Ring *ring : rings)
+            {
+                ring->tail.store(ring->head.load(std::memory_order_acquire), std::memory_order_release);
+            }
+        }
+        enabled.store(v, std::memory_order_relaxed);
+    }
+
+    void push(const T &sample) noexcept
+    {
+        Ring *ring = local_ring();
+        if(ring == nullptr)
+        {
+            return;
+        }
+
+        size_t head = ring->head.load(std::memory_order_relaxed);
+        if(head - ring->tail.load(std::memory_order_acquire) == k_ring_size)
+        {
+            return;
+        }
+
+        ring->entries[head % k_ring_size] = Entry{PerfClock::now(), sample};
+        ring->head.store(head + 1, std::memory_order_release);
+    }
+
+    // Write the samples pushed since the previous call, "null" if the collection is disabled
     void json_dump(std::ostream &os)
     {
-        RingBuffer<T> *buffer = nullptr;
+        std::vector<Entry> entries;
         {
             std::lock_guard<std::mutex> lg{lock};
-            if(enabled)
+            if(!is_enabled())
             {
-                std::swap(front, back);
-                front->reset();
-                buffer = back;
+                os << "null";
+                return;
+            }
+
+            for(Ring *ring : rings)
+            {
+                size_t tail = ring->tail.load(std::memory_order_relaxed);
+                size_t head = ring->head.load(std::memory_order_acquire);
+                for(; tail != head; ++tail)
+                {
+                    entries.push_back(ring->entries[tail % k_ring_size]);
+                }
+                ring->tail.store(tail, std::memory_order_release);
+            }
+        }
+
+        std::stable_sort(entries.begin(),
+                         entries.end(),
+                         [](const Entry &lhs, const Entry &rhs) { return lhs.date < rhs.date; });
+
+        os << "[";
+        bool first = true;
+        for(auto &entry : entries)
+        {
+            if(!first)
+            {
+                os << ",";
             }
+            entry.sample.json_dump(os);
+            first = false;
         }
+        os << "]";
+    }
+
+    // Number of rings created so far, used or not
+    size_t get_nb_rings()
+    {
+        std::lock_guard<std::mutex> lg{lock};
+        return rings.size();
+    }
 
-        if(buffer == nullptr)
+  private:
+    struct Entry
+    {
+        PerfClock::time_point date;
+        T sample;
+    };
+
+    struct Ring
+    {
+        Entry entries[k_ring_size];
+        // Number of samples pushed and consumed, only written by the owner thread and the dumping thread respectively
+        alignas(64) std::atomic<size_t> head{0};
+        alignas(64) std::atomic<size_t> tail{0};
+        // Set while a thread pushes in this ring
+        std::atomic<bool> owned{true};
+    };
+
+    // Give the ring back when the thread exits, for it to be reused by another thread
+    struct RingOwner
+    {
+        ~RingOwner()
         {
-            os << "null";
+            if(ring != nullptr)
+            {
+                ring->owned.store(false, std::memory_order_release);
+            }
         }
-        else
+
+        Ring *ring = nullptr;
+    };
+
+    Ring *local_ring() noexcept
+    {
+        thread_local RingOwner owner;
+        if(owner.ring == nullptr)
         {
-            buffer->json_dump(os);
+            owner.ring = acquire_ring();
         }
+        return owner.ring;
     }
 
-    void enable(bool v)
+    Ring *acquire_ring() noexcept
     {
         std::lock_guard<std::mutex> lg{lock};
-        enabled = v;
-        if(v)
+        for(Ring *ring : rings)
+        {
+            bool owned = false;
+            if(ring->owned.compare_exchange_strong(owned, true, std::memory_order_acq_rel))
+            {
+                return ring;
+            }
+        }
+
+        try
+        {
+            // Only give up the ownership of the new ring once it is in the list
+            auto ring = std::make_unique<Ring>();
+            rings.push_back(ring.get());
+            return ring.release();
+        }
+        catch(...)
         {
-            front->reset();
+            return nullptr;
         }
     }
 
+    std::atomic<bool> enabled{false};
+    // Protects the list of rings and their consumption
     std::mutex lock;
-    RingBuffer<T> ring_buffers[2];
-    RingBuffer<T> *front = &ring_buffers[0];
-    RingBuffer<T> *back = &ring_buffers[1];
-    bool enabled = false;
+    // Never deleted: a thread can give its ring back after the collector is destroyed
+    std::vector<Ring *> rings;
 };
 } // namespace Tango
 
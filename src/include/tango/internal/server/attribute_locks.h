@@ -0,0 +1,54 @@
+#ifndef TANGO_INTERNAL_SERVER_ATTRIBUTE_LOCKS_H
+#define TANGO_INTERNAL_SERVER_ATTRIBUTE_LOCKS_H
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Tango::detail
+{
+
+/// @brief Per device attribute locks used by the attribute read locking model
+///
+/// Each attribute is protected by the lock of its group. By default, an
+/// attribute is alone in its group (named after the lower case attribute
+/// name). Locks are created on first use and never deleted.
+class AttributeLocks
+{
+  public:
+    using Guard = std::vector<std::unique_lock<std::timed_mutex>>;
+
+    void enable(bool on)
+    {
+        enabled.store(on, std::memory_order_relaxed);
+    }
+
+    bool is_enabled() const
+    {
+        return enabled.load(std::memory_order_relaxed);
+    }
+
+    /// @brief Put an attribute (lower case name) in a lock group
+    void set_group(const std::string &attr_name, const std::string &group);
+
+    /// @brief Lock the groups of the given attributes (lower case names)
+    ///
+    /// The groups are locked in a global order to avoid dead locks between
+    /// requests. Return false (with nothing locked) if one of the locks cannot
+    /// be taken before the timeout.
+    bool lock(const std::vector<std::string> &attr_names, std::chrono::milliseconds timeout, Guard &guard);
+
+  private:
+    std::atomic<bool> enabled{false};
+    std::mutex mutex;                                               // Protects the two maps
+    std::map<std::string, std::string> groups;                      // Group of the attributes not alone in their group
+    std::map<std::string, std::unique_ptr<std::timed_mutex>> locks; // Lock of each group
+};
+
+} // namespace Tango::detail
+
+#endif // TANGO_INTERNAL_SERVER_ATTRIBUTE_LOCKS_H
@@ -0,0 +1,62 @@
+#ifndef TANGO_INTERNAL_SERVER_COMMAND_INDEX_H
+#define TANGO_INTERNAL_SERVER_COMMAND_INDEX_H
+
+#include <cstddef>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Tango
+{
+class Command;
+} // namespace Tango
+
+namespace Tango::detail
+{
+
+/// @brief Case independent hash index on a command list
+///
+/// The index does not own the commands. Its keys are views on the lower case
+/// names of the commands, so lookups do not allocate memory.
+///
+/// Command lists are filled by the user code (command_factory()) directly
+/// into the vector, so the index is (re)built lazily when the list it was
+/// built for has changed size or storage. Code removing a command from a list
+/// must call invalidate().
+class CommandIndex
+{
+  public:
+    /// @brief Return the command with the given name (case independent) in list or nullptr
+    Command *find(const std::vector<Command *> &list, std::string_view name);
+
+    void invalidate();
+
+  private:
+    struct NoCaseHash
+    {
+        std::size_t operator()(std::string_view str) const noexcept;
+    };
+
+    struct NoCaseEqual
+    {
+        bool operator()(std::string_view lhs, std::string_view rhs) const noexcept;
+    };
+
+    bool is_valid_for(const std::vector<Command *> &list) const
+    {
+        return valid && list.size() == indexed_size && list.data() == indexed_data;
+    }
+
+    void build(const std::vector<Command *> &list);
+
+    std::shared_mutex mutex;
+    std::unordered_map<std::string_view, Command *, NoCaseHash, NoCaseEqual> index;
+    bool valid{false};
+    std::size_t indexed_size{0};
+    Command *const *indexed_data{nullptr};
+};
+
+} // namespace Tango::detail
+
+#endif // TANGO_INTERNAL_SERVER_COMMAND_INDEX_H
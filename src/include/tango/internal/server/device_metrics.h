@@ -0,0 +1,66 @@
+#ifndef TANGO_INTERNAL_SERVER_DEVICE_METRICS_H
+#define TANGO_INTERNAL_SERVER_DEVICE_METRICS_H
+
+#include <tango/internal/metrics.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace Tango::detail
+{
+
+/// @brief The metrics of one device
+///
+/// The request metrics are looked up by the name of the CORBA operation, once per request. The histograms of the
+/// operations already executed are found in a lock free table, only the first request of an operation going through
+/// the MetricsRegistry. The histograms are created when first used, with one shard as the requests of a device are
+/// mostly serialized by its monitor. The metrics of the device are removed from the registry when it is deleted.
+class DeviceMetrics
+{
+  public:
+    explicit DeviceMetrics(std::string device_name);
+    ~DeviceMetrics();
+
+    DeviceMetrics(const DeviceMetrics &) = delete;
+    DeviceMetrics &operator=(const DeviceMetrics &) = delete;
+
+    /// @brief Return the histogram of the duration of the given operation
+    Histogram &request_duration(const char *operation);
+
+    /// @brief Return the counter of the failed requests of the given operation
+    Counter &request_errors(const char *operation);
+
+    /// @brief Return the histogram of the polling lateness
+    Histogram &polling_lateness();
+
+  private:
+    static constexpr std::size_t OPERATION_SLOTS = 64;
+
+    struct Operation
+    {
+        std::string name;
+        Histogram &duration;
+    };
+
+    Histogram &register_request_duration(const char *operation);
+
+    std::string device_name;
+    std::array<std::atomic<Operation *>, OPERATION_SLOTS> operations{};
+    std::atomic<Histogram *> lateness{nullptr};
+};
+
+/// @brief Set the metrics of the device executing the request of the calling thread
+///
+/// The device sets them when it records the request in its black box, the call interceptor reads them once the
+/// request is done: the device is not looked for from the CORBA servant.
+void set_request_metrics(DeviceMetrics *metrics) noexcept;
+
+/// @brief Return the metrics of the device executing the request of the calling thread (nullptr if not known)
+DeviceMetrics *get_request_metrics() noexcept;
+
+} // namespace Tango::detail
+
+#endif // TANGO_INTERNAL_SERVER_DEVICE_METRICS_H
@@ -0,0 +1,101 @@
+#ifndef TANGO_INTERNAL_SERVER_JPEG_ENCODER_H
+#define TANGO_INTERNAL_SERVER_JPEG_ENCODER_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Tango::detail
+{
+
+enum class JpegColorSpace
+{
+    RGB,
+    RGBA,
+    GRAY
+};
+
+/// @brief Reusable JPEG encoder used by EncodedAttribute
+///
+/// The libjpeg compressors and their output buffers are kept from one image to the next. When more than one thread
+/// is configured, the image is split in horizontal stripes (a whole number of MCU rows each) which are encoded in
+/// parallel. The stripes are then concatenated as the restart intervals of a single standard baseline JPEG image. A
+/// single stripe is written directly in the caller buffer.
+///
+/// One image is encoded at a time: as the compressors, their buffers and the threads are shared, concurrent calls to
+/// encode() (e.g. for different buffers of the EncodedAttribute pool) are serialized. The EncodedAttribute methods
+/// are not reentrant anyway (the index of the next buffer of the pool is not protected), the buffer mutexes only
+/// protect a buffer between its encoding and the sending of its content.
+class JpegEncoder
+{
+  public:
+    JpegEncoder();
+    ~JpegEncoder();
+
+    JpegEncoder(const JpegEncoder &) = delete;
+    JpegEncoder &operator=(const JpegEncoder &) = delete;
+
+    /// @brief Set the number of threads used to encode one image (the caller thread included)
+    void set_nb_threads(int nb);
+
+    int get_nb_threads() const
+    {
+        return static_cast<int>(workers.size()) + 1;
+    }
+
+    /// @brief Encode an image
+    ///
+    /// The JPEG image is written in `*out`, a buffer allocated with malloc() holding `*out_capacity` bytes. It is
+    /// reallocated only if it is too small. Throws DevFailed (API_EncodeErr) if the image cannot be encoded.
+    /// Serialized with the other calls to encode() and set_nb_threads().
+    void encode(const unsigned char *image,
+                int width,
+                int height,
+                double quality,
+                JpegColorSpace type,
+                unsigned char **out,
+                std::size_t *out_capacity,
+                std::size_t *out_size);
+
+  private:
+    struct Stripe;
+
+    struct Job
+    {
+        const unsigned char *image{nullptr};
+        int width{0};
+        int height{0};
+        double quality{0};
+        JpegColorSpace type{JpegColorSpace::GRAY};
+        int rows_per_stripe{0};
+        std::size_t nb_stripes{0};
+    };
+
+    void start_workers(int nb);
+    void stop_workers();
+    void worker_loop();
+    void run_stripes(std::unique_lock<std::mutex> &lock);
+    void encode_stripe(std::size_t index);
+
+    // Held while an image is encoded
+    std::mutex encode_mutex;
+    std::vector<std::unique_ptr<Stripe>> stripes;
+    Job job;
+
+    std::vector<std::thread> workers;
+    std::mutex pool_mutex;
+    std::condition_variable work_cond;
+    std::condition_variable done_cond;
+    std::uint64_t generation{0};
+    std::size_t next_stripe{0};
+    std::size_t pending_stripes{0};
+    bool stopping{false};
+};
+
+} // namespace Tango::detail
+
+#endif // TANGO_INTERNAL_SERVER_JPEG_ENCODER_H
@@ -0,0 +1,57 @@
+#ifndef TANGO_INTERNAL_SERVER_LOSSLESS_CODEC_H
+#define TANGO_INTERNAL_SERVER_LOSSLESS_CODEC_H
+
+#include <cstddef>
+
+namespace Tango::detail
+{
+
+/// @brief Size of the image header (width and height, 32 bits big endian each) of the lossless formats
+constexpr std::size_t LOSSLESS_HEADER_SIZE = 8;
+
+/// @brief Number of samples coded with the same bit width
+constexpr std::size_t LOSSLESS_BLOCK_SIZE = 32;
+
+// Lossless image codec used by the LOSSLESS_* DevEncoded formats.
+//
+// The rows are coded one after the other. Every sample is predicted from the previous sample of the same channel in
+// the row, the first pixel of a row being predicted from the first pixel of the previous row (from 0 for the first
+// row): a row can only be decoded once the previous one is. The prediction residuals, computed modulo 2^bits and
+// zigzag mapped to small unsigned values, are cut in blocks of LOSSLESS_BLOCK_SIZE samples starting at each row
+// (the last block of a row being zero padded). Each block is stored as one byte holding the bit width `b` of its
+// largest residual followed by the residuals packed on `b` bits each (LSB first).
+
+/// @brief Maximum size of the coded data for an image of `nb_rows` rows of `row_samples` samples
+std::size_t lossless_max_size(std::size_t row_samples, std::size_t nb_rows, std::size_t sample_size);
+
+/// @brief Minimum size of the coded data for an image of `nb_rows` rows of `row_samples` samples
+std::size_t lossless_min_size(std::size_t row_samples, std::size_t nb_rows);
+
+/// @brief Code an image of `height` rows of `width` pixels of `channels` interleaved samples
+///
+/// `out` must hold at least lossless_max_size() bytes. Return the number of bytes written.
+std::size_t lossless_encode(
+    const unsigned char *image, std::size_t width, std::size_t height, std::size_t channels, unsigned char *out);
+std::size_t lossless_encode(
+    const unsigned short *image, std::size_t width, std::size_t height, std::size_t channels, unsigned char *out);
+
+/// @brief Decode the coded data of an image of `height` rows of `width` pixels of `channels` samples
+///
+/// `image` must hold width * height * channels samples. Throw DevFailed (API_DecodeErr) if the coded data are
+/// corrupted.
+void lossless_decode(const unsigned char *data,
+                     std::size_t size,
+                     std::size_t width,
+                     std::size_t height,
+                     std::size_t channels,
+                     unsigned char *image);
+void lossless_decode(const unsigned char *data,
+                     std::size_t size,
+                     std::size_t width,
+                     std::size_t height,
+                     std::size_t channels,
+                     unsigned short *image);
+
+} // namespace Tango::detail
+
+#endif // TANGO_INTERNAL_SERVER_LOSSLESS_CODEC_H
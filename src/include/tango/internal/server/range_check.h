@@ -0,0 +1,146 @@
+#ifndef _INTERNAL_RANGE_CHECK_H
+#define _INTERNAL_RANGE_CHECK_H
+
+#include <tango/common/tango_const.h>
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+namespace Tango::detail
+{
+
+/// @brief Number of elements tested at once by find_first_if()
+constexpr std::size_t RANGE_CHECK_BLOCK_SIZE = 64;
+
+/// @brief Return the index of the first element for which `pred` is true, `nb` if there is none
+///
+/// This is used to check attribute values against alarm levels and write limits. Instead of testing the elements
+/// one by one with an early exit (which prevents the compiler from vectorizing the loop), the elements are tested
+/// by blocks of RANGE_CHECK_BLOCK_SIZE without any branch. Only the block holding a matching element is then
+/// scanned element per element. `pred` must be a cheap function without side effects, using comparison operators
+/// only, so that the result is the same as with the element per element loop (including for NaN).
+///
+/// The compilers vectorize this loop for the 8, 16 and 32 bits types only. The 64 bits types use the explicit
+/// kernels of find_first_out_of_range().
+template <typename T, typename Pred>
+std::size_t find_first_if(const T *data, std::size_t nb, Pred pred)
+{
+    std::size_t i = 0;
+
+    for(; i + RANGE_CHECK_BLOCK_SIZE <= nb; i += RANGE_CHECK_BLOCK_SIZE)
+    {
+        unsigned int found = 0;
+        for(std::size_t j = 0; j < RANGE_CHECK_BLOCK_SIZE; ++j)
+        {
+            found |= static_cast<unsigned int>(pred(data[i + j]));
+        }
+
+        if(found != 0)
+        {
+            break;
+        }
+    }
+
+    for(; i < nb; ++i)
+    {
+        if(pred(data[i]))
+        {
+            return i;
+        }
+    }
+
+    return nb;
+}
+
+/// @brief Return true if `val` is a NaN or an infinite value (always false for non floating point types)
+template <typename T>
+bool is_not_finite(const T &val)
+{
+    if constexpr(std::is_floating_point_v<T>)
+    {
+        return !std::isfinite(val);
+    }
+    else
+    {
+        return false;
+    }
+}
+
+/// @brief The tests done on each element by find_first_out_of_range()
+///
+/// An element is out of range when it is below `low` (or equal to it when `inclusive` is set), above `high` (or
+/// equal to it when `inclusive` is set) or, if `check_finite` is set, not finite. The alarm levels are inclusive
+/// while the write limits are not. As with the comparison operators, a NaN is never below or above a limit.
+template <typename T>
+struct RangeCheck
+{
+    T low{};
+    T high{};
+    bool check_low{false};
+    bool check_high{false};
+    bool inclusive{false};
+    bool check_finite{false};
+
+    bool operator()(const T &val) const
+    {
+        bool below = inclusive ? (val <= low) : (val < low);
+        bool above = inclusive ? (val >= high) : (val > high);
+        return (check_low & below) | (check_high & above) | (check_finite & is_not_finite(val));
+    }
+};
+
+/// @brief Return the index of the first element out of range, `nb` if there is none
+template <typename T>
+std::size_t find_first_out_of_range(const T *data, std::size_t nb, const RangeCheck<T> &check)
+{
+    return find_first_if(data, nb, check);
+}
+
+/// @brief The kernels of find_first_out_of_range() for the 64 bits types, which the compilers do not vectorize
+enum class RangeCheckKernel
+{
+    SCALAR, // find_first_if()
+    SSE2,   // x86 only, always available on x86-64
+    AVX2    // x86 with GCC or Clang only, selected at run time when the CPU supports it
+};
+
+/// @brief Return the best kernel for this build and this CPU
+RangeCheckKernel range_check_kernel();
+
+/// @brief Same as find_first_out_of_range() with the given kernel, which must be supported
+std::size_t find_first_out_of_range(const DevDouble *data,
+                                    std::size_t nb,
+                                    const RangeCheck<DevDouble> &check,
+                                    RangeCheckKernel kernel);
+std::size_t find_first_out_of_range(const DevLong64 *data,
+                                    std::size_t nb,
+                                    const RangeCheck<DevLong64> &check,
+                                    RangeCheckKernel kernel);
+std::size_t find_first_out_of_range(const DevULong64 *data,
+                                    std::size_t nb,
+                                    const RangeCheck<DevULong64> &check,
+                                    RangeCheckKernel kernel);
+
+template <>
+inline std::size_t find_first_out_of_range(const DevDouble *data, std::size_t nb, const RangeCheck<DevDouble> &check)
+{
+    return find_first_out_of_range(data, nb, check, range_check_kernel());
+}
+
+template <>
+inline std::size_t find_first_out_of_range(const DevLong64 *data, std::size_t nb, const RangeCheck<DevLong64> &check)
+{
+    return find_first_out_of_range(data, nb, check, range_check_kernel());
+}
+
+template <>
+inline std::size_t
+    find_first_out_of_range(const DevULong64 *data, std::size_t nb, const RangeCheck<DevULong64> &check)
+{
+    return find_first_out_of_range(data, nb, check, range_check_kernel());
+}
+
+} // namespace Tango::detail
+
+#endif // _INTERNAL_RANGE_CHECK_H
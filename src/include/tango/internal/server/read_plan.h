@@ -0,0 +1,70 @@
+#ifndef TANGO_INTERNAL_SERVER_READ_PLAN_H
+#define TANGO_INTERNAL_SERVER_READ_PLAN_H
+
+#include <tango/common/tango_const.h>
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Tango::detail
+{
+
+/// @brief Resolved attribute name list of a read_attributes request
+///
+/// One item per requested name, in the request order. Plans with unknown
+/// attributes are not cached.
+struct ReadPlan
+{
+    enum class Kind
+    {
+        Attribute,
+        State,
+        Status,
+        Unknown
+    };
+
+    struct Item
+    {
+        Kind kind;
+        long idx_in_multi_attr; // -1 for State, Status and unknown attributes
+        bool read;              // The attribute has to be read
+        bool write;             // The attribute is also a writable one
+    };
+
+    std::vector<Item> items;
+    std::size_t nb_read{0};
+    std::size_t nb_write{0};
+};
+
+/// @brief Per device cache of the last used read plans
+///
+/// Plans are keyed by the exact (case sensitive) name list and are valid for
+/// one generation of the device attribute list. They are dropped when the
+/// generation changes (dynamic attribute added or removed).
+class ReadPlanCache
+{
+  public:
+    std::shared_ptr<const ReadPlan> get(const DevVarStringArray &names, std::uint64_t generation);
+    void put(const DevVarStringArray &names, std::uint64_t generation, std::shared_ptr<const ReadPlan> plan);
+
+  private:
+    struct Entry
+    {
+        std::vector<std::string> names;
+        std::shared_ptr<const ReadPlan> plan;
+    };
+
+    static bool same_names(const std::vector<std::string> &, const DevVarStringArray &);
+
+    std::mutex mutex;
+    std::uint64_t plans_generation{0};
+    std::list<Entry> entries; // Most recently used first
+};
+
+} // namespace Tango::detail
+
+#endif // TANGO_INTERNAL_SERVER_READ_PLAN_H
@@ -0,0 +1,157 @@
+#ifndef _INTERNAL_SHM_RING_H
+#define _INTERNAL_SHM_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+namespace Tango::detail
+{
+
+// Shared memory ring used by the shm transport between a device server and the clients running on the same host.
+//
+// The device server writes the event values in the slots of the ring, one after the other, and sends a ShmRingRef to
+// the clients in the events. The clients get the ring name from the QueryShmTransport admin device command when they
+// subscribe and read the values in place, from a read only mapping of the segment. Only the user running the device
+// server can map it. Each slot is protected by a sequence number (seqlock): it is odd while a value is written and is
+// then set to the even number of the reference. A reader checks it before and after having used the value and
+// discards the value if it changed, the slot having been reused for another value in the meantime.
+
+/// @brief Location of one value in a shared memory ring
+struct ShmRingRef
+{
+    std::uint64_t key{0}; // Random key identifying the segment (a new one for each device server run)
+    std::uint32_t slot{0};
+    std::uint64_t seq{0};
+    std::uint64_t size{0};
+};
+
+/// @brief Number of 32 bits integers used to send a ShmRingRef in a Tango::DevVarLongArray or a CDR stream
+constexpr std::size_t SHM_RING_REF_WORDS = 7;
+
+/// @brief Store `ref` in `words` (SHM_RING_REF_WORDS elements)
+void shm_ring_ref_to_words(const ShmRingRef &ref, std::uint32_t *words);
+
+/// @brief Build a ShmRingRef from SHM_RING_REF_WORDS elements
+ShmRingRef shm_ring_ref_from_words(const std::uint32_t *words);
+
+/// @brief Return the name of the shared memory segment of the device server process `pid`
+std::string get_shm_ring_name(long pid);
+
+/// @brief Remove the shared memory segments left by the device server processes of the current user which no longer
+/// exist
+void remove_stale_shm_rings();
+
+/// @brief Device server side of a shared memory ring
+class ShmRingWriter
+{
+  public:
+    /// @brief Create the segment `name` with `nb_slots` slots of `slot_size` bytes
+    ///
+    /// A segment with the same name (left by a crashed process with the same pid) is replaced. Throws a DevFailed
+    /// if the segment cannot be created. The segment is removed when the object is deleted.
+    ShmRingWriter(const std::string &name, std::size_t nb_slots, std::size_t slot_size);
+    ~ShmRingWriter();
+
+    ShmRingWriter(const ShmRingWriter &) = delete;
+    ShmRingWriter &operator=(const ShmRingWriter &) = delete;
+
+    /// @brief Copy `size` bytes in the next free slot. Returns nothing if the value does not fit in a slot
+    ///
+    /// This can be called by several threads at the same time.
+    std::optional<ShmRingRef> publish(const void *data, std::size_t size);
+
+    const std::string &get_name() const
+    {
+        return name;
+    }
+
+    std::uint64_t get_key() const
+    {
+        return key;
+    }
+
+    std::size_t get_nb_slots() const
+    {
+        return nb_slots;
+    }
+
+    std::size_t get_slot_size() const
+    {
+        return slot_size;
+    }
+
+  private:
+    std::string name;
+    std::uint64_t key{0};
+    std::size_t nb_slots{0};
+    std::size_t slot_size{0};
+    std::size_t mapped_size{0};
+    char *base{nullptr};
+};
+
+/// @brief Client side of a shared memory ring
+class ShmRingReader
+{
+  public:
+    /// @brief Map the segment `name` read only. Returns nullptr if it does not exist or if its key is not `key`
+    ///
+    /// A segment with another key is not the one of the device server (e.g. the client and the device server do not
+    /// share the same /dev/shm).
+    static std::shared_ptr<ShmRingReader> open(const std::string &name, std::uint64_t key);
+
+    ~ShmRingReader();
+
+    ShmRingReader(const ShmRingReader &) = delete;
+    ShmRingReader &operator=(const ShmRingReader &) = delete;
+
+    /// @brief Execute `func(const char *data, std::size_t size)` on the value `ref` in place
+    ///
+    /// Returns false (and does not execute `func` or discards its result) if the slot does not hold this value any
+    /// more. As the value may be overwritten while `func` runs, `func` must not trust its content (e.g. sizes read in
+    /// it must be checked against `size`) and its result must be discarded when false is returned.
+    template <typename F>
+    bool read(const ShmRingRef &ref, F &&func) const
+    {
+        const std::atomic<std::uint64_t> *seq = get_slot_seq(ref);
+        if(seq == nullptr || seq->load(std::memory_order_acquire) != ref.seq)
+        {
+            return false;
+        }
+
+        func(get_slot_data(ref.slot), static_cast<std::size_t>(ref.size));
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return seq->load(std::memory_order_relaxed) == ref.seq;
+    }
+
+    const std::string &get_name() const
+    {
+        return name;
+    }
+
+    std::uint64_t get_key() const
+    {
+        return key;
+    }
+
+  private:
+    ShmRingReader() = default;
+
+    const std::atomic<std::uint64_t> *get_slot_seq(const ShmRingRef &ref) const;
+    const char *get_slot_data(std::uint32_t slot) const;
+
+    std::string name;
+    std::uint64_t key{0};
+    std::size_t nb_slots{0};
+    std::size_t slot_size{0};
+    std::size_t mapped_size{0};
+    const char *base{nullptr};
+};
+
+} // namespace Tango::detail
+
+#endif // _INTERNAL_SHM_RING_H
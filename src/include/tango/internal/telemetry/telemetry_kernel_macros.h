@@ -108,19 +108,24 @@ class SilentKernelScope
           throw;                                                                                               \
       }
 
+    /// The span attributes ATTRS (an initializer list enclosed in `()`), only built if INTERFACE may sample the span
+  #define TANGO_TELEMETRY_KERNEL_ATTRIBUTES(INTERFACE, ATTRS) \
+      ((INTERFACE)->may_sample_spans() ? Tango::telemetry::Attributes ATTRS : Tango::telemetry::Attributes{})
+
     /// Helper macros for tango RPC starting points
     /// ATTRS is an initializer list enclosed in `()`, pass `({})` for no additional attributes
-  #define TANGO_TELEMETRY_TRACE_BEGIN(ATTRS)                                              \
-      auto span = TANGO_TELEMETRY_KERNEL_CLIENT_SPAN(Tango::telemetry::Attributes ATTRS); \
-      auto scope = TANGO_TELEMETRY_SCOPE(span);                                           \
+  #define TANGO_TELEMETRY_TRACE_BEGIN(ATTRS)                                                     \
+      auto span = TANGO_TELEMETRY_KERNEL_CLIENT_SPAN(                                            \
+          TANGO_TELEMETRY_KERNEL_ATTRIBUTES(Tango::telemetry::Interface::get_current(), ATTRS)); \
+      auto scope = TANGO_TELEMETRY_SCOPE(span);                                                  \
       TANGO_TELEMETRY_TRY
 
     /// Helper macros for tango RPC starting points inside the kernel part of the device server
     /// ATTRS is an initializer list enclosed in `()`, pass `({})` for no additional attributes
-  #define TANGO_TELEMETRY_KERNEL_TRACE_BEGIN(ATTRS)                                                              \
-      auto telemetry_interface_scope = TANGO_TELEMETRY_ACTIVE_INTERFACE(telemetry());                            \
-      auto scope =                                                                                               \
-          TANGO_TELEMETRY_KERNEL_SERVER_SPAN(TANGO_CURRENT_FUNCTION, Tango::telemetry::Attributes ATTRS, cl_id); \
+  #define TANGO_TELEMETRY_KERNEL_TRACE_BEGIN(ATTRS)                                              \
+      auto telemetry_interface_scope = TANGO_TELEMETRY_ACTIVE_INTERFACE(telemetry());            \
+      auto scope = TANGO_TELEMETRY_KERNEL_SERVER_SPAN(                                           \
+          TANGO_CURRENT_FUNCTION, TANGO_TELEMETRY_KERNEL_ATTRIBUTES(telemetry(), ATTRS), cl_id); \
       TANGO_TELEMETRY_TRY
 
   #define TANGO_TELEMETRY_TRACE_END() TANGO_TELEMETRY_CATCH
@@ -63,6 +63,11 @@ std::optional<bool> to_boolean(std::string_view str);
 /// Return `default_value` in case it is not present, throws for unkonwn content
 bool get_boolean_env_var(const char *env_var, bool default_value);
 
+/// @brief Return false if there is no process `pid` on this host (always true on Windows)
+///
+/// Used to remove the files left by the device servers which crashed.
+bool is_process_running(long pid);
+
 void stringify_any(std::ostream &os, const CORBA::Any &any);
 
 void stringify_attribute_data(std::ostream &os, const DeviceAttribute &da);
@@ -110,6 +115,7 @@ std::string build_device_trl(DeviceProxy *device, const std::vector<std::string>
 /// - `short_attr`: Attribute name (optional, lower cased)
 /// - `#dbase=no`: no database suffix (optional)
 /// - `idl5_`: idl prefix for event name (optional)
+/// - `delta_`: delta encoded change event (optional)
 /// - `change`: Event name
 ///
 /// @{
@@ -132,6 +138,29 @@ std::string remove_idl_for_compat(std::string fq_event_name);
 /// @brief Get the event name, one of @ref EventName, from a fully qualified event name
 std::string get_event_name(std::string fq_event_name);
 
+/// @brief Insert `delta_` after the idl prefix (if any) in a string like `idl5_change`
+///
+/// This is the event name used for the delta encoded change events, see detail::EventDeltaEncoder.
+std::string add_delta_prefix(std::string event_name);
+
+/// @brief Remove `delta_` from a string like `idl5_delta_change`
+std::string remove_delta_prefix(std::string event_name);
+
+/// @brief Return true for a string like `idl5_delta_change` or a fully qualified event name ending with it
+bool is_delta_event_name(const std::string &event_name);
+
+/// @brief Insert `shm_` after the idl prefix (if any) in a string like `idl5_change` or a fully qualified event
+/// name ending with it
+///
+/// This is the event name used for the events sent through the shm transport, see detail::ShmRingWriter.
+std::string add_shm_prefix(std::string event_name);
+
+/// @brief Remove `shm_` from a string like `idl5_shm_change` or a fully qualified event name ending with it
+std::string remove_shm_prefix(std::string event_name);
+
+/// @brief Return true for a string like `idl5_shm_change` or a fully qualified event name ending with it
+bool is_shm_event_name(const std::string &event_name);
+
 } // namespace Tango::detail
 
 namespace Tango
@@ -0,0 +1,66 @@
+#ifndef TANGO_INTERNAL_WORKER_POOL_H
+#define TANGO_INTERNAL_WORKER_POOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace Tango::detail
+{
+
+// Process wide pool of threads running the calls the library fans out to several devices or device servers (event
+// subscriptions and re-subscriptions, forwarded attribute root reads).
+//
+// The iterations of a parallel loop are shared between the calling thread and some pool threads. As the calling
+// thread takes its share of the iterations, a loop never waits for a pool thread to be free and loops can be
+// nested. The pool threads are created when needed (up to WORKER_POOL_MAX_THREADS), are known by omniORB (the
+// iterations can take a TangoMonitor) and wait for the next loops until the process exits.
+
+constexpr std::size_t WORKER_POOL_MAX_THREADS = 32;
+
+class WorkerPool
+{
+  public:
+    static WorkerPool &instance();
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    /// @brief Execute func(i) for i in [0, nb), with up to max_parallel threads (the calling thread included)
+    ///
+    /// Return once all the iterations are done. func must not throw.
+    void for_each(std::size_t nb, std::size_t max_parallel, const std::function<void(std::size_t)> &func);
+
+    /// @brief Number of threads created by the pool
+    std::size_t get_nb_threads();
+
+  private:
+    struct Loop;
+
+    WorkerPool() = default;
+
+    void post(const std::shared_ptr<Loop> &loop, std::size_t nb_helpers);
+    void withdraw(const std::shared_ptr<Loop> &loop);
+    void worker_loop();
+    static void run(Loop &loop);
+
+    std::mutex lock;
+    std::condition_variable work_cond;
+    // One entry per pool thread asked to help a loop
+    std::deque<std::shared_ptr<Loop>> tickets;
+    std::size_t nb_threads{0};
+    std::size_t nb_idle{0};
+};
+
+/// @brief Execute func(i) for i in [0, nb) with the worker pool, using up to max_parallel threads
+inline void for_each_in_parallel(std::size_t nb, std::size_t max_parallel, const std::function<void(std::size_t)> &func)
+{
+    WorkerPool::instance().for_each(nb, max_parallel, func);
+}
+
+} // namespace Tango::detail
+
+#endif // TANGO_INTERNAL_WORKER_POOL_H
@@ -46,11 +46,14 @@
 #include <tango/common/utils/assert.h>
 #include <tango/server/tango_config.h>
 
+#include <atomic>
+#include <cstdint>
 #include <iterator>
 #include <type_traits>
 #include <variant>
 #include <vector>
 #include <map>
+#include <memory>
 #include <string>
 
 namespace Tango
@@ -266,6 +269,11 @@ struct LastAttrValue
 
 class EventSupplier;
 
+namespace detail
+{
+class EventDeltaEncoder;
+} // namespace detail
+
 //=============================================================================
 //
 //            The Attribute class
@@ -1977,6 +1985,26 @@ class Attribute
         old_alarm = alarm;
     }
 
+    void set_quality_update_counter(std::atomic<std::uint64_t> *counter)
+    {
+        quality_updates = counter;
+    }
+
+    // In incremental state mode, the quality is kept when the value is deleted after an event is pushed
+    void set_incremental_state(bool on)
+    {
+        incremental_state = on;
+    }
+
+    // Signal to the device that the attribute quality may have changed
+    void quality_updated()
+    {
+        if(quality_updates != nullptr)
+        {
+            quality_updates->fetch_add(1, std::memory_order_release);
+        }
+    }
+
     bool is_startup_exception()
     {
         return check_startup_exceptions;
@@ -2003,6 +2031,11 @@ class Attribute
 
     void remove_client_lib(int, const std::string &);
 
+    detail::EventDeltaEncoder &get_change_delta_encoder()
+    {
+        return *change_delta_encoder;
+    }
+
     void add_config_5_specific(AttributeConfig_5 &);
     void add_startup_exception(std::string, const DevFailed &);
 
@@ -2317,6 +2350,8 @@ class Attribute
     std::vector<std::string> mcast_event;    // In case of multicasting used for event transport
     AttrQuality old_quality;                 // Previous attribute quality
     std::bitset<numFlags> old_alarm;         // Previous attribute alarm
+    std::atomic<std::uint64_t> *quality_updates{nullptr}; // Device quality update counter (in MultiAttribute)
+    bool incremental_state{false};                        // Device state computed in incremental mode
     std::map<std::string, DevFailed> startup_exceptions; // Map containing exceptions related to attribute configuration
                                                          // raised during the server startup sequence
     bool check_startup_exceptions{
@@ -2326,6 +2361,7 @@ class Attribute
     bool att_mem_exception{false}; // Flag set to true if the attribute is writable and
                                    // memorized and if it failed at init
     std::vector<int> client_lib[numEventType]; // Clients lib used (for event sending and compat)
+    std::unique_ptr<detail::EventDeltaEncoder> change_delta_encoder; // Delta encoded change events
 };
 
 //
@@ -53,6 +53,11 @@
 namespace Tango
 {
 
+namespace detail
+{
+class DeviceMetrics;
+}
+
 #define IP_ADDR_BUFFER_SIZE 80
 
 //==================================================================================================================
@@ -254,6 +259,12 @@ class BlackBox
 
     Tango::DevVarStringArray *read(long);
 
+    // The metrics of the device owning the black box, in which the requests it records are measured
+    void set_metrics(detail::DeviceMetrics *m)
+    {
+        metrics = m;
+    }
+
   private:
     void inc_indexes();
     void get_client_host();
@@ -273,6 +284,7 @@ class BlackBox
     omni_mutex sync;
 
     std::string elt_str;
+    detail::DeviceMetrics *metrics{nullptr};
 };
 
 } // namespace Tango
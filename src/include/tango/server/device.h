@@ -45,11 +45,14 @@
 #include <tango/server/auto_tango_monitor.h>
 #include <tango/common/telemetry/telemetry.h>
 
+#include <cstdint>
 #include <string_view>
 #include <vector>
 #include <map>
 #include <algorithm>
 #include <memory>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace Tango
 {
@@ -62,6 +65,14 @@ class Util;
 class FwdWrongConf;
 class DbDevice;
 class DevicePipeBlob;
+class PipeStreamWriter;
+
+namespace detail
+{
+class AttributeLocks;
+class CommandIndex;
+class DeviceMetrics;
+} // namespace detail
 
 /** @defgroup Server Server classes */
 
@@ -211,6 +222,58 @@ class DeviceImpl : public virtual POA_Tango::Device
      */
     void set_state(const Tango::DevState &new_state);
 
+    /**
+     * Enable or disable the incremental device state computation.
+     *
+     * By default, the default dev_state() method reads all the attributes with alarm levels defined (except the
+     * polled ones and the ones already read in the same request) to check their alarms. In incremental mode, it
+     * uses the attribute quality factors computed each time an attribute value is set (read by a client or by the
+     * polling thread, or pushed with an event) and the state is computed again only when one of these quality
+     * factors may have changed. An attribute which is never read, polled or pushed keeps its last quality factor.
+     *
+     * @param on Set to true to enable the incremental state computation
+     */
+    void set_incremental_state(bool on);
+
+    /**
+     * Check if the incremental device state computation is enabled.
+     *
+     * @return True if the incremental state computation is enabled
+     */
+    bool is_incremental_state()
+    {
+        return ext->incremental_state;
+    }
+
+    /**
+     * Enable or disable the attribute read locking model.
+     *
+     * With the default BY_DEVICE serialization model, a read_attributes request (including the
+     * read_attr_hardware() call) is executed with the device monitor locked. When the attribute read locking model is
+     * enabled, read_attributes requests from IDL 3 clients and above hold the device monitor in shared mode and only
+     * lock the attributes they read (or their lock groups). Requests reading different attributes are then executed
+     * in parallel: their always_executed_hook(), read_attr_hardware() and attribute read method calls run
+     * concurrently in several threads. These methods must then protect the device data they share (e.g. a connection
+     * to the hardware or members written by always_executed_hook()). Requests reading the State or Status attributes
+     * and all the other device calls still lock the device monitor as usual. The attribute serialization model
+     * (AttrSerialModel) is not changed.
+     * This model is used only when the process serialization model is BY_DEVICE.
+     *
+     * @param on Set to true to enable the attribute read locking model
+     */
+    void set_attribute_read_locking(bool on);
+
+    /**
+     * Set the lock group of an attribute.
+     *
+     * With the attribute read locking model, attributes of the same group are never read in parallel. By default,
+     * each attribute is alone in its group.
+     *
+     * @param attr_name The attribute name
+     * @param group The lock group name
+     */
+    void set_attribute_lock_group(const std::string &attr_name, const std::string &group);
+
     /**
      * Get device name.
      *
@@ -611,6 +674,28 @@ class DeviceImpl : public virtual POA_Tango::Device
      */
     void add_attribute(Attr *new_attr);
 
+    /**
+     * Add several new attributes to the device attribute list.
+     *
+     * This is equivalent to calling DeviceImpl::add_attribute for each attribute
+     * but the attribute properties are retrieved from the database with a single
+     * call and only one device interface change event is sent. This should be
+     * preferred when a device creates many dynamic attributes.
+     * All the attributes are checked before the first one is added. If one of them
+     * is already defined with another definition, an exception is thrown and none
+     * of them is added. As with add_attribute, the attributes already defined with
+     * the same definition are skipped and deleted. A pointer given several times in
+     * the list is only handled once.
+     *
+     * @param new_attrs Pointers to the new attributes to be added to the list. These pointers
+     * must point to "heap" allocated memory (or to static memory) and not to "stack"
+     * allocated memory
+     * @exception DevFailed
+     * Click <a href="https://tango-controls.readthedocs.io/en/latest/development/advanced/IDL.html#exceptions">here</a>
+     * to read <b>DevFailed</b> exception specification
+     */
+    void add_attributes(const std::vector<Attr *> &new_attrs);
+
     /**
      * Remove one attribute from the device attribute list.
      *
@@ -1586,6 +1671,28 @@ class DeviceImpl : public virtual POA_Tango::Device
                          Tango::DevicePipeBlob *p_data,
                          const TangoTimestamp &t,
                          bool reuse_it = false);
+    /**
+     * Push a pipe event with data built by a PipeStreamWriter.
+     *
+     * The pipe is the one the writer has been created for. The time stamp of the event is set to the
+     * actual time. The writer is not modified and can be cleared and re-used for the next event.
+     *
+     * @param writer The writer holding the data to be sent with the event
+     * @exception DevFailed If the pipe is unknown or if the writer has no data element.
+     * Click <a href="https://tango-controls.readthedocs.io/en/latest/development/advanced/IDL.html#exceptions">here</a>
+     * to read <b>DevFailed</b> exception specification
+     */
+    void push_pipe_event(Tango::PipeStreamWriter &writer);
+    /**
+     * Push a pipe event with data built by a PipeStreamWriter and a specified timestamp.
+     *
+     * @param writer The writer holding the data to be sent with the event
+     * @param t The time stamp
+     * @exception DevFailed If the pipe is unknown or if the writer has no data element.
+     * Click <a href="https://tango-controls.readthedocs.io/en/latest/development/advanced/IDL.html#exceptions">here</a>
+     * to read <b>DevFailed</b> exception specification
+     */
+    void push_pipe_event(Tango::PipeStreamWriter &writer, const TangoTimestamp &t);
 //@}
 
 /**@name Signal related methods
@@ -1805,6 +1912,10 @@ class DeviceImpl : public virtual POA_Tango::Device
         return poll_obj_list;
     }
 
+    PollObj *get_polled_obj(Tango::PollObjType, const std::string &);
+    void add_poll_obj(PollObj *);
+    void remove_poll_obj(std::vector<PollObj *>::iterator);
+
     void stop_polling(bool);
 
     void stop_polling()
@@ -1825,6 +1936,11 @@ class DeviceImpl : public virtual POA_Tango::Device
         return only_one;
     }
 
+    detail::DeviceMetrics &get_metrics()
+    {
+        return *device_metrics;
+    }
+
     TangoMonitor &get_poll_monitor()
     {
         return poll_mon;
@@ -1913,7 +2029,8 @@ class DeviceImpl : public virtual POA_Tango::Device
     void push_att_conf_event(Attribute *);
 
     void data_into_net_object(Attribute &, AttributeIdlData &, long, AttrWriteType, bool);
-    void polled_data_into_net_object(AttributeIdlData &, long, long, long, PollObj *, const DevVarStringArray &);
+    void polled_data_into_net_object(
+        AttributeIdlData &, long, long, long, const PollObj::LastAttrValue &, const DevVarStringArray &);
 
     int get_min_poll_period()
     {
@@ -1989,6 +2106,7 @@ class DeviceImpl : public virtual POA_Tango::Device
     }
 
     Command &get_local_cmd_by_name(const std::string &);
+    Command *find_local_command(const std::string &);
     void remove_local_command(const std::string &);
 
     void set_event_intr_change_subscription(time_t _t)
@@ -2097,6 +2215,12 @@ class DeviceImpl : public virtual POA_Tango::Device
 
         time_t alarm_state_user{0};
         time_t alarm_state_kernel{0};
+
+        bool incremental_state{false};
+        bool state_computed{false};                     // True when the following fields are set
+        Tango::DevState computed_state{Tango::UNKNOWN}; // Last state computed in incremental mode
+        std::uint64_t state_quality_updates{0};         // Attribute quality updates at last computation
+        std::uint64_t state_attr_generation{0};         // Attribute list generation at last computation
     };
 
   protected:
@@ -2131,6 +2255,8 @@ class DeviceImpl : public virtual POA_Tango::Device
     std::vector<std::string> non_auto_polled_cmd;
     std::vector<std::string> non_auto_polled_attr;
     std::vector<PollObj *> poll_obj_list;
+    std::unordered_map<std::string, PollObj *> poll_obj_index; // Polled objects by type and lower case name
+    std::shared_mutex poll_obj_index_mutex;
 
     TangoMonitor only_one;             // Device monitor
     Tango::DevState device_prev_state; // Device previous state
@@ -2170,6 +2296,9 @@ class DeviceImpl : public virtual POA_Tango::Device
     DevSource call_source;
 
     std::vector<Command *> command_list;
+    std::unique_ptr<detail::CommandIndex> cmd_index; // Index on command_list
+    std::unique_ptr<detail::AttributeLocks> attr_locks; // Attribute locks (attribute read locking model)
+    std::unique_ptr<detail::DeviceMetrics> device_metrics; // Request and polling metrics
     time_t event_intr_change_subscription{0};
     bool intr_change_ev{false};
 
@@ -2207,6 +2336,7 @@ class DeviceImpl : public virtual POA_Tango::Device
     void poll_object(const std::string &, int, PollObjType);
     void stop_poll_object(const std::string &, PollObjType);
     void att_conf_loop();
+    Tango::DevState incremental_dev_state();
     void build_att_list_in_status_mess(size_t, AttErrorType);
     void lock_root_devices(int, bool);
     void push_dev_intr(bool);
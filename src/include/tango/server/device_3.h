@@ -50,6 +50,12 @@ namespace Tango
 class DeviceClass;
 class AttributeValueList_4;
 
+namespace detail
+{
+struct ReadPlan;
+class ReadPlanCache;
+} // namespace detail
+
 //=============================================================================
 //
 //            The Device_3Impl class
@@ -169,7 +175,7 @@ class Device_3Impl : public virtual POA_Tango::Device_3, public Device_2Impl
     /**
      * The device desctructor.
      */
-    ~Device_3Impl() override { }
+    ~Device_3Impl() override;
 
     //@}
 
@@ -308,6 +314,10 @@ class Device_3Impl : public virtual POA_Tango::Device_3, public Device_2Impl
                                    Tango::AttributeIdlData &,
                                    bool,
                                    std::vector<long> &);
+    void read_attributes_locked(const Tango::DevVarStringArray &,
+                                Tango::AttributeIdlData &,
+                                bool,
+                                std::vector<long> &);
     void write_attributes_in_db(const std::vector<long> &, const std::vector<AttIdx> &);
     void add_alarmed(std::vector<long> &);
     void state2attr(Tango::DevState, Tango::AttributeValue_3 &);
@@ -317,6 +327,7 @@ class Device_3Impl : public virtual POA_Tango::Device_3, public Device_2Impl
     void status2attr(Tango::ConstDevString, Tango::AttributeValue_4 &);
     void status2attr(Tango::ConstDevString, Tango::AttributeValue_5 &);
     void alarmed_not_read(const std::vector<AttIdx> &);
+    std::shared_ptr<const detail::ReadPlan> get_read_plan(const Tango::DevVarStringArray &);
 
     void write_attributes_34(const Tango::AttributeValueList *, const Tango::AttributeValueList_4 *);
 
@@ -337,6 +348,8 @@ class Device_3Impl : public virtual POA_Tango::Device_3, public Device_2Impl
     void real_ctor();
 
     std::unique_ptr<Device_3ImplExt> ext_3; // Class extension
+
+    std::unique_ptr<detail::ReadPlanCache> read_plans; // Resolved name lists of the last read_attributes calls
 };
 
 } // namespace Tango
@@ -61,6 +61,11 @@ class MultiClassAttribute;
 class MultiClassPipe;
 class DbClass;
 
+namespace detail
+{
+class CommandIndex;
+} // namespace detail
+
 //=============================================================================
 //
 //            The DeviceClass class
@@ -574,6 +579,7 @@ class DeviceClass
     void release_devices_mon();
 
     void remove_command(const std::string &);
+    Command *find_command(const std::string &);
 
     void create_device_pipe(DeviceClass *, DeviceImpl *);
 
@@ -608,6 +614,8 @@ class DeviceClass
 
     std::unique_ptr<DeviceClassExt> ext; // Class extension
 
+    std::unique_ptr<detail::CommandIndex> cmd_index; // Index on command_list
+
     //
     // Ported from the extension class
     //
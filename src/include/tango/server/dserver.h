@@ -93,6 +93,7 @@ class DServer : public TANGO_BASE_CLASS
     Tango::DevVarStringArray *query_device();
     Tango::DevVarStringArray *query_sub_device();
     Tango::DevString query_event_system();
+    Tango::DevString query_metrics();
     void enable_event_system_perf_mon(Tango::DevBoolean enabled);
     void kill();
     void restart(const std::string &);
@@ -102,6 +103,7 @@ class DServer : public TANGO_BASE_CLASS
 
     Tango::DevVarStringArray *polled_device();
     Tango::DevVarStringArray *dev_poll_status(const std::string &);
+    Tango::DevEncoded *polled_attr_snapshot(const Tango::DevVarStringArray *);
     void add_obj_polling(const Tango::DevVarLongStringArray *, bool with_db_upd = true, int delta_ms = 0);
     void upd_obj_polling_period(const Tango::DevVarLongStringArray *, bool with_db_upd = true);
     void rem_obj_polling(const Tango::DevVarStringArray *, bool with_db_upd = true);
@@ -119,6 +121,9 @@ class DServer : public TANGO_BASE_CLASS
     Tango::DevLong event_subscription_change(const Tango::DevVarStringArray *);
     Tango::DevVarLongStringArray *zmq_event_subscription_change(const Tango::DevVarStringArray *);
     void event_confirm_subscription(const Tango::DevVarStringArray *);
+    Tango::DevVarLongStringArray *zmq_event_bulk_subscribe(const Tango::DevVarStringArray *);
+
+    Tango::DevVarLongStringArray *query_shm_transport();
 
     void delete_devices();
 
@@ -174,6 +174,28 @@ class DevQueryEventSystemCmd : public Command
     CORBA::Any *execute(DeviceImpl *device, const CORBA::Any &in_any) override;
 };
 
+//=============================================================================
+//
+//            The DevQueryMetricsCmd class
+//
+// description :    Class to implement the QueryMetrics command. This
+//            command does not take any input argument and returns a
+//            single string containing a JSON object holding the metrics
+//            collected by the Tango kernel (request durations, polling
+//            lateness, event rates and queue depths).
+//
+//=============================================================================
+
+class DevQueryMetricsCmd : public Command
+{
+  public:
+    DevQueryMetricsCmd(const char *cmd_name, Tango::CmdArgType argin, Tango::CmdArgType argout, const char *desc);
+
+    ~DevQueryMetricsCmd() override = default;
+
+    CORBA::Any *execute(DeviceImpl *device, const CORBA::Any &in_any) override;
+};
+
 //=============================================================================
 //
 //            The DevEnableEventSystemPerfMonCmd class
@@ -516,6 +538,53 @@ class EventConfirmSubscriptionCmd : public Tango::Command
     CORBA::Any *execute(Tango::DeviceImpl *, const CORBA::Any &) override;
 };
 
+//=============================================================================
+//
+//            The ZmqEventBulkSubscribeCmd class
+//
+// description :    Class to implement the ZmqEventBulkSubscribe command.
+//            This command takes a list of event the client wants to
+//            subscribe to (used to re-subscribe after a server restart)
+//            and returns one status per event
+//
+//=============================================================================
+
+class ZmqEventBulkSubscribeCmd : public Tango::Command
+{
+  public:
+    static const std::string in_desc;
+    static const std::string out_desc;
+    ZmqEventBulkSubscribeCmd();
+
+    ~ZmqEventBulkSubscribeCmd() override { }
+
+    bool is_allowed(Tango::DeviceImpl *, const CORBA::Any &) override;
+    CORBA::Any *execute(Tango::DeviceImpl *, const CORBA::Any &) override;
+};
+
+//=============================================================================
+//
+//            The QueryShmTransportCmd class
+//
+// description :    Class to implement the QueryShmTransport command.
+//            This command does not take any input argument and returns
+//            the shared memory ring used by the shm transport (only
+//            when it is enabled with the TANGO_SHM_TRANSPORT
+//            environment variable)
+//
+//=============================================================================
+
+class QueryShmTransportCmd : public Tango::Command
+{
+  public:
+    static const std::string out_desc;
+    QueryShmTransportCmd();
+
+    ~QueryShmTransportCmd() override { }
+
+    CORBA::Any *execute(Tango::DeviceImpl *, const CORBA::Any &) override;
+};
+
 //=============================================================================
 //
 //            The DServerClass class
@@ -58,7 +58,8 @@ class EncodedAttribute
     enum class Feature : int
     {
         JPEG,
-        JPEG_WITH_ALPHA
+        JPEG_WITH_ALPHA,
+        LOSSLESS
     };
     /**@name Constructors
      * Miscellaneous constructors */
@@ -160,13 +161,69 @@ class EncodedAttribute
      *
      */
     void encode_rgb24(const unsigned char *rgb24, int width, int height);
+
+    /**
+     * Encode a 8 bit grayscale image with a fast lossless compression (LOSSLESS_GRAY8 format)
+     *
+     * Each sample is predicted from its left neighbour and the prediction residuals are
+     * stored by blocks of 32 samples, on the number of bits needed by the largest residual
+     * of the block. This is well suited to detector images where neighbouring pixels have
+     * close values. The first pixel of a row is predicted from the first pixel of the
+     * previous row, so the rows are decoded one after the other. The format does not use
+     * any external library. The compressed size is at most 1/32 larger than the raw image.
+     *
+     * @param gray8    Array of 8bit gray sample
+     * @param width    The image width
+     * @param height   The image height
+     *
+     */
+    void encode_lossless_gray8(const unsigned char *gray8, int width, int height);
+
+    /**
+     * Encode a 16 bit grayscale image with a fast lossless compression (LOSSLESS_GRAY16 format)
+     *
+     * See encode_lossless_gray8() for a description of the compression.
+     *
+     * @param gray16   Array of 16bit gray sample
+     * @param width    The image width
+     * @param height   The image height
+     *
+     */
+    void encode_lossless_gray16(const unsigned short *gray16, int width, int height);
+
+    /**
+     * Encode a 24 bit color image with a fast lossless compression (LOSSLESS_RGB24 format)
+     *
+     * See encode_lossless_gray8() for a description of the compression. Each color is
+     * predicted from the same color of the previous pixel.
+     *
+     * @param rgb24    Array of 24bit RGB sample
+     * @param width    The image width
+     * @param height   The image height
+     *
+     */
+    void encode_lossless_rgb24(const unsigned char *rgb24, int width, int height);
+
+    /**
+     * Set the number of threads used to encode one image as JPEG format
+     *
+     * With more than one thread, the image is split in horizontal stripes which are
+     * encoded in parallel. The result is still a standard JPEG image, each stripe
+     * being one of its restart intervals. The threads are created by this call and
+     * kept until the next call or the destruction of this object. The default is 1
+     * (the image is encoded by the calling thread).
+     *
+     * @param nb_threads  Number of threads (including the calling one)
+     *
+     */
+    void set_jpeg_encoding_threads(int nb_threads);
     //@}
 
     /**@name Image Decoding Methods
      */
     //@{
     /**
-     * Decode a color image (JPEG_RGB or RGB24) and returns a 32 bits RGB image.
+     * Decode a color image (JPEG_RGB, RGB24 or LOSSLESS_RGB24) and returns a 32 bits RGB image.
      * Throws DevFailed in case of failure.
      *
      * @param attr     DeviceAttribute that contains the image
@@ -177,7 +234,7 @@ class EncodedAttribute
     void decode_rgb32(DeviceAttribute *attr, int *width, int *height, unsigned char **rgb32);
 
     /**
-     * Decode a 8 bits grayscale image (JPEG_GRAY8 or GRAY8) and returns a 8 bits gray scale image.
+     * Decode a 8 bits grayscale image (JPEG_GRAY8, GRAY8 or LOSSLESS_GRAY8) and returns a 8 bits gray scale image.
      * Throws DevFailed in case of failure.
      *
      * @param attr     DeviceAttribute that contains the image
@@ -188,7 +245,7 @@ class EncodedAttribute
     void decode_gray8(DeviceAttribute *attr, int *width, int *height, unsigned char **gray8);
 
     /**
-     * Decode a 16 bits grayscale image (GRAY16) and returns a 16 bits gray scale image.
+     * Decode a 16 bits grayscale image (GRAY16 or LOSSLESS_GRAY16) and returns a 16 bits gray scale image.
      * Throws DevFailed in case of failure.
      *
      * @param attr     DeviceAttribute that contains the image
@@ -259,9 +316,7 @@ class EncodedAttribute
     }
 
   private:
-    class EncodedAttributeExt
-    {
-    };
+    class EncodedAttributeExt;
 
     unsigned char **buffer_array;
     std::size_t *buffSize_array;
@@ -274,20 +329,6 @@ class EncodedAttribute
 
     std::unique_ptr<EncodedAttributeExt> ext; // Class extension
 
-    // ----------------------------------------------------------------------------
-    // Encode a RGB image to a buffer
-    // quality ranges in 0(poor), 100(max)
-    // jpegData is allocated by the function and must be freed by the caller.
-    // ----------------------------------------------------------------------------
-    void jpeg_encode_rgb32(
-        int width, int height, unsigned char *rgb32, double quality, std::size_t *jpegSize, unsigned char **jpegData);
-
-    void jpeg_encode_rgb24(
-        int width, int height, unsigned char *rgb24, double quality, std::size_t *jpegSize, unsigned char **jpegData);
-
-    void jpeg_encode_gray8(
-        int width, int height, unsigned char *gray8, double quality, std::size_t *jpegSize, unsigned char **jpegData);
-
     // ----------------------------------------------------------------------------
     // Decode a JPEG image and return error code in case of failure, 0 is returned
     // otherwise. frame is a pointer to a set of 8bit sample (8bit gray scale or
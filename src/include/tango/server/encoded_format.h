@@ -60,6 +60,15 @@ namespace Tango
 
 #define RGB_24 "RGB24"
 
+//
+// Lossless compression (image width and height on 32 bits big endian followed
+// by the rows coded as documented in EncodedAttribute::encode_lossless_gray8)
+//
+
+#define LOSSLESS_GRAY_8 "LOSSLESS_GRAY8"
+#define LOSSLESS_GRAY_16 "LOSSLESS_GRAY16"
+#define LOSSLESS_RGB_24 "LOSSLESS_RGB24"
+
 } // namespace Tango
 
 #endif // _ENCODED_FORMAT_H
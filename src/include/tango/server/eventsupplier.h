@@ -69,10 +69,17 @@
 
 #include <chrono>
 #include <list>
+#include <memory>
+#include <mutex>
 
 namespace Tango
 {
 
+namespace detail
+{
+class ShmRingWriter;
+}
+
 typedef struct _NotifService
 {
     CosNotifyChannelAdmin::SupplierAdmin_var SupAdm;
@@ -101,6 +108,16 @@ class EventSupplier
     void push_dev_intr_change_event(DeviceImpl *, bool, DevCmdInfoList_2 *, AttributeConfigList_5 *);
     bool any_dev_intr_client(const DeviceImpl *) const;
 
+    // The AttributeValue_5 read by a poll cycle, marshalled by the first event pushed for it and reused by the
+    // other events pushed during the same cycle (see detect_and_push_events())
+    struct MarshalledValue
+    {
+        const AttributeValue_5 *source{nullptr}; // The value held by cdr
+        bool done{false};                        // Set once cdr holds the marshalled source
+        bool large_data{false};
+        TangoCdrMemoryStream cdr;
+    };
+
     struct SuppliedEventData
     {
         const AttributeValue *attr_val;
@@ -114,6 +131,9 @@ class EventSupplier
         const DevIntrChange *dev_intr_change;
         DevPipeData *pipe_val;
         zmq::message_t *zmq_mess;
+        const DevVarULongArray *delta_runs; // Delta encoded change event runs (see detail::EventDeltaEncoder)
+        CORBA::ULong delta_kind;
+        MarshalledValue *marshalled; // Only for the IDL 5 value of a poll cycle, nullptr otherwise
     };
 
     SendEventType detect_and_push_events(
@@ -170,6 +190,7 @@ class EventSupplier
                                  const struct SuppliedEventData &,
                                  Attribute &,
                                  DevFailed *) = 0;
+    virtual void push_change_delta_event(DeviceImpl *, const struct SuppliedEventData &, Attribute &, DevFailed *) = 0;
     virtual void push_heartbeat_event() = 0;
 
     //------------------- Attribute conf change event ---------------------
@@ -280,6 +301,8 @@ class NotifdEventSupplier : public EventSupplier, public POA_CosNotifyComm::Stru
     {
     }
 
+    void push_change_delta_event(DeviceImpl *, const struct SuppliedEventData &, Attribute &, DevFailed *) override { }
+
   protected:
     NotifdEventSupplier(CORBA::ORB_var,
                         CosNotifyChannelAdmin::SupplierAdmin_var,
@@ -344,6 +367,7 @@ class ZmqEventSupplier : public EventSupplier
                          const struct SuppliedEventData &,
                          Attribute &,
                          DevFailed *) override;
+    void push_change_delta_event(DeviceImpl *, const struct SuppliedEventData &, Attribute &, DevFailed *) override;
 
     std::string &get_heartbeat_endpoint()
     {
@@ -389,6 +413,18 @@ class ZmqEventSupplier : public EventSupplier
         return zmq_release;
     }
 
+    bool is_local_ipc_bound()
+    {
+        return local_ipc;
+    }
+
+    detail::ShmRingWriter *get_shm_ring()
+    {
+        return shm_ring.get();
+    }
+
+    void set_shm_subscription(const std::string &event_name);
+
     int get_calling_th()
     {
         return calling_th;
@@ -408,6 +444,8 @@ class ZmqEventSupplier : public EventSupplier
   private:
     static ZmqEventSupplier *_instance;
 
+    bool marshal_event_data(TangoCdrMemoryStream &, const struct SuppliedEventData &, DevFailed *);
+
     struct McastSocketPub
     {
         std::string endpoint;
@@ -454,6 +492,13 @@ class ZmqEventSupplier : public EventSupplier
 
     std::string event_endpoint;                    // event publisher endpoint
     std::vector<std::string> alternate_e_endpoint; // Alternate event endpoint (host with several NIC)
+    bool local_ipc{false};                         // Publisher sockets also bound to ipc endpoints
+    std::vector<std::string> local_ipc_files;      // Files of the ipc endpoints, removed at exit
+
+    std::unique_ptr<detail::ShmRingWriter> shm_ring;   // Shared memory ring of the shm transport (if enabled)
+    std::map<std::string, time_t> shm_subscriptions; // Events also sent through the shm transport, with the date of
+                                                     // the last subscription. The key is the full event name
+    std::mutex shm_mutex;                            // Protects shm_subscriptions
 
     std::map<std::string, unsigned int> event_cptr; // event counter map
 
@@ -466,10 +511,12 @@ class ZmqEventSupplier : public EventSupplier
     int calling_th;
 
     void tango_bind(zmq::socket_t *, std::string &);
+    bool bind_local_ipc(zmq::socket_t *, const std::string &);
+    void create_shm_ring();
+    bool is_shm_subscribed(const std::string &);
+    void push_shm_event(zmq::message_t &, const char *, size_t);
     unsigned char test_endian();
     void create_mcast_socket(const std::string &, int, McastSocketPub &);
-    size_t get_blob_data_nb(DevVarPipeDataEltArray &);
-    size_t get_data_elt_data_nb(DevPipeDataElt &);
     std::string ctr_event_name;
 };
 
@@ -36,7 +36,9 @@
 #include <tango/server/attrdesc.h>
 
 #include <string>
+#include <map>
 #include <memory>
+#include <vector>
 
 namespace Tango
 {
@@ -209,6 +211,33 @@ class FwdAttr : public ImageAttr
     std::unique_ptr<FwdAttrExt> ext; // Class extension
 };
 
+/// @privatesection
+
+//
+// Root attribute values of the forwarded attributes read by one client request. Forwarded attributes are grouped per
+// root device and each root device is read with one read_attributes() call, the root devices being read in parallel.
+// The values are used by FwdAttr::read() when it is called in the same thread while the instance exists.
+//
+
+class FwdRootReads
+{
+  public:
+    FwdRootReads();
+    ~FwdRootReads();
+
+    FwdRootReads(const FwdRootReads &) = delete;
+    FwdRootReads &operator=(const FwdRootReads &) = delete;
+
+    void read(DeviceImpl *, const std::vector<long> &);
+
+    static bool get_root_value(const Attribute &, DeviceAttribute &);
+
+  private:
+    struct RootValue;
+
+    std::map<const Attribute *, std::unique_ptr<RootValue>> values;
+};
+
 } // namespace Tango
 
 #endif /* _FWDATTRDESC_H */
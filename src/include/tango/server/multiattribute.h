@@ -41,6 +41,8 @@
 #include <tango/server/w_attribute.h>
 #include <tango/server/event_subscription_state.h>
 
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <map>
@@ -301,6 +303,7 @@ class MultiAttribute
 
     void add_write_value(Attribute &);
     void add_attribute(const std::string &, DeviceClass *, long);
+    void add_attributes(const std::string &, DeviceClass *, const std::vector<long> &);
     void add_fwd_attribute(const std::string &, DeviceClass *, long, Attr *);
     void remove_attribute(const std::string &, bool);
 
@@ -309,6 +312,28 @@ class MultiAttribute
         return writable_attr_list;
     }
 
+    // Incremented each time an attribute is added to or removed from the attribute list
+    std::uint64_t get_attr_list_generation() const
+    {
+        return ext->attr_list_generation;
+    }
+
+    // Incremented each time the quality of one attribute may have changed
+    std::uint64_t get_quality_updates() const
+    {
+        return ext->quality_updates.load(std::memory_order_acquire);
+    }
+
+    // Tell the attributes that the device state is computed in incremental mode
+    void set_incremental_state(bool on)
+    {
+        ext->incremental_state = on;
+        for(auto *att : attr_list)
+        {
+            att->set_incremental_state(on);
+        }
+    }
+
     bool is_att_quality_alarmed();
     AttributeEventSubscriptionStates get_event_subscription_states();
     void set_event_subscription_states(const AttributeEventSubscriptionStates &);
@@ -332,6 +357,9 @@ class MultiAttribute
         MultiAttributeExt() { }
 
         std::map<std::string, AttributePtrAndIndex> attr_map;
+        std::uint64_t attr_list_generation{0};
+        std::atomic<std::uint64_t> quality_updates{0};
+        bool incremental_state{false};
 
         void put_attribute_in_map(Attribute *att, long index)
         {
@@ -339,6 +367,9 @@ class MultiAttribute
             mapElement.att_ptr = att;
             mapElement.att_index_in_vector = index;
             attr_map[att->get_name_lower()] = mapElement;
+            attr_list_generation++;
+            att->set_quality_update_counter(&quality_updates);
+            att->set_incremental_state(incremental_state);
         }
 
         void increment_state_and_status_indexes()
@@ -44,6 +44,7 @@
 namespace Tango
 {
 class UserDefaultPipeProp;
+class PipeStreamWriter;
 
 enum PipeSerialModel
 {
@@ -521,6 +522,7 @@ class Pipe
     void fire_event(DeviceImpl *, DevFailed *);
     void fire_event(DeviceImpl *, DevicePipeBlob *, bool);
     void fire_event(DeviceImpl *, DevicePipeBlob *, const TangoTimestamp &, bool);
+    void fire_event(DeviceImpl *, PipeStreamWriter &, const TangoTimestamp &);
 
     void set_event_subscription(time_t _t)
     {
@@ -0,0 +1,180 @@
+#ifndef _PIPE_STREAM_WRITER_H
+#define _PIPE_STREAM_WRITER_H
+
+#include <tango/common/tango_const.h>
+#include <tango/server/tango_clock.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Tango
+{
+class Pipe;
+
+/**
+ * Build the data sent with a pipe event without creating a DevicePipeBlob.
+ *
+ * The data elements are serialised in the event message while they are added, so no
+ * intermediate data element tree is built. The message is exactly the one built from a
+ * DevicePipeBlob and clients receive a usual DevicePipe.
+ *
+ * @code
+ * Tango::PipeStreamWriter writer("MyPipe", "MyBlob");
+ *
+ * writer.add("counter", counter);
+ * writer.add("values", values_vector);
+ * writer.begin_blob("inner", "InnerBlob");
+ * writer.add("status", status_str);
+ * writer.end_blob();
+ *
+ * push_pipe_event(writer);
+ * @endcode
+ *
+ * A writer can be re-used for the next event after a call to clear(). Its memory is then
+ * re-used as well.
+ *
+ * @headerfile tango.h
+ * @ingroup Server
+ */
+
+class PipeStreamWriter
+{
+  public:
+    /**@name Constructors
+     * Miscellaneous constructors */
+    //@{
+    /**
+     * Create a new PipeStreamWriter object.
+     *
+     * @param pipe_name The name of the pipe the data are pushed for
+     * @param blob_name The root blob name
+     */
+    explicit PipeStreamWriter(const std::string &pipe_name, const std::string &blob_name = "");
+    //@}
+
+    PipeStreamWriter(const PipeStreamWriter &) = delete;
+    PipeStreamWriter &operator=(const PipeStreamWriter &) = delete;
+
+    ~PipeStreamWriter();
+
+    /**@name Data element insertion methods */
+    //@{
+    /**
+     * Add a scalar data element to the current blob
+     *
+     * @param elt_name The data element name
+     * @param datum The data element value
+     */
+    void add(const std::string &elt_name, DevBoolean datum);
+    void add(const std::string &elt_name, DevShort datum);
+    void add(const std::string &elt_name, DevLong datum);
+    void add(const std::string &elt_name, DevLong64 datum);
+    void add(const std::string &elt_name, DevFloat datum);
+    void add(const std::string &elt_name, DevDouble datum);
+    void add(const std::string &elt_name, DevUChar datum);
+    void add(const std::string &elt_name, DevUShort datum);
+    void add(const std::string &elt_name, DevULong datum);
+    void add(const std::string &elt_name, DevULong64 datum);
+    void add(const std::string &elt_name, DevState datum);
+    void add(const std::string &elt_name, const std::string &datum);
+    void add(const std::string &elt_name, const char *datum);
+
+    /**
+     * Add an array data element to the current blob
+     *
+     * @param elt_name The data element name
+     * @param datum The data element value
+     */
+    void add(const std::string &elt_name, const std::vector<DevBoolean> &datum);
+    void add(const std::string &elt_name, const std::vector<DevShort> &datum);
+    void add(const std::string &elt_name, const std::vector<DevLong> &datum);
+    void add(const std::string &elt_name, const std::vector<DevLong64> &datum);
+    void add(const std::string &elt_name, const std::vector<DevFloat> &datum);
+    void add(const std::string &elt_name, const std::vector<DevDouble> &datum);
+    void add(const std::string &elt_name, const std::vector<DevUChar> &datum);
+    void add(const std::string &elt_name, const std::vector<DevUShort> &datum);
+    void add(const std::string &elt_name, const std::vector<DevULong> &datum);
+    void add(const std::string &elt_name, const std::vector<DevULong64> &datum);
+    void add(const std::string &elt_name, const std::vector<DevState> &datum);
+    void add(const std::string &elt_name, const std::vector<std::string> &datum);
+
+    /**
+     * Start an inner blob data element in the current blob
+     *
+     * All the data elements added until the matching end_blob() call are inserted in the
+     * inner blob.
+     *
+     * @param elt_name The data element name
+     * @param blob_name The inner blob name
+     */
+    void begin_blob(const std::string &elt_name, const std::string &blob_name);
+    /**
+     * End the inner blob started by the last begin_blob() call
+     *
+     * @exception DevFailed If there is no inner blob to end.
+     * Click <a href="https://tango-controls.readthedocs.io/en/latest/development/advanced/IDL.html#exceptions">here</a>
+     * to read <b>DevFailed</b> exception specification
+     */
+    void end_blob();
+    //@}
+
+    /**@name Miscellaneous methods */
+    //@{
+    /**
+     * Remove all the data elements, keeping the writer memory
+     */
+    void clear();
+
+    /**
+     * Return the pipe name
+     *
+     * @return The pipe name
+     */
+    const std::string &get_pipe_name() const
+    {
+        return pipe_name;
+    }
+
+    /**
+     * Return the number of data elements in the root blob
+     *
+     * @return The number of data elements in the root blob
+     */
+    std::size_t get_data_elt_nb() const
+    {
+        return blobs.front().elt_nb;
+    }
+    //@}
+
+  private:
+    friend class Pipe;
+
+    struct OpenBlob
+    {
+        std::size_t len_offset; // Offset of the data element sequence length
+        CORBA::ULong elt_nb;    // Number of data elements already added
+        std::string name;       // Blob name, marshalled after the sequence
+    };
+
+    void start();
+    void start_elt(const std::string &, AttributeDataType, std::size_t);
+    void end_elt(const char *);
+    void write_ulong_at(std::size_t, CORBA::ULong);
+    template <typename T>
+    void add_array(const std::string &, AttributeDataType, const T *, std::size_t, omni::alignment_t, const char *);
+
+    // Called by Pipe::fire_event(). Set the time stamp and return the message to send
+
+    const void *get_message(const TangoTimestamp &, std::size_t &);
+
+    std::string pipe_name;
+    std::string root_blob_name;
+    cdrMemoryStream stream;
+    std::size_t time_offset{0};
+    std::vector<OpenBlob> blobs;
+};
+
+} // namespace Tango
+
+#endif /* _PIPE_STREAM_WRITER_H */
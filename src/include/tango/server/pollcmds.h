@@ -88,6 +88,27 @@ class DevPollStatusCmd : public Command
     CORBA::Any *execute(DeviceImpl *device, const CORBA::Any &in_any) override;
 };
 
+//=============================================================================
+//
+//            The PolledAttrSnapshot class
+//
+// description :    Class to implement the PolledAttrSnapshot command.
+//            This class returns the last polled value of all the
+//            polled attributes of a device
+//
+//=============================================================================
+
+class PolledAttrSnapshotCmd : public Command
+{
+  public:
+    PolledAttrSnapshotCmd(
+        const char *cmd_name, Tango::CmdArgType in, Tango::CmdArgType out, const char *in_desc, const char *out_desc);
+
+    ~PolledAttrSnapshotCmd() override { }
+
+    CORBA::Any *execute(DeviceImpl *device, const CORBA::Any &in_any) override;
+};
+
 //=============================================================================
 //
 //            The AddObjPolling class
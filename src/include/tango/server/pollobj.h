@@ -40,6 +40,10 @@
 #include <tango/server/pollring.h>
 #include <tango/server/tango_clock.h>
 
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
 namespace Tango
 {
 
@@ -79,6 +83,34 @@ class PollObj : public omni_mutex
 
     void update_upd(PollClock::duration);
 
+    /// The last value inserted in the ring of a polled attribute. It shares the value with the ring and stays valid
+    /// while the polling thread inserts new ones, without locking the polled object.
+    struct LastAttrValue
+    {
+        PollClock::time_point when{};
+        std::shared_ptr<Tango::AttributeValueList_3> value_3;
+        std::shared_ptr<Tango::AttributeValueList_4> value_4;
+        std::shared_ptr<Tango::AttributeValueList_5> value_5;
+        std::shared_ptr<Tango::DevFailed> except;
+
+        // These methods throw the exception inserted in the ring if the attribute reading failed
+        Tango::AttributeValue_3 &get_value_3() const;
+        Tango::AttributeValue_4 &get_value_4() const;
+        Tango::AttributeValue_5 &get_value_5() const;
+    };
+
+    /// Return the last value inserted in the ring of a polled attribute, nullptr if there is none yet
+    ///
+    /// This does not lock the polled object.
+    std::shared_ptr<const LastAttrValue> get_last_attr_value_snapshot() const
+    {
+#if defined(__cpp_lib_atomic_shared_ptr)
+        return last_attr_value.load();
+#else
+        return std::atomic_load(&last_attr_value);
+#endif
+    }
+
     CORBA::Any *get_last_cmd_result();
     Tango::AttributeValue &get_last_attr_value(bool);
     Tango::AttributeValue_3 &get_last_attr_value_3(bool);
@@ -148,6 +180,19 @@ class PollObj : public omni_mutex
 
     PollClock::time_point get_last_insert_date_i();
 
+    /// Return the number of the last insertion in the ring. The insertions in the rings of all the polled objects
+    /// of the process are numbered with the same increasing counter
+    std::uint64_t get_last_insert_nb_i()
+    {
+        return last_insert_nb;
+    }
+
+    /// Return the number of the last insertion in the ring of any polled object of the process
+    static std::uint64_t get_insert_ctr()
+    {
+        return insert_ctr.load();
+    }
+
     bool is_last_an_error()
     {
         omni_mutex_lock sync(*this);
@@ -225,6 +270,8 @@ class PollObj : public omni_mutex
     }
 
   protected:
+    void publish_last_attr_value();
+
     DeviceImpl *dev;
     PollObjType type;
     std::string name;
@@ -233,6 +280,14 @@ class PollObj : public omni_mutex
     PollClock::duration max_delta_t;
     PollRing ring;
     bool fwd;
+    std::uint64_t last_insert_nb{0};
+#if defined(__cpp_lib_atomic_shared_ptr)
+    std::atomic<std::shared_ptr<const LastAttrValue>> last_attr_value;
+#else
+    std::shared_ptr<const LastAttrValue> last_attr_value; // Only accessed with std::atomic_load/store
+#endif
+
+    static std::atomic<std::uint64_t> insert_ctr;
 };
 
 inline bool operator<(const PollObj &, const PollObj &)
@@ -37,6 +37,7 @@
 #include <tango/server/tango_clock.h>
 #include <tango/common/tango_const.h>
 
+#include <memory>
 #include <vector>
 
 namespace Tango
@@ -58,9 +59,10 @@ class RingElt
 
     CORBA::Any *cmd_result;
     Tango::AttributeValueList *attr_value;
-    Tango::AttributeValueList_3 *attr_value_3;
-    Tango::AttributeValueList_4 *attr_value_4;
-    Tango::AttributeValueList_5 *attr_value_5;
+    // Shared with the PollObj::LastAttrValue snapshots read by the cache reads
+    std::shared_ptr<Tango::AttributeValueList_3> attr_value_3;
+    std::shared_ptr<Tango::AttributeValueList_4> attr_value_4;
+    std::shared_ptr<Tango::AttributeValueList_5> attr_value_5;
     Tango::DevFailed *except;
     PollClock::time_point when;
 };
@@ -124,6 +126,11 @@ class PollRing
         return nb_elt;
     }
 
+    const RingElt &get_last_elt()
+    {
+        return ring[insert_elt == 0 ? max_elt - 1 : insert_elt - 1];
+    }
+
     void get_cmd_history(long, Tango::DevCmdHistoryList *);
     void get_cmd_history(long, Tango::DevCmdHistory_4 *, Tango::CmdArgType &);
 
@@ -40,6 +40,11 @@
 #include <string>
 #include <map>
 
+namespace zmq
+{
+class message_t;
+} // namespace zmq
+
 namespace Tango
 {
 class FwdAttr;
@@ -172,6 +177,8 @@ class RootAttRegistry
         void push_event(Tango::DataReadyEventData *) override;
 
       private:
+        void store_root_value(Tango::EventData *, const zmq::message_t &, unsigned char);
+
         RootAttRegistry *rar;
 
         std::vector<std::string> dummy_vs;
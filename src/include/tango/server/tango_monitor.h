@@ -66,6 +66,9 @@ class TangoMonitor : public omni_mutex
     void get_monitor();
     void rel_monitor();
 
+    void get_shared_monitor();
+    void rel_shared_monitor();
+
     void timeout(long new_to)
     {
         _timeout = new_to;
@@ -106,7 +109,12 @@ class TangoMonitor : public omni_mutex
     omni_condition cond;
     omni_thread *locking_thread{};
     long locked_ctr{};
+    long shared_ctr{};        // Number of threads holding the monitor in shared mode
+    long shared_waiters{};    // Number of threads waiting for the monitor in shared mode
+    long exclusive_waiters{}; // Number of threads waiting for the monitor in exclusive mode
     std::string name;
+
+    void wake_up_waiters();
 };
 
 //--------------------------------------------------------------------------------------------------------------------
@@ -155,13 +163,14 @@ inline void TangoMonitor::get_monitor()
     TANGO_LOG_DEBUG << "In get_monitor() " << name << ", thread = " << th->id() << ", ctr = " << locked_ctr
                     << std::endl;
 
-    if(locked_ctr == 0)
+    if(locked_ctr == 0 && shared_ctr == 0)
     {
         locking_thread = th;
     }
     else if(th != locking_thread)
     {
-        while(locked_ctr > 0)
+        exclusive_waiters++;
+        while(locked_ctr > 0 || shared_ctr > 0)
         {
             TANGO_LOG_DEBUG << "Thread " << th->id() << ": waiting !!" << std::endl;
             int interupted;
@@ -170,13 +179,23 @@ inline void TangoMonitor::get_monitor()
             if(interupted == 0)
             {
                 TANGO_LOG_DEBUG << "TIME OUT for thread " << th->id() << std::endl;
+                exclusive_waiters--;
+                wake_up_waiters();
                 std::stringstream ss;
                 ss << "Thread " << th->id();
                 ss << " is not able to acquire serialization monitor \"" << name << "\", ";
-                ss << " it is currently held by thread " << get_locking_thread_id() << ".";
+                if(shared_ctr > 0)
+                {
+                    ss << " it is currently shared by " << shared_ctr << " thread(s).";
+                }
+                else
+                {
+                    ss << " it is currently held by thread " << get_locking_thread_id() << ".";
+                }
                 TANGO_THROW_EXCEPTION(API_CommandTimedOut, ss.str());
             }
         }
+        exclusive_waiters--;
         locking_thread = th;
     }
     else
@@ -215,6 +234,110 @@ inline void TangoMonitor::rel_monitor()
     {
         TANGO_LOG_DEBUG << "Signalling !" << std::endl;
         locking_thread = nullptr;
+        wake_up_waiters();
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        TangoMonitor::get_shared_monitor
+//
+// description :
+//        Get a monitor in shared mode. Several threads may hold the monitor in shared mode at the same time, but not
+//        while another thread holds it with get_monitor(). The thread will wait (with timeout) if the monitor is
+//        locked by another thread or if another thread is waiting to lock it. If the thread is already the monitor
+//        owner thread, simply increment the locking counter.
+//        A thread holding the monitor in shared mode must not call get_monitor() on it.
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+inline void TangoMonitor::get_shared_monitor()
+{
+    omni_thread *th = omni_thread::self();
+
+    omni_mutex_lock synchronized(*this);
+
+    TANGO_LOG_DEBUG << "In get_shared_monitor() " << name << ", thread = " << th->id() << ", ctr = " << locked_ctr
+                    << ", shared ctr = " << shared_ctr << std::endl;
+
+    if(locked_ctr > 0 && th == locking_thread)
+    {
+        locked_ctr++;
+        return;
+    }
+
+    shared_waiters++;
+    while(locked_ctr > 0 || exclusive_waiters > 0)
+    {
+        int interupted = wait(_timeout);
+        if(interupted == 0)
+        {
+            shared_waiters--;
+            std::stringstream ss;
+            ss << "Thread " << th->id();
+            ss << " is not able to acquire serialization monitor \"" << name << "\", ";
+            ss << " it is currently held by thread " << get_locking_thread_id() << ".";
+            TANGO_THROW_EXCEPTION(API_CommandTimedOut, ss.str());
+        }
+    }
+    shared_waiters--;
+    shared_ctr++;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        TangoMonitor::rel_shared_monitor
+//
+// description :
+//        Release a monitor taken with get_shared_monitor()
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+inline void TangoMonitor::rel_shared_monitor()
+{
+    omni_thread *th = omni_thread::self();
+
+    {
+        omni_mutex_lock synchronized(*this);
+
+        if(locked_ctr == 0 || th != locking_thread)
+        {
+            if(shared_ctr > 0)
+            {
+                shared_ctr--;
+                if(shared_ctr == 0)
+                {
+                    wake_up_waiters();
+                }
+            }
+            return;
+        }
+    }
+
+    rel_monitor();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        TangoMonitor::wake_up_waiters
+//
+// description :
+//        Signal the threads waiting for the monitor. All of them are woken up if some may want it in shared mode.
+//        Must be called with the monitor mutex locked.
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+inline void TangoMonitor::wake_up_waiters()
+{
+    if(shared_waiters > 0)
+    {
+        cond.broadcast();
+    }
+    else
+    {
         cond.signal();
     }
 }
@@ -51,6 +51,7 @@
 #include <iostream>
 #include <new>
 #include <algorithm>
+#include <chrono>
 
 namespace Tango
 {
@@ -596,6 +597,36 @@ class Util
      * @return A boolean set to true if the device is restarting.
      */
     bool is_device_restarting(const std::string &d_name);
+
+    /**
+     * Set the maximum age of the root attribute values used to read forwarded attributes
+     *
+     * When set to a non-zero value, this enables the client attribute cache (see
+     * ApiUtil::enable_attribute_read_cache()) and forwarded attributes are read from the cache if their root
+     * attribute value is younger than max_age. The cache is fed by the root attribute reads and by the change,
+     * periodic, archive and alarm events received from the root attributes. The default value is 0 (root attributes
+     * are always read from their device).
+     *
+     * @param max_age The maximum age of the root attribute values
+     */
+    void set_fwd_att_max_age(std::chrono::milliseconds max_age)
+    {
+        fwd_att_max_age = max_age;
+        if(max_age.count() != 0)
+        {
+            ApiUtil::instance()->enable_attribute_read_cache(true);
+        }
+    }
+
+    /**
+     * Get the maximum age of the root attribute values used to read forwarded attributes
+     *
+     * @return The maximum age of the root attribute values
+     */
+    std::chrono::milliseconds get_fwd_att_max_age()
+    {
+        return fwd_att_max_age;
+    }
     //@}
 
     /**@name Database related methods */
@@ -1312,6 +1343,9 @@ class Util
     bool wattr_nan_allowed{false};               // NaN allowed when writing attribute
     RootAttRegistry root_att_reg;                // Root attribute(s) registry
 
+    // Max age of the root attribute values used to read forwarded attributes
+    std::chrono::milliseconds fwd_att_max_age{0};
+
     // If set, then alarm events are automatically pushed to alarm event
     // subscribes when a user calls push_change_event, if is_alarm_event is not
     // set for the attribute.
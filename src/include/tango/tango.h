@@ -128,6 +128,7 @@
   #include <tango/server/pipedesc.h>
   #include <tango/server/pipe.h>
   #include <tango/server/w_pipe.h>
+  #include <tango/server/pipe_stream_writer.h>
   #include <tango/server/pipe_templ.h>
   #include <tango/server/dserver.h>
   #include <tango/server/utils_spec_templ.h>
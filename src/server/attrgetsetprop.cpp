@@ -37,6 +37,7 @@
 #include <tango/server/eventsupplier.h>
 #include <tango/server/log4tango.h>
 #include <tango/internal/server/attribute_utils.h>
+#include <tango/internal/number_conversion.h>
 #include <tango/client/Database.h>
 
 #include <algorithm>
@@ -1290,11 +1291,7 @@ void Attribute::set_one_alarm_prop(const char *prop_name,
                 ss1 >> alrm_usr_def_db;
 
                 double db;
-                std::stringstream ss;
-                ss.precision(TANGO_FLOAT_PRECISION);
-
-                ss << conf_val;
-                if(ss >> db && ss.eof())
+                if(Tango::detail::parse_number(conf_val.in(), db))
                 {
                     switch(data_type)
                     {
@@ -1383,11 +1380,7 @@ void Attribute::set_one_alarm_prop(const char *prop_name,
                 ss1 >> alrm_class_def_db;
 
                 double db;
-                std::stringstream ss;
-                ss.precision(TANGO_FLOAT_PRECISION);
-
-                ss << conf_val;
-                if(ss >> db && ss.eof())
+                if(Tango::detail::parse_number(conf_val.in(), db))
                 {
                     switch(data_type)
                     {
@@ -1537,10 +1530,7 @@ void Attribute::set_one_alarm_prop(const char *prop_name,
     if(class_defaults && att_conf_str != AlrmValueNotSpec)
     {
         double db;
-        str.str("");
-        str.clear();
-        str << att_conf_str;
-        if(str >> db && str.eof() && db == alrm_class_def_db)
+        if(Tango::detail::parse_number(att_conf_str, db) && db == alrm_class_def_db)
         {
             att_conf_str = class_def_val;
         }
@@ -1548,10 +1538,7 @@ void Attribute::set_one_alarm_prop(const char *prop_name,
     else if(user_defaults && att_conf_str != AlrmValueNotSpec)
     {
         double db;
-        str.str("");
-        str.clear();
-        str << att_conf_str;
-        if(str >> db && str.eof() && db == alrm_usr_def_db)
+        if(Tango::detail::parse_number(att_conf_str, db) && db == alrm_usr_def_db)
         {
             att_conf_str = usr_def_val;
         }
@@ -1575,18 +1562,13 @@ void Attribute::set_one_alarm_prop(const char *prop_name,
         else
         {
             double db;
-
-            std::stringstream ss;
-            ss.precision(TANGO_FLOAT_PRECISION);
-
-            ss << conf_val;
-            if(!(ss >> db && ss.eof()))
+            if(!Tango::detail::parse_number(conf_val.in(), db))
             {
                 Tango::detail::throw_err_format(prop_name, d_name, name, "Attribute::set_one_alarm_prop()");
             }
 
-            ss.str("");
-            ss.clear();
+            std::stringstream ss;
+            ss.precision(TANGO_FLOAT_PRECISION);
 
             switch(data_type)
             {
@@ -1868,10 +1850,7 @@ void Attribute::set_rds_prop_val(const AttributeAlarm &att_alarm,
     if(class_defaults && delta_val_str != AlrmValueNotSpec)
     {
         double db;
-        str.str("");
-        str.clear();
-        str << delta_val_str;
-        if(str >> db && str.eof() && db == delta_val_class_def_db)
+        if(Tango::detail::parse_number(delta_val_str, db) && db == delta_val_class_def_db)
         {
             delta_val_str = delta_val_class_def;
         }
@@ -1879,10 +1858,7 @@ void Attribute::set_rds_prop_val(const AttributeAlarm &att_alarm,
     else if(usr_defaults && delta_val_str != AlrmValueNotSpec)
     {
         double db;
-        str.str("");
-        str.clear();
-        str << delta_val_str;
-        if(str >> db && str.eof() && db == delta_val_usr_def_db)
+        if(Tango::detail::parse_number(delta_val_str, db) && db == delta_val_usr_def_db)
         {
             delta_val_str = delta_val_usr_def;
         }
@@ -1965,12 +1941,8 @@ void Attribute::set_rds_prop_val(const AttributeAlarm &att_alarm,
     {
         if((data_type != Tango::DEV_STRING) && (data_type != Tango::DEV_BOOLEAN) && (data_type != Tango::DEV_STATE))
         {
-            str.str("");
-            str.clear();
-
-            str << delta_t_str;
             double db;
-            if(!(str >> db && str.eof()))
+            if(!Tango::detail::parse_number(delta_t_str, db))
             {
                 Tango::detail::throw_err_format("delta_t", d_name, name, "Attribute::set_rds_prop_val");
             }
@@ -1994,10 +1966,7 @@ void Attribute::set_rds_prop_val(const AttributeAlarm &att_alarm,
     if(class_defaults && delta_t_str != AlrmValueNotSpec)
     {
         double db;
-        str.str("");
-        str.clear();
-        str << delta_t_str;
-        if(str >> db && str.eof() && db == delta_t_class_def_db)
+        if(Tango::detail::parse_number(delta_t_str, db) && db == delta_t_class_def_db)
         {
             delta_t_str = delta_t_class_def;
         }
@@ -2005,10 +1974,7 @@ void Attribute::set_rds_prop_val(const AttributeAlarm &att_alarm,
     else if(usr_defaults && delta_t_str != AlrmValueNotSpec)
     {
         double db;
-        str.str("");
-        str.clear();
-        str << delta_t_str;
-        if(str >> db && str.eof() && db == delta_t_usr_def_db)
+        if(Tango::detail::parse_number(delta_t_str, db) && db == delta_t_usr_def_db)
         {
             delta_t_str = delta_t_usr_def;
         }
@@ -2162,10 +2128,7 @@ void Attribute::set_rds_prop_db(const AttributeAlarm &att_alarm,
         {
             double db;
 
-            str.str("");
-            str.clear();
-            str << att_alarm.delta_val;
-            if(!(str >> db && str.eof()))
+            if(!Tango::detail::parse_number(att_alarm.delta_val.in(), db))
             {
                 Tango::detail::throw_err_format("delta_val", d_name, name, "Attribute::set_rds_prop_db)");
             }
@@ -2304,11 +2267,8 @@ void Attribute::set_rds_prop_db(const AttributeAlarm &att_alarm,
     {
         if((data_type != Tango::DEV_STRING) && (data_type != Tango::DEV_BOOLEAN) && (data_type != Tango::DEV_STATE))
         {
-            str.str("");
-            str.clear();
-            str << att_alarm.delta_t;
             double db;
-            if(!(str >> db && str.eof()))
+            if(!Tango::detail::parse_number(att_alarm.delta_t.in(), db))
             {
                 Tango::detail::throw_err_format("delta_t", d_name, name, "Attribute::set_rds_prop_db()");
             }
@@ -3265,11 +3225,8 @@ void Attribute::set_one_event_period(const char *prop_name,
             }
             else
             {
-                str.str("");
-                str.clear();
-                str << usr_def_val;
                 double db;
-                if(!(str >> db && str.eof()))
+                if(!Tango::detail::parse_number(usr_def_val, db))
                 {
                     Tango::detail::throw_err_format(prop_name, d_name, name, "Attribute::set_one_event_period()");
                 }
@@ -3278,11 +3235,8 @@ void Attribute::set_one_event_period(const char *prop_name,
         }
         else
         {
-            str.str("");
-            str.clear();
-            str << class_def_val;
             double db;
-            if(!(str >> db && str.eof()))
+            if(!Tango::detail::parse_number(class_def_val, db))
             {
                 Tango::detail::throw_err_format(prop_name, d_name, name, "Attribute::set_one_event_period()");
             }
@@ -3298,11 +3252,8 @@ void Attribute::set_one_event_period(const char *prop_name,
         }
         else
         {
-            str.str("");
-            str.clear();
-            str << usr_def_val;
             double db;
-            if(!(str >> db && str.eof()))
+            if(!Tango::detail::parse_number(usr_def_val, db))
             {
                 Tango::detail::throw_err_format(prop_name, d_name, name, "Attribute::set_one_event_period()");
             }
@@ -3312,11 +3263,8 @@ void Attribute::set_one_event_period(const char *prop_name,
     else
     {
         // set property
-        str.str("");
-        str.clear();
-        str << conf_val;
         double db;
-        if(!(str >> db && str.eof()))
+        if(!Tango::detail::parse_number(conf_val.in(), db))
         {
             Tango::detail::throw_err_format(prop_name, d_name, name, "Attribute::set_one_event_period()");
         }
@@ -3342,11 +3290,8 @@ void Attribute::set_one_event_period(const char *prop_name,
             }
 
             bool input_equal_def = false;
-            str.str("");
-            str.clear();
-            str << conf_val.in();
             double db;
-            if(str >> db && str.eof())
+            if(Tango::detail::parse_number(conf_val.in(), db))
             {
                 str.str("");
                 str.clear();
@@ -3367,11 +3312,8 @@ void Attribute::set_one_event_period(const char *prop_name,
         else if(user_defaults)
         {
             bool input_equal_def = false;
-            str.str("");
-            str.clear();
-            str << conf_val.in();
             double db;
-            if(str >> db && str.eof())
+            if(Tango::detail::parse_number(conf_val.in(), db))
             {
                 str.str("");
                 str.clear();
@@ -3392,11 +3334,8 @@ void Attribute::set_one_event_period(const char *prop_name,
         else
         {
             bool input_equal_def = false;
-            str.str("");
-            str.clear();
-            str << conf_val.in();
             double db;
-            if(str >> db && str.eof())
+            if(Tango::detail::parse_number(conf_val.in(), db))
             {
                 if((int) db == (int) (prop_def))
                 {
@@ -3431,11 +3370,8 @@ void Attribute::set_one_event_period(const char *prop_name,
             }
             else
             {
-                str.str("");
-                str.clear();
-                str << conf_val.in();
                 double db;
-                if(!(str >> db && str.eof()))
+                if(!Tango::detail::parse_number(conf_val.in(), db))
                 {
                     Tango::detail::throw_err_format(prop_name, d_name, name, "Attribute::set_one_event_period()");
                 }
@@ -3534,11 +3470,7 @@ void Attribute::convert_prop_value(const char *prop_name,
                                    Attr_CheckVal &val,
                                    const std::string &dev_name)
 {
-    std::stringstream str;
-    str.precision(TANGO_FLOAT_PRECISION);
-
-    str << value_str;
-    if(!(str >> val.db && str.eof()))
+    if(!Tango::detail::parse_number(value_str, val.db))
     {
         Tango::detail::throw_err_format(prop_name, dev_name, name, "Attribute::convert_prop_value()");
     }
@@ -3548,23 +3480,17 @@ void Attribute::convert_prop_value(const char *prop_name,
     case Tango::DEV_SHORT:
     case Tango::DEV_ENUM:
         val.sh = (DevShort) val.db;
-        str.str("");
-        str.clear();
-        str << val.sh;
+        value_str = Tango::detail::format_number(val.sh);
         break;
 
     case Tango::DEV_LONG:
         val.lg = (DevLong) val.db;
-        str.str("");
-        str.clear();
-        str << val.lg;
+        value_str = Tango::detail::format_number(val.lg);
         break;
 
     case Tango::DEV_LONG64:
         val.lg64 = (DevLong64) val.db;
-        str.str("");
-        str.clear();
-        str << val.lg64;
+        value_str = Tango::detail::format_number(val.lg64);
         break;
 
     case Tango::DEV_DOUBLE:
@@ -3576,43 +3502,29 @@ void Attribute::convert_prop_value(const char *prop_name,
 
     case Tango::DEV_USHORT:
         (val.db < 0.0) ? val.ush = (DevUShort) (-val.db) : val.ush = (DevUShort) val.db;
-        str.str("");
-        str.clear();
-        str << val.ush;
+        value_str = Tango::detail::format_number(val.ush);
         break;
 
     case Tango::DEV_UCHAR:
         (val.db < 0.0) ? val.uch = (DevUChar) (-val.db) : val.uch = (DevUChar) val.db;
-        str.str("");
-        str.clear();
-        str << (short) val.uch;
+        value_str = Tango::detail::format_number(static_cast<short>(val.uch));
         break;
 
     case Tango::DEV_ULONG:
         (val.db < 0.0) ? val.ulg = (DevULong) (-val.db) : val.ulg = (DevULong) val.db;
-        str.str("");
-        str.clear();
-        str << val.ulg;
+        value_str = Tango::detail::format_number(val.ulg);
         break;
 
     case Tango::DEV_ULONG64:
         (val.db < 0.0) ? val.ulg64 = (DevULong64) (-val.db) : val.ulg64 = (DevULong64) val.db;
-        str.str("");
-        str.clear();
-        str << val.ulg64;
+        value_str = Tango::detail::format_number(val.ulg64);
         break;
 
     case Tango::DEV_ENCODED:
         (val.db < 0.0) ? val.uch = (DevUChar) (-val.db) : val.uch = (DevUChar) val.db;
-        str.str("");
-        str.clear();
-        str << (short) val.uch;
+        value_str = Tango::detail::format_number(static_cast<short>(val.uch));
         break;
     }
-    if(data_type != Tango::DEV_FLOAT && data_type != Tango::DEV_DOUBLE)
-    {
-        value_str = str.str();
-    }
 }
 
 //+--------------------------------------------------------------------------------------------------------------------
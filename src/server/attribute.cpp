@@ -40,6 +40,8 @@
 #include <tango/server/device.h>
 #include <tango/client/Database.h>
 #include <tango/internal/server/attribute_utils.h>
+#include <tango/internal/server/range_check.h>
+#include <tango/internal/event_delta.h>
 
 #include <functional>
 #include <algorithm>
@@ -599,6 +601,7 @@ Attribute::Attribute(std::vector<AttrProperty> &prop_list, Attr &tmp_attr, const
     //
 
     ext = new Attribute::AttributeExt();
+    change_delta_encoder = std::make_unique<detail::EventDeltaEncoder>();
 
     idx_in_attr = idx;
     d_name = dev_name;
@@ -2177,6 +2180,7 @@ bool Attribute::check_alarm()
     if(!is_fwd_att() && quality != Tango::ATTR_VALID)
     {
         log_quality();
+        quality_updated();
         return returned;
     }
 
@@ -2225,6 +2229,7 @@ bool Attribute::check_alarm()
     }
 
     log_quality();
+    quality_updated();
 
     return returned;
 }
@@ -2275,32 +2280,33 @@ bool Attribute::general_check_alarm(const Tango::AttrQuality &alarm_type, const
 
     using ArrayType = typename tango_type_traits<T>::ArrayType;
     ArrayType *storage = get_value_storage<ArrayType>();
+    const T *data = storage->get_buffer();
+
+    // The alarm levels are inclusive. The low and high levels are checked separately as they set different flags
+    detail::RangeCheck<T> check{min_value, max_value};
+    check.inclusive = true;
 
     if(alarm_conf.test(min))
     {
-        for(std::uint32_t i = 0; i < data_size; i++)
+        check.check_low = true;
+        check.check_high = false;
+        if(detail::find_first_out_of_range(data, data_size, check) < data_size)
         {
-            if((*storage)[i] <= min_value)
-            {
-                quality = alarm_type;
-                alarm.set(min);
-                real_returned = true;
-                break;
-            }
+            quality = alarm_type;
+            alarm.set(min);
+            real_returned = true;
         }
     }
 
     if(alarm_conf.test(max))
     {
-        for(std::uint32_t i = 0; i < data_size; i++)
+        check.check_low = false;
+        check.check_high = true;
+        if(detail::find_first_out_of_range(data, data_size, check) < data_size)
         {
-            if((*storage)[i] >= max_value)
-            {
-                quality = alarm_type;
-                alarm.set(max);
-                real_returned = true;
-                break;
-            }
+            quality = alarm_type;
+            alarm.set(max);
+            real_returned = true;
         }
     }
 
@@ -2338,32 +2344,28 @@ bool Attribute::general_check_devencoded_alarm(const Tango::AttrQuality &alarm_t
     bool real_returned = false;
 
     const Tango::DevEncoded &value = (*attribute_value.get<Tango::DevVarEncodedArray>())[0];
+    const unsigned char *data = value.encoded_data.get_buffer();
+    std::size_t nb_data = value.encoded_data.length();
 
     if(alarm_conf.test(min))
     {
-        for(unsigned int i = 0; i < value.encoded_data.length(); i++)
+        if(detail::find_first_if(data, nb_data, [&min_value](unsigned char val) { return val <= min_value; }) <
+           nb_data)
         {
-            if(value.encoded_data[i] <= min_value)
-            {
-                quality = alarm_type;
-                alarm.set(min);
-                real_returned = true;
-                break;
-            }
+            quality = alarm_type;
+            alarm.set(min);
+            real_returned = true;
         }
     }
 
     if(alarm_conf.test(max))
     {
-        for(unsigned int i = 0; i < value.encoded_data.length(); i++)
+        if(detail::find_first_if(data, nb_data, [&max_value](unsigned char val) { return val >= max_value; }) <
+           nb_data)
         {
-            if(value.encoded_data[i] >= max_value)
-            {
-                quality = alarm_type;
-                alarm.set(max);
-                real_returned = true;
-                break;
-            }
+            quality = alarm_type;
+            alarm.set(max);
+            real_returned = true;
         }
     }
 
@@ -2475,6 +2477,8 @@ bool Attribute::check_warn_alarm()
 // description :    Delete the sequence created to store attribute
 //            value and reset any alarms that may have been calculated by
 //            set_alarm.
+//            In incremental state mode, the quality and the alarms are
+//            kept: the device state is computed from them.
 //
 //--------------------------------------------------------------------------
 
@@ -2482,8 +2486,11 @@ void Attribute::delete_seq_and_reset_alarm()
 {
     TANGO_LOG_DEBUG << "Attribute::delete_seq_and_reset_alarm() called " << std::endl;
     delete_seq();
-    quality = Tango::ATTR_VALID;
-    alarm.reset();
+    if(!incremental_state)
+    {
+        quality = Tango::ATTR_VALID;
+        alarm.reset();
+    }
 }
 
 //+-------------------------------------------------------------------------
@@ -3979,6 +3986,7 @@ void Attribute::fire_error_periodic_event(DevFailed *except)
 void Attribute::set_quality(Tango::AttrQuality qua, bool send_event)
 {
     quality = qua;
+    quality_updated();
     if(send_event)
     {
         fire_change_event();
@@ -6896,6 +6904,7 @@ void Attribute::set_value(T *p_data, long x, long y, bool release)
     dim_y = y;
     data_size = Tango::detail::compute_data_size(data_format, dim_x, dim_y);
     quality = Tango::ATTR_VALID;
+    quality_updated();
 
     //
     // Throw exception if pointer is null and data_size != 0
@@ -6977,6 +6986,7 @@ void Attribute::set_value(Tango::DevShort *p_data, long x, long y, bool release)
     dim_y = y;
     data_size = Tango::detail::compute_data_size(data_format, dim_x, dim_y);
     quality = Tango::ATTR_VALID;
+    quality_updated();
 
     //
     // Throw exception if pointer is null and data_size != 0
@@ -7091,6 +7101,7 @@ void Attribute::set_value(Tango::DevString *p_data, long x, long y, bool release
     dim_y = y;
     data_size = Tango::detail::compute_data_size(data_format, dim_x, dim_y);
     quality = Tango::ATTR_VALID;
+    quality_updated();
 
     //
     // Throw exception if pointer is null and data size != 0
@@ -7179,6 +7190,7 @@ void Attribute::set_value(Tango::DevEncoded *p_data, long x, long y, bool releas
     dim_y = y;
     data_size = Tango::detail::compute_data_size(data_format, dim_x, dim_y);
     quality = Tango::ATTR_VALID;
+    quality_updated();
 
     //
     // Throw exception if pointer is null and data size != 0
@@ -0,0 +1,63 @@
+#include <tango/internal/server/attribute_locks.h>
+
+#include <algorithm>
+
+namespace Tango::detail
+{
+
+void AttributeLocks::set_group(const std::string &attr_name, const std::string &group)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    groups[attr_name] = group;
+}
+
+bool AttributeLocks::lock(const std::vector<std::string> &attr_names, std::chrono::milliseconds timeout, Guard &guard)
+{
+    std::vector<std::timed_mutex *> to_lock;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        std::vector<std::string> wanted_groups;
+        wanted_groups.reserve(attr_names.size());
+        for(const auto &name : attr_names)
+        {
+            auto pos = groups.find(name);
+            wanted_groups.push_back(pos == groups.end() ? name : pos->second);
+        }
+
+        std::sort(wanted_groups.begin(), wanted_groups.end());
+        wanted_groups.erase(std::unique(wanted_groups.begin(), wanted_groups.end()), wanted_groups.end());
+
+        to_lock.reserve(wanted_groups.size());
+        for(const auto &group : wanted_groups)
+        {
+            auto &group_lock = locks[group];
+            if(group_lock == nullptr)
+            {
+                group_lock = std::make_unique<std::timed_mutex>();
+            }
+            to_lock.push_back(group_lock.get());
+        }
+    }
+
+    //
+    // The groups are sorted by name, so all requests lock them in the same order
+    //
+
+    guard.reserve(to_lock.size());
+    for(auto *group_lock : to_lock)
+    {
+        std::unique_lock<std::timed_mutex> lock(*group_lock, timeout);
+        if(!lock.owns_lock())
+        {
+            guard.clear();
+            return false;
+        }
+        guard.push_back(std::move(lock));
+    }
+
+    return true;
+}
+
+} // namespace Tango::detail
@@ -33,10 +33,13 @@
 //-===================================================================================================================
 
 #include <tango/server/blackbox.h>
+#include <tango/server/device.h>
 #include <tango/server/tango_clock.h>
 #include <tango/server/utils.h>
 #include <tango/server/except.h>
+#include <tango/internal/server/device_metrics.h>
 
+#include <chrono>
 #include <cstdio>
 #include <iomanip>
 
@@ -60,6 +63,52 @@
 namespace Tango
 {
 
+namespace
+{
+
+// Execute the call, recording its duration (and its failure) in the metrics of the device which executed it. The
+// device is known once it has recorded the request in its black box
+void timed_call(omniCallDescriptor *d, omniServant *s)
+{
+    // Restored at the end: this call can be a collocated call made while executing another request
+    detail::DeviceMetrics *caller_metrics = detail::get_request_metrics();
+    detail::set_request_metrics(nullptr);
+
+    auto start = std::chrono::steady_clock::now();
+    auto record = [d, start]()
+    {
+        detail::DeviceMetrics *metrics = detail::get_request_metrics();
+        if(metrics != nullptr)
+        {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            metrics->request_duration(d->op())
+                .record(static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()));
+        }
+        return metrics;
+    };
+
+    try
+    {
+        d->interceptedCall(s);
+    }
+    catch(...)
+    {
+        detail::DeviceMetrics *metrics = record();
+        if(metrics != nullptr)
+        {
+            metrics->request_errors(d->op()).add();
+        }
+        detail::set_request_metrics(caller_metrics);
+        throw;
+    }
+
+    record();
+    detail::set_request_metrics(caller_metrics);
+}
+
+} // namespace
+
 // Client call interceptor: works for collocated and remote calls so that the client info is properly setup in any case
 // Since the adoption of omniORB 4.3, it is used for both local and remote calls.
 void client_call_interceptor(omniCallDescriptor *d, omniServant *s)
@@ -132,7 +181,7 @@ void client_call_interceptor(omniCallDescriptor *d, omniServant *s)
         t.self()->set_value(Util::get_tssk_client_info(), a);
         // pass on the (i.e. continue) the call (see section 10.3 of the omniORB documentation)
         // std::cout << "in BlackBox::client_call_interceptor: passing on the (i.e. continue) the call..." << std::endl;
-        d->interceptedCall(s);
+        timed_call(d, s);
         // restore the previous client info (we might be handling a collocated call generated by a remote one)
         // std::cout << "in BlackBox::client_call_interceptor: restoring initial client info" << std::endl;
         t.self()->set_value(Util::get_tssk_client_info(), previous_client_addr);
@@ -1117,6 +1166,8 @@ void BlackBox::inc_indexes()
 
 void BlackBox::get_client_host()
 {
+    detail::set_request_metrics(metrics);
+
     omni_thread *th_id = omni_thread::self();
     if(th_id == nullptr)
     {
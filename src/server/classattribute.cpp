@@ -173,6 +173,8 @@ MultiClassAttribute::MultiClassAttribute()
 // argument :
 //        in :
 //            - class_name : The device class name
+//            - base : Index of the first attribute to initialize in the attribute list. All the attributes from this
+//                     one up to the end of the list are initialized
 //
 //-------------------------------------------------------------------------------------------------------------------
 
@@ -184,15 +186,7 @@ void MultiClassAttribute::init_class_attribute(const std::string &class_name, lo
     Tango::Util *tg = Tango::Util::instance();
     CORBA::Any send;
 
-    long nb_attr;
-    if(base == 0)
-    {
-        nb_attr = attr_list.size();
-    }
-    else
-    {
-        nb_attr = 1;
-    }
+    long nb_attr = attr_list.size() - base;
 
     //
     // Get class attribute(s) properties stored in DB. No need to implement a retry here (in case of db server restart)
@@ -258,15 +252,19 @@ void MultiClassAttribute::init_class_attribute(const std::string &class_name, lo
             if(nb_prop != 0)
             {
                 //
-                // Find this attribute in the attribute list
+                // Find this attribute in the attribute list. The database returns the attributes in the order they
+                // were requested, so try this index first
                 //
 
-                unsigned int k;
-                for(k = 0; k < attr_list.size(); k++)
+                unsigned int k = i + base;
+                if(TG_strcasecmp(attr_name.c_str(), attr_list[k]->get_name().c_str()) != 0)
                 {
-                    if(TG_strcasecmp(attr_name.c_str(), attr_list[k]->get_name().c_str()) == 0)
+                    for(k = 0; k < attr_list.size(); k++)
                     {
-                        break;
+                        if(TG_strcasecmp(attr_name.c_str(), attr_list[k]->get_name().c_str()) == 0)
+                        {
+                            break;
+                        }
                     }
                 }
                 if(k == attr_list.size())
@@ -0,0 +1,85 @@
+#include <tango/internal/server/command_index.h>
+#include <tango/server/command.h>
+
+#include <cctype>
+#include <mutex>
+
+namespace Tango::detail
+{
+
+std::size_t CommandIndex::NoCaseHash::operator()(std::string_view str) const noexcept
+{
+    // FNV-1a on the lower case characters
+    std::size_t hash = 14695981039346656037ULL;
+    for(char c : str)
+    {
+        hash ^= static_cast<unsigned char>(std::tolower(static_cast<unsigned char>(c)));
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+bool CommandIndex::NoCaseEqual::operator()(std::string_view lhs, std::string_view rhs) const noexcept
+{
+    if(lhs.size() != rhs.size())
+    {
+        return false;
+    }
+
+    for(std::size_t i = 0; i < lhs.size(); ++i)
+    {
+        if(std::tolower(static_cast<unsigned char>(lhs[i])) != std::tolower(static_cast<unsigned char>(rhs[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+Command *CommandIndex::find(const std::vector<Command *> &list, std::string_view name)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+        if(is_valid_for(list))
+        {
+            auto pos = index.find(name);
+            return pos == index.end() ? nullptr : pos->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    if(!is_valid_for(list))
+    {
+        build(list);
+    }
+
+    auto pos = index.find(name);
+    return pos == index.end() ? nullptr : pos->second;
+}
+
+void CommandIndex::invalidate()
+{
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    valid = false;
+}
+
+void CommandIndex::build(const std::vector<Command *> &list)
+{
+    index.clear();
+    index.reserve(list.size());
+
+    //
+    // Keep the first command in case of duplicate names, like the linear searches did
+    //
+
+    for(Command *cmd : list)
+    {
+        index.emplace(cmd->get_lower_name(), cmd);
+    }
+
+    valid = true;
+    indexed_size = list.size();
+    indexed_data = list.data();
+}
+
+} // namespace Tango::detail
@@ -33,6 +33,7 @@
 #include <tango/server/device.h>
 #include <tango/server/utils.h>
 #include <tango/server/pipe.h>
+#include <tango/server/pipe_stream_writer.h>
 
 #include <tango/server/logging.h>
 
@@ -597,4 +598,36 @@ void DeviceImpl::push_pipe_event(const std::string &pipe_name,
     pi.fire_event(this, p_data, t, reuse_it);
 }
 
+//+-----------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        DeviceImpl::push_pipe_event
+//
+// description :
+//        Push a pipe event with data built by a pipe stream writer
+//
+// args:
+//        in :
+//            - writer : the pipe stream writer
+//            - t : timestamp
+//
+//-----------------------------------------------------------------------------------------------------------------
+
+void DeviceImpl::push_pipe_event(Tango::PipeStreamWriter &writer)
+{
+    push_pipe_event(writer, std::chrono::system_clock::now());
+}
+
+void DeviceImpl::push_pipe_event(Tango::PipeStreamWriter &writer, const TangoTimestamp &t)
+{
+    // get the tango synchronisation monitor
+    Tango::AutoTangoMonitor synch(this);
+
+    // search the pipe from the pipe list
+    Tango::Pipe &pi = get_device_class()->get_pipe_by_name(writer.get_pipe_name(), device_name_lower);
+
+    // push the event
+    pi.fire_event(this, writer, t);
+}
+
 } // namespace Tango
@@ -31,6 +31,7 @@
 //-================================================================================================================
 
 #include <new>
+#include <unordered_set>
 
 #include <tango/server/basiccommand.h>
 #include <tango/server/blackbox.h>
@@ -46,6 +47,10 @@
 #include <tango/common/git_revision.h>
 #include <tango/server/logging.h>
 #include <tango/client/DbDevice.h>
+#include <tango/internal/utils.h>
+#include <tango/internal/server/attribute_locks.h>
+#include <tango/internal/server/command_index.h>
+#include <tango/internal/server/device_metrics.h>
 #include <tango/internal/telemetry/telemetry_kernel_macros.h>
 
 #if defined(TANGO_USE_TELEMETRY)
@@ -69,8 +74,15 @@ T &get_union_value(Tango::AttrValUnion &val);
 template <class T>
 void data_in_object(Attribute &att, AttributeIdlData &aid, long index, bool del_seq);
 
+std::string poll_obj_key(Tango::PollObjType obj_type, const std::string &obj_name)
+{
+    std::string key = obj_type == Tango::POLL_CMD ? "cmd/" : "attr/";
+    key += obj_name;
+    return detail::to_lower(std::move(key));
+}
+
 template <class T>
-void data_in_net_object(AttributeIdlData &aid, long index, long vers, PollObj *polled_att);
+void data_in_net_object(AttributeIdlData &aid, long index, long vers, const PollObj::LastAttrValue &polled_att);
 
 template <>
 inline Tango::DevVarShortArray &get_any_value(Tango::AttrValUnion &val)
@@ -301,11 +313,11 @@ inline void set_union_value(Tango::AttrValUnion &val, Tango::DevVarULong64Array
 }
 
 template <class T>
-inline void data_in_net_object(AttributeIdlData &aid, long index, long vers, PollObj *polled_att)
+inline void data_in_net_object(AttributeIdlData &aid, long index, long vers, const PollObj::LastAttrValue &polled_att)
 {
     if(aid.data_5 != nullptr)
     {
-        AttributeValue_5 &att_val = polled_att->get_last_attr_value_5(false);
+        AttributeValue_5 &att_val = polled_att.get_value_5();
         set_union_value((*aid.data_5)[index].value,
                         get_union_value<typename tango_type_traits<T>::ArrayType>(att_val.value));
     }
@@ -313,13 +325,13 @@ inline void data_in_net_object(AttributeIdlData &aid, long index, long vers, Pol
     {
         if(vers >= 5)
         {
-            AttributeValue_5 &att_val = polled_att->get_last_attr_value_5(false);
+            AttributeValue_5 &att_val = polled_att.get_value_5();
             set_union_value((*aid.data_4)[index].value,
                             get_union_value<typename tango_type_traits<T>::ArrayType>(att_val.value));
         }
         else
         {
-            AttributeValue_4 &att_val = polled_att->get_last_attr_value_4(false);
+            AttributeValue_4 &att_val = polled_att.get_value_4();
             set_union_value((*aid.data_4)[index].value,
                             get_union_value<typename tango_type_traits<T>::ArrayType>(att_val.value));
         }
@@ -329,7 +341,7 @@ inline void data_in_net_object(AttributeIdlData &aid, long index, long vers, Pol
         typename tango_type_traits<T>::ArrayType *tmp;
         if(vers >= 5)
         {
-            AttributeValue_5 &att_val = polled_att->get_last_attr_value_5(false);
+            AttributeValue_5 &att_val = polled_att.get_value_5();
             typename tango_type_traits<T>::ArrayType &union_seq =
                 get_union_value<typename tango_type_traits<T>::ArrayType>(att_val.value);
             tmp = new typename tango_type_traits<T>::ArrayType(
@@ -337,7 +349,7 @@ inline void data_in_net_object(AttributeIdlData &aid, long index, long vers, Pol
         }
         else if(vers == 4)
         {
-            AttributeValue_4 &att_val = polled_att->get_last_attr_value_4(false);
+            AttributeValue_4 &att_val = polled_att.get_value_4();
             typename tango_type_traits<T>::ArrayType &union_seq =
                 get_union_value<typename tango_type_traits<T>::ArrayType>(att_val.value);
             tmp = new typename tango_type_traits<T>::ArrayType(
@@ -346,7 +358,7 @@ inline void data_in_net_object(AttributeIdlData &aid, long index, long vers, Pol
         else
         {
             const typename tango_type_traits<T>::ArrayType *tmp_cst;
-            AttributeValue_3 &att_val = polled_att->get_last_attr_value_3(false);
+            AttributeValue_3 &att_val = polled_att.get_value_3();
             att_val.value >>= tmp_cst;
             tmp = new typename tango_type_traits<T>::ArrayType(
                 tmp_cst->length(), tmp_cst->length(), const_cast<T *>(tmp_cst->get_buffer()), false);
@@ -430,6 +442,9 @@ void DeviceImpl::real_ctor()
 
     device_prev_state = device_state;
 
+    cmd_index = std::make_unique<detail::CommandIndex>();
+    attr_locks = std::make_unique<detail::AttributeLocks>();
+
     //
     // Init lower case device name
     //
@@ -437,6 +452,8 @@ void DeviceImpl::real_ctor()
     device_name_lower = device_name;
     std::transform(device_name_lower.begin(), device_name_lower.end(), device_name_lower.begin(), ::tolower);
 
+    device_metrics = std::make_unique<detail::DeviceMetrics>(device_name_lower);
+
     //
     //  Write the device name into the per thread data for sub device diagnostics
     //
@@ -790,6 +807,7 @@ void DeviceImpl::black_box_create()
     {
         blackbox_ptr = std::make_unique<BlackBox>(blackbox_depth);
     }
+    blackbox_ptr->set_metrics(device_metrics.get());
 }
 
 //+----------------------------------------------------------------------------
@@ -1143,20 +1161,16 @@ void DeviceImpl::signal_handler(long signo)
 
 void DeviceImpl::check_command_exists(const std::string &cmd_name)
 {
-    std::vector<Command *> &cmd_list = device_class->get_command_list();
-    unsigned long i;
-    for(i = 0; i < cmd_list.size(); i++)
+    Command *cmd = device_class->find_command(cmd_name);
+    if(cmd != nullptr)
     {
-        if(cmd_list[i]->get_lower_name() == cmd_name)
+        if(cmd->get_in_type() != Tango::DEV_VOID)
         {
-            if(cmd_list[i]->get_in_type() != Tango::DEV_VOID)
-            {
-                TangoSys_OMemStream o;
-                o << "Command " << cmd_name << " cannot be polled because it needs input value" << std::ends;
-                TANGO_THROW_EXCEPTION(API_IncompatibleCmdArgumentType, o.str());
-            }
-            return;
+            TangoSys_OMemStream o;
+            o << "Command " << cmd_name << " cannot be polled because it needs input value" << std::ends;
+            TANGO_THROW_EXCEPTION(API_IncompatibleCmdArgumentType, o.str());
         }
+        return;
     }
 
     TangoSys_OMemStream o;
@@ -1178,14 +1192,10 @@ void DeviceImpl::check_command_exists(const std::string &cmd_name)
 
 Command *DeviceImpl::get_command(const std::string &cmd_name)
 {
-    std::vector<Command *> cmd_list = device_class->get_command_list();
-    unsigned long i;
-    for(i = 0; i < cmd_list.size(); i++)
+    Command *cmd = device_class->find_command(cmd_name);
+    if(cmd != nullptr)
     {
-        if(cmd_list[i]->get_lower_name() == cmd_name)
-        {
-            return cmd_list[i];
-        }
+        return cmd;
     }
 
     TangoSys_OMemStream o;
@@ -1205,31 +1215,27 @@ Command *DeviceImpl::get_command(const std::string &cmd_name)
 //
 // method :        DeviceImpl::get_polled_obj_by_type_name
 //
-// description :    This method check that a comamnd is supported by
-//            the device and does not need input value.
-//            The method throws an exception if the
-//            command is not defined or needs an input value
+// description :    This method returns an iterator on the polled object
+//            list for the object with the given type and name.
+//            The method throws an exception if the object is
+//            not polled
 //
-// in :         cmd_name : The command name
+// in :         obj_type : The object type (command or attribute)
+//            obj_name : The object name
 //
 //--------------------------------------------------------------------------
 
 std::vector<PollObj *>::iterator DeviceImpl::get_polled_obj_by_type_name(Tango::PollObjType obj_type,
                                                                          const std::string &obj_name)
 {
-    std::vector<PollObj *> &po_list = get_poll_obj_list();
-    std::vector<PollObj *>::iterator ite;
-    for(ite = po_list.begin(); ite < po_list.end(); ++ite)
+    PollObj *polled_obj = get_polled_obj(obj_type, obj_name);
+    if(polled_obj != nullptr)
     {
-        omni_mutex_lock sync(**ite);
+        std::vector<PollObj *> &po_list = get_poll_obj_list();
+        auto ite = std::find(po_list.begin(), po_list.end(), polled_obj);
+        if(ite != po_list.end())
         {
-            if((*ite)->get_type_i() == obj_type)
-            {
-                if((*ite)->get_name_i() == obj_name)
-                {
-                    return ite;
-                }
-            }
+            return ite;
         }
     }
 
@@ -1238,6 +1244,74 @@ std::vector<PollObj *>::iterator DeviceImpl::get_polled_obj_by_type_name(Tango::
     TANGO_THROW_EXCEPTION(API_PollObjNotFound, o.str());
 }
 
+//+-------------------------------------------------------------------------
+//
+// method :        DeviceImpl::get_polled_obj
+//
+// description :    This method returns the polled object with the given
+//            type and name (case independent) using the device polled
+//            object index. It returns nullptr if the object is not
+//            polled
+//
+// in :         obj_type : The object type (command or attribute)
+//            obj_name : The object name
+//
+//--------------------------------------------------------------------------
+
+PollObj *DeviceImpl::get_polled_obj(Tango::PollObjType obj_type, const std::string &obj_name)
+{
+    std::string key = poll_obj_key(obj_type, obj_name);
+
+    std::shared_lock<std::shared_mutex> lock(poll_obj_index_mutex);
+    auto pos = poll_obj_index.find(key);
+    return pos == poll_obj_index.end() ? nullptr : pos->second;
+}
+
+//+-------------------------------------------------------------------------
+//
+// method :        DeviceImpl::add_poll_obj
+//
+// description :    Add an object to the list of polled objects and to
+//            its index. The device takes ownership of the object.
+//            The caller has to protect the polled object list with
+//            the device polling monitor if needed
+//
+// in :         polled_obj : The new polled object
+//
+//--------------------------------------------------------------------------
+
+void DeviceImpl::add_poll_obj(PollObj *polled_obj)
+{
+    std::string key = poll_obj_key(polled_obj->get_type(), polled_obj->get_name());
+
+    std::unique_lock<std::shared_mutex> lock(poll_obj_index_mutex);
+    poll_obj_list.push_back(polled_obj);
+    poll_obj_index[key] = polled_obj;
+}
+
+//+-------------------------------------------------------------------------
+//
+// method :        DeviceImpl::remove_poll_obj
+//
+// description :    Remove an object from the list of polled objects and
+//            from its index, then delete it. The caller has to
+//            protect the polled object list with the device polling
+//            monitor if needed
+//
+// in :         ite : Iterator on the object in the polled object list
+//
+//--------------------------------------------------------------------------
+
+void DeviceImpl::remove_poll_obj(std::vector<PollObj *>::iterator ite)
+{
+    std::string key = poll_obj_key((*ite)->get_type(), (*ite)->get_name());
+
+    std::unique_lock<std::shared_mutex> lock(poll_obj_index_mutex);
+    poll_obj_index.erase(key);
+    delete(*ite);
+    poll_obj_list.erase(ite);
+}
+
 //+-----------------------------------------------------------------------------------------------------------------
 //
 // method :
@@ -1447,6 +1521,15 @@ Tango::DevState DeviceImpl::dev_state()
     {
         if((device_state == Tango::ON) || (device_state == Tango::ALARM))
         {
+            //
+            // In incremental mode, the attributes are not read. Their quality factors are already up to date
+            //
+
+            if(ext->incremental_state)
+            {
+                return incremental_dev_state();
+            }
+
             //
             // Build attribute lists
             //
@@ -1676,6 +1759,118 @@ Tango::DevState DeviceImpl::dev_state()
     return device_state;
 }
 
+//----------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        DeviceImpl::incremental_dev_state
+//
+// description :
+//        Compute the device state from the attribute quality factors, without reading any attribute. The quality
+//        factors are updated (and the alarms checked) each time an attribute value is set. The computation is done
+//        only if one of them may have changed since the previous call (or if the state has been changed by the user)
+//
+// return :
+//        The device state
+//
+//---------------------------------------------------------------------------------------------------------------------
+
+Tango::DevState DeviceImpl::incremental_dev_state()
+{
+    std::uint64_t updates = dev_attr->get_quality_updates();
+    std::uint64_t generation = dev_attr->get_attr_list_generation();
+
+    if(ext->state_computed && device_state == ext->computed_state && updates == ext->state_quality_updates &&
+       generation == ext->state_attr_generation)
+    {
+        return device_state;
+    }
+
+    if(dev_attr->is_att_quality_alarmed())
+    {
+        if(device_state != Tango::ALARM)
+        {
+            device_state = Tango::ALARM;
+            ext->alarm_state_kernel = Tango::get_current_system_datetime();
+        }
+    }
+    else
+    {
+        if(ext->alarm_state_kernel > ext->alarm_state_user)
+        {
+            device_state = Tango::ON;
+        }
+    }
+
+    ext->state_computed = true;
+    ext->computed_state = device_state;
+    ext->state_quality_updates = updates;
+    ext->state_attr_generation = generation;
+
+    return device_state;
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        DeviceImpl::set_incremental_state
+//
+// description :
+//        Enable/disable the incremental computation of the device state
+//
+// argument :
+//        in :
+//            - on : Set to true to enable the incremental state computation
+//
+//---------------------------------------------------------------------------------------------------------------------
+
+void DeviceImpl::set_incremental_state(bool on)
+{
+    NoSyncModelTangoMonitor mon(this);
+
+    ext->incremental_state = on;
+    ext->state_computed = false;
+    dev_attr->set_incremental_state(on);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        DeviceImpl::set_attribute_read_locking
+//
+// description :
+//        Enable/disable the attribute read locking model
+//
+// argument :
+//        in :
+//            - on : Set to true to enable the attribute read locking model
+//
+//---------------------------------------------------------------------------------------------------------------------
+
+void DeviceImpl::set_attribute_read_locking(bool on)
+{
+    attr_locks->enable(on);
+}
+
+//----------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        DeviceImpl::set_attribute_lock_group
+//
+// description :
+//        Set the lock group used for one attribute with the attribute read locking model
+//
+// argument :
+//        in :
+//            - attr_name : The attribute name
+//            - group : The lock group name
+//
+//---------------------------------------------------------------------------------------------------------------------
+
+void DeviceImpl::set_attribute_lock_group(const std::string &attr_name, const std::string &group)
+{
+    attr_locks->set_group(detail::to_lower(attr_name), group);
+}
+
 //----------------------------------------------------------------------------------------------------------------------
 //
 // method :
@@ -3342,6 +3537,26 @@ void DeviceImpl::write_attributes(const Tango::AttributeValueList &values)
 //--------------------------------------------------------------------------------------------------------------------
 
 void DeviceImpl::add_attribute(Tango::Attr *new_attr)
+{
+    add_attributes({new_attr});
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        DeviceImpl::add_attributes
+//
+// description :
+//        Add several attributes to the device attribute(s) list. The attribute properties are retrieved from the
+//        database with one call for all the attributes and a single device interface change event is sent.
+//
+// argument:
+//        in :
+//            - new_attrs: The new attributes to be added.
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+void DeviceImpl::add_attributes(const std::vector<Tango::Attr *> &new_attrs)
 {
     //
     // Take the device monitor in order to protect the attribute list
@@ -3353,46 +3568,128 @@ void DeviceImpl::add_attribute(Tango::Attr *new_attr)
     long old_attr_nb = attr_list.size();
 
     //
-    // Check that this attribute is not already defined for this device. If it is already there, immediately returns.
-    // Trick : If you add an attribute to a device, this attribute will be inserted in the device class attribute list.
-    // Therefore, all devices created after this attribute addition will also have this attribute.
+    // Index the attributes already defined in the class, by name and class name
     //
 
-    std::string &attr_name = new_attr->get_name();
-    bool already_there = true;
-    bool throw_ex = false;
-    try
+    std::map<std::pair<std::string, std::string>, long> class_attr_indexes;
+    for(long i = 0; i < old_attr_nb; i++)
     {
-        Tango::Attribute &al_attr = dev_attr->get_attr_by_name(attr_name.c_str());
-        if((al_attr.get_data_type() != new_attr->get_type()) || (al_attr.get_data_format() != new_attr->get_format()) ||
-           (al_attr.get_writable() != new_attr->get_writable()))
-        {
-            throw_ex = true;
-        }
-    }
-    catch(Tango::DevFailed &)
-    {
-        already_there = false;
+        class_attr_indexes.emplace(std::make_pair(attr_list[i]->get_name(), attr_list[i]->get_cl_name()), i);
     }
 
     //
-    // Throw exception if the device already have an attribute with the same name but with a different definition
+    // Check all the attributes before modifying anything, so that the device is left unchanged if one of them is
+    // wrongly defined.
+    // Check that this attribute is not already defined for this device. If it is already there, it is skipped.
+    // Trick : If you add an attribute to a device, this attribute will be inserted in the device class attribute list.
+    // Therefore, all devices created after this attribute addition will also have this attribute.
     //
 
-    if(throw_ex)
+    std::vector<Tango::Attr *> to_add;
+    std::vector<Tango::Attr *> already_there;
+    std::map<std::string, Tango::Attr *> batch_attrs;
+    std::unordered_set<Tango::Attr *> seen_attrs;
+
+    for(Tango::Attr *new_attr : new_attrs)
     {
-        TangoSys_OMemStream o;
+        //
+        // The same Attr object may be given twice in the list. It is only handled (added or deleted) once
+        //
 
-        o << "Device " << get_name() << " -> Attribute " << attr_name
-          << " already exists for your device but with other definition";
-        o << "\n(data type, data format or data write type)" << std::ends;
+        if(!seen_attrs.insert(new_attr).second)
+        {
+            continue;
+        }
 
-        TANGO_THROW_EXCEPTION(API_AttrNotFound, o.str());
+        std::string &attr_name = new_attr->get_name();
+        bool there = true;
+        bool throw_ex = false;
+        try
+        {
+            Tango::Attribute &al_attr = dev_attr->get_attr_by_name(attr_name.c_str());
+            if((al_attr.get_data_type() != new_attr->get_type()) ||
+               (al_attr.get_data_format() != new_attr->get_format()) ||
+               (al_attr.get_writable() != new_attr->get_writable()))
+            {
+                throw_ex = true;
+            }
+        }
+        catch(Tango::DevFailed &)
+        {
+            there = false;
+        }
+
+        //
+        // The same attribute may also be given twice in the list
+        //
+
+        if(!there)
+        {
+            auto ite = batch_attrs.find(detail::to_lower(attr_name));
+            if(ite != batch_attrs.end())
+            {
+                there = true;
+                throw_ex = (ite->second->get_type() != new_attr->get_type()) ||
+                           (ite->second->get_format() != new_attr->get_format()) ||
+                           (ite->second->get_writable() != new_attr->get_writable());
+            }
+        }
+
+        //
+        // Throw exception if the device already have an attribute with the same name but with a different definition
+        //
+
+        if(throw_ex)
+        {
+            TangoSys_OMemStream o;
+
+            o << "Device " << get_name() << " -> Attribute " << attr_name
+              << " already exists for your device but with other definition";
+            o << "\n(data type, data format or data write type)" << std::ends;
+
+            TANGO_THROW_EXCEPTION(API_AttrNotFound, o.str());
+        }
+
+        if(there)
+        {
+            already_there.push_back(new_attr);
+            continue;
+        }
+
+        //
+        // If an attribute with the same name is already defined within the class, check if the data type, data format
+        // and write type are the same
+        //
+
+        auto ite = class_attr_indexes.find(std::make_pair(attr_name, new_attr->get_cl_name()));
+        if(ite != class_attr_indexes.end())
+        {
+            Tango::Attr *class_attr = attr_list[ite->second];
+            if((class_attr->get_type() != new_attr->get_type()) ||
+               (class_attr->get_format() != new_attr->get_format()) ||
+               (class_attr->get_writable() != new_attr->get_writable()))
+            {
+                TangoSys_OMemStream o;
+
+                o << "Device " << get_name() << " -> Attribute " << attr_name
+                  << " already exists for your device class but with other definition";
+                o << "\n(data type, data format or data write type)" << std::ends;
+
+                TANGO_THROW_EXCEPTION(API_AttrNotFound, o.str());
+            }
+        }
+
+        batch_attrs.emplace(detail::to_lower(attr_name), new_attr);
+        to_add.push_back(new_attr);
     }
 
-    if(already_there)
+    for(Tango::Attr *new_attr : already_there)
     {
         delete new_attr;
+    }
+
+    if(to_add.empty())
+    {
         return;
     }
 
@@ -3422,64 +3719,51 @@ void DeviceImpl::add_attribute(Tango::Attr *new_attr)
     }
 
     //
-    // Add this attribute in the MultiClassAttribute attr_list vector if it does not already exist
+    // Add the attributes in the MultiClassAttribute attr_list vector if they do not already exist and get all the
+    // properties defined for them at class level
     //
 
-    bool need_free = false;
-    long i;
+    std::vector<long> class_indexes;
+    std::vector<Tango::Attr *> to_free;
+    class_indexes.reserve(to_add.size());
 
-    for(i = 0; i < old_attr_nb; i++)
+    for(Tango::Attr *new_attr : to_add)
     {
-        if((attr_list[i]->get_name() == attr_name) && (attr_list[i]->get_cl_name() == new_attr->get_cl_name()))
+        auto ite = class_attr_indexes.find(std::make_pair(new_attr->get_name(), new_attr->get_cl_name()));
+        if(ite == class_attr_indexes.end())
         {
-            need_free = true;
-            break;
+            attr_list.push_back(new_attr);
+            class_indexes.push_back(attr_list.size() - 1);
+        }
+        else
+        {
+            class_indexes.push_back(ite->second);
+            to_free.push_back(new_attr);
         }
     }
 
-    if(i == old_attr_nb)
+    if(static_cast<long>(attr_list.size()) != old_attr_nb)
     {
-        attr_list.push_back(new_attr);
-
-        //
-        // Get all the properties defined for this attribute at class level
-        //
-
         device_class->get_class_attr()->init_class_attribute(device_class->get_name(), old_attr_nb);
     }
-    else
-    {
-        //
-        // An attribute with the same name is already defined within the class. Check if the data type, data format and
-        // write type are the same
-        //
-
-        if((attr_list[i]->get_type() != new_attr->get_type()) ||
-           (attr_list[i]->get_format() != new_attr->get_format()) ||
-           (attr_list[i]->get_writable() != new_attr->get_writable()))
-        {
-            TangoSys_OMemStream o;
-
-            o << "Device " << get_name() << " -> Attribute " << attr_name
-              << " already exists for your device class but with other definition";
-            o << "\n(data type, data format or data write type)" << std::ends;
-
-            TANGO_THROW_EXCEPTION(API_AttrNotFound, o.str());
-        }
-    }
 
     //
-    // Add the attribute to the MultiAttribute object
+    // Add the attributes to the MultiAttribute object
     //
 
-    if(new_attr->is_fwd())
+    std::vector<long> non_fwd_indexes;
+    for(size_t i = 0; i < to_add.size(); i++)
     {
-        dev_attr->add_fwd_attribute(device_name, device_class, i, new_attr);
-    }
-    else
-    {
-        dev_attr->add_attribute(device_name, device_class, i);
+        if(to_add[i]->is_fwd())
+        {
+            dev_attr->add_fwd_attribute(device_name, device_class, class_indexes[i], to_add[i]);
+        }
+        else
+        {
+            non_fwd_indexes.push_back(class_indexes[i]);
+        }
     }
+    dev_attr->add_attributes(device_name, device_class, non_fwd_indexes);
 
     //
     // Eventually start or update device interface change event thread
@@ -3491,17 +3775,21 @@ void DeviceImpl::add_attribute(Tango::Attr *new_attr)
     // If attribute has to be polled (set by Pogo), start polling now
     //
 
-    long per = new_attr->get_polling_period();
-    if((!is_attribute_polled(attr_name)) && (per != 0))
+    for(Tango::Attr *new_attr : to_add)
     {
-        poll_attribute(attr_name, per);
+        std::string &attr_name = new_attr->get_name();
+        long per = new_attr->get_polling_period();
+        if((!is_attribute_polled(attr_name)) && (per != 0))
+        {
+            poll_attribute(attr_name, per);
+        }
     }
 
     //
     // Free memory if needed
     //
 
-    if(need_free)
+    for(Tango::Attr *new_attr : to_free)
     {
         delete new_attr;
     }
@@ -5356,13 +5644,17 @@ void DeviceImpl::data_into_net_object(
 //            - index :
 //            - type :
 //            - vers : Device IDl version
-//            - polled_att :
+//            - polled_att : The last value of the polled attribute
 //            - names :
 //
 //-------------------------------------------------------------------------------------------------------------------
 
-void DeviceImpl::polled_data_into_net_object(
-    AttributeIdlData &aid, long index, long type, long vers, PollObj *polled_att, const DevVarStringArray &names)
+void DeviceImpl::polled_data_into_net_object(AttributeIdlData &aid,
+                                             long index,
+                                             long type,
+                                             long vers,
+                                             const PollObj::LastAttrValue &polled_att,
+                                             const DevVarStringArray &names)
 {
     const Tango::DevVarStateArray *tmp_state;
     Tango::DevVarStateArray *new_tmp_state;
@@ -5418,7 +5710,7 @@ void DeviceImpl::polled_data_into_net_object(
     case Tango::DEV_STATE:
         if(aid.data_5 != nullptr)
         {
-            AttributeValue_5 &att_val = polled_att->get_last_attr_value_5(false);
+            AttributeValue_5 &att_val = polled_att.get_value_5();
             if(att_val.value._d() == DEVICE_STATE)
             {
                 sta = att_val.value.dev_state_att();
@@ -5434,7 +5726,7 @@ void DeviceImpl::polled_data_into_net_object(
         {
             if(vers >= 5)
             {
-                AttributeValue_5 &att_val = polled_att->get_last_attr_value_5(false);
+                AttributeValue_5 &att_val = polled_att.get_value_5();
                 if(att_val.value._d() == DEVICE_STATE)
                 {
                     sta = att_val.value.dev_state_att();
@@ -5448,7 +5740,7 @@ void DeviceImpl::polled_data_into_net_object(
             }
             else
             {
-                AttributeValue_4 &att_val = polled_att->get_last_attr_value_4(false);
+                AttributeValue_4 &att_val = polled_att.get_value_4();
                 if(att_val.value._d() == DEVICE_STATE)
                 {
                     sta = att_val.value.dev_state_att();
@@ -5465,7 +5757,7 @@ void DeviceImpl::polled_data_into_net_object(
         {
             if(vers >= 5)
             {
-                AttributeValue_5 &att_val = polled_att->get_last_attr_value_5(false);
+                AttributeValue_5 &att_val = polled_att.get_value_5();
                 if(att_val.value._d() == DEVICE_STATE)
                 {
                     sta = att_val.value.dev_state_att();
@@ -5481,7 +5773,7 @@ void DeviceImpl::polled_data_into_net_object(
             }
             else if(vers == 4)
             {
-                AttributeValue_4 &att_val = polled_att->get_last_attr_value_4(false);
+                AttributeValue_4 &att_val = polled_att.get_value_4();
                 if(att_val.value._d() == DEVICE_STATE)
                 {
                     sta = att_val.value.dev_state_att();
@@ -5497,7 +5789,7 @@ void DeviceImpl::polled_data_into_net_object(
             }
             else
             {
-                AttributeValue_3 &att_val = polled_att->get_last_attr_value_3(false);
+                AttributeValue_3 &att_val = polled_att.get_value_3();
                 CORBA::TypeCode_var ty;
                 ty = att_val.value.type();
 
@@ -5522,7 +5814,7 @@ void DeviceImpl::polled_data_into_net_object(
     case Tango::DEV_ENCODED:
         if(aid.data_5 != nullptr)
         {
-            AttributeValue_5 &att_val = polled_att->get_last_attr_value_5(false);
+            AttributeValue_5 &att_val = polled_att.get_value_5();
             DevVarEncodedArray &polled_seq = att_val.value.encoded_att_value();
 
             unsigned int nb_encoded = polled_seq.length();
@@ -5543,7 +5835,7 @@ void DeviceImpl::polled_data_into_net_object(
         {
             if(vers >= 5)
             {
-                AttributeValue_5 &att_val = polled_att->get_last_attr_value_5(false);
+                AttributeValue_5 &att_val = polled_att.get_value_5();
                 DevVarEncodedArray &polled_seq = att_val.value.encoded_att_value();
 
                 unsigned int nb_encoded = polled_seq.length();
@@ -5562,7 +5854,7 @@ void DeviceImpl::polled_data_into_net_object(
             }
             else
             {
-                AttributeValue_4 &att_val = polled_att->get_last_attr_value_4(false);
+                AttributeValue_4 &att_val = polled_att.get_value_4();
                 DevVarEncodedArray &polled_seq = att_val.value.encoded_att_value();
 
                 unsigned int nb_encoded = polled_seq.length();
@@ -5966,22 +6258,9 @@ void DeviceImpl::lock_root_devices(int validity, bool lock_action)
 
 Command &DeviceImpl::get_local_cmd_by_name(const std::string &cmd_name)
 {
-    std::vector<Command *>::iterator pos;
-
-    pos = find_if(command_list.begin(),
-                  command_list.end(),
-                  [&](Command *cmd) -> bool
-                  {
-                      if(cmd_name.size() != cmd->get_lower_name().size())
-                      {
-                          return false;
-                      }
-                      std::string tmp_name(cmd_name);
-                      std::transform(tmp_name.begin(), tmp_name.end(), tmp_name.begin(), ::tolower);
-                      return cmd->get_lower_name() == tmp_name;
-                  });
+    Command *cmd = find_local_command(cmd_name);
 
-    if(pos == command_list.end())
+    if(cmd == nullptr)
     {
         TANGO_LOG_DEBUG << "DeviceImpl::get_cmd_by_name throwing exception" << std::endl;
         TangoSys_OMemStream o;
@@ -5990,7 +6269,25 @@ Command &DeviceImpl::get_local_cmd_by_name(const std::string &cmd_name)
         TANGO_THROW_EXCEPTION(API_CommandNotFound, o.str());
     }
 
-    return *(*pos);
+    return *cmd;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method :        DeviceImpl::find_local_command
+//
+// description :    Search a command in the local command list using the
+//            device command index
+//
+// in :     cmd_name : The command name (case independent)
+//
+// return : A pointer to the Command object or nullptr if not found
+//
+//-----------------------------------------------------------------------------
+
+Command *DeviceImpl::find_local_command(const std::string &cmd_name)
+{
+    return cmd_index->find(command_list, cmd_name);
 }
 
 //+----------------------------------------------------------------------------
@@ -6028,6 +6325,7 @@ void DeviceImpl::remove_local_command(const std::string &cmd_name)
     }
 
     command_list.erase(pos);
+    cmd_index->invalidate();
 }
 
 //+-----------------------------------------------------------------------------------------------------------------
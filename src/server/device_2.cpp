@@ -213,31 +213,8 @@ CORBA::Any *Device_2Impl::command_inout_2(const char *in_cmd, const CORBA::Any &
             // Warning : Since IDL 3 (Tango V5), state and status are polled as attributes
             //
 
-            bool found = false;
-            std::vector<PollObj *> &poll_list = get_poll_obj_list();
-            unsigned long i;
-            for(i = 0; i < poll_list.size(); i++)
-            {
-                if(poll_list[i]->get_name() == cmd_str)
-                {
-                    if((state_cmd) || (status_cmd))
-                    {
-                        if(poll_list[i]->get_type() == Tango::POLL_ATTR)
-                        {
-                            polled_cmd = poll_list[i];
-                            found = true;
-                        }
-                    }
-                    else
-                    {
-                        if(poll_list[i]->get_type() == Tango::POLL_CMD)
-                        {
-                            polled_cmd = poll_list[i];
-                            found = true;
-                        }
-                    }
-                }
-            }
+            polled_cmd = get_polled_obj(((state_cmd) || (status_cmd)) ? Tango::POLL_ATTR : Tango::POLL_CMD, cmd_str);
+            bool found = polled_cmd != nullptr;
 
             //
             // Throw exception if the command is not polled
@@ -547,14 +524,7 @@ Tango::AttributeValueList *Device_2Impl::read_attributes_2(const Tango::DevVarSt
                 {
                     for(i = 0; i < real_names.length(); i++)
                     {
-                        for(j = 0; j < nb_poll; j++)
-                        {
-                            if(TG_strcasecmp(poll_list[j]->get_name().c_str(), real_names[i]) == 0)
-                            {
-                                break;
-                            }
-                        }
-                        if(j == nb_poll)
+                        if(get_polled_obj(Tango::POLL_ATTR, real_names[i].in()) == nullptr)
                         {
                             non_polled.push_back(i);
                         }
@@ -661,18 +631,7 @@ Tango::AttributeValueList *Device_2Impl::read_attributes_2(const Tango::DevVarSt
 
                 for(i = 0; i < nb_attr; i++)
                 {
-                    std::vector<PollObj *> &poll_list = get_poll_obj_list();
-                    PollObj *polled_attr = nullptr;
-                    unsigned long j;
-                    for(j = 0; j < poll_list.size(); j++)
-                    {
-                        if((poll_list[j]->get_type() == Tango::POLL_ATTR) &&
-                           (TG_strcasecmp(poll_list[j]->get_name().c_str(), real_names[i]) == 0))
-                        {
-                            polled_attr = poll_list[j];
-                            break;
-                        }
-                    }
+                    PollObj *polled_attr = get_polled_obj(Tango::POLL_ATTR, real_names[i].in());
 
                     //
                     // Check that some data is available in cache
@@ -1337,29 +1296,8 @@ Tango::DevCmdHistoryList *Device_2Impl::command_inout_history_2(const char *comm
     // Check that the command is polled
     //
 
-    PollObj *polled_cmd = nullptr;
-    std::vector<PollObj *> &poll_list = get_poll_obj_list();
-    unsigned long i;
-    for(i = 0; i < poll_list.size(); i++)
-    {
-        if(poll_list[i]->get_name() == cmd_str)
-        {
-            if((state_cmd) || (status_cmd))
-            {
-                if(poll_list[i]->get_type() == Tango::POLL_ATTR)
-                {
-                    polled_cmd = poll_list[i];
-                }
-            }
-            else
-            {
-                if(poll_list[i]->get_type() == Tango::POLL_CMD)
-                {
-                    polled_cmd = poll_list[i];
-                }
-            }
-        }
-    }
+    PollObj *polled_cmd =
+        get_polled_obj(((state_cmd) || (status_cmd)) ? Tango::POLL_ATTR : Tango::POLL_CMD, cmd_str);
 
     if(polled_cmd == nullptr)
     {
@@ -1507,8 +1445,6 @@ Tango::DevAttrHistoryList *Device_2Impl::read_attribute_history_2(const char *na
     long vers = get_dev_idl_version();
     Tango::DevAttrHistoryList *back = nullptr;
     Tango::DevAttrHistoryList_3 *back_3 = nullptr;
-    std::vector<PollObj *> &poll_list = get_poll_obj_list();
-    long nb_poll = poll_list.size();
 
     //
     // Check that the device supports this attribute. This method returns an
@@ -1524,16 +1460,7 @@ Tango::DevAttrHistoryList *Device_2Impl::read_attribute_history_2(const char *na
     // Check that the wanted attribute is polled.
     //
 
-    long j;
-    PollObj *polled_attr = nullptr;
-    for(j = 0; j < nb_poll; j++)
-    {
-        if((poll_list[j]->get_type() == Tango::POLL_ATTR) && (poll_list[j]->get_name() == attr_str))
-        {
-            polled_attr = poll_list[j];
-            break;
-        }
-    }
+    PollObj *polled_attr = get_polled_obj(Tango::POLL_ATTR, attr_str);
     if(polled_attr == nullptr)
     {
         TangoSys_OMemStream o;
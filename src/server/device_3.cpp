@@ -34,9 +34,12 @@
 #include <tango/server/eventsupplier.h>
 #include <tango/server/tango_clock.h>
 #include <tango/server/fwdattribute.h>
+#include <tango/server/fwdattrdesc.h>
 #include <new>
 #include <tango/internal/telemetry/telemetry_kernel_macros.h>
 #include <tango/internal/utils.h>
+#include <tango/internal/server/attribute_locks.h>
+#include <tango/internal/server/read_plan.h>
 #include <tango/client/Database.h>
 
 namespace
@@ -58,6 +61,29 @@ void report_attr_error(const std::vector<std::string> &vec)
 }
 
 #endif // TANGO_USE_TELEMETRY
+// Hold a monitor in shared mode
+class SharedMonitorLock
+{
+  public:
+    explicit SharedMonitorLock(Tango::TangoMonitor &m) :
+        mon(m)
+    {
+        mon.get_shared_monitor();
+    }
+
+    ~SharedMonitorLock()
+    {
+        mon.rel_shared_monitor();
+    }
+
+    SharedMonitorLock(const SharedMonitorLock &) = delete;
+    SharedMonitorLock &operator=(const SharedMonitorLock &) = delete;
+
+  private:
+    Tango::TangoMonitor &mon;
+    omni_thread::ensure_self auto_self;
+};
+
 template <typename T>
 void error_from_devfailed(T &back, Tango::DevFailed &e, const char *na)
 {
@@ -504,14 +530,16 @@ namespace Tango
 
 Device_3Impl::Device_3Impl(DeviceClass *device_class, const std::string &dev_name) :
     Device_2Impl(device_class, dev_name),
-    ext_3(new Device_3ImplExt)
+    ext_3(new Device_3ImplExt),
+    read_plans(new detail::ReadPlanCache)
 {
     real_ctor();
 }
 
 Device_3Impl::Device_3Impl(DeviceClass *device_class, const std::string &dev_name, const std::string &desc) :
     Device_2Impl(device_class, dev_name, desc),
-    ext_3(new Device_3ImplExt)
+    ext_3(new Device_3ImplExt),
+    read_plans(new detail::ReadPlanCache)
 {
     real_ctor();
 }
@@ -522,7 +550,8 @@ Device_3Impl::Device_3Impl(DeviceClass *device_class,
                            Tango::DevState dev_state,
                            const std::string &dev_status) :
     Device_2Impl(device_class, dev_name, desc, dev_state, dev_status),
-    ext_3(new Device_3ImplExt)
+    ext_3(new Device_3ImplExt),
+    read_plans(new detail::ReadPlanCache)
 {
     real_ctor();
 }
@@ -533,7 +562,8 @@ Device_3Impl::Device_3Impl(DeviceClass *device_class,
                            Tango::DevState dev_state,
                            const char *dev_status) :
     Device_2Impl(device_class, dev_name, desc, dev_state, dev_status),
-    ext_3(new Device_3ImplExt)
+    ext_3(new Device_3ImplExt),
+    read_plans(new detail::ReadPlanCache)
 {
     real_ctor();
 }
@@ -553,6 +583,8 @@ void Device_3Impl::real_ctor()
     }
 }
 
+Device_3Impl::~Device_3Impl() { }
+
 //+-------------------------------------------------------------------------------------------------------------------
 //
 // method :
@@ -638,8 +670,7 @@ Tango::AttributeValueList_3 *Device_3Impl::read_attributes_3(const Tango::DevVar
     {
         try
         {
-            AutoTangoMonitor sync(this);
-            read_attributes_no_except(real_names, aid, false, idx_in_back);
+            read_attributes_locked(real_names, aid, false, idx_in_back);
         }
         catch(...)
         {
@@ -715,8 +746,7 @@ Tango::AttributeValueList_3 *Device_3Impl::read_attributes_3(const Tango::DevVar
 
             try
             {
-                AutoTangoMonitor sync(this);
-                read_attributes_no_except(names_from_device, aid, true, idx_in_back);
+                read_attributes_locked(names_from_device, aid, true, idx_in_back);
             }
             catch(...)
             {
@@ -795,25 +825,31 @@ void Device_3Impl::read_attributes_no_except(const Tango::DevVarStringArray &nam
 
         state_idx = status_idx = -1;
 
+        //
+        // The name resolution (and the attribute classification) is cached for the name lists which have been
+        // received lately
+        //
+
+        std::shared_ptr<const detail::ReadPlan> plan = get_read_plan(names);
+        wanted_attr.reserve(plan->nb_read);
+        wanted_w_attr.reserve(plan->nb_write);
+
         for(i = 0; i < nb_names; i++)
         {
+            const detail::ReadPlan::Item &item = plan->items[i];
             AttIdx x;
             x.idx_in_names = i;
-            std::string att_name(names[i]);
-            std::transform(att_name.begin(), att_name.end(), att_name.begin(), ::tolower);
+            x.idx_in_multi_attr = item.idx_in_multi_attr;
+            x.failed = false;
 
-            if(att_name == "state")
+            if(item.kind == detail::ReadPlan::Kind::State)
             {
-                x.idx_in_multi_attr = -1;
-                x.failed = false;
                 wanted_attr.push_back(x);
                 state_wanted = true;
                 state_idx = i;
             }
-            else if(att_name == "status")
+            else if(item.kind == detail::ReadPlan::Kind::Status)
             {
-                x.idx_in_multi_attr = -1;
-                x.failed = false;
                 wanted_attr.push_back(x);
                 status_wanted = true;
                 status_idx = i;
@@ -822,72 +858,31 @@ void Device_3Impl::read_attributes_no_except(const Tango::DevVarStringArray &nam
             {
                 try
                 {
-                    long j;
+                    //
+                    // For an unknown attribute, redo the search to get the exception reported to the caller
+                    //
 
-                    j = dev_attr->get_attr_ind_by_name(names[i]);
-                    if((dev_attr->get_attr_by_ind(j).get_writable() == Tango::READ_WRITE) ||
-                       (dev_attr->get_attr_by_ind(j).get_writable() == Tango::READ_WITH_WRITE))
+                    if(item.kind == detail::ReadPlan::Kind::Unknown)
+                    {
+                        dev_attr->get_attr_ind_by_name(names[i]);
+                        continue;
+                    }
+
+                    Attribute &att = dev_attr->get_attr_by_ind(x.idx_in_multi_attr);
+                    if(att.is_startup_exception())
+                    {
+                        att.throw_startup_exception("Device_3Impl::read_attributes_no_except()");
+                    }
+                    if(item.write)
                     {
-                        x.idx_in_multi_attr = j;
-                        x.failed = false;
-                        Attribute &att = dev_attr->get_attr_by_ind(x.idx_in_multi_attr);
-                        if(att.is_startup_exception())
-                        {
-                            att.throw_startup_exception("Device_3Impl::read_attributes_no_except()");
-                        }
                         wanted_w_attr.push_back(x);
+                    }
+                    if(item.read)
+                    {
                         wanted_attr.push_back(x);
                         att.get_when().tv_sec = 0;
                         att.save_alarm_quality();
                     }
-                    else
-                    {
-                        if(dev_attr->get_attr_by_ind(j).get_writable() == Tango::WRITE)
-                        {
-                            //
-                            // If the attribute is a forwarded one, force reading it from  the root device. Another
-                            // client could have written its value
-                            //
-
-                            if(dev_attr->get_attr_by_ind(j).is_fwd_att())
-                            {
-                                x.idx_in_multi_attr = j;
-                                x.failed = false;
-                                Attribute &att = dev_attr->get_attr_by_ind(x.idx_in_multi_attr);
-                                if(att.is_startup_exception())
-                                {
-                                    att.throw_startup_exception("Device_3Impl::read_attributes_no_except()");
-                                }
-                                wanted_attr.push_back(x);
-                                att.get_when().tv_sec = 0;
-                                att.save_alarm_quality();
-                            }
-                            else
-                            {
-                                x.idx_in_multi_attr = j;
-                                x.failed = false;
-                                Attribute &att = dev_attr->get_attr_by_ind(x.idx_in_multi_attr);
-                                if(att.is_startup_exception())
-                                {
-                                    att.throw_startup_exception("Device_3Impl::read_attributes_no_except()");
-                                }
-                                wanted_w_attr.push_back(x);
-                            }
-                        }
-                        else
-                        {
-                            x.idx_in_multi_attr = j;
-                            x.failed = false;
-                            Attribute &att = dev_attr->get_attr_by_ind(x.idx_in_multi_attr);
-                            if(att.is_startup_exception())
-                            {
-                                att.throw_startup_exception("Device_3Impl::read_attributes_no_except()");
-                            }
-                            wanted_attr.push_back(x);
-                            att.get_when().tv_sec = 0;
-                            att.save_alarm_quality();
-                        }
-                    }
                 }
                 catch(Tango::DevFailed &e)
                 {
@@ -933,6 +928,8 @@ void Device_3Impl::read_attributes_no_except(const Tango::DevVarStringArray &nam
         // index
         //
 
+        FwdRootReads fwd_root_reads;
+
         if(nb_wanted_attr != 0)
         {
             std::vector<long> tmp_idx;
@@ -955,6 +952,15 @@ void Device_3Impl::read_attributes_no_except(const Tango::DevVarStringArray &nam
             if(!tmp_idx.empty())
             {
                 read_attr_hardware(tmp_idx);
+
+                //
+                // Read the root attributes of the forwarded attributes, one call per root device
+                //
+
+                if(get_with_fwd_att())
+                {
+                    fwd_root_reads.read(this, tmp_idx);
+                }
             }
         }
 
@@ -1608,6 +1614,182 @@ void Device_3Impl::read_attributes_no_except(const Tango::DevVarStringArray &nam
     TANGO_LOG_DEBUG << "Leaving Device_3Impl::read_attributes_no_except" << std::endl;
 }
 
+//+-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        Device_3Impl::read_attributes_locked
+//
+// description :
+//        Call read_attributes_no_except() with the device locked according to the serialization model. With the
+//        attribute read locking model, the device monitor is taken in shared mode and only the locks of the read
+//        attributes are taken. Requests for the State or Status attributes always take the device monitor because
+//        the device state computation may read other attributes.
+//
+// argument:
+//        in :
+//            - names: The names of the attribute to read
+//            - second_try : Flag set to true if this method is called due to a client request with source set to
+//                           CACHE_DEVICE and the reading the value from the cache failed
+//            - idx : Vector used to store indexes in the aid (only for second_try)
+//        out :
+//            - aid : The structure used to return data to caller
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+void Device_3Impl::read_attributes_locked(const Tango::DevVarStringArray &names,
+                                          Tango::AttributeIdlData &aid,
+                                          bool second_try,
+                                          std::vector<long> &idx)
+{
+    bool by_attribute = attr_locks->is_enabled() && Util::instance()->get_serial_model() == BY_DEVICE;
+
+    for(unsigned long i = 0; by_attribute && i < names.length(); i++)
+    {
+        if(TG_strcasecmp(names[i], "state") == 0 || TG_strcasecmp(names[i], "status") == 0)
+        {
+            by_attribute = false;
+        }
+    }
+
+    if(!by_attribute)
+    {
+        AutoTangoMonitor sync(this);
+        read_attributes_no_except(names, aid, second_try, idx);
+        return;
+    }
+
+    SharedMonitorLock sync(only_one);
+
+    //
+    // Unknown attributes are ignored here. They are reported by read_attributes_no_except()
+    //
+
+    std::vector<std::string> lower_names;
+    lower_names.reserve(names.length());
+    for(unsigned long i = 0; i < names.length(); i++)
+    {
+        try
+        {
+            lower_names.push_back(dev_attr->get_attr_by_name(names[i]).get_name_lower());
+        }
+        catch(Tango::DevFailed &)
+        {
+        }
+    }
+
+    detail::AttributeLocks::Guard att_locks;
+    if(!attr_locks->lock(lower_names, std::chrono::milliseconds(only_one.timeout()), att_locks))
+    {
+        std::stringstream ss;
+        ss << "Thread " << omni_thread::self()->id();
+        ss << " is not able to acquire the attribute lock(s) of device " << device_name;
+        TANGO_THROW_EXCEPTION(API_CommandTimedOut, ss.str());
+    }
+
+    read_attributes_no_except(names, aid, second_try, idx);
+}
+
+//+-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        Device_3Impl::get_read_plan
+//
+// description :
+//        Return the read plan for a list of attribute names: For each name, its index in the device attribute list
+//        and if the attribute has to be read and/or is writable. The plan is taken from the device read plan cache
+//        when the same name list has been received lately. Otherwise, it is built and stored in the cache (except if
+//        some attributes are not found)
+//
+// argument:
+//        in :
+//            - names: The names of the attribute to read
+//
+// return :
+//        The read plan
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+std::shared_ptr<const detail::ReadPlan> Device_3Impl::get_read_plan(const Tango::DevVarStringArray &names)
+{
+    std::uint64_t generation = dev_attr->get_attr_list_generation();
+
+    std::shared_ptr<const detail::ReadPlan> cached = read_plans->get(names, generation);
+    if(cached != nullptr)
+    {
+        return cached;
+    }
+
+    auto plan = std::make_shared<detail::ReadPlan>();
+    unsigned long nb_names = names.length();
+    plan->items.reserve(nb_names);
+    bool complete = true;
+
+    for(unsigned long i = 0; i < nb_names; i++)
+    {
+        detail::ReadPlan::Item item{detail::ReadPlan::Kind::Attribute, -1, true, false};
+
+        if(TG_strcasecmp(names[i], "state") == 0)
+        {
+            item.kind = detail::ReadPlan::Kind::State;
+        }
+        else if(TG_strcasecmp(names[i], "status") == 0)
+        {
+            item.kind = detail::ReadPlan::Kind::Status;
+        }
+        else
+        {
+            try
+            {
+                item.idx_in_multi_attr = dev_attr->get_attr_ind_by_name(names[i]);
+            }
+            catch(Tango::DevFailed &)
+            {
+                item.kind = detail::ReadPlan::Kind::Unknown;
+                item.read = false;
+                complete = false;
+            }
+
+            if(item.kind == detail::ReadPlan::Kind::Attribute)
+            {
+                Attribute &att = dev_attr->get_attr_by_ind(item.idx_in_multi_attr);
+                Tango::AttrWriteType w_type = att.get_writable();
+
+                if((w_type == Tango::READ_WRITE) || (w_type == Tango::READ_WITH_WRITE))
+                {
+                    item.write = true;
+                }
+                else if(w_type == Tango::WRITE)
+                {
+                    //
+                    // If the attribute is a forwarded one, force reading it from the root device. Another client
+                    // could have written its value
+                    //
+
+                    item.read = att.is_fwd_att();
+                    item.write = !att.is_fwd_att();
+                }
+            }
+        }
+
+        if(item.read)
+        {
+            plan->nb_read++;
+        }
+        if(item.write)
+        {
+            plan->nb_write++;
+        }
+        plan->items.push_back(item);
+    }
+
+    if(complete)
+    {
+        read_plans->put(names, generation, plan);
+    }
+
+    return plan;
+}
+
 //+-------------------------------------------------------------------------------------------------------------------
 //
 // method :
@@ -1638,10 +1820,7 @@ void Device_3Impl::read_attributes_from_cache(const Tango::DevVarStringArray &na
     //
 
     unsigned long i;
-    std::vector<PollObj *> &poll_list = get_poll_obj_list();
     std::vector<long> non_polled;
-    unsigned long nb_poll = poll_list.size();
-    unsigned long j;
 
 #if defined(TANGO_USE_TELEMETRY)
     // see comment at Device_3Impl::read_attributes_no_except
@@ -1653,14 +1832,7 @@ void Device_3Impl::read_attributes_from_cache(const Tango::DevVarStringArray &na
         try
         {
             dev_attr->get_attr_ind_by_name(names[i]);
-            for(j = 0; j < nb_poll; j++)
-            {
-                if(TG_strcasecmp(poll_list[j]->get_name().c_str(), names[i]) == 0)
-                {
-                    break;
-                }
-            }
-            if(j == nb_poll)
+            if(get_polled_obj(Tango::POLL_ATTR, names[i].in()) == nullptr)
             {
                 non_polled.push_back(i);
             }
@@ -1767,22 +1939,11 @@ void Device_3Impl::read_attributes_from_cache(const Tango::DevVarStringArray &na
             }
         }
 
-        PollObj *polled_attr = nullptr;
-        unsigned long j;
-        for(j = 0; j < poll_list.size(); j++)
-        {
-            if((poll_list[j]->get_type() == Tango::POLL_ATTR) &&
-               (TG_strcasecmp(poll_list[j]->get_name().c_str(), names[i]) == 0))
-            {
-                polled_attr = poll_list[j];
-                break;
-            }
-        }
+        PollObj *polled_attr = get_polled_obj(Tango::POLL_ATTR, names[i].in());
 
         //
         // In some cases where data from polling are required by a DS for devices marked as polled but for which the
-        // polling is not sarted yet, polled_attr could be nullptr at the end of this loop. Return "No data yet" in
-        // this case
+        // polling is not sarted yet, polled_attr could be nullptr. Return "No data yet" in this case
         //
 
         if(polled_attr == nullptr)
@@ -1812,10 +1973,14 @@ void Device_3Impl::read_attributes_from_cache(const Tango::DevVarStringArray &na
         }
 
         //
-        // Check that some data is available in cache
+        // Check that some data is available in cache. The checks and the copy use a snapshot of the last value
+        // inserted in the ring, which does not lock the polled object: the cache reads do not contend with the
+        // polling thread inserting new data
         //
 
-        if(polled_attr->is_ring_empty())
+        std::shared_ptr<const PollObj::LastAttrValue> last_value = polled_attr->get_last_attr_value_snapshot();
+
+        if(last_value == nullptr)
         {
             TangoSys_OMemStream o;
             o << "No data available in cache for attribute " << names[i] << std::ends;
@@ -1844,10 +2009,10 @@ void Device_3Impl::read_attributes_from_cache(const Tango::DevVarStringArray &na
         // Skip this test for object with external polling triggering (upd = 0)
         //
 
-        auto tmp_upd = polled_attr->get_upd();
+        auto tmp_upd = polled_attr->get_upd_i();
         if(tmp_upd != PollClock::duration::zero())
         {
-            auto last = polled_attr->get_last_insert_date();
+            auto last = last_value->when;
             auto now = PollClock::now();
             auto diff_d = now - last;
             if(diff_d > polled_attr->get_authorized_delta())
@@ -1895,8 +2060,6 @@ void Device_3Impl::read_attributes_from_cache(const Tango::DevVarStringArray &na
         {
             long vers = get_dev_idl_version();
             {
-                omni_mutex_lock sync(*polled_attr);
-
                 Tango::AttrQuality qual;
 
                 //
@@ -1905,17 +2068,17 @@ void Device_3Impl::read_attributes_from_cache(const Tango::DevVarStringArray &na
 
                 if(vers >= 5)
                 {
-                    AttributeValue_5 &att_val = polled_attr->get_last_attr_value_5(false);
+                    AttributeValue_5 &att_val = last_value->get_value_5();
                     qual = att_val.quality;
                 }
                 else if(vers == 4)
                 {
-                    AttributeValue_4 &att_val = polled_attr->get_last_attr_value_4(false);
+                    AttributeValue_4 &att_val = last_value->get_value_4();
                     qual = att_val.quality;
                 }
                 else
                 {
-                    AttributeValue_3 &att_val = polled_attr->get_last_attr_value_3(false);
+                    AttributeValue_3 &att_val = last_value->get_value_3();
                     qual = att_val.quality;
                 }
 
@@ -1925,7 +2088,7 @@ void Device_3Impl::read_attributes_from_cache(const Tango::DevVarStringArray &na
 
                 if(qual != Tango::ATTR_INVALID)
                 {
-                    polled_data_into_net_object(aid, i, type, vers, polled_attr, names);
+                    polled_data_into_net_object(aid, i, type, vers, *last_value, names);
                 }
 
                 //
@@ -1934,7 +2097,7 @@ void Device_3Impl::read_attributes_from_cache(const Tango::DevVarStringArray &na
 
                 if(aid.data_5 != nullptr)
                 {
-                    AttributeValue_5 &att_val = polled_attr->get_last_attr_value_5(false);
+                    AttributeValue_5 &att_val = last_value->get_value_5();
                     init_polled_out_data((*aid.data_5)[i], att_val);
                     (*aid.data_5)[i].data_format = att_val.data_format;
                     (*aid.data_5)[i].data_type = att_val.data_type;
@@ -1943,13 +2106,13 @@ void Device_3Impl::read_attributes_from_cache(const Tango::DevVarStringArray &na
                 {
                     if(vers >= 5)
                     {
-                        AttributeValue_5 &att_val = polled_attr->get_last_attr_value_5(false);
+                        AttributeValue_5 &att_val = last_value->get_value_5();
                         init_polled_out_data((*aid.data_4)[i], att_val);
                         (*aid.data_4)[i].data_format = att_val.data_format;
                     }
                     else
                     {
-                        AttributeValue_4 &att_val = polled_attr->get_last_attr_value_4(false);
+                        AttributeValue_4 &att_val = last_value->get_value_4();
                         init_polled_out_data((*aid.data_4)[i], att_val);
                         (*aid.data_4)[i].data_format = att_val.data_format;
                     }
@@ -1958,17 +2121,17 @@ void Device_3Impl::read_attributes_from_cache(const Tango::DevVarStringArray &na
                 {
                     if(vers >= 5)
                     {
-                        AttributeValue_5 &att_val = polled_attr->get_last_attr_value_5(false);
+                        AttributeValue_5 &att_val = last_value->get_value_5();
                         init_polled_out_data((*aid.data_3)[i], att_val);
                     }
                     else if(vers == 4)
                     {
-                        AttributeValue_4 &att_val = polled_attr->get_last_attr_value_4(false);
+                        AttributeValue_4 &att_val = last_value->get_value_4();
                         init_polled_out_data((*aid.data_3)[i], att_val);
                     }
                     else
                     {
-                        AttributeValue_3 &att_val = polled_attr->get_last_attr_value_3(false);
+                        AttributeValue_3 &att_val = last_value->get_value_3();
                         init_polled_out_data((*aid.data_3)[i], att_val);
                     }
                 }
@@ -2591,8 +2754,6 @@ Tango::DevAttrHistoryList_3 *Device_3Impl::read_attribute_history_3(const char *
     blackbox_ptr->insert_op(Op_Read_Attr_history_3);
 
     Tango::DevAttrHistoryList_3 *back = nullptr;
-    std::vector<PollObj *> &poll_list = get_poll_obj_list();
-    long nb_poll = poll_list.size();
 
     //
     // Check that the device supports this attribute. This method returns an exception in case of unsupported
@@ -2608,16 +2769,7 @@ Tango::DevAttrHistoryList_3 *Device_3Impl::read_attribute_history_3(const char *
     // Check that the wanted attribute is polled.
     //
 
-    long j;
-    PollObj *polled_attr = nullptr;
-    for(j = 0; j < nb_poll; j++)
-    {
-        if((poll_list[j]->get_type() == Tango::POLL_ATTR) && (poll_list[j]->get_name() == attr_str))
-        {
-            polled_attr = poll_list[j];
-            break;
-        }
-    }
+    PollObj *polled_attr = get_polled_obj(Tango::POLL_ATTR, attr_str);
     if(polled_attr == nullptr)
     {
         TangoSys_OMemStream o;
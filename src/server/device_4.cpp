@@ -141,8 +141,6 @@ Tango::DevAttrHistory_4 *Device_4Impl::read_attribute_history_4(const char *name
     blackbox_ptr->insert_op(Op_Read_Attr_history_4);
 
     Tango::DevAttrHistory_4 *back = nullptr;
-    std::vector<PollObj *> &poll_list = get_poll_obj_list();
-    long nb_poll = poll_list.size();
 
     //
     // Check that the device supports this attribute. This method returns an
@@ -158,16 +156,7 @@ Tango::DevAttrHistory_4 *Device_4Impl::read_attribute_history_4(const char *name
     // Check that the wanted attribute is polled
     //
 
-    long j;
-    PollObj *polled_attr = nullptr;
-    for(j = 0; j < nb_poll; j++)
-    {
-        if((poll_list[j]->get_type() == Tango::POLL_ATTR) && (poll_list[j]->get_name() == attr_str))
-        {
-            polled_attr = poll_list[j];
-            break;
-        }
-    }
+    PollObj *polled_attr = get_polled_obj(Tango::POLL_ATTR, attr_str);
     if(polled_attr == nullptr)
     {
         TangoSys_OMemStream o;
@@ -292,29 +281,8 @@ Tango::DevCmdHistory_4 *Device_4Impl::command_inout_history_4(const char *comman
     // Check that the command is polled
     //
 
-    PollObj *polled_cmd = nullptr;
-    std::vector<PollObj *> &poll_list = get_poll_obj_list();
-    unsigned long i;
-    for(i = 0; i < poll_list.size(); i++)
-    {
-        if(poll_list[i]->get_name() == cmd_str)
-        {
-            if((state_cmd) || (status_cmd))
-            {
-                if(poll_list[i]->get_type() == Tango::POLL_ATTR)
-                {
-                    polled_cmd = poll_list[i];
-                }
-            }
-            else
-            {
-                if(poll_list[i]->get_type() == Tango::POLL_CMD)
-                {
-                    polled_cmd = poll_list[i];
-                }
-            }
-        }
-    }
+    PollObj *polled_cmd =
+        get_polled_obj(((state_cmd) || (status_cmd)) ? Tango::POLL_ATTR : Tango::POLL_CMD, cmd_str);
 
     if(polled_cmd == nullptr)
     {
@@ -594,8 +562,7 @@ Tango::AttributeValueList_4 *Device_4Impl::read_attributes_4(const Tango::DevVar
     {
         try
         {
-            AutoTangoMonitor sync(this);
-            read_attributes_no_except(real_names, aid, false, idx_in_back);
+            read_attributes_locked(real_names, aid, false, idx_in_back);
         }
         catch(...)
         {
@@ -674,8 +641,7 @@ Tango::AttributeValueList_4 *Device_4Impl::read_attributes_4(const Tango::DevVar
                 }
 
                 {
-                    AutoTangoMonitor sync(this);
-                    read_attributes_no_except(fwd_names, aid, true, idx_in_back);
+                    read_attributes_locked(fwd_names, aid, true, idx_in_back);
                     idx_in_back.clear();
                 }
             }
@@ -742,8 +708,7 @@ Tango::AttributeValueList_4 *Device_4Impl::read_attributes_4(const Tango::DevVar
 
             try
             {
-                AutoTangoMonitor sync(this);
-                read_attributes_no_except(names_from_device, aid, true, idx_in_back);
+                read_attributes_locked(names_from_device, aid, true, idx_in_back);
             }
             catch(...)
             {
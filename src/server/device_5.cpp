@@ -210,8 +210,7 @@ Tango::AttributeValueList_5 *Device_5Impl::read_attributes_5(const Tango::DevVar
     {
         try
         {
-            AutoTangoMonitor sync(this);
-            read_attributes_no_except(real_names, aid, false, idx_in_back);
+            read_attributes_locked(real_names, aid, false, idx_in_back);
         }
         catch(...)
         {
@@ -290,8 +289,7 @@ Tango::AttributeValueList_5 *Device_5Impl::read_attributes_5(const Tango::DevVar
                 }
 
                 {
-                    AutoTangoMonitor sync(this);
-                    read_attributes_no_except(fwd_names, aid, true, idx_in_back);
+                    read_attributes_locked(fwd_names, aid, true, idx_in_back);
                     idx_in_back.clear();
                 }
             }
@@ -358,8 +356,7 @@ Tango::AttributeValueList_5 *Device_5Impl::read_attributes_5(const Tango::DevVar
 
             try
             {
-                AutoTangoMonitor sync(this);
-                read_attributes_no_except(names_from_device, aid, true, idx_in_back);
+                read_attributes_locked(names_from_device, aid, true, idx_in_back);
             }
             catch(...)
             {
@@ -732,8 +729,6 @@ Tango::DevAttrHistory_5 *Device_5Impl::read_attribute_history_5(const char *name
     blackbox_ptr->insert_op(Op_Read_Attr_history_5);
 
     Tango::DevAttrHistory_5 *back = nullptr;
-    std::vector<PollObj *> &poll_list = get_poll_obj_list();
-    long nb_poll = poll_list.size();
 
     //
     // Check that the device supports this attribute. This method returns an
@@ -749,16 +744,7 @@ Tango::DevAttrHistory_5 *Device_5Impl::read_attribute_history_5(const char *name
     // Check that the wanted attribute is polled (Except in case of forwarded attribute)
     //
 
-    long j;
-    PollObj *polled_attr = nullptr;
-    for(j = 0; j < nb_poll; j++)
-    {
-        if((poll_list[j]->get_type() == Tango::POLL_ATTR) && (poll_list[j]->get_name() == attr_str))
-        {
-            polled_attr = poll_list[j];
-            break;
-        }
-    }
+    PollObj *polled_attr = get_polled_obj(Tango::POLL_ATTR, attr_str);
     if((polled_attr == nullptr) && (!att.is_fwd_att()))
     {
         TangoSys_OMemStream o;
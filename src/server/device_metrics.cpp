@@ -0,0 +1,121 @@
+#include <tango/internal/server/device_metrics.h>
+
+#include <cstring>
+
+namespace Tango::detail
+{
+
+namespace
+{
+
+std::size_t hash_operation(const char *operation) noexcept
+{
+    // FNV-1a
+    std::size_t hash = 14695981039346656037ULL;
+    for(; *operation != '\0'; ++operation)
+    {
+        hash ^= static_cast<unsigned char>(*operation);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+// The requests of a device are serialized by its monitor (except with the NO_SYNC serialization model) and its
+// polled objects are polled by one thread
+constexpr std::size_t DEVICE_HISTOGRAM_SHARDS = 1;
+
+thread_local DeviceMetrics *request_metrics = nullptr;
+
+} // namespace
+
+DeviceMetrics::DeviceMetrics(std::string name) :
+    device_name(std::move(name))
+{
+}
+
+DeviceMetrics::~DeviceMetrics()
+{
+    for(auto &slot : operations)
+    {
+        delete slot.load(std::memory_order_acquire);
+    }
+
+    MetricsRegistry::instance().remove("device", device_name);
+}
+
+Histogram &DeviceMetrics::register_request_duration(const char *operation)
+{
+    return MetricsRegistry::instance().histogram(
+        METRIC_REQUEST_DURATION, {{"device", device_name}, {"operation", operation}}, DEVICE_HISTOGRAM_SHARDS);
+}
+
+Histogram &DeviceMetrics::polling_lateness()
+{
+    Histogram *histogram = lateness.load(std::memory_order_acquire);
+    if(histogram == nullptr)
+    {
+        // The registry returns the same histogram to the threads racing to create it
+        histogram = &MetricsRegistry::instance().histogram(
+            METRIC_POLLING_LATENESS, {{"device", device_name}}, DEVICE_HISTOGRAM_SHARDS);
+        lateness.store(histogram, std::memory_order_release);
+    }
+    return *histogram;
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        DeviceMetrics::request_duration()
+//
+// description :
+//        Find the operation in an open addressing hash table, inserting it if it is not there yet. The slots are
+//        filled once with a compare and swap and never emptied, so the lookups do not need any lock. When the table
+//        is full (it is sized for the operations of the IDL interface) the registry is used.
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+Histogram &DeviceMetrics::request_duration(const char *operation)
+{
+    const std::size_t hash = hash_operation(operation);
+
+    for(std::size_t i = 0; i < OPERATION_SLOTS; ++i)
+    {
+        auto &slot = operations[(hash + i) % OPERATION_SLOTS];
+        Operation *entry = slot.load(std::memory_order_acquire);
+
+        if(entry == nullptr)
+        {
+            auto new_entry = std::make_unique<Operation>(Operation{operation, register_request_duration(operation)});
+            if(slot.compare_exchange_strong(entry, new_entry.get(), std::memory_order_acq_rel))
+            {
+                return new_entry.release()->duration;
+            }
+            // Another thread has filled the slot, entry is now its operation
+        }
+
+        if(std::strcmp(entry->name.c_str(), operation) == 0)
+        {
+            return entry->duration;
+        }
+    }
+
+    return register_request_duration(operation);
+}
+
+Counter &DeviceMetrics::request_errors(const char *operation)
+{
+    return MetricsRegistry::instance().counter(METRIC_REQUEST_ERRORS,
+                                               {{"device", device_name}, {"operation", operation}});
+}
+
+void set_request_metrics(DeviceMetrics *metrics) noexcept
+{
+    request_metrics = metrics;
+}
+
+DeviceMetrics *get_request_metrics() noexcept
+{
+    return request_metrics;
+}
+
+} // namespace Tango::detail
@@ -41,6 +41,7 @@
 #include <tango/server/device_3.h>
 #include <tango/server/pipe.h>
 #include <tango/server/dserver.h>
+#include <tango/internal/server/command_index.h>
 
 #include <tango/client/apiexcept.h>
 #include <tango/client/Database.h>
@@ -69,6 +70,7 @@ static void lower_cmd_name(std::string &cmd)
 DeviceClass::DeviceClass(const std::string &s) :
     name(s),
     ext(new DeviceClassExt),
+    cmd_index(new detail::CommandIndex),
     only_one("class " + s)
 
 {
@@ -1150,41 +1152,21 @@ void DeviceClass::export_device(DeviceImpl *dev, const char *corba_obj_name)
 CORBA::Any *DeviceClass::command_handler(DeviceImpl *device, const std::string &command, const CORBA::Any &in_any)
 {
     CORBA::Any *ret = nullptr;
-    std::vector<Command *>::iterator i_cmd;
-
-    std::string command_lower(command);
 
     TANGO_LOG_DEBUG << "Entering DeviceClass::command_handler() method" << std::endl;
 
-    std::transform(command_lower.begin(), command_lower.end(), command_lower.begin(), ::tolower);
-
     //
     // Search for command object first at class level then at device level (case of dynamic command installed at device
-    // level)
+    // level). The lookups are case independent and do not need a lower case copy of the command name
     //
 
-    bool found = false;
-    for(i_cmd = command_list.begin(); i_cmd < command_list.end(); ++i_cmd)
+    Command *cmd = find_command(command);
+    if(cmd == nullptr)
     {
-        if((*i_cmd)->get_lower_name() == command_lower)
-        {
-            found = true;
-            break;
-        }
+        cmd = device->find_local_command(command);
     }
 
-    if(!found)
-    {
-        std::vector<Command *> &dev_command_list = device->get_local_command_list();
-        for(i_cmd = dev_command_list.begin(); i_cmd < dev_command_list.end(); ++i_cmd)
-        {
-            if((*i_cmd)->get_lower_name() == command_lower)
-            {
-                found = true;
-                break;
-            }
-        }
-    }
+    bool found = cmd != nullptr;
 
     if(found)
     {
@@ -1198,7 +1180,7 @@ CORBA::Any *DeviceClass::command_handler(DeviceImpl *device, const std::string &
         // Check if command is allowed
         //
 
-        if(!(*i_cmd)->is_allowed(device, in_any))
+        if(!cmd->is_allowed(device, in_any))
         {
             TangoSys_OMemStream o;
             o << "Command " << command << " not allowed when the device is in "
@@ -1210,7 +1192,7 @@ CORBA::Any *DeviceClass::command_handler(DeviceImpl *device, const std::string &
         // Execute command
         //
 
-        ret = (*i_cmd)->execute(device, in_any);
+        ret = cmd->execute(device, in_any);
     }
 
     if(!found)
@@ -1540,22 +1522,9 @@ void DeviceClass::get_mcast_event(DServer *dserv)
 
 Command &DeviceClass::get_cmd_by_name(const std::string &cmd_name)
 {
-    std::vector<Command *>::iterator pos;
+    Command *cmd = find_command(cmd_name);
 
-    pos = find_if(command_list.begin(),
-                  command_list.end(),
-                  [&](Command *cmd) -> bool
-                  {
-                      if(cmd_name.size() != cmd->get_lower_name().size())
-                      {
-                          return false;
-                      }
-                      std::string tmp_name(cmd_name);
-                      std::transform(tmp_name.begin(), tmp_name.end(), tmp_name.begin(), ::tolower);
-                      return cmd->get_lower_name() == tmp_name;
-                  });
-
-    if(pos == command_list.end())
+    if(cmd == nullptr)
     {
         TANGO_LOG_DEBUG << "DeviceClass::get_cmd_by_name throwing exception" << std::endl;
         TangoSys_OMemStream o;
@@ -1564,7 +1533,29 @@ Command &DeviceClass::get_cmd_by_name(const std::string &cmd_name)
         TANGO_THROW_EXCEPTION(API_CommandNotFound, o.str());
     }
 
-    return *(*pos);
+    return *cmd;
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        DeviceClass::find_command
+//
+// description :
+//        Search a command in the class command list using the class command index
+//
+// arguemt :
+//         in :
+//            - cmd_name : The command name (case independent)
+//
+// return :
+//        A pointer to the Command object or nullptr if the class does not have this command
+//
+//------------------------------------------------------------------------------------------------------------------
+
+Command *DeviceClass::find_command(const std::string &cmd_name)
+{
+    return cmd_index->find(command_list, cmd_name);
 }
 
 //+------------------------------------------------------------------------------------------------------------------
@@ -1660,6 +1651,7 @@ void DeviceClass::remove_command(const std::string &cmd_name)
     }
 
     command_list.erase(pos);
+    cmd_index->invalidate();
 }
 
 //+------------------------------------------------------------------------------------------------------------------
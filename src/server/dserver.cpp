@@ -39,6 +39,7 @@
 #include <tango/server/seqvec.h>
 #include <tango/client/DbDevice.h>
 #include <tango/client/Database.h>
+#include <tango/internal/metrics.h>
 
 #include <new>
 #include <algorithm>
@@ -770,6 +771,33 @@ Tango::DevString DServer::query_event_system()
     return ret;
 }
 
+//+-----------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        DServer::query_metrics()
+//
+// description :
+//        command to query the metrics collected by the Tango kernel
+//
+// returns :
+//        The counters, gauges and histograms of the process in a JSON string
+//
+//------------------------------------------------------------------------------------------------------------------
+
+Tango::DevString DServer::query_metrics()
+{
+    NoSyncModelTangoMonitor mon(this);
+
+    TANGO_LOG_DEBUG << "In query_metrics command" << std::endl;
+
+    std::stringstream out;
+    detail::MetricsRegistry::instance().json_dump(out);
+
+    Tango::DevString ret = string_dup(out.str());
+
+    return ret;
+}
+
 void DServer::enable_event_system_perf_mon(Tango::DevBoolean enabled)
 {
     NoSyncModelTangoMonitor mon(this);
@@ -351,6 +351,43 @@ CORBA::Any *DevQueryEventSystemCmd::execute(DeviceImpl *device, TANGO_UNUSED(con
     return out_any;
 }
 
+//+----------------------------------------------------------------------------
+//
+// method :         DevQueryMetricsCmd::DevQueryMetricsCmd()
+//
+// description :     constructor for the QueryMetrics command of the
+//                    DServer.
+//
+//-----------------------------------------------------------------------------
+
+DevQueryMetricsCmd::DevQueryMetricsCmd(const char *name,
+                                       Tango::CmdArgType argin,
+                                       Tango::CmdArgType argout,
+                                       const char *out_desc) :
+    Command(name, argin, argout)
+{
+    set_out_type_desc(out_desc);
+}
+
+//+----------------------------------------------------------------------------
+//
+// method :         DevQueryMetricsCmd::execute()
+//
+// description :     method to trigger the execution of the "QueryMetrics"
+//                    command
+//
+//-----------------------------------------------------------------------------
+
+CORBA::Any *DevQueryMetricsCmd::execute(DeviceImpl *device, TANGO_UNUSED(const CORBA::Any &in_any))
+{
+    auto *out_any = new CORBA::Any();
+
+    Tango::DevString ret = (static_cast<DServer *>(device))->query_metrics();
+    (*out_any) <<= ret;
+
+    return out_any;
+}
+
 //+----------------------------------------------------------------------------
 //
 // method :         DevEnableEventSystemPerfMonCmd::DevEnableEventSystemPerfMonCmd()
@@ -1347,6 +1384,163 @@ CORBA::Any *EventConfirmSubscriptionCmd::execute(Tango::DeviceImpl *device, cons
     return ret;
 }
 
+const std::string ZmqEventBulkSubscribeCmd::in_desc =
+    "<Tango client IDL version>, Str[0] = dev1 name, Str[1] = att1 name, Str[2] = event name, Str[3] = dev2 name, "
+    "Str[4] = att2 name, Str[5] = event name,...";
+
+const std::string ZmqEventBulkSubscribeCmd::out_desc =
+    "Lg[2i] = Long nb, Lg[2i+1] = String nb returned for event i (0 long and the error message if event i is not "
+    "subscribed)\n"
+    "Followed by the ZmqEventSubscriptionChange command results for all events";
+
+//+----------------------------------------------------------------------------
+//
+// method :         ZmqEventBulkSubscribeCmd::ZmqEventBulkSubscribeCmd()
+//
+// description :     constructor for the ZmqEventBulkSubscribe command
+//
+//-----------------------------------------------------------------------------
+ZmqEventBulkSubscribeCmd::ZmqEventBulkSubscribeCmd() :
+    Command("ZmqEventBulkSubscribe",
+            Tango::DEVVAR_STRINGARRAY,
+            Tango::DEVVAR_LONGSTRINGARRAY,
+            ZmqEventBulkSubscribeCmd::in_desc.c_str(),
+            ZmqEventBulkSubscribeCmd::out_desc.c_str())
+{
+}
+
+//+----------------------------------------------------------------------------
+//
+// method :         ZmqEventBulkSubscribeCmd::is_allowed()
+//
+// description :     method to test whether command is allowed or not in this
+//            state. In this case, the command is always allowed
+//
+// in : - device : The device on which the command must be excuted
+//        - in_any : The command input data
+//
+// returns :    boolean - true == is allowed , false == not allowed
+//
+//-----------------------------------------------------------------------------
+bool ZmqEventBulkSubscribeCmd::is_allowed(TANGO_UNUSED(Tango::DeviceImpl *device),
+                                          TANGO_UNUSED(const CORBA::Any &in_any))
+{
+    return true;
+}
+
+//+----------------------------------------------------------------------------
+//
+// method :         ZmqEventBulkSubscribeCmd::execute()
+//
+// description :     method to trigger the execution of the command.
+//
+// in : - device : The device on which the command must be excuted
+//        - in_any : The command input data
+//
+// returns : The command output data (packed in the Any object)
+//
+//-----------------------------------------------------------------------------
+CORBA::Any *ZmqEventBulkSubscribeCmd::execute(Tango::DeviceImpl *device, const CORBA::Any &in_any)
+{
+    TANGO_LOG_DEBUG << "ZmqEventBulkSubscribeCmd::execute(): arrived" << std::endl;
+
+    //
+    // Extract the input string array
+    //
+
+    const Tango::DevVarStringArray *in_data;
+    extract(in_any, in_data);
+
+    //
+    // Some check on argument
+    //
+
+    if((in_data->length() < 3) || (in_data->length() % 3) == 2)
+    {
+        TangoSys_OMemStream o;
+        o << "Wrong number of input arguments: optional client release then 3 needed per event: device name, "
+             "attribute/pipe name and event name"
+          << std::endl;
+
+        TANGO_THROW_EXCEPTION(API_WrongNumberOfArgs, o.str());
+    }
+
+    //
+    // call DServer method which implements this command
+    //
+
+    Tango::DevVarLongStringArray *ret = (static_cast<DServer *>(device))->zmq_event_bulk_subscribe(in_data);
+
+    //
+    // return to the caller
+    //
+
+    CORBA::Any *out_any = nullptr;
+    try
+    {
+        out_any = new CORBA::Any();
+    }
+    catch(std::bad_alloc &)
+    {
+        TANGO_LOG_DEBUG << "Bad allocation while in ZmqEventBulkSubscribeCmd::execute()" << std::endl;
+        TANGO_THROW_EXCEPTION(API_MemoryAllocation, "Can't allocate memory in server");
+    }
+    (*out_any) <<= ret;
+
+    TANGO_LOG_DEBUG << "Leaving ZmqEventBulkSubscribeCmd::execute()" << std::endl;
+    return (out_any);
+}
+
+const std::string QueryShmTransportCmd::out_desc =
+    "Lg[0] = Ring key high 32 bits, Lg[1] = Ring key low 32 bits, Str[0] = Ring shared memory segment name";
+
+//+----------------------------------------------------------------------------
+//
+// method :         QueryShmTransportCmd::QueryShmTransportCmd()
+//
+// description :     constructor for the QueryShmTransport command
+//
+//-----------------------------------------------------------------------------
+QueryShmTransportCmd::QueryShmTransportCmd() :
+    Command("QueryShmTransport", Tango::DEV_VOID, Tango::DEVVAR_LONGSTRINGARRAY)
+{
+    set_out_type_desc(QueryShmTransportCmd::out_desc.c_str());
+}
+
+//+----------------------------------------------------------------------------
+//
+// method :         QueryShmTransportCmd::execute()
+//
+// description :     method to trigger the execution of the command.
+//
+// in : - device : The device on which the command must be excuted
+//        - in_any : The command input data
+//
+// returns : The command output data (packed in the Any object)
+//
+//-----------------------------------------------------------------------------
+CORBA::Any *QueryShmTransportCmd::execute(Tango::DeviceImpl *device, TANGO_UNUSED(const CORBA::Any &in_any))
+{
+    TANGO_LOG_DEBUG << "QueryShmTransportCmd::execute(): arrived" << std::endl;
+
+    Tango::DevVarLongStringArray *ret = (static_cast<DServer *>(device))->query_shm_transport();
+
+    CORBA::Any *out_any = nullptr;
+    try
+    {
+        out_any = new CORBA::Any();
+    }
+    catch(std::bad_alloc &)
+    {
+        TANGO_LOG_DEBUG << "Bad allocation while in QueryShmTransportCmd::execute()" << std::endl;
+        TANGO_THROW_EXCEPTION(API_MemoryAllocation, "Can't allocate memory in server");
+    }
+    (*out_any) <<= ret;
+
+    TANGO_LOG_DEBUG << "Leaving QueryShmTransportCmd::execute()" << std::endl;
+    return (out_any);
+}
+
 DServerClass *DServerClass::_instance = nullptr;
 
 //+----------------------------------------------------------------------------
@@ -1489,6 +1683,8 @@ void DServerClass::command_factory()
                                            Tango::DEV_BOOLEAN,
                                            Tango::DEV_VOID,
                                            "Enable or disable the collection of performance samples for events"));
+    command_list.push_back(new DevQueryMetricsCmd(
+        "QueryMetrics", Tango::DEV_VOID, Tango::DEV_STRING, "JSON object with the metrics of the Tango kernel"));
 
     //
     // Now, commands related to polling
@@ -1498,6 +1694,12 @@ void DServerClass::command_factory()
         new PolledDeviceCmd("PolledDevice", Tango::DEV_VOID, Tango::DEVVAR_STRINGARRAY, "Polled device name list"));
     command_list.push_back(new DevPollStatusCmd(
         "DevPollStatus", Tango::DEV_STRING, Tango::DEVVAR_STRINGARRAY, "Device name", "Device polling status"));
+    command_list.push_back(new PolledAttrSnapshotCmd("PolledAttrSnapshot",
+                                                     Tango::DEVVAR_STRINGARRAY,
+                                                     Tango::DEV_ENCODED,
+                                                     "Str[0]=Device name. Str[1]=Sequence number (optional)",
+                                                     "Last polled value of the attributes polled since the sequence "
+                                                     "number"));
     std::string msg("Lg[0]=Upd period.");
     msg = msg + (" Str[0]=Device name");
     msg = msg + (". Str[1]=Object type");
@@ -1558,6 +1760,9 @@ void DServerClass::command_factory()
                                         "Str[0] = dev1 name, Str[1] = att1 name, Str[2] = event name, Str[3] = dev2 "
                                         "name, Str[4] = att2 name, Str[5] = event name,..."));
 
+    command_list.push_back(new ZmqEventBulkSubscribeCmd());
+    command_list.push_back(new QueryShmTransportCmd());
+
     command_list.push_back(
         new QueryWizardClassPropertyCmd("QueryWizardClassProperty",
                                         Tango::DEV_STRING,
@@ -573,6 +573,129 @@ Tango::DevVarStringArray *DServer::dev_poll_status(const std::string &dev_name)
     return (ret);
 }
 
+//+----------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        DServer::polled_attr_snapshot()
+//
+// description :
+//        command to read the last polled value of all the polled attributes of a device in one call. When the
+//        sequence number returned by a previous call is given, only the attributes polled since this call are
+//        returned.
+//        The data of the returned DevEncoded are CDR encoded: the byte order flag, the sequence number to be used
+//        for the next call and the AttributeValueList_5 sequence
+//
+// args :
+//        in :
+//            - argin : Str[0] = Device name. Str[1] = Sequence number (optional)
+//
+// return :
+//        The DevEncoded with the attribute values
+//
+//-----------------------------------------------------------------------------------------------------------------
+
+Tango::DevEncoded *DServer::polled_attr_snapshot(const Tango::DevVarStringArray *argin)
+{
+    NoSyncModelTangoMonitor mon(this);
+
+    TANGO_LOG_DEBUG << "In polled_attr_snapshot method" << std::endl;
+
+    if(argin->length() != 1 && argin->length() != 2)
+    {
+        TANGO_THROW_EXCEPTION(API_WrongNumberOfArgs, "Incorrect number of inout arguments");
+    }
+
+    std::string dev_name((*argin)[0]);
+
+    CORBA::ULongLong since = 0;
+    if(argin->length() == 2)
+    {
+        std::stringstream ss;
+        ss << (*argin)[1].in();
+        ss >> since;
+        if(!ss || !ss.eof())
+        {
+            TangoSys_OMemStream o;
+            o << "Sequence number " << (*argin)[1].in() << " is not a valid number" << std::ends;
+            TANGO_THROW_EXCEPTION(API_IncompatibleArgumentType, o.str());
+        }
+    }
+
+    //
+    // Find the device. The values are copied from the polling buffers into AttributeValue_5 structures
+    //
+
+    Tango::Util *tg = Tango::Util::instance();
+    DeviceImpl *dev = tg->get_device_by_name(dev_name);
+
+    if(dev->get_dev_idl_version() < 5)
+    {
+        TangoSys_OMemStream o;
+        o << "Device " << dev_name << " is too old to support polled attribute snapshot" << std::ends;
+        TANGO_THROW_EXCEPTION(API_NotSupported, o.str());
+    }
+
+    Tango::DevEncoded *ret = new Tango::DevEncoded();
+    ret->encoded_format = Tango::string_dup(POLLED_SNAPSHOT_FORMAT);
+
+    TangoMonitor &poll_mon = dev->get_poll_monitor();
+    AutoTangoMonitor sync(&poll_mon);
+
+    //
+    // Get the sequence number before looking at the polling buffers. An attribute polled while the snapshot is
+    // built will be returned again by the next call but its new value cannot be missed
+    //
+
+    CORBA::ULongLong seq = PollObj::get_insert_ctr();
+
+    //
+    // Select the attributes polled since the given sequence number. Forwarded attributes are not read from the
+    // local polling buffers
+    //
+
+    Tango::DevVarStringArray names;
+    for(PollObj *poll_obj : dev->get_poll_obj_list())
+    {
+        omni_mutex_lock sync_obj(*poll_obj);
+
+        if(poll_obj->get_type_i() != Tango::POLL_ATTR || poll_obj->is_fwd_att() ||
+           poll_obj->get_last_insert_nb_i() <= since)
+        {
+            continue;
+        }
+
+        CORBA::ULong nb = names.length();
+        names.length(nb + 1);
+        names[nb] = Tango::string_dup(poll_obj->get_name_i().c_str());
+    }
+
+    Tango::AttributeValueList_5 values;
+    values.length(names.length());
+    for(CORBA::ULong loop = 0; loop < values.length(); loop++)
+    {
+        values[loop].value.union_no_data(true);
+    }
+
+    AttributeIdlData aid;
+    aid.data_5 = &values;
+    static_cast<Device_3Impl *>(dev)->read_attributes_from_cache(names, aid);
+
+    //
+    // Marshall the values while the polling monitor is still taken. The sequences in the AttributeValue_5 structures
+    // are using the polling buffers
+    //
+
+    cdrMemoryStream stream;
+    stream.marshalBoolean(omni::myByteOrder);
+    seq >>= stream;
+    values >>= stream;
+
+    ret->encoded_data.length(stream.bufSize());
+    ::memcpy(ret->encoded_data.get_buffer(), stream.bufPtr(), stream.bufSize());
+
+    return ret;
+}
+
 //+----------------------------------------------------------------------------------------------------------------
 //
 // method :
@@ -706,28 +829,19 @@ void DServer::add_obj_polling(const Tango::DevVarLongStringArray *argin, bool wi
     // Check that the object is not already polled
     //
 
-    std::vector<PollObj *> &poll_list = dev->get_poll_obj_list();
-    for(i = 0; i < poll_list.size(); i++)
+    if(dev->get_polled_obj(type, obj_name) != nullptr)
     {
-        if(poll_list[i]->get_type() == type)
+        TangoSys_OMemStream o;
+        if(type == Tango::POLL_CMD)
         {
-            std::string name_lower = poll_list[i]->get_name();
-            std::transform(name_lower.begin(), name_lower.end(), name_lower.begin(), ::tolower);
-            if(name_lower == obj_name)
-            {
-                TangoSys_OMemStream o;
-                if(type == Tango::POLL_CMD)
-                {
-                    o << "Command ";
-                }
-                else
-                {
-                    o << "Attribute ";
-                }
-                o << obj_name << " already polled" << std::ends;
-                TANGO_THROW_EXCEPTION(API_AlreadyPolled, o.str());
-            }
+            o << "Command ";
         }
+        else
+        {
+            o << "Attribute ";
+        }
+        o << obj_name << " already polled" << std::ends;
+        TANGO_THROW_EXCEPTION(API_AlreadyPolled, o.str());
     }
 
     //
@@ -784,8 +898,9 @@ void DServer::add_obj_polling(const Tango::DevVarLongStringArray *argin, bool wi
         depth = dev->get_attr_poll_ring_depth(obj_name);
     }
 
+    std::vector<PollObj *> &poll_list = dev->get_poll_obj_list();
     dev->get_poll_monitor().get_monitor();
-    poll_list.push_back(new PollObj(dev, type, obj_name, std::chrono::milliseconds(upd), depth));
+    dev->add_poll_obj(new PollObj(dev, type, obj_name, std::chrono::milliseconds(upd), depth));
     dev->get_poll_monitor().rel_monitor();
 
     PollingThreadInfo *th_info;
@@ -859,8 +974,7 @@ void DServer::add_obj_polling(const Tango::DevVarLongStringArray *argin, bool wi
                 if((shared_cmd.cmd_pending) && (interupted == 0))
                 {
                     TANGO_LOG_DEBUG << "TIME OUT" << std::endl;
-                    delete poll_list.back();
-                    poll_list.pop_back();
+                    dev->remove_poll_obj(poll_list.end() - 1);
 
                     //
                     // If the thread has been created by this request, try to kill it
@@ -1530,8 +1644,7 @@ void DServer::rem_obj_polling(const Tango::DevVarStringArray *argin, bool with_d
     std::vector<PollObj *> &poll_list = dev->get_poll_obj_list();
 
     dev->get_poll_monitor().get_monitor();
-    delete(*ite);
-    poll_list.erase(ite);
+    dev->remove_poll_obj(ite);
     dev->get_poll_monitor().rel_monitor();
 
     //
@@ -0,0 +1,61 @@
+//+=============================================================================
+//
+// file :               dservershm.cpp
+//
+// description :        C++ source for the DServer command used by the shm transport. With this transport, the
+//                      clients running on the same host than the device server get the attribute event values
+//                      through a shared memory ring instead of the network.
+//
+//-=============================================================================
+
+#include <tango/server/dserver.h>
+#include <tango/server/eventsupplier.h>
+#include <tango/server/utils.h>
+#include <tango/internal/shm_ring.h>
+
+namespace Tango
+{
+
+namespace
+{
+
+detail::ShmRingWriter *get_shm_ring()
+{
+    ZmqEventSupplier *ev = Util::instance()->get_zmq_event_supplier();
+    if(ev == nullptr || ev->get_shm_ring() == nullptr)
+    {
+        TANGO_THROW_EXCEPTION(API_NotSupported,
+                              "The shm transport is not enabled in this device server (see TANGO_SHM_TRANSPORT)");
+    }
+
+    return ev->get_shm_ring();
+}
+
+} // anonymous namespace
+
+//+----------------------------------------------------------------------------
+//
+// method :         DServer::query_shm_transport()
+//
+// description :     command to get the shared memory ring of the shm transport
+//
+// returns : Lg[0] = Ring key high 32 bits, Lg[1] = Ring key low 32 bits,
+//           Str[0] = Ring shared memory segment name
+//
+//-----------------------------------------------------------------------------
+
+Tango::DevVarLongStringArray *DServer::query_shm_transport()
+{
+    detail::ShmRingWriter *ring = get_shm_ring();
+
+    auto *ret = new Tango::DevVarLongStringArray;
+    ret->lvalue.length(2);
+    ret->lvalue[0] = static_cast<DevLong>(ring->get_key() >> 32);
+    ret->lvalue[1] = static_cast<DevLong>(ring->get_key() & 0xffffffff);
+    ret->svalue.length(1);
+    ret->svalue[0] = Tango::string_dup(ring->get_name().c_str());
+
+    return ret;
+}
+
+} // namespace Tango
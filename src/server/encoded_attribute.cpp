@@ -37,6 +37,12 @@
 #include <tango/client/DeviceAttribute.h>
 #include <tango/server/except.h>
 #include <tango/client/apiexcept.h>
+#include <tango/internal/server/jpeg_encoder.h>
+#include <tango/internal/server/lossless_codec.h>
+
+#include <limits>
+#include <memory>
+#include <vector>
 
 #ifdef TANGO_USE_JPEG
   #include <iostream>
@@ -52,11 +58,112 @@ using namespace Tango;
         x = nullptr; \
     }
 
+class EncodedAttribute::EncodedAttributeExt
+{
+  public:
+    explicit EncodedAttributeExt(int nb_buffers) :
+        buffer_capacity(nb_buffers, 0)
+    {
+    }
+
+    detail::JpegEncoder jpeg_encoder;
+    // Allocated size of each buffer of the pool, buffSize_array holding the size of the encoded data
+    std::vector<std::size_t> buffer_capacity;
+};
+
+namespace
+{
+
+void check_lossless_size(int width, int height)
+{
+    if(width < 0 || height < 0)
+    {
+        TANGO_THROW_EXCEPTION(API_EncodeErr, "Image width and height must not be negative");
+    }
+}
+
+// Compress an image with the lossless codec in buffer, reallocated only if it is too small
+template <typename T>
+void lossless_encode_image(const T *image,
+                           int width,
+                           int height,
+                           int channels,
+                           unsigned char *&buffer,
+                           std::size_t &capacity,
+                           std::size_t &size)
+{
+    std::size_t row_samples = static_cast<std::size_t>(width) * channels;
+    std::size_t max_size = detail::LOSSLESS_HEADER_SIZE + detail::lossless_max_size(row_samples, height, sizeof(T));
+    if(max_size > capacity)
+    {
+        SAFE_FREE(buffer);
+        capacity = 0;
+        size = 0;
+        buffer = (unsigned char *) malloc(max_size);
+        if(buffer == nullptr)
+        {
+            TANGO_THROW_EXCEPTION(API_MemoryAllocation, "Cannot allocate the lossless image buffer");
+        }
+        capacity = max_size;
+    }
+
+    // Store image dimension (big endian)
+    for(int i = 0; i < 4; ++i)
+    {
+        buffer[i] = (unsigned char) ((width >> (24 - 8 * i)) & 0xFF);
+        buffer[4 + i] = (unsigned char) ((height >> (24 - 8 * i)) & 0xFF);
+    }
+
+    size = detail::LOSSLESS_HEADER_SIZE +
+           detail::lossless_encode(image, width, height, channels, buffer + detail::LOSSLESS_HEADER_SIZE);
+}
+
+// Decompress a lossless image, allocated with new[]
+template <typename T>
+T *lossless_decode_image(const unsigned char *data, std::size_t size, int channels, int *width, int *height)
+{
+    if(size < detail::LOSSLESS_HEADER_SIZE)
+    {
+        TANGO_THROW_EXCEPTION(API_DecodeErr, "Lossless image data are truncated");
+    }
+
+    std::size_t dims[2];
+    for(int d = 0; d < 2; ++d)
+    {
+        dims[d] = 0;
+        for(int i = 0; i < 4; ++i)
+        {
+            dims[d] = (dims[d] << 8) | data[4 * d + i];
+        }
+        if(dims[d] > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+        {
+            TANGO_THROW_EXCEPTION(API_DecodeErr, "Invalid lossless image size");
+        }
+    }
+
+    // Check the data size before allocating the image, the header may be corrupted
+    std::size_t row_samples = dims[0] * channels;
+    size -= detail::LOSSLESS_HEADER_SIZE;
+    if(size < detail::lossless_min_size(row_samples, dims[1]))
+    {
+        TANGO_THROW_EXCEPTION(API_DecodeErr, "Lossless image data are truncated");
+    }
+
+    std::unique_ptr<T[]> image(new T[row_samples * dims[1]]);
+    detail::lossless_decode(data + detail::LOSSLESS_HEADER_SIZE, size, dims[0], dims[1], channels, image.get());
+
+    *width = static_cast<int>(dims[0]);
+    *height = static_cast<int>(dims[1]);
+    return image.release();
+}
+
+} // namespace
+
 // ----------------------------------------------------------------------------
 
 EncodedAttribute::EncodedAttribute() :
     manage_exclusion(false),
-    ext(nullptr)
+    ext(std::make_unique<EncodedAttributeExt>(1))
 {
     buffer_array = (unsigned char **) calloc(1, sizeof(unsigned char *));
     buffer_array[0] = nullptr;
@@ -70,7 +177,7 @@ EncodedAttribute::EncodedAttribute() :
 
 EncodedAttribute::EncodedAttribute(int si, bool excl) :
     manage_exclusion(excl),
-    ext(nullptr)
+    ext(std::make_unique<EncodedAttributeExt>(si))
 {
     buffer_array = (unsigned char **) calloc(si, sizeof(unsigned char *));
     buffSize_array = (std::size_t *) calloc(si, sizeof(std::size_t));
@@ -115,10 +222,16 @@ void EncodedAttribute::encode_jpeg_gray8(unsigned char *gray8, int width, int he
         mutex_array[index].lock();
     }
 
-    SAFE_FREE(buffer_array[index]);
     buffSize_array[index] = 0;
     format = (char *) JPEG_GRAY_8;
-    jpeg_encode_gray8(width, height, gray8, quality, &(buffSize_array[index]), &(buffer_array[index]));
+    ext->jpeg_encoder.encode(gray8,
+                             width,
+                             height,
+                             quality,
+                             detail::JpegColorSpace::GRAY,
+                             &(buffer_array[index]),
+                             &(ext->buffer_capacity[index]),
+                             &(buffSize_array[index]));
     INC_INDEX()
 }
 
@@ -131,10 +244,16 @@ void EncodedAttribute::encode_jpeg_rgb32(unsigned char *rgb32, int width, int he
         mutex_array[index].lock();
     }
 
-    SAFE_FREE(buffer_array[index]);
     buffSize_array[index] = 0;
     format = (char *) JPEG_RGB;
-    jpeg_encode_rgb32(width, height, rgb32, quality, &(buffSize_array[index]), &(buffer_array[index]));
+    ext->jpeg_encoder.encode(rgb32,
+                             width,
+                             height,
+                             quality,
+                             detail::JpegColorSpace::RGBA,
+                             &(buffer_array[index]),
+                             &(ext->buffer_capacity[index]),
+                             &(buffSize_array[index]));
     INC_INDEX()
 }
 
@@ -147,10 +266,16 @@ void EncodedAttribute::encode_jpeg_rgb24(unsigned char *rgb24, int width, int he
         mutex_array[index].lock();
     }
 
-    SAFE_FREE(buffer_array[index]);
     buffSize_array[index] = 0;
     format = (char *) JPEG_RGB;
-    jpeg_encode_rgb24(width, height, rgb24, quality, &(buffSize_array[index]), &(buffer_array[index]));
+    ext->jpeg_encoder.encode(rgb24,
+                             width,
+                             height,
+                             quality,
+                             detail::JpegColorSpace::RGB,
+                             &(buffer_array[index]),
+                             &(ext->buffer_capacity[index]),
+                             &(buffSize_array[index]));
     INC_INDEX()
 }
 
@@ -170,6 +295,7 @@ void EncodedAttribute::encode_gray8(const unsigned char *gray8, int width, int h
         SAFE_FREE(buffer_array[index]);
         buffer_array[index] = (unsigned char *) malloc(newSize);
         buffSize_array[index] = newSize;
+        ext->buffer_capacity[index] = newSize;
     }
 
     format = (char *) GRAY_8;
@@ -202,6 +328,7 @@ void EncodedAttribute::encode_gray16(const unsigned short *gray16, int width, in
         SAFE_FREE(buffer_array[index]);
         buffer_array[index] = (unsigned char *) malloc(newSize);
         buffSize_array[index] = newSize;
+        ext->buffer_capacity[index] = newSize;
     }
 
     format = (char *) GRAY_16;
@@ -244,6 +371,7 @@ void EncodedAttribute::encode_rgb24(const unsigned char *rgb24, int width, int h
         SAFE_FREE(buffer_array[index]);
         buffer_array[index] = (unsigned char *) malloc(newSize);
         buffSize_array[index] = newSize;
+        ext->buffer_capacity[index] = newSize;
     }
 
     format = (char *) RGB_24;
@@ -261,6 +389,64 @@ void EncodedAttribute::encode_rgb24(const unsigned char *rgb24, int width, int h
 
 // ----------------------------------------------------------------------------
 
+void EncodedAttribute::encode_lossless_gray8(const unsigned char *gray8, int width, int height)
+{
+    check_lossless_size(width, height);
+
+    if(manage_exclusion)
+    {
+        mutex_array[index].lock();
+    }
+
+    format = (char *) LOSSLESS_GRAY_8;
+    lossless_encode_image(
+        gray8, width, height, 1, buffer_array[index], ext->buffer_capacity[index], buffSize_array[index]);
+    INC_INDEX()
+}
+
+// ----------------------------------------------------------------------------
+
+void EncodedAttribute::encode_lossless_gray16(const unsigned short *gray16, int width, int height)
+{
+    check_lossless_size(width, height);
+
+    if(manage_exclusion)
+    {
+        mutex_array[index].lock();
+    }
+
+    format = (char *) LOSSLESS_GRAY_16;
+    lossless_encode_image(
+        gray16, width, height, 1, buffer_array[index], ext->buffer_capacity[index], buffSize_array[index]);
+    INC_INDEX()
+}
+
+// ----------------------------------------------------------------------------
+
+void EncodedAttribute::encode_lossless_rgb24(const unsigned char *rgb24, int width, int height)
+{
+    check_lossless_size(width, height);
+
+    if(manage_exclusion)
+    {
+        mutex_array[index].lock();
+    }
+
+    format = (char *) LOSSLESS_RGB_24;
+    lossless_encode_image(
+        rgb24, width, height, 3, buffer_array[index], ext->buffer_capacity[index], buffSize_array[index]);
+    INC_INDEX()
+}
+
+// ----------------------------------------------------------------------------
+
+void EncodedAttribute::set_jpeg_encoding_threads(int nb_threads)
+{
+    ext->jpeg_encoder.set_nb_threads(nb_threads);
+}
+
+// ----------------------------------------------------------------------------
+
 void EncodedAttribute::decode_rgb32(DeviceAttribute *attr, int *width, int *height, unsigned char **rgb32)
 {
     if(attr->is_empty())
@@ -280,8 +466,9 @@ void EncodedAttribute::decode_rgb32(DeviceAttribute *attr, int *width, int *heig
 
     bool isRGB = strcmp(local_format.c_str(), RGB_24) == 0;
     bool isJPEG = strcmp(local_format.c_str(), JPEG_RGB) == 0;
+    bool isLossless = strcmp(local_format.c_str(), LOSSLESS_RGB_24) == 0;
 
-    if((!isRGB) && (!isJPEG))
+    if((!isRGB) && (!isJPEG) && (!isLossless))
     {
         TANGO_THROW_EXCEPTION(API_WrongFormat, "Not a color format");
     }
@@ -335,6 +522,31 @@ void EncodedAttribute::decode_rgb32(DeviceAttribute *attr, int *width, int *heig
 
         return;
     }
+
+    if(isLossless)
+    {
+        int iWidth;
+        int iHeight;
+        std::unique_ptr<unsigned char[]> rgb24(
+            lossless_decode_image<unsigned char>(rawBuff, size, 3, &iWidth, &iHeight));
+
+        // Convert to RGB32
+        std::size_t nb_pixels = static_cast<std::size_t>(iWidth) * iHeight;
+        unsigned char *data = new unsigned char[nb_pixels * 4];
+        for(std::size_t i = 0; i < nb_pixels; i++)
+        {
+            data[4 * i] = rgb24[3 * i];
+            data[4 * i + 1] = rgb24[3 * i + 1];
+            data[4 * i + 2] = rgb24[3 * i + 2];
+            data[4 * i + 3] = 0;
+        }
+
+        *rgb32 = data;
+        *width = iWidth;
+        *height = iHeight;
+
+        return;
+    }
 }
 
 // ----------------------------------------------------------------------------
@@ -358,8 +570,9 @@ void EncodedAttribute::decode_gray8(DeviceAttribute *attr, int *width, int *heig
 
     bool isGrey = strcmp(local_format.c_str(), GRAY_8) == 0;
     bool isJPEG = strcmp(local_format.c_str(), JPEG_GRAY_8) == 0;
+    bool isLossless = strcmp(local_format.c_str(), LOSSLESS_GRAY_8) == 0;
 
-    if((!isGrey) && (!isJPEG))
+    if((!isGrey) && (!isJPEG) && (!isLossless))
     {
         TANGO_THROW_EXCEPTION(API_WrongFormat, "Not a grayscale 8bit format");
     }
@@ -400,6 +613,13 @@ void EncodedAttribute::decode_gray8(DeviceAttribute *attr, int *width, int *heig
 
         return;
     }
+
+    if(isLossless)
+    {
+        *gray8 = lossless_decode_image<unsigned char>(rawBuff, size, 1, width, height);
+
+        return;
+    }
 }
 
 // ----------------------------------------------------------------------------
@@ -422,8 +642,9 @@ void EncodedAttribute::decode_gray16(DeviceAttribute *attr, int *width, int *hei
     std::string local_format(encDataSeq.in()[0].encoded_format);
 
     bool isGrey = strcmp(local_format.c_str(), GRAY_16) == 0;
+    bool isLossless = strcmp(local_format.c_str(), LOSSLESS_GRAY_16) == 0;
 
-    if(!isGrey)
+    if((!isGrey) && (!isLossless))
     {
         TANGO_THROW_EXCEPTION(API_WrongFormat, "Not a grayscale 16 bits format");
     }
@@ -434,6 +655,13 @@ void EncodedAttribute::decode_gray16(DeviceAttribute *attr, int *width, int *hei
     DevVarCharArray &encBuff = encData[0].encoded_data;
     rawBuff = encBuff.get_buffer(false);
 
+    if(isLossless)
+    {
+        *gray16 = lossless_decode_image<unsigned short>(rawBuff, encBuff.length(), 1, width, height);
+
+        return;
+    }
+
     if(isGrey)
     {
         // Get width and height
@@ -492,23 +720,16 @@ constexpr bool is_feature_supported<EncodedAttribute::Feature::JPEG_WITH_ALPHA>(
 #endif
 }
 
-#ifdef TANGO_USE_JPEG
-enum class color_space
+template <>
+constexpr bool is_feature_supported<EncodedAttribute::Feature::LOSSLESS>()
 {
-    RGB,
-    RGBA,
-    GRAY
-};
+    return true;
+}
 
+#ifdef TANGO_USE_JPEG
 template <typename JpegCompressDecompressStruct>
 [[noreturn]] void jpeg_throw_exception(const std::string &);
 
-template <>
-[[noreturn]] void jpeg_throw_exception<jpeg_compress_struct>(const std::string &msg)
-{
-    TANGO_THROW_EXCEPTION(API_EncodeErr, msg);
-}
-
 template <>
 [[noreturn]] void jpeg_throw_exception<jpeg_decompress_struct>(const std::string &msg)
 {
@@ -518,12 +739,6 @@ template <>
 template <typename JpegCompressDecompressStruct>
 void jpeg_destroy(JpegCompressDecompressStruct *cinfo_ptr);
 
-template <>
-void jpeg_destroy(jpeg_compress_struct *cinfo_ptr)
-{
-    jpeg_destroy_compress(cinfo_ptr);
-}
-
 template <>
 void jpeg_destroy(jpeg_decompress_struct *cinfo_ptr)
 {
@@ -544,76 +759,6 @@ template <typename JpegCompressDecompressStruct>
     jpeg_throw_exception<JpegCompressDecompressStruct>(err_msg);
 }
 
-// ----------------------------------------------------------------
-void jpeg_encode_rgb(int width,
-                     int height,
-                     unsigned char *rgb,
-                     double quality,
-                     std::size_t *jpegSize,
-                     unsigned char **jpegData,
-                     color_space type)
-{
-    jpeg_compress_struct cinfo{};
-    jpeg_error_mgr jerr{};
-    /* We set up the normal JPEG error routines, then override error_exit. */
-    cinfo.err = jpeg_std_error(&jerr);
-    jerr.error_exit = &handle_jpeg_error<jpeg_compress_struct>;
-
-    jpeg_create_compress(&cinfo);
-
-    unsigned long size;
-    jpeg_mem_dest(&cinfo, jpegData, &size);
-
-    cinfo.image_width = width; /* image width and height, in pixels */
-    cinfo.image_height = height;
-    switch(type)
-    {
-    case color_space::RGB:
-    {
-        cinfo.input_components = 3;
-        cinfo.in_color_space = JCS_RGB;
-        break;
-    }
-    case color_space::RGBA:
-    {
-  #ifdef JCS_EXTENSIONS
-        cinfo.input_components = 4;
-        cinfo.in_color_space = JCS_EXT_RGBA;
-  #else
-        TANGO_THROW_DETAILED_EXCEPTION(
-            ApiNonSuppExcept, API_UnsupportedFeature, "JPEG implementation does not support alpha channel");
-  #endif
-        break;
-    }
-    case color_space::GRAY:
-    {
-        cinfo.input_components = 1;
-        cinfo.in_color_space = JCS_GRAYSCALE;
-        break;
-    }
-    }
-
-    jpeg_set_defaults(&cinfo);
-
-    jpeg_set_quality(&cinfo, quality, TRUE);
-
-    jpeg_start_compress(&cinfo, TRUE);
-
-    unsigned char *row_ptr[1];
-    while(cinfo.next_scanline < cinfo.image_height)
-    {
-        row_ptr[0] = &rgb[cinfo.next_scanline * width * cinfo.input_components];
-        jpeg_write_scanlines(&cinfo, row_ptr, 1);
-    }
-
-    jpeg_finish_compress(&cinfo);
-    jpeg_destroy_compress(&cinfo);
-
-    // Set it up after the call to jpeg_finish_compress
-    // cause this is where it is actually set.
-    // Depending on the implementation, if done before it will return 4096 all the time
-    *jpegSize = size;
-}
 #endif // TANGO_USE_JPEG
 } // namespace
 
@@ -629,6 +774,9 @@ bool EncodedAttribute::is_feature_supported(const Feature &feat) const noexcept
     case Feature::JPEG_WITH_ALPHA:
         return ::is_feature_supported<Feature::JPEG_WITH_ALPHA>();
         break;
+    case Feature::LOSSLESS:
+        return ::is_feature_supported<Feature::LOSSLESS>();
+        break;
     default:
         return false;
         break;
@@ -636,28 +784,6 @@ bool EncodedAttribute::is_feature_supported(const Feature &feat) const noexcept
 }
 
 #ifdef TANGO_USE_JPEG
-void EncodedAttribute::jpeg_encode_rgb32(
-    int width, int height, unsigned char *rgb32, double quality, std::size_t *jpegSize, unsigned char **jpegData)
-{
-    jpeg_encode_rgb(width, height, rgb32, quality, jpegSize, jpegData, color_space::RGBA);
-}
-
-void EncodedAttribute::jpeg_encode_rgb24(
-    int width, int height, unsigned char *rgb24, double quality, std::size_t *jpegSize, unsigned char **jpegData)
-{
-    jpeg_encode_rgb(width, height, rgb24, quality, jpegSize, jpegData, color_space::RGB);
-}
-
-// --------------------------------------------------------------------------
-
-void EncodedAttribute::jpeg_encode_gray8(
-    int width, int height, unsigned char *gray8, double quality, std::size_t *jpegSize, unsigned char **jpegData)
-{
-    jpeg_encode_rgb(width, height, gray8, quality, jpegSize, jpegData, color_space::GRAY);
-}
-
-// --------------------------------------------------------------------------
-
 void EncodedAttribute::jpeg_decode(
     std::size_t jpegSize, unsigned char *jpegData, int *width, int *height, unsigned char *&frame)
 {
@@ -703,21 +829,6 @@ void EncodedAttribute::jpeg_decode(
     jpeg_destroy_decompress(&cinfo);
 }
 #else
-void EncodedAttribute::jpeg_encode_rgb32(int, int, unsigned char *, double, std::size_t *, unsigned char **)
-{
-    TANGO_THROW_DETAILED_EXCEPTION(ApiNonSuppExcept, API_UnsupportedFeature, "Tango was built without jpeg support");
-}
-
-void EncodedAttribute::jpeg_encode_rgb24(int, int, unsigned char *, double, std::size_t *, unsigned char **)
-{
-    TANGO_THROW_DETAILED_EXCEPTION(ApiNonSuppExcept, API_UnsupportedFeature, "Tango was built without jpeg support");
-}
-
-void EncodedAttribute::jpeg_encode_gray8(int, int, unsigned char *, double, std::size_t *, unsigned char **)
-{
-    TANGO_THROW_DETAILED_EXCEPTION(ApiNonSuppExcept, API_UnsupportedFeature, "Tango was built without jpeg support");
-}
-
 void EncodedAttribute::jpeg_decode(std::size_t, unsigned char *, int *, int *, unsigned char *&)
 {
     TANGO_THROW_DETAILED_EXCEPTION(ApiNonSuppExcept, API_UnsupportedFeature, "Tango was built without jpeg support");
@@ -33,6 +33,7 @@
 #include <tango/server/utils.h>
 #include <tango/server/pipe.h>
 #include <tango/server/fwdattribute.h>
+#include <tango/internal/event_delta.h>
 #include <tango/internal/utils.h>
 
 namespace Tango
@@ -714,6 +715,29 @@ DevVarLongStringArray *DServer::zmq_event_subscription_change(const Tango::DevVa
         action = (*argin)[2];
         event = (*argin)[3];
 
+        //
+        // A client asks for the delta encoded change event either with the client release suffix (first
+        // subscription) or with the event name (re-subscription by the keep alive thread)
+        //
+
+        bool delta = false;
+        if(detail::is_delta_event_name(event))
+        {
+            delta = true;
+            event = detail::remove_delta_prefix(event);
+        }
+
+        //
+        // Same for the events sent through the shm transport
+        //
+
+        bool shm = false;
+        if(detail::is_shm_event_name(event))
+        {
+            shm = true;
+            event = detail::remove_shm_prefix(event);
+        }
+
         //
         // Check event type validity
         //
@@ -763,8 +787,23 @@ DevVarLongStringArray *DServer::zmq_event_subscription_change(const Tango::DevVa
 
         if(argin->length() == 5)
         {
+            std::string release((*argin)[4]);
+            std::string::size_type pos = release.find(EVENT_SHM_OPTION);
+            if(pos != std::string::npos)
+            {
+                shm = true;
+                release.erase(pos, strlen(EVENT_SHM_OPTION));
+            }
+
+            pos = release.find(EVENT_DELTA_OPTION);
+            if(pos != std::string::npos)
+            {
+                delta = true;
+                release.erase(pos);
+            }
+
             std::stringstream ss;
-            ss << (*argin)[4];
+            ss << release;
             ss >> client_release;
 
             if(client_release == 0)
@@ -955,12 +994,28 @@ DevVarLongStringArray *DServer::zmq_event_subscription_change(const Tango::DevVa
         // For forwarded attribute, eventually subscribe to events coming from root attribute
         //
 
+        delta = delta && !intr_change && !pipe_event;
+
         if(!intr_change && !pipe_event)
         {
             Attribute &attribute = dev->get_device_attr()->get_attr_by_name(obj_name.c_str());
             EventType et;
             tg->event_name_2_event_type(event, et);
 
+            //
+            // The delta encoded change event is only granted to IDL 5 clients of non forwarded attributes using the
+            // usual zmq transport. Other clients get the change event.
+            //
+
+            delta = delta && action == "subscribe" && et == CHANGE_EVENT && client_release >= 5 &&
+                    !attribute.is_fwd_att() && multicast_params.endpoint.empty();
+            if(delta)
+            {
+                attribute.get_change_delta_encoder().subscribe(true);
+                ev->init_event_cptr(
+                    ev->create_full_event_name(dev, detail::add_delta_prefix(event), obj_name_lower, intr_change));
+            }
+
             if(attribute.is_fwd_att() && et != ATTR_CONF_EVENT)
             {
                 FwdAttribute &fwd_att = static_cast<FwdAttribute &>(attribute);
@@ -987,7 +1042,7 @@ DevVarLongStringArray *DServer::zmq_event_subscription_change(const Tango::DevVa
         //
 
         ret_data = new Tango::DevVarLongStringArray();
-        ret_data->lvalue.length(6);
+        ret_data->lvalue.length(7);
         ret_data->svalue.length(2);
 
         ret_data->lvalue[0] = (Tango::DevLong) tg->get_tango_lib_release();
@@ -996,6 +1051,7 @@ DevVarLongStringArray *DServer::zmq_event_subscription_change(const Tango::DevVa
         ret_data->lvalue[3] = multicast_params.rate;
         ret_data->lvalue[4] = multicast_params.recovery_ivl;
         ret_data->lvalue[5] = ev->get_zmq_release();
+        ret_data->lvalue[6] = ev->is_local_ipc_bound() ? (Tango::DevLong) tg->get_pid() : 0;
 
         std::string &heartbeat_endpoint = ev->get_heartbeat_endpoint();
         ret_data->svalue[0] = Tango::string_dup(heartbeat_endpoint.c_str());
@@ -1045,8 +1101,13 @@ DevVarLongStringArray *DServer::zmq_event_subscription_change(const Tango::DevVa
         {
             add_compat_info = true;
         }
-        if(client_release >= 5 &&
-           add_compat_info) // client_release here is the minimum of the client release and dev IDL version
+        if(delta)
+        {
+            event_topic = ev->create_full_event_name(
+                dev, detail::add_delta_prefix(detail::add_idl_prefix(event)), obj_name_lower, intr_change);
+        }
+        else if(client_release >= 5 &&
+                add_compat_info) // client_release here is the minimum of the client release and dev IDL version
         {
             event_topic = ev->create_full_event_name(dev, detail::add_idl_prefix(event), obj_name_lower, intr_change);
         }
@@ -1054,6 +1115,22 @@ DevVarLongStringArray *DServer::zmq_event_subscription_change(const Tango::DevVa
         {
             event_topic = ev->create_full_event_name(dev, event, obj_name_lower, intr_change);
         }
+
+        //
+        // The shm transport is only granted to IDL 5 clients of attribute events which do not use multicast. The
+        // client then gets the event name with the shm prefix, other clients still get the event on the usual name.
+        // It is also granted without the ring of the shm transport, the event data being then sent in the event
+        // message: this is for the clients which subscribe again after a restart of the device server (the clients
+        // only ask for it the first time if they can map the ring)
+        //
+
+        shm = shm && action == "subscribe" && !delta && !intr_change && !pipe_event && client_release >= 5 &&
+              multicast_params.endpoint.empty();
+        if(shm)
+        {
+            ev->set_shm_subscription(event_topic);
+            event_topic = detail::add_shm_prefix(event_topic);
+        }
         TANGO_ASSERT(!(event_topic.empty()));
         TANGO_LOG_DEBUG << "Sending event_topic = " << event_topic << std::endl;
         ret_data->svalue[size] = Tango::string_dup(event_topic.c_str());
@@ -1153,9 +1230,145 @@ void DServer::event_confirm_subscription(const Tango::DevVarStringArray *argin)
             }
         }
 
+        bool delta = false;
+        if(detail::is_delta_event_name(event))
+        {
+            delta = true;
+            event = detail::remove_delta_prefix(event);
+        }
+
+        bool shm = false;
+        if(detail::is_shm_event_name(event))
+        {
+            shm = true;
+            event = detail::remove_shm_prefix(event);
+        }
+
         event_subscription(*dev, obj_name, action, event, ZMQ, client_lib);
         store_subscribed_client_info(*dev, obj_name, event, client_lib);
+
+        //
+        // Keep on sending the event through the shm transport
+        //
+
+        ZmqEventSupplier *ev = tg->get_zmq_event_supplier();
+        if(shm && ev != nullptr)
+        {
+            std::string obj_name_lower = detail::to_lower(obj_name);
+            bool intr_change = event == EventName[INTERFACE_CHANGE_EVENT];
+            bool add_compat_info = event != EventName[DATA_READY_EVENT] && event != EventName[ALARM_EVENT];
+            std::string ev_name = client_lib >= 5 && add_compat_info ? detail::add_idl_prefix(event) : event;
+            ev->set_shm_subscription(ev->create_full_event_name(dev, ev_name, obj_name_lower, intr_change));
+        }
+
+        if(delta && client_lib >= 5 && event == EventName[CHANGE_EVENT])
+        {
+            Attribute &attribute = dev->get_device_attr()->get_attr_by_name(obj_name.c_str());
+            attribute.get_change_delta_encoder().subscribe(false);
+        }
+    }
+}
+
+//+-----------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        DServer::zmq_event_bulk_subscribe()
+//
+// description :
+//        method to execute the command ZmqEventBulkSubscribe command. Subscribe to a list of events in one call.
+//        Used by clients subscribing to many events at once or re-subscribing all their events after a device server
+//        restart. Each event is subscribed as with the ZmqEventSubscriptionChange command. An error for one event
+//        does not prevent the other events to be subscribed.
+//
+// args :
+//         in :
+//            - argin : The command input argument. An optional client release followed by (device name,
+//                      attribute/pipe name, event name) for each event
+//
+// returns :
+//        For each event, the number of long and string returned by the ZmqEventSubscriptionChange command in the
+//        first 2 * nb_event elements of the long array. Then, the concatenation of the data returned by
+//        ZmqEventSubscriptionChange for each event. For an event which cannot be subscribed, there is no long data
+//        and one string which is the error message.
+//
+//------------------------------------------------------------------------------------------------------------------
+DevVarLongStringArray *DServer::zmq_event_bulk_subscribe(const Tango::DevVarStringArray *argin)
+{
+    unsigned int first = argin->length() % 3;
+    unsigned int nb_event = argin->length() / 3;
+
+    Tango::DevVarStringArray sub_args;
+    sub_args.length(5);
+    sub_args[2] = Tango::string_dup("subscribe");
+    if(first == 1)
+    {
+        sub_args[4] = Tango::string_dup((*argin)[0]);
+    }
+    else
+    {
+        sub_args[4] = Tango::string_dup("0");
     }
+
+    std::vector<Tango::DevLong> lg_data;
+    std::vector<std::string> str_data;
+    lg_data.resize(nb_event << 1);
+
+    for(unsigned int loop = 0; loop < nb_event; loop++)
+    {
+        int base = first + (loop * 3);
+        sub_args[0] = Tango::string_dup((*argin)[base]);
+        sub_args[1] = Tango::string_dup((*argin)[base + 1]);
+        sub_args[3] = Tango::string_dup((*argin)[base + 2]);
+
+        TANGO_LOG_DEBUG << "ZmqEventBulkSubscribeCmd: subscription for device " << sub_args[0].in()
+                        << " attribute/pipe " << sub_args[1].in() << " event " << sub_args[3].in() << std::endl;
+
+        try
+        {
+            std::unique_ptr<Tango::DevVarLongStringArray> res(zmq_event_subscription_change(&sub_args));
+
+            lg_data[loop << 1] = res->lvalue.length();
+            lg_data[(loop << 1) + 1] = res->svalue.length();
+            for(unsigned int i = 0; i < res->lvalue.length(); i++)
+            {
+                lg_data.push_back(res->lvalue[i]);
+            }
+            for(unsigned int i = 0; i < res->svalue.length(); i++)
+            {
+                str_data.emplace_back(res->svalue[i].in());
+            }
+        }
+        catch(Tango::DevFailed &e)
+        {
+            //
+            // A server shutting down will not accept any other subscription
+            //
+
+            std::string reason(e.errors[0].reason.in());
+            if(reason == API_ShutdownInProgress)
+            {
+                throw;
+            }
+
+            lg_data[loop << 1] = 0;
+            lg_data[(loop << 1) + 1] = 1;
+            str_data.emplace_back(e.errors[0].desc.in());
+        }
+    }
+
+    Tango::DevVarLongStringArray *ret_data = new Tango::DevVarLongStringArray();
+    ret_data->lvalue.length(lg_data.size());
+    for(size_t loop = 0; loop < lg_data.size(); loop++)
+    {
+        ret_data->lvalue[loop] = lg_data[loop];
+    }
+    ret_data->svalue.length(str_data.size());
+    for(size_t loop = 0; loop < str_data.size(); loop++)
+    {
+        ret_data->svalue[loop] = Tango::string_dup(str_data[loop].c_str());
+    }
+
+    return ret_data;
 }
 
 } // namespace Tango
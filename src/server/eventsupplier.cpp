@@ -147,6 +147,16 @@ SendEventType EventSupplier::detect_and_push_events(DeviceImpl *device_impl,
 
     Attribute &attr = device_impl->dev_attr->get_attr_by_name(attr_name.c_str());
 
+    //
+    // An IDL 5 value is marshalled only once for all the events pushed for it (see push_event()). The stream is kept
+    // by the thread to reuse its buffer from one poll cycle to the next
+    //
+
+    thread_local MarshalledValue marshalled;
+    marshalled.source = attr_value.attr_val_5;
+    marshalled.done = false;
+    attr_value.marshalled = attr_value.attr_val_5 != nullptr ? &marshalled : nullptr;
+
     now = Tango::get_current_system_datetime();
 
     {
@@ -351,6 +361,8 @@ SendEventType EventSupplier::detect_and_push_events(DeviceImpl *device_impl,
         }
     }
 
+    attr_value.marshalled = nullptr;
+
     return ret;
 }
 
@@ -561,6 +573,8 @@ bool EventSupplier::detect_and_push_change_event(DeviceImpl *device_impl,
             }
         }
 
+        push_change_delta_event(device_impl, attr_value, attr, except);
+
         ret = true;
     }
 
@@ -2675,6 +2689,7 @@ void EventSupplier::convert_att_event_to_5(const struct EventSupplier::SuppliedE
     else
     {
         sent_value.attr_val_5 = attr_value.attr_val_5;
+        sent_value.marshalled = attr_value.marshalled;
     }
 }
 
@@ -38,6 +38,10 @@
 #include <tango/server/fwdattribute_templ.h>
 #include <tango/client/Database.h>
 
+#include <tango/internal/worker_pool.h>
+
+#include <algorithm>
+
 namespace
 {
 //--------------------------------------------------------------------------------------------------------------------
@@ -420,8 +424,21 @@ void FwdAttr::read(DeviceImpl *dev, Attribute &attr)
 
     try
     {
-        root_att_dev->set_source(dev->get_call_source());
-        DeviceAttribute da = root_att_dev->read_attribute(fwd_attr.get_fwd_att_name());
+        DeviceAttribute da;
+        if(!FwdRootReads::get_root_value(attr, da))
+        {
+            root_att_dev->set_source(dev->get_call_source());
+
+            std::chrono::milliseconds max_age = Util::instance()->get_fwd_att_max_age();
+            if(max_age.count() != 0)
+            {
+                da = root_att_dev->read_attribute_cached(fwd_attr.get_fwd_att_name(), max_age);
+            }
+            else
+            {
+                da = root_att_dev->read_attribute(fwd_attr.get_fwd_att_name());
+            }
+        }
 
         //
         // Set the local attribute from the result of the previous read
@@ -831,4 +848,216 @@ void FwdAttr::remove_useless_prop(std::vector<AttrProperty> &prop_list,
     }
 }
 
+//--------------------------------------------------------------------------------------------------------------------
+//
+// FwdRootReads class
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+namespace
+{
+//
+// The root attribute reads of the request being executed by this thread
+//
+
+thread_local FwdRootReads *current_root_reads = nullptr;
+
+//
+// Forwarded attributes of one root device
+//
+
+struct RootDevRead
+{
+    DeviceProxy *root_dev{nullptr};
+    std::vector<std::string> names;
+    std::vector<const Attribute *> atts;
+    std::unique_ptr<std::vector<DeviceAttribute>> values;
+    DevErrorList errors;
+};
+} // namespace
+
+struct FwdRootReads::RootValue
+{
+    DeviceAttribute value;
+    DevErrorList errors; // Not empty if reading the root device failed
+};
+
+FwdRootReads::FwdRootReads() = default;
+
+FwdRootReads::~FwdRootReads()
+{
+    if(current_root_reads == this)
+    {
+        current_root_reads = nullptr;
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        FwdRootReads::read
+//
+// description :
+//        Read the root attributes of the forwarded attributes in the list of attributes to be read. One
+//        read_attributes() call is done per root device and the root devices are read in parallel with the worker
+//        pool (up to FWD_ATT_READ_MAX_THREADS threads). Nothing is done if there is less than two forwarded
+//        attributes to read: FwdAttr::read() reads it.
+//
+// argument :
+//        in :
+//            - dev : The device
+//            - att_idx : Index of the attributes to be read
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+void FwdRootReads::read(DeviceImpl *dev, const std::vector<long> &att_idx)
+{
+    values.clear();
+
+    //
+    // Group forwarded attributes per root device
+    //
+
+    std::map<std::string, RootDevRead> root_devs;
+    size_t nb_fwd = 0;
+
+    for(auto idx : att_idx)
+    {
+        Attribute &att = dev->get_device_attr()->get_attr_by_ind(idx);
+        if(!att.is_fwd_att() || att.get_data_type() == DATA_TYPE_UNKNOWN)
+        {
+            continue;
+        }
+
+        auto &fwd_att = static_cast<FwdAttribute &>(att);
+        RootDevRead &rdr = root_devs[fwd_att.get_fwd_dev_name()];
+        rdr.names.push_back(fwd_att.get_fwd_att_name());
+        rdr.atts.push_back(&att);
+        nb_fwd++;
+    }
+
+    if(nb_fwd < 2)
+    {
+        return;
+    }
+
+    //
+    // Get the root device proxies. If a root device is not available, its attributes are left to FwdAttr::read()
+    // which reports the error
+    //
+
+    RootAttRegistry &rar = Util::instance()->get_root_att_reg();
+    Tango::DevSource source = dev->get_call_source();
+    std::vector<RootDevRead *> to_read;
+
+    for(auto &elem : root_devs)
+    {
+        try
+        {
+            elem.second.root_dev = rar.get_root_att_dp(elem.first);
+            elem.second.root_dev->set_source(source);
+            to_read.push_back(&elem.second);
+        }
+        catch(Tango::DevFailed &)
+        {
+        }
+    }
+
+    //
+    // Read the root devices
+    //
+
+    std::chrono::milliseconds max_age = Util::instance()->get_fwd_att_max_age();
+    auto read_root_dev = [max_age](RootDevRead &rdr)
+    {
+        try
+        {
+            if(max_age.count() != 0)
+            {
+                rdr.values.reset(rdr.root_dev->read_attributes_cached(rdr.names, max_age));
+            }
+            else
+            {
+                rdr.values.reset(rdr.root_dev->read_attributes(rdr.names));
+            }
+        }
+        catch(Tango::DevFailed &e)
+        {
+            rdr.errors = e.errors;
+        }
+    };
+
+    detail::for_each_in_parallel(to_read.size(),
+                                 FWD_ATT_READ_MAX_THREADS,
+                                 [&to_read, &read_root_dev](size_t idx) { read_root_dev(*to_read[idx]); });
+
+    //
+    // Store the results for FwdAttr::read()
+    //
+
+    for(auto *rdr : to_read)
+    {
+        for(size_t loop = 0; loop < rdr->atts.size(); ++loop)
+        {
+            auto root_value = std::make_unique<RootValue>();
+            if(rdr->values != nullptr)
+            {
+                root_value->value = std::move((*rdr->values)[loop]);
+            }
+            else
+            {
+                root_value->errors = rdr->errors;
+            }
+            values[rdr->atts[loop]] = std::move(root_value);
+        }
+    }
+
+    current_root_reads = this;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        FwdRootReads::get_root_value
+//
+// description :
+//        Get the root attribute value of a forwarded attribute if it has been read by the FwdRootReads instance
+//        of the calling thread. The value can be got only once.
+//
+// argument :
+//        in :
+//            - att : The forwarded attribute
+//        out :
+//            - da : The root attribute value
+//
+// return :
+//        True if the root attribute value has been read. Throw an exception if the root device read failed
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+bool FwdRootReads::get_root_value(const Attribute &att, DeviceAttribute &da)
+{
+    if(current_root_reads == nullptr)
+    {
+        return false;
+    }
+
+    auto ite = current_root_reads->values.find(&att);
+    if(ite == current_root_reads->values.end())
+    {
+        return false;
+    }
+
+    std::unique_ptr<RootValue> root_value = std::move(ite->second);
+    current_root_reads->values.erase(ite);
+
+    if(root_value->errors.length() != 0)
+    {
+        throw DevFailed(root_value->errors);
+    }
+
+    da = std::move(root_value->value);
+    return true;
+}
+
 } // namespace Tango
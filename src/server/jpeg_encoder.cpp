@@ -0,0 +1,582 @@
+#include <tango/internal/server/jpeg_encoder.h>
+
+#include <tango/common/utils/assert.h>
+#include <tango/server/except.h>
+#include <tango/client/apiexcept.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <new>
+#include <string>
+
+#ifdef TANGO_USE_JPEG
+  #include <cstdio>
+  #include <jpeglib.h>
+#endif
+
+namespace Tango::detail
+{
+
+#ifdef TANGO_USE_JPEG
+namespace
+{
+// Initial size of the output buffer of a stripe, doubled each time it is full
+constexpr std::size_t STRIPE_OUTPUT_INITIAL_SIZE = 64 * 1024;
+
+// A restart interval is stored on 16 bits
+constexpr std::size_t MAX_RESTART_INTERVAL = 65535;
+
+constexpr unsigned char MARKER_SOF0 = 0xC0;
+constexpr unsigned char MARKER_RST0 = 0xD0;
+constexpr unsigned char MARKER_EOI = 0xD9;
+constexpr unsigned char MARKER_SOS = 0xDA;
+constexpr unsigned char MARKER_DRI = 0xDD;
+
+[[noreturn]] void stripe_error_exit(j_common_ptr cinfo_ptr)
+{
+    char buffer[JMSG_LENGTH_MAX];
+    (*cinfo_ptr->err->format_message)(cinfo_ptr, buffer);
+    std::string err_msg = std::string{"libjpeg error "} + std::to_string(cinfo_ptr->err->msg_code) + ": " + buffer;
+
+    // Do not destroy the compressor, it is reused for the next image
+    jpeg_abort(cinfo_ptr);
+    TANGO_THROW_EXCEPTION(API_EncodeErr, err_msg);
+}
+
+// Position of the markers we need in the output of a stripe
+struct JpegLayout
+{
+    std::size_t sof_pos;  // SOF0 marker
+    std::size_t sos_pos;  // SOS marker
+    std::size_t data_pos; // First byte of entropy coded data
+    std::size_t data_end; // EOI marker
+};
+
+JpegLayout parse_layout(const unsigned char *data, std::size_t size)
+{
+    JpegLayout layout{0, 0, 0, 0};
+
+    // Skip SOI
+    std::size_t pos = 2;
+    while(pos + 4 <= size)
+    {
+        TANGO_ASSERT(data[pos] == 0xFF);
+        unsigned char marker = data[pos + 1];
+        std::size_t length = (static_cast<std::size_t>(data[pos + 2]) << 8) | data[pos + 3];
+
+        if(marker == MARKER_SOF0)
+        {
+            layout.sof_pos = pos;
+        }
+        else if(marker == MARKER_SOS)
+        {
+            layout.sos_pos = pos;
+            layout.data_pos = pos + 2 + length;
+            break;
+        }
+        pos += 2 + length;
+    }
+
+    if(layout.sof_pos == 0 || layout.data_pos == 0 || layout.data_pos + 2 > size || data[size - 2] != 0xFF ||
+       data[size - 1] != MARKER_EOI)
+    {
+        TANGO_THROW_EXCEPTION(API_EncodeErr, "Unexpected JPEG stream layout while assembling the image stripes");
+    }
+    layout.data_end = size - 2;
+
+    return layout;
+}
+
+std::size_t bytes_per_pixel(JpegColorSpace type)
+{
+    switch(type)
+    {
+    case JpegColorSpace::RGB:
+        return 3;
+    case JpegColorSpace::RGBA:
+        return 4;
+    case JpegColorSpace::GRAY:
+    default:
+        return 1;
+    }
+}
+
+void reserve_output(unsigned char **out, std::size_t *out_capacity, std::size_t size)
+{
+    if(size <= *out_capacity)
+    {
+        return;
+    }
+
+    free(*out);
+    *out = static_cast<unsigned char *>(malloc(size));
+    if(*out == nullptr)
+    {
+        *out_capacity = 0;
+        throw std::bad_alloc();
+    }
+    *out_capacity = size;
+}
+
+// Like reserve_output() but keeps the content of the buffer
+void extend_output(unsigned char **out, std::size_t *out_capacity, std::size_t size)
+{
+    if(size <= *out_capacity)
+    {
+        return;
+    }
+
+    auto *ptr = static_cast<unsigned char *>(realloc(*out, size));
+    if(ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    *out = ptr;
+    *out_capacity = size;
+}
+
+} // namespace
+
+//
+// The libjpeg compressor of one stripe, writing in a buffer kept from one image to the next or directly in the caller
+// buffer
+//
+
+struct JpegEncoder::Stripe
+{
+    Stripe()
+    {
+        cinfo.err = jpeg_std_error(&jerr);
+        jerr.error_exit = &stripe_error_exit;
+        jpeg_create_compress(&cinfo);
+
+        cinfo.client_data = this;
+        dest.init_destination = &init_destination;
+        dest.empty_output_buffer = &empty_output_buffer;
+        dest.term_destination = &term_destination;
+        cinfo.dest = &dest;
+    }
+
+    ~Stripe()
+    {
+        jpeg_destroy_compress(&cinfo);
+    }
+
+    Stripe(const Stripe &) = delete;
+    Stripe &operator=(const Stripe &) = delete;
+
+    void setup(int width, int height, double quality, JpegColorSpace type)
+    {
+        cinfo.image_width = width;
+        cinfo.image_height = height;
+        switch(type)
+        {
+        case JpegColorSpace::RGB:
+            cinfo.input_components = 3;
+            cinfo.in_color_space = JCS_RGB;
+            break;
+
+        case JpegColorSpace::RGBA:
+  #ifdef JCS_EXTENSIONS
+            cinfo.input_components = 4;
+            cinfo.in_color_space = JCS_EXT_RGBA;
+  #else
+            TANGO_THROW_DETAILED_EXCEPTION(
+                ApiNonSuppExcept, API_UnsupportedFeature, "JPEG implementation does not support alpha channel");
+  #endif
+            break;
+
+        case JpegColorSpace::GRAY:
+            cinfo.input_components = 1;
+            cinfo.in_color_space = JCS_GRAYSCALE;
+            break;
+        }
+
+        jpeg_set_defaults(&cinfo);
+        jpeg_set_quality(&cinfo, static_cast<int>(quality), TRUE);
+
+        // Stripes must share the default Huffman tables and must not contain their own restart markers
+        cinfo.optimize_coding = FALSE;
+        cinfo.restart_interval = 0;
+        cinfo.restart_in_rows = 0;
+    }
+
+    // Size of a MCU in pixels, only valid after setup()
+    void mcu_size(int &mcu_width, int &mcu_height) const
+    {
+        int max_h = 1;
+        int max_v = 1;
+        for(int i = 0; i < cinfo.num_components; ++i)
+        {
+            max_h = std::max(max_h, cinfo.comp_info[i].h_samp_factor);
+            max_v = std::max(max_v, cinfo.comp_info[i].v_samp_factor);
+        }
+        mcu_width = max_h * DCTSIZE;
+        mcu_height = max_v * DCTSIZE;
+    }
+
+    void compress(const unsigned char *image, int width, int height, double quality, JpegColorSpace type)
+    {
+        setup(width, height, quality, type);
+        jpeg_start_compress(&cinfo, TRUE);
+
+        std::size_t row_stride = static_cast<std::size_t>(width) * cinfo.input_components;
+        rows.resize(height);
+        for(int i = 0; i < height; ++i)
+        {
+            rows[i] = const_cast<JSAMPROW>(image + i * row_stride);
+        }
+
+        try
+        {
+            while(cinfo.next_scanline < cinfo.image_height)
+            {
+                jpeg_write_scanlines(
+                    &cinfo, rows.data() + cinfo.next_scanline, cinfo.image_height - cinfo.next_scanline);
+            }
+
+            jpeg_finish_compress(&cinfo);
+        }
+        catch(...)
+        {
+            // The output buffer could not be extended, make the compressor ready for the next image
+            jpeg_abort_compress(&cinfo);
+            throw;
+        }
+    }
+
+    // Write the next JPEG streams in the malloc() buffer *buf of *capacity bytes (nullptr to use output again)
+    void write_to(unsigned char **buf, std::size_t *capacity)
+    {
+        target = buf;
+        target_capacity = capacity;
+    }
+
+    unsigned char *buffer()
+    {
+        return target != nullptr ? *target : output.data();
+    }
+
+    std::size_t capacity() const
+    {
+        return target != nullptr ? *target_capacity : output.size();
+    }
+
+    // Extend the buffer to at least size bytes, keeping its content
+    void extend(std::size_t size)
+    {
+        if(target != nullptr)
+        {
+            extend_output(target, target_capacity, size);
+        }
+        else if(output.size() < size)
+        {
+            output.resize(size);
+        }
+    }
+
+    static void init_destination(j_compress_ptr cinfo_ptr)
+    {
+        Stripe *stripe = static_cast<Stripe *>(cinfo_ptr->client_data);
+        stripe->extend(STRIPE_OUTPUT_INITIAL_SIZE);
+        stripe->dest.next_output_byte = stripe->buffer();
+        stripe->dest.free_in_buffer = stripe->capacity();
+        stripe->output_size = 0;
+    }
+
+    static boolean empty_output_buffer(j_compress_ptr cinfo_ptr)
+    {
+        Stripe *stripe = static_cast<Stripe *>(cinfo_ptr->client_data);
+        std::size_t old_size = stripe->capacity();
+        stripe->extend(2 * old_size);
+        stripe->dest.next_output_byte = stripe->buffer() + old_size;
+        stripe->dest.free_in_buffer = stripe->capacity() - old_size;
+        return TRUE;
+    }
+
+    static void term_destination(j_compress_ptr cinfo_ptr)
+    {
+        Stripe *stripe = static_cast<Stripe *>(cinfo_ptr->client_data);
+        stripe->output_size = stripe->capacity() - stripe->dest.free_in_buffer;
+    }
+
+    jpeg_compress_struct cinfo{};
+    jpeg_error_mgr jerr{};
+    jpeg_destination_mgr dest{};
+
+    // The allocated size of this buffer is kept between images, output_size is the size of the last JPEG stream
+    // (written in output or in the caller buffer)
+    std::vector<unsigned char> output;
+    std::size_t output_size{0};
+    unsigned char **target{nullptr};
+    std::size_t *target_capacity{nullptr};
+    std::vector<JSAMPROW> rows;
+    std::exception_ptr error;
+};
+#else
+struct JpegEncoder::Stripe
+{
+};
+#endif // TANGO_USE_JPEG
+
+JpegEncoder::JpegEncoder() { }
+
+JpegEncoder::~JpegEncoder()
+{
+    stop_workers();
+}
+
+void JpegEncoder::set_nb_threads(int nb)
+{
+    std::lock_guard<std::mutex> guard(encode_mutex);
+
+    nb = std::max(nb, 1);
+    if(nb == get_nb_threads())
+    {
+        return;
+    }
+
+    stop_workers();
+    start_workers(nb - 1);
+}
+
+void JpegEncoder::start_workers(int nb)
+{
+    for(int i = 0; i < nb; ++i)
+    {
+        workers.emplace_back(&JpegEncoder::worker_loop, this);
+    }
+}
+
+void JpegEncoder::stop_workers()
+{
+    {
+        std::lock_guard<std::mutex> lock(pool_mutex);
+        stopping = true;
+    }
+    work_cond.notify_all();
+
+    for(auto &worker : workers)
+    {
+        worker.join();
+    }
+    workers.clear();
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    stopping = false;
+}
+
+void JpegEncoder::worker_loop()
+{
+    std::unique_lock<std::mutex> lock(pool_mutex);
+    std::uint64_t seen = generation;
+
+    while(true)
+    {
+        work_cond.wait(lock, [this, &seen]() { return stopping || generation != seen; });
+        if(stopping)
+        {
+            return;
+        }
+        seen = generation;
+
+        while(next_stripe < job.nb_stripes)
+        {
+            std::size_t index = next_stripe++;
+            lock.unlock();
+            encode_stripe(index);
+            lock.lock();
+
+            if(--pending_stripes == 0)
+            {
+                done_cond.notify_all();
+            }
+        }
+    }
+}
+
+void JpegEncoder::run_stripes(std::unique_lock<std::mutex> &lock)
+{
+    next_stripe = 0;
+    pending_stripes = job.nb_stripes;
+    generation++;
+    work_cond.notify_all();
+
+    // The caller thread also encodes stripes
+    while(next_stripe < job.nb_stripes)
+    {
+        std::size_t index = next_stripe++;
+        lock.unlock();
+        encode_stripe(index);
+        lock.lock();
+        --pending_stripes;
+    }
+
+    done_cond.wait(lock, [this]() { return pending_stripes == 0; });
+}
+
+#ifdef TANGO_USE_JPEG
+void JpegEncoder::encode_stripe(std::size_t index)
+{
+    Stripe &stripe = *stripes[index];
+    try
+    {
+        int first_row = static_cast<int>(index) * job.rows_per_stripe;
+        int nb_rows = std::min(job.rows_per_stripe, job.height - first_row);
+        std::size_t row_stride = static_cast<std::size_t>(job.width) * bytes_per_pixel(job.type);
+
+        stripe.compress(job.image + first_row * row_stride, job.width, nb_rows, job.quality, job.type);
+    }
+    catch(...)
+    {
+        stripe.error = std::current_exception();
+    }
+}
+
+void JpegEncoder::encode(const unsigned char *image,
+                         int width,
+                         int height,
+                         double quality,
+                         JpegColorSpace type,
+                         unsigned char **out,
+                         std::size_t *out_capacity,
+                         std::size_t *out_size)
+{
+    std::lock_guard<std::mutex> guard(encode_mutex);
+
+    if(stripes.empty())
+    {
+        stripes.push_back(std::make_unique<Stripe>());
+    }
+
+    //
+    // Split the image in stripes of whole MCU rows, one or more per thread. All the stripes but the last one must
+    // have the same number of MCUs which becomes the restart interval of the final image.
+    //
+
+    std::size_t nb_stripes = 1;
+    int rows_per_stripe = height;
+    std::size_t restart_interval = 0;
+
+    int nb_threads = get_nb_threads();
+    if(nb_threads > 1 && width > 0 && height > 0)
+    {
+        int mcu_width;
+        int mcu_height;
+        stripes[0]->setup(width, height, quality, type);
+        stripes[0]->mcu_size(mcu_width, mcu_height);
+
+        std::size_t mcus_per_row = (width + mcu_width - 1) / mcu_width;
+        std::size_t mcu_rows = (height + mcu_height - 1) / mcu_height;
+        std::size_t mcu_rows_per_stripe = (mcu_rows + nb_threads - 1) / nb_threads;
+        std::size_t max_mcu_rows_per_stripe = MAX_RESTART_INTERVAL / mcus_per_row;
+
+        if(max_mcu_rows_per_stripe != 0)
+        {
+            mcu_rows_per_stripe = std::min(mcu_rows_per_stripe, max_mcu_rows_per_stripe);
+            nb_stripes = (mcu_rows + mcu_rows_per_stripe - 1) / mcu_rows_per_stripe;
+            rows_per_stripe = static_cast<int>(mcu_rows_per_stripe) * mcu_height;
+            restart_interval = mcus_per_row * mcu_rows_per_stripe;
+        }
+    }
+
+    while(stripes.size() < nb_stripes)
+    {
+        stripes.push_back(std::make_unique<Stripe>());
+    }
+    for(std::size_t i = 0; i < nb_stripes; ++i)
+    {
+        stripes[i]->error = nullptr;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(pool_mutex);
+        job = Job{image, width, height, quality, type, rows_per_stripe, nb_stripes};
+        if(nb_stripes == 1)
+        {
+            // A single stripe is a complete JPEG image, written directly in the caller buffer
+            lock.unlock();
+            stripes[0]->write_to(out, out_capacity);
+            encode_stripe(0);
+            stripes[0]->write_to(nullptr, nullptr);
+        }
+        else
+        {
+            run_stripes(lock);
+        }
+    }
+
+    for(std::size_t i = 0; i < nb_stripes; ++i)
+    {
+        if(stripes[i]->error)
+        {
+            std::rethrow_exception(stripes[i]->error);
+        }
+    }
+
+    const Stripe &first = *stripes[0];
+    if(nb_stripes == 1)
+    {
+        *out_size = first.output_size;
+        return;
+    }
+
+    //
+    // Otherwise, take the headers of the first stripe with the full image height and a DRI marker, then the entropy
+    // coded data of each stripe separated by RSTn markers
+    //
+
+    std::vector<JpegLayout> layouts;
+    layouts.reserve(nb_stripes);
+    std::size_t total_size = 0;
+    for(std::size_t i = 0; i < nb_stripes; ++i)
+    {
+        layouts.push_back(parse_layout(stripes[i]->output.data(), stripes[i]->output_size));
+        total_size += layouts.back().data_end - layouts.back().data_pos + 2;
+    }
+    const JpegLayout &head = layouts[0];
+    total_size += head.data_pos + 6;
+
+    reserve_output(out, out_capacity, total_size);
+    unsigned char *ptr = *out;
+
+    memcpy(ptr, first.output.data(), head.sos_pos);
+    ptr[head.sof_pos + 5] = static_cast<unsigned char>((height >> 8) & 0xFF);
+    ptr[head.sof_pos + 6] = static_cast<unsigned char>(height & 0xFF);
+    ptr += head.sos_pos;
+
+    *ptr++ = 0xFF;
+    *ptr++ = MARKER_DRI;
+    *ptr++ = 0;
+    *ptr++ = 4;
+    *ptr++ = static_cast<unsigned char>((restart_interval >> 8) & 0xFF);
+    *ptr++ = static_cast<unsigned char>(restart_interval & 0xFF);
+
+    memcpy(ptr, first.output.data() + head.sos_pos, head.data_pos - head.sos_pos);
+    ptr += head.data_pos - head.sos_pos;
+
+    for(std::size_t i = 0; i < nb_stripes; ++i)
+    {
+        std::size_t length = layouts[i].data_end - layouts[i].data_pos;
+        memcpy(ptr, stripes[i]->output.data() + layouts[i].data_pos, length);
+        ptr += length;
+
+        *ptr++ = 0xFF;
+        *ptr++ = (i + 1 == nb_stripes) ? MARKER_EOI : static_cast<unsigned char>(MARKER_RST0 + (i % 8));
+    }
+
+    *out_size = ptr - *out;
+}
+#else
+void JpegEncoder::encode_stripe(std::size_t) { }
+
+void JpegEncoder::encode(
+    const unsigned char *, int, int, double, JpegColorSpace, unsigned char **, std::size_t *, std::size_t *)
+{
+    TANGO_THROW_DETAILED_EXCEPTION(ApiNonSuppExcept, API_UnsupportedFeature, "Tango was built without jpeg support");
+}
+#endif // TANGO_USE_JPEG
+
+} // namespace Tango::detail
@@ -0,0 +1,240 @@
+#include <tango/internal/server/lossless_codec.h>
+
+#include <tango/server/except.h>
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace Tango::detail
+{
+
+namespace
+{
+
+std::size_t blocks_per_row(std::size_t row_samples)
+{
+    return (row_samples + LOSSLESS_BLOCK_SIZE - 1) / LOSSLESS_BLOCK_SIZE;
+}
+
+// Map a residual (modulo 2^bits) to an unsigned value, small residuals of both signs giving small values
+template <typename T>
+T zigzag(T residual)
+{
+    using S = std::make_signed_t<T>;
+    S value = static_cast<S>(residual);
+    return static_cast<T>(static_cast<T>(residual << 1) ^ static_cast<T>(value >> (sizeof(T) * 8 - 1)));
+}
+
+template <typename T>
+T unzigzag(T value)
+{
+    return static_cast<T>((value >> 1) ^ static_cast<T>(0 - (value & 1)));
+}
+
+template <typename T>
+unsigned char *pack_block(const T *values, unsigned char *out)
+{
+    // Bit width of the largest value
+    T all = 0;
+    for(std::size_t i = 0; i < LOSSLESS_BLOCK_SIZE; ++i)
+    {
+        all |= values[i];
+    }
+
+    unsigned int bits = 0;
+    while(all != 0)
+    {
+        all >>= 1;
+        ++bits;
+    }
+
+    *out++ = static_cast<unsigned char>(bits);
+    if(bits == 0)
+    {
+        return out;
+    }
+
+    // LOSSLESS_BLOCK_SIZE * bits is a multiple of 32
+    std::uint64_t acc = 0;
+    unsigned int nb_bits = 0;
+    for(std::size_t i = 0; i < LOSSLESS_BLOCK_SIZE; ++i)
+    {
+        acc |= static_cast<std::uint64_t>(values[i]) << nb_bits;
+        nb_bits += bits;
+        if(nb_bits >= 32)
+        {
+            out[0] = static_cast<unsigned char>(acc);
+            out[1] = static_cast<unsigned char>(acc >> 8);
+            out[2] = static_cast<unsigned char>(acc >> 16);
+            out[3] = static_cast<unsigned char>(acc >> 24);
+            out += 4;
+            acc >>= 32;
+            nb_bits -= 32;
+        }
+    }
+
+    return out;
+}
+
+template <typename T>
+const unsigned char *unpack_block(const unsigned char *in, const unsigned char *end, T *values)
+{
+    if(in == end)
+    {
+        TANGO_THROW_EXCEPTION(API_DecodeErr, "Lossless image data are truncated");
+    }
+
+    unsigned int bits = *in++;
+    if(bits > sizeof(T) * 8 || static_cast<std::size_t>(end - in) < 4 * bits)
+    {
+        TANGO_THROW_EXCEPTION(API_DecodeErr, "Lossless image data are corrupted or truncated");
+    }
+
+    if(bits == 0)
+    {
+        for(std::size_t i = 0; i < LOSSLESS_BLOCK_SIZE; ++i)
+        {
+            values[i] = 0;
+        }
+        return in;
+    }
+
+    const std::uint64_t mask = (std::uint64_t{1} << bits) - 1;
+    std::uint64_t acc = 0;
+    unsigned int nb_bits = 0;
+    for(std::size_t i = 0; i < LOSSLESS_BLOCK_SIZE; ++i)
+    {
+        if(nb_bits < bits)
+        {
+            std::uint64_t word = static_cast<std::uint64_t>(in[0]) | (static_cast<std::uint64_t>(in[1]) << 8) |
+                                 (static_cast<std::uint64_t>(in[2]) << 16) | (static_cast<std::uint64_t>(in[3]) << 24);
+            acc |= word << nb_bits;
+            in += 4;
+            nb_bits += 32;
+        }
+        values[i] = static_cast<T>(acc & mask);
+        acc >>= bits;
+        nb_bits -= bits;
+    }
+
+    return in;
+}
+
+template <typename T>
+std::size_t
+    encode_image(const T *image, std::size_t width, std::size_t height, std::size_t channels, unsigned char *out)
+{
+    const std::size_t row_samples = width * channels;
+    const std::size_t nb_blocks = blocks_per_row(row_samples);
+    std::vector<T> residuals(nb_blocks * LOSSLESS_BLOCK_SIZE, 0);
+
+    unsigned char *ptr = out;
+    for(std::size_t y = 0; y < height; ++y)
+    {
+        const T *row = image + y * row_samples;
+        for(std::size_t i = 0; i < channels && i < row_samples; ++i)
+        {
+            T prediction = (y == 0) ? 0 : row[i - row_samples];
+            residuals[i] = zigzag(static_cast<T>(row[i] - prediction));
+        }
+
+        for(std::size_t i = channels; i < row_samples; ++i)
+        {
+            residuals[i] = zigzag(static_cast<T>(row[i] - row[i - channels]));
+        }
+
+        for(std::size_t block = 0; block < nb_blocks; ++block)
+        {
+            ptr = pack_block(residuals.data() + block * LOSSLESS_BLOCK_SIZE, ptr);
+        }
+    }
+
+    return ptr - out;
+}
+
+template <typename T>
+void decode_image(const unsigned char *data,
+                  std::size_t size,
+                  std::size_t width,
+                  std::size_t height,
+                  std::size_t channels,
+                  T *image)
+{
+    const std::size_t row_samples = width * channels;
+    const std::size_t nb_blocks = blocks_per_row(row_samples);
+    std::vector<T> residuals(nb_blocks * LOSSLESS_BLOCK_SIZE, 0);
+
+    const unsigned char *ptr = data;
+    const unsigned char *end = data + size;
+    for(std::size_t y = 0; y < height; ++y)
+    {
+        for(std::size_t block = 0; block < nb_blocks; ++block)
+        {
+            ptr = unpack_block(ptr, end, residuals.data() + block * LOSSLESS_BLOCK_SIZE);
+        }
+
+        T *row = image + y * row_samples;
+        for(std::size_t i = 0; i < channels && i < row_samples; ++i)
+        {
+            T prediction = (y == 0) ? 0 : row[i - row_samples];
+            row[i] = static_cast<T>(prediction + unzigzag(residuals[i]));
+        }
+
+        for(std::size_t i = channels; i < row_samples; ++i)
+        {
+            row[i] = static_cast<T>(row[i - channels] + unzigzag(residuals[i]));
+        }
+    }
+
+    if(ptr != end)
+    {
+        TANGO_THROW_EXCEPTION(API_DecodeErr, "Lossless image data are larger than the image size");
+    }
+}
+
+} // namespace
+
+std::size_t lossless_max_size(std::size_t row_samples, std::size_t nb_rows, std::size_t sample_size)
+{
+    return nb_rows * blocks_per_row(row_samples) * (1 + LOSSLESS_BLOCK_SIZE * sample_size);
+}
+
+std::size_t lossless_min_size(std::size_t row_samples, std::size_t nb_rows)
+{
+    return nb_rows * blocks_per_row(row_samples);
+}
+
+std::size_t lossless_encode(
+    const unsigned char *image, std::size_t width, std::size_t height, std::size_t channels, unsigned char *out)
+{
+    return encode_image(image, width, height, channels, out);
+}
+
+std::size_t lossless_encode(
+    const unsigned short *image, std::size_t width, std::size_t height, std::size_t channels, unsigned char *out)
+{
+    return encode_image(image, width, height, channels, out);
+}
+
+void lossless_decode(const unsigned char *data,
+                     std::size_t size,
+                     std::size_t width,
+                     std::size_t height,
+                     std::size_t channels,
+                     unsigned char *image)
+{
+    decode_image(data, size, width, height, channels, image);
+}
+
+void lossless_decode(const unsigned char *data,
+                     std::size_t size,
+                     std::size_t width,
+                     std::size_t height,
+                     std::size_t channels,
+                     unsigned short *image)
+{
+    decode_image(data, size, width, height, channels, image);
+}
+
+} // namespace Tango::detail
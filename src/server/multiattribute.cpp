@@ -715,7 +715,36 @@ void MultiAttribute::check_idl_release(DeviceImpl *dev)
 
 void MultiAttribute::add_attribute(const std::string &dev_name, DeviceClass *dev_class_ptr, long index)
 {
-    TANGO_LOG_DEBUG << "Entering MultiAttribute::add_attribute" << std::endl;
+    add_attributes(dev_name, dev_class_ptr, std::vector<long>{index});
+}
+
+//+-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        MultiAttribute::add_attributes
+//
+// description :
+//        Construct several new attribute objects and add them to the device attribute list. The device attribute
+//        properties of all these attributes are retrieved with a single database call.
+//
+// argument :
+//        in :
+//            - dev_name : The device name
+//            - dev_class_ptr : Pointer to the DeviceClass object
+//            - indexes : Indexes in class attribute list of the new device attributes
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+void MultiAttribute::add_attributes(const std::string &dev_name,
+                                    DeviceClass *dev_class_ptr,
+                                    const std::vector<long> &indexes)
+{
+    TANGO_LOG_DEBUG << "Entering MultiAttribute::add_attributes" << std::endl;
+
+    if(indexes.empty())
+    {
+        return;
+    }
 
     //
     // Retrieve device class attribute list
@@ -734,7 +763,10 @@ void MultiAttribute::add_attribute(const std::string &dev_name, DeviceClass *dev
 
     if(tg->use_db())
     {
-        db_list.emplace_back(tmp_attr_list[index]->get_name());
+        for(long index : indexes)
+        {
+            db_list.emplace_back(tmp_attr_list[index]->get_name());
+        }
 
         try
         {
@@ -750,135 +782,144 @@ void MultiAttribute::add_attribute(const std::string &dev_name, DeviceClass *dev
     }
 
     //
-    // Get attribute class properties
+    // If the device implement IDL 3 (with state and status as attributes), the new attributes have to be inserted
+    // at the end of the list but before state and status. Remove state and status from the list while the new
+    // attributes are appended and put them back at the end, so their indexes are updated only once
     //
 
-    Attr &attr = dev_class_ptr->get_class_attr()->get_attr(tmp_attr_list[index]->get_name());
-    std::vector<AttrProperty> &class_prop = attr.get_class_properties();
-    std::vector<AttrProperty> &def_user_prop = attr.get_user_default_properties();
+    std::vector<Attribute *> state_and_status;
+    if(!attr_list.empty() && (attr_list.back())->get_name() == "Status")
+    {
+        state_and_status.assign(attr_list.end() - 2, attr_list.end());
+        attr_list.erase(attr_list.end() - 2, attr_list.end());
+    }
 
-    //
-    // If the attribute has some properties defined at device level, build a vector of these properties
-    //
+    auto restore_state_and_status = [this, &state_and_status]()
+    {
+        for(Attribute *att : state_and_status)
+        {
+            add_attr(att);
+        }
+        state_and_status.clear();
+    };
 
-    std::vector<AttrProperty> dev_prop;
+    std::vector<long> new_indexes;
+    new_indexes.reserve(indexes.size());
 
-    if(tg->use_db())
+    try
     {
         long ind = 0;
-        long nb_prop = 0;
-        db_list[ind] >> nb_prop;
-        ind++;
-
-        for(long j = 0; j < nb_prop; j++)
+        for(long index : indexes)
         {
-            if(db_list[ind].size() > 1)
+            //
+            // Get attribute class properties
+            //
+
+            Attr &attr = dev_class_ptr->get_class_attr()->get_attr(tmp_attr_list[index]->get_name());
+            std::vector<AttrProperty> &class_prop = attr.get_class_properties();
+            std::vector<AttrProperty> &def_user_prop = attr.get_user_default_properties();
+
+            //
+            // If the attribute has some properties defined at device level, build a vector of these properties
+            //
+
+            std::vector<AttrProperty> dev_prop;
+
+            if(tg->use_db())
             {
-                std::string tmp(db_list[ind].value_string[0]);
-                long nb = db_list[ind].size();
-                for(int k = 1; k < nb; k++)
+                long nb_prop = 0;
+                db_list[ind] >> nb_prop;
+                ind++;
+
+                for(long j = 0; j < nb_prop; j++)
                 {
-                    tmp = tmp + ",";
-                    tmp = tmp + db_list[ind].value_string[k];
+                    if(db_list[ind].size() > 1)
+                    {
+                        std::string tmp(db_list[ind].value_string[0]);
+                        long nb = db_list[ind].size();
+                        for(int k = 1; k < nb; k++)
+                        {
+                            tmp = tmp + ",";
+                            tmp = tmp + db_list[ind].value_string[k];
+                        }
+                        dev_prop.emplace_back(db_list[ind].name, tmp);
+                    }
+                    else
+                    {
+                        dev_prop.emplace_back(db_list[ind].name, db_list[ind].value_string[0]);
+                    }
+                    ind++;
                 }
-                dev_prop.emplace_back(db_list[ind].name, tmp);
+            }
+
+            //
+            // Concatenate these two attribute properties levels
+            //
+
+            std::vector<AttrProperty> prop_list;
+            concat(dev_prop, class_prop, prop_list);
+            add_user_default(prop_list, def_user_prop);
+            add_default(prop_list, dev_name, attr.get_name(), attr.get_type());
+
+            //
+            // Create an Attribute instance and insert it in the attribute list
+            //
+
+            if((attr.get_writable() == Tango::WRITE) || (attr.get_writable() == Tango::READ_WRITE))
+            {
+                Attribute *new_attr = new WAttribute(prop_list, attr, dev_name, index);
+                add_attr(new_attr);
             }
             else
             {
-                dev_prop.emplace_back(db_list[ind].name, db_list[ind].value_string[0]);
+                Attribute *new_attr = new Attribute(prop_list, attr, dev_name, index);
+                add_attr(new_attr);
             }
-            ind++;
-        }
-    }
-
-    //
-    // Concatenate these two attribute properties levels
-    //
+            long att_index = attr_list.size() - 1;
+            new_indexes.push_back(att_index);
 
-    std::vector<AttrProperty> prop_list;
-    concat(dev_prop, class_prop, prop_list);
-    add_user_default(prop_list, def_user_prop);
-    add_default(prop_list, dev_name, attr.get_name(), attr.get_type());
+            //
+            // If it is writable, add it to the writable attribute list
+            //
 
-    //
-    // Create an Attribute instance and insert it in the attribute list. If the device implement IDL 3
-    // (with state and status as attributes), add it at the end of the list but before state and status.
-    //
+            Tango::AttrWriteType w_type = attr_list[att_index]->get_writable();
+            if((w_type == Tango::WRITE) || (w_type == Tango::READ_WRITE))
+            {
+                writable_attr_list.push_back(att_index);
+            }
 
-    bool idl_3 = false;
-    std::vector<Attribute *>::iterator ite;
-    if((attr_list.back())->get_name() == "Status")
-    {
-        idl_3 = true;
-        ite = attr_list.end();
-        ite = ite - 2;
-    }
+            //
+            // If one of the alarm properties is defined, add it to the alarmed attribute list
+            //
 
-    if((attr.get_writable() == Tango::WRITE) || (attr.get_writable() == Tango::READ_WRITE))
-    {
-        if(!idl_3)
-        {
-            Attribute *new_attr = new WAttribute(prop_list, attr, dev_name, index);
-            add_attr(new_attr);
-            index = attr_list.size() - 1;
-        }
-        else
-        {
-            Attribute *new_attr = new WAttribute(prop_list, attr, dev_name, index);
-            attr_list.insert(ite, new_attr);
-            index = attr_list.size() - 3;
-            ext->put_attribute_in_map(new_attr, index);
-            ext->increment_state_and_status_indexes();
+            if(attr_list[att_index]->is_alarmed().any())
+            {
+                if(w_type != Tango::WRITE)
+                {
+                    alarm_attr_list.push_back(att_index);
+                }
+            }
         }
     }
-    else
+    catch(...)
     {
-        if(!idl_3)
-        {
-            Attribute *new_attr = new Attribute(prop_list, attr, dev_name, index);
-            add_attr(new_attr);
-            index = attr_list.size() - 1;
-        }
-        else
-        {
-            Attribute *new_attr = new Attribute(prop_list, attr, dev_name, index);
-            attr_list.insert(ite, new_attr);
-            index = attr_list.size() - 3;
-            ext->put_attribute_in_map(new_attr, index);
-            ext->increment_state_and_status_indexes();
-        }
+        restore_state_and_status();
+        throw;
     }
 
-    //
-    // If it is writable, add it to the writable attribute list
-    //
-
-    Tango::AttrWriteType w_type = attr_list[index]->get_writable();
-    if((w_type == Tango::WRITE) || (w_type == Tango::READ_WRITE))
-    {
-        writable_attr_list.push_back(index);
-    }
+    restore_state_and_status();
 
     //
-    // If one of the alarm properties is defined, add it to the alarmed attribute list
+    // Check if the writable_attr_name property is set and in this case, check if the associated attribute exists and is
+    // writable. This is done once all the attributes are created because the associated attribute may be one of them
     //
 
-    if(attr_list[index]->is_alarmed().any())
+    for(long att_index : new_indexes)
     {
-        if(w_type != Tango::WRITE)
-        {
-            alarm_attr_list.push_back(index);
-        }
+        check_associated(att_index, dev_name);
     }
 
-    //
-    // Check if the writable_attr_name property is set and in this case, check if the associated attribute exists and is
-    // writable
-    //
-
-    check_associated(index, dev_name);
-
-    TANGO_LOG_DEBUG << "Leaving MultiAttribute::add_attribute" << std::endl;
+    TANGO_LOG_DEBUG << "Leaving MultiAttribute::add_attributes" << std::endl;
 }
 
 //+-------------------------------------------------------------------------------------------------------------------
@@ -1054,6 +1095,7 @@ void MultiAttribute::remove_attribute(const std::string &attr_name, bool update_
     std::string &dev_class_name = the_dev->get_device_class()->get_name();
 
     ext->attr_map.erase(att->get_name_lower());
+    ext->attr_list_generation++;
     delete att;
     auto pos = attr_list.begin();
     advance(pos, att_index);
@@ -32,6 +32,7 @@
 
 #include <tango/server/pipe.h>
 #include <tango/server/pipedesc.h>
+#include <tango/server/pipe_stream_writer.h>
 #include <tango/server/deviceclass.h>
 #include <tango/server/device.h>
 #include <tango/server/eventsupplier.h>
@@ -838,6 +839,77 @@ void Pipe::fire_event(DeviceImpl *dev, DevicePipeBlob *p_data, const TangoTimest
     delete ad.pipe_val;
 }
 
+//+-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        Pipe::fire_event
+//
+// description :
+//        Fire a pipe event with data built by a pipe stream writer. The writer already holds the marshalled event
+//        data, so it is passed to the event supplier as a ready to send message
+//
+// arguments:
+//         in :
+//            - dev : Device pointer
+//            - writer : The pipe stream writer
+//            - t : The event time stamp
+//
+//---------------------------------------------------------------------------------------------------------------------
+
+void Pipe::fire_event(DeviceImpl *dev, PipeStreamWriter &writer, const TangoTimestamp &t)
+{
+    TANGO_LOG_DEBUG << "Pipe::fire_event() entering ..." << std::endl;
+
+    //
+    // Check if it is needed to send an event
+    //
+
+    if(!is_pipe_event_subscribed())
+    {
+        return;
+    }
+
+    //
+    // Get the event supplier, and simply return if not created
+    //
+
+    ZmqEventSupplier *event_supplier_zmq = nullptr;
+
+    Tango::Util *tg = Util::instance();
+    event_supplier_zmq = tg->get_zmq_event_supplier();
+
+    if(event_supplier_zmq == nullptr)
+    {
+        return;
+    }
+
+    //
+    // Create the message sent to the event system from the writer data
+    //
+
+    std::size_t mess_size;
+    const void *mess_ptr = writer.get_message(t, mess_size);
+
+    zmq::message_t data_mess(mess_size);
+    ::memcpy(data_mess.data(), mess_ptr, mess_size);
+
+    EventSupplier::SuppliedEventData ad;
+    ::memset(&ad, 0, sizeof(ad));
+    ad.zmq_mess = &data_mess;
+
+    //
+    // Fire event
+    //
+
+    std::vector<std::string> f_names;
+    std::vector<double> f_data;
+    std::vector<std::string> f_names_lg;
+    std::vector<long> f_data_lg;
+
+    std::string event_type("pipe");
+    event_supplier_zmq->push_event(dev, event_type, f_names, f_data, f_names_lg, f_data_lg, ad, name, nullptr, true);
+}
+
 bool Pipe::is_pipe_event_subscribed() const
 {
     const auto now = Tango::get_current_system_datetime();
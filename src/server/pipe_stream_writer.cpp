@@ -0,0 +1,355 @@
+#include <tango/server/pipe_stream_writer.h>
+#include <tango/server/except.h>
+
+#include <cstring>
+
+namespace Tango
+{
+
+PipeStreamWriter::PipeStreamWriter(const std::string &_pipe_name, const std::string &_blob_name) :
+    pipe_name(_pipe_name),
+    root_blob_name(_blob_name)
+{
+    start();
+}
+
+PipeStreamWriter::~PipeStreamWriter() { }
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        PipeStreamWriter::start()
+//
+// description :
+//        Write the message header. The message is the one built by ZmqEventSupplier::push_event() for a DevPipeData:
+//        two padding longs followed by the marshalled DevPipeData. The time stamp and the root blob data element
+//        number are not yet known and are updated in place before the message is sent.
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+void PipeStreamWriter::start()
+{
+    stream.rewindPtrs();
+    blobs.clear();
+
+    CORBA::ULong padding = 0XDEC0DEC0UL;
+    padding >>= stream;
+    padding >>= stream;
+
+    stream.marshalString(pipe_name.c_str());
+
+    CORBA::Long time_field = 0;
+    time_field >>= stream;
+    time_field >>= stream;
+    time_field >>= stream;
+    time_offset = stream.bufSize() - 3 * sizeof(CORBA::Long);
+
+    stream.marshalString(root_blob_name.c_str());
+
+    CORBA::ULong elt_nb = 0;
+    elt_nb >>= stream;
+    blobs.push_back({stream.bufSize() - sizeof(CORBA::ULong), 0, root_blob_name});
+}
+
+void PipeStreamWriter::clear()
+{
+    start();
+}
+
+void PipeStreamWriter::write_ulong_at(std::size_t offset, CORBA::ULong val)
+{
+    ::memcpy(static_cast<char *>(stream.bufPtr()) + offset, &val, sizeof(val));
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        PipeStreamWriter::start_elt() and PipeStreamWriter::end_elt()
+//
+// description :
+//        Write the fields of a DevPipeDataElt around its data: the name, the AttrValUnion discriminator and the
+//        data sequence length before the data, the (empty) inner blob and the inner blob name after them.
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+void PipeStreamWriter::start_elt(const std::string &elt_name, AttributeDataType type, std::size_t nb)
+{
+    blobs.back().elt_nb++;
+
+    stream.marshalString(elt_name.c_str());
+
+    CORBA::ULong discr = static_cast<CORBA::ULong>(type);
+    discr >>= stream;
+
+    CORBA::ULong len = static_cast<CORBA::ULong>(nb);
+    len >>= stream;
+}
+
+void PipeStreamWriter::end_elt(const char *inner_blob_name)
+{
+    CORBA::ULong inner_blob_len = 0;
+    inner_blob_len >>= stream;
+
+    stream.marshalString(inner_blob_name);
+}
+
+template <typename T>
+void PipeStreamWriter::add_array(const std::string &elt_name,
+                                 AttributeDataType type,
+                                 const T *data,
+                                 std::size_t nb,
+                                 omni::alignment_t align,
+                                 const char *inner_blob_name)
+{
+    start_elt(elt_name, type, nb);
+    if(nb != 0)
+    {
+        stream.put_octet_array(reinterpret_cast<const CORBA::Octet *>(data), static_cast<int>(nb * sizeof(T)), align);
+    }
+    end_elt(inner_blob_name);
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        PipeStreamWriter::add()
+//
+// description :
+//        Add a data element to the current blob. Like with DevicePipeBlob, a scalar is sent as a one element array
+//        with the "Scalar" inner blob name.
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+void PipeStreamWriter::add(const std::string &elt_name, DevBoolean datum)
+{
+    add_array(elt_name, ATT_BOOL, &datum, 1, omni::ALIGN_1, SCALAR_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, DevShort datum)
+{
+    add_array(elt_name, ATT_SHORT, &datum, 1, omni::ALIGN_2, SCALAR_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, DevLong datum)
+{
+    add_array(elt_name, ATT_LONG, &datum, 1, omni::ALIGN_4, SCALAR_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, DevLong64 datum)
+{
+    add_array(elt_name, ATT_LONG64, &datum, 1, omni::ALIGN_8, SCALAR_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, DevFloat datum)
+{
+    add_array(elt_name, ATT_FLOAT, &datum, 1, omni::ALIGN_4, SCALAR_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, DevDouble datum)
+{
+    add_array(elt_name, ATT_DOUBLE, &datum, 1, omni::ALIGN_8, SCALAR_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, DevUChar datum)
+{
+    add_array(elt_name, ATT_UCHAR, &datum, 1, omni::ALIGN_1, SCALAR_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, DevUShort datum)
+{
+    add_array(elt_name, ATT_USHORT, &datum, 1, omni::ALIGN_2, SCALAR_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, DevULong datum)
+{
+    add_array(elt_name, ATT_ULONG, &datum, 1, omni::ALIGN_4, SCALAR_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, DevULong64 datum)
+{
+    add_array(elt_name, ATT_ULONG64, &datum, 1, omni::ALIGN_8, SCALAR_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, DevState datum)
+{
+    start_elt(elt_name, ATT_STATE, 1);
+    CORBA::ULong state = static_cast<CORBA::ULong>(datum);
+    state >>= stream;
+    end_elt(SCALAR_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, const std::string &datum)
+{
+    add(elt_name, datum.c_str());
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, const char *datum)
+{
+    start_elt(elt_name, ATT_STRING, 1);
+    stream.marshalString(datum);
+    end_elt(SCALAR_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, const std::vector<DevBoolean> &datum)
+{
+    start_elt(elt_name, ATT_BOOL, datum.size());
+    for(bool val : datum)
+    {
+        stream.marshalBoolean(val);
+    }
+    end_elt(ARRAY_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, const std::vector<DevShort> &datum)
+{
+    add_array(elt_name, ATT_SHORT, datum.data(), datum.size(), omni::ALIGN_2, ARRAY_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, const std::vector<DevLong> &datum)
+{
+    add_array(elt_name, ATT_LONG, datum.data(), datum.size(), omni::ALIGN_4, ARRAY_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, const std::vector<DevLong64> &datum)
+{
+    add_array(elt_name, ATT_LONG64, datum.data(), datum.size(), omni::ALIGN_8, ARRAY_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, const std::vector<DevFloat> &datum)
+{
+    add_array(elt_name, ATT_FLOAT, datum.data(), datum.size(), omni::ALIGN_4, ARRAY_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, const std::vector<DevDouble> &datum)
+{
+    add_array(elt_name, ATT_DOUBLE, datum.data(), datum.size(), omni::ALIGN_8, ARRAY_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, const std::vector<DevUChar> &datum)
+{
+    add_array(elt_name, ATT_UCHAR, datum.data(), datum.size(), omni::ALIGN_1, ARRAY_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, const std::vector<DevUShort> &datum)
+{
+    add_array(elt_name, ATT_USHORT, datum.data(), datum.size(), omni::ALIGN_2, ARRAY_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, const std::vector<DevULong> &datum)
+{
+    add_array(elt_name, ATT_ULONG, datum.data(), datum.size(), omni::ALIGN_4, ARRAY_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, const std::vector<DevULong64> &datum)
+{
+    add_array(elt_name, ATT_ULONG64, datum.data(), datum.size(), omni::ALIGN_8, ARRAY_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, const std::vector<DevState> &datum)
+{
+    start_elt(elt_name, ATT_STATE, datum.size());
+    for(DevState val : datum)
+    {
+        CORBA::ULong state = static_cast<CORBA::ULong>(val);
+        state >>= stream;
+    }
+    end_elt(ARRAY_PIPE);
+}
+
+void PipeStreamWriter::add(const std::string &elt_name, const std::vector<std::string> &datum)
+{
+    start_elt(elt_name, ATT_STRING, datum.size());
+    for(const auto &val : datum)
+    {
+        stream.marshalString(val.c_str());
+    }
+    end_elt(ARRAY_PIPE);
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        PipeStreamWriter::begin_blob()
+//
+// description :
+//        Start an inner blob data element. Its value is the ATT_NO_DATA union member, like for a DevicePipeBlob
+//        inserted into another one. The inner blob length and name are written by end_blob()
+//
+// argument :
+//        in :
+//            - elt_name : The data element name
+//            - blob_name : The inner blob name
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+void PipeStreamWriter::begin_blob(const std::string &elt_name, const std::string &blob_name)
+{
+    blobs.back().elt_nb++;
+
+    stream.marshalString(elt_name.c_str());
+
+    CORBA::ULong discr = static_cast<CORBA::ULong>(ATT_NO_DATA);
+    discr >>= stream;
+    stream.marshalBoolean(true);
+
+    CORBA::ULong elt_nb = 0;
+    elt_nb >>= stream;
+    blobs.push_back({stream.bufSize() - sizeof(CORBA::ULong), 0, blob_name});
+}
+
+void PipeStreamWriter::end_blob()
+{
+    if(blobs.size() < 2)
+    {
+        TANGO_THROW_EXCEPTION(API_PipeWrongArg, "No inner blob started in the pipe stream writer");
+    }
+
+    const OpenBlob &blob = blobs.back();
+    write_ulong_at(blob.len_offset, blob.elt_nb);
+    stream.marshalString(blob.name.c_str());
+
+    blobs.pop_back();
+}
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        PipeStreamWriter::get_message()
+//
+// description :
+//        Update the message with the time stamp and the root blob data element number and return it
+//
+// argument :
+//        in :
+//            - t : The event time stamp
+//        out :
+//            - size : The message size
+//
+// return :
+//        Pointer to the message
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+const void *PipeStreamWriter::get_message(const TangoTimestamp &t, std::size_t &size)
+{
+    if(blobs.size() != 1)
+    {
+        TANGO_THROW_EXCEPTION(API_PipeWrongArg, "Inner blob not ended in the pipe stream writer (missing end_blob())");
+    }
+
+    if(blobs.front().elt_nb == 0)
+    {
+        TANGO_THROW_EXCEPTION(API_PipeNoDataElement, "No data in PipeStreamWriter!");
+    }
+
+    write_ulong_at(blobs.front().len_offset, blobs.front().elt_nb);
+
+    TimeVal tv = make_TimeVal(t);
+    CORBA::Long time_fields[3] = {tv.tv_sec, tv.tv_usec, tv.tv_nsec};
+    ::memcpy(static_cast<char *>(stream.bufPtr()) + time_offset, time_fields, sizeof(time_fields));
+
+    size = stream.bufSize();
+    return stream.bufPtr();
+}
+
+} // namespace Tango
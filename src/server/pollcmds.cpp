@@ -125,6 +125,53 @@ CORBA::Any *DevPollStatusCmd::execute(DeviceImpl *device, const CORBA::Any &in_a
     return insert((static_cast<DServer *>(device))->dev_poll_status(d_name));
 }
 
+//+-------------------------------------------------------------------------
+//
+// method :         PolledAttrSnapshotCmd::PolledAttrSnapshotCmd
+//
+// description :     constructors for Command class PolledAttrSnapshot
+//
+//--------------------------------------------------------------------------
+
+PolledAttrSnapshotCmd::PolledAttrSnapshotCmd(
+    const char *name, Tango::CmdArgType in, Tango::CmdArgType out, const char *in_desc, const char *out_desc) :
+    Command(name, in, out)
+{
+    set_in_type_desc(in_desc);
+    set_out_type_desc(out_desc);
+}
+
+//+-------------------------------------------------------------------------
+//
+// method :         PolledAttrSnapshotCmd::execute
+//
+// description :     Trigger the execution of the method really implemented
+//            the command in the DServer class
+//
+//--------------------------------------------------------------------------
+
+CORBA::Any *PolledAttrSnapshotCmd::execute(DeviceImpl *device, const CORBA::Any &in_any)
+{
+    TANGO_LOG_DEBUG << "PolledAttrSnapshot::execute(): arrived " << std::endl;
+
+    //
+    // Extract the input string array
+    //
+
+    const DevVarStringArray *tmp_data;
+    if(!(in_any >>= tmp_data))
+    {
+        TANGO_THROW_EXCEPTION(API_IncompatibleCmdArgumentType,
+                              "Imcompatible command argument type, expected type is : DevVarStringArray");
+    }
+
+    //
+    // Call the device method and return to caller
+    //
+
+    return insert((static_cast<DServer *>(device))->polled_attr_snapshot(tmp_data));
+}
+
 //+-------------------------------------------------------------------------
 //
 // method :         AddObjPollingCmd::AddObjPollingCmd
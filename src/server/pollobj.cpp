@@ -42,6 +42,8 @@
 namespace Tango
 {
 
+std::atomic<std::uint64_t> PollObj::insert_ctr{0};
+
 //+------------------------------------------------------------------------------------------------------------------
 //
 // method :
@@ -107,6 +109,7 @@ void PollObj::insert_data(CORBA::Any *res, PollClock::time_point when, PollClock
 
     ring.insert_data(res, when);
     needed_time = needed;
+    last_insert_nb = ++insert_ctr;
 }
 
 void PollObj::insert_data(Tango::AttributeValueList *res, PollClock::time_point when, PollClock::duration needed)
@@ -115,6 +118,7 @@ void PollObj::insert_data(Tango::AttributeValueList *res, PollClock::time_point
 
     ring.insert_data(res, when);
     needed_time = needed;
+    last_insert_nb = ++insert_ctr;
 }
 
 void PollObj::insert_data(Tango::AttributeValueList_3 *res, PollClock::time_point when, PollClock::duration needed)
@@ -123,6 +127,8 @@ void PollObj::insert_data(Tango::AttributeValueList_3 *res, PollClock::time_poin
 
     ring.insert_data(res, when);
     needed_time = needed;
+    last_insert_nb = ++insert_ctr;
+    publish_last_attr_value();
 }
 
 void PollObj::insert_data(Tango::AttributeValueList_4 *res, PollClock::time_point when, PollClock::duration needed)
@@ -131,6 +137,8 @@ void PollObj::insert_data(Tango::AttributeValueList_4 *res, PollClock::time_poin
 
     ring.insert_data(res, when, true);
     needed_time = needed;
+    last_insert_nb = ++insert_ctr;
+    publish_last_attr_value();
 }
 
 void PollObj::insert_data(Tango::AttributeValueList_5 *res, PollClock::time_point when, PollClock::duration needed)
@@ -139,6 +147,8 @@ void PollObj::insert_data(Tango::AttributeValueList_5 *res, PollClock::time_poin
 
     ring.insert_data(res, when, true);
     needed_time = needed;
+    last_insert_nb = ++insert_ctr;
+    publish_last_attr_value();
 }
 
 //-------------------------------------------------------------------------------------------------------------------
@@ -163,6 +173,83 @@ void PollObj::insert_except(Tango::DevFailed *res, PollClock::time_point when, P
 
     ring.insert_except(res, when);
     needed_time = needed;
+    last_insert_nb = ++insert_ctr;
+    if(type == POLL_ATTR)
+    {
+        publish_last_attr_value();
+    }
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        PollObj::publish_last_attr_value
+//
+// description :
+//        Publish the element just inserted in the ring for the cache reads (see get_last_attr_value_snapshot()).
+//        The attribute value is shared with the ring, the exception (rare) is copied. Called with the object locked
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+void PollObj::publish_last_attr_value()
+{
+    const RingElt &last = ring.get_last_elt();
+
+    auto value = std::make_shared<LastAttrValue>();
+    value->when = last.when;
+    if(last.except != nullptr)
+    {
+        value->except = std::make_shared<Tango::DevFailed>(*last.except);
+    }
+    else
+    {
+        value->value_3 = last.attr_value_3;
+        value->value_4 = last.attr_value_4;
+        value->value_5 = last.attr_value_5;
+    }
+
+#if defined(__cpp_lib_atomic_shared_ptr)
+    last_attr_value.store(std::move(value));
+#else
+    std::atomic_store(&last_attr_value, std::shared_ptr<const LastAttrValue>(std::move(value)));
+#endif
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        PollObj::LastAttrValue::get_value_3/4/5
+//
+// description :
+//        Return the attribute value or throw the exception inserted in the ring
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+Tango::AttributeValue_3 &PollObj::LastAttrValue::get_value_3() const
+{
+    if(except != nullptr)
+    {
+        throw Tango::DevFailed(*except);
+    }
+    return (*value_3)[0];
+}
+
+Tango::AttributeValue_4 &PollObj::LastAttrValue::get_value_4() const
+{
+    if(except != nullptr)
+    {
+        throw Tango::DevFailed(*except);
+    }
+    return (*value_4)[0];
+}
+
+Tango::AttributeValue_5 &PollObj::LastAttrValue::get_value_5() const
+{
+    if(except != nullptr)
+    {
+        throw Tango::DevFailed(*except);
+    }
+    return (*value_5)[0];
 }
 
 //-------------------------------------------------------------------------------------------------------------------
@@ -302,9 +302,6 @@ PollRing::~PollRing()
         delete ring[i].cmd_result;
         delete ring[i].except;
         delete ring[i].attr_value;
-        delete ring[i].attr_value_3;
-        delete ring[i].attr_value_4;
-        delete ring[i].attr_value_5;
     }
 }
 
@@ -366,11 +363,10 @@ void PollRing::insert_data(Tango::AttributeValueList_3 *attr_val, PollClock::tim
     // Insert data in the ring
     //
 
-    delete(ring[insert_elt].attr_value_3);
     delete(ring[insert_elt].except);
     ring[insert_elt].except = nullptr;
 
-    ring[insert_elt].attr_value_3 = attr_val;
+    ring[insert_elt].attr_value_3.reset(attr_val);
     ring[insert_elt].when = t;
 
     //
@@ -386,14 +382,13 @@ void PollRing::insert_data(Tango::AttributeValueList_4 *attr_val, PollClock::tim
     // Insert data in the ring
     //
 
-    delete(ring[insert_elt].attr_value_4);
     delete(ring[insert_elt].except);
     ring[insert_elt].except = nullptr;
 
-    ring[insert_elt].attr_value_4 = attr_val;
+    ring[insert_elt].attr_value_4.reset(attr_val);
     ring[insert_elt].when = t;
 
-    force_copy_data(ring[insert_elt].attr_value_4);
+    force_copy_data(ring[insert_elt].attr_value_4.get());
 
     //
     // Release attribute mutexes because the data are now copied
@@ -421,14 +416,13 @@ void PollRing::insert_data(Tango::AttributeValueList_5 *attr_val, PollClock::tim
     // Insert data in the ring
     //
 
-    delete(ring[insert_elt].attr_value_5);
     delete(ring[insert_elt].except);
     ring[insert_elt].except = nullptr;
 
-    ring[insert_elt].attr_value_5 = attr_val;
+    ring[insert_elt].attr_value_5.reset(attr_val);
     ring[insert_elt].when = t;
 
-    force_copy_data(ring[insert_elt].attr_value_5);
+    force_copy_data(ring[insert_elt].attr_value_5.get());
 
     //
     // Release attribute mutexes because the data are now copied
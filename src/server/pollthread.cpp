@@ -38,6 +38,7 @@
 #include <tango/server/device_4.h>
 #include <tango/server/device_3.h>
 #include <tango/server/utils.h>
+#include <tango/internal/server/device_metrics.h>
 
 namespace Tango
 {
@@ -786,6 +787,13 @@ void PollThread::one_more_poll()
 
     if(!polling_stop)
     {
+        if(tmp.type == Tango::POLL_CMD || tmp.type == Tango::POLL_ATTR)
+        {
+            auto lateness = std::max(PollClock::now() - tmp.wake_up_date, PollClock::duration::zero());
+            tmp.dev->get_metrics().polling_lateness().record(
+                static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(lateness).count()));
+        }
+
         switch(tmp.type)
         {
         case Tango::POLL_CMD:
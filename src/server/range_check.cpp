@@ -0,0 +1,415 @@
+#include <tango/internal/server/range_check.h>
+
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  #define TANGO_RANGE_CHECK_SSE2
+  #include <emmintrin.h>
+#endif
+
+// The AVX2 kernels are compiled with the target attribute, without changing the flags of the whole library. MSVC
+// has no equivalent and uses the SSE2 kernels.
+#if defined(TANGO_RANGE_CHECK_SSE2) && (defined(__GNUC__) || defined(__clang__))
+  #define TANGO_RANGE_CHECK_AVX2
+  #define TANGO_TARGET_AVX2 __attribute__((target("avx2")))
+  #include <immintrin.h>
+#endif
+
+namespace Tango::detail
+{
+
+namespace
+{
+
+// Number of vectors tested before checking if one element is out of range
+constexpr std::size_t UNROLL = 4;
+
+#if defined(TANGO_RANGE_CHECK_SSE2)
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// SSE2 kernels
+//
+// Each kernel returns a mask with all the bits of an element set if the element is out of range
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+__m128i sse2_all_ones_if(bool cond)
+{
+    return _mm_set1_epi32(cond ? -1 : 0);
+}
+
+template <bool Inclusive>
+struct Sse2Double
+{
+    static constexpr std::size_t WIDTH = 2;
+
+    explicit Sse2Double(const RangeCheck<DevDouble> &check) :
+        low(_mm_set1_pd(check.low)),
+        high(_mm_set1_pd(check.high)),
+        sign(_mm_set1_pd(-0.0)),
+        max(_mm_set1_pd(std::numeric_limits<DevDouble>::max())),
+        low_on(_mm_castsi128_pd(sse2_all_ones_if(check.check_low))),
+        high_on(_mm_castsi128_pd(sse2_all_ones_if(check.check_high))),
+        finite_on(_mm_castsi128_pd(sse2_all_ones_if(check.check_finite)))
+    {
+    }
+
+    __m128i test(const DevDouble *data) const
+    {
+        __m128d val = _mm_loadu_pd(data);
+        __m128d below;
+        __m128d above;
+        if constexpr(Inclusive)
+        {
+            below = _mm_cmple_pd(val, low);
+            above = _mm_cmpge_pd(val, high);
+        }
+        else
+        {
+            below = _mm_cmplt_pd(val, low);
+            above = _mm_cmpgt_pd(val, high);
+        }
+        // |val| > max is true for the infinite values and, being an unordered comparison, for NaN
+        __m128d not_finite = _mm_cmpnle_pd(_mm_andnot_pd(sign, val), max);
+
+        __m128d result = _mm_or_pd(_mm_and_pd(below, low_on), _mm_and_pd(above, high_on));
+        return _mm_castpd_si128(_mm_or_pd(result, _mm_and_pd(not_finite, finite_on)));
+    }
+
+    __m128d low;
+    __m128d high;
+    __m128d sign;
+    __m128d max;
+    __m128d low_on;
+    __m128d high_on;
+    __m128d finite_on;
+};
+
+// a > b for signed 64 bits integers: SSE2 only compares 32 bits integers. The high halves are compared as signed
+// integers and, when they are equal, the low halves as unsigned ones (by flipping their sign bit)
+__m128i sse2_cmpgt_epi64(__m128i a, __m128i b)
+{
+    const __m128i low_sign = _mm_set_epi32(0, static_cast<int>(0x80000000u), 0, static_cast<int>(0x80000000u));
+    a = _mm_xor_si128(a, low_sign);
+    b = _mm_xor_si128(b, low_sign);
+
+    __m128i gt = _mm_cmpgt_epi32(a, b);
+    __m128i eq = _mm_cmpeq_epi32(a, b);
+    __m128i gt_low = _mm_shuffle_epi32(gt, _MM_SHUFFLE(2, 2, 0, 0));
+    __m128i gt_high = _mm_shuffle_epi32(gt, _MM_SHUFFLE(3, 3, 1, 1));
+    __m128i eq_high = _mm_shuffle_epi32(eq, _MM_SHUFFLE(3, 3, 1, 1));
+    return _mm_or_si128(gt_high, _mm_and_si128(eq_high, gt_low));
+}
+
+// The unsigned values are compared as signed ones after flipping their sign bit
+template <typename T>
+__m128i sse2_bias()
+{
+    if constexpr(std::is_unsigned_v<T>)
+    {
+        return _mm_set_epi32(static_cast<int>(0x80000000u), 0, static_cast<int>(0x80000000u), 0);
+    }
+    else
+    {
+        return _mm_setzero_si128();
+    }
+}
+
+template <typename T, bool Inclusive>
+struct Sse2Int64
+{
+    static constexpr std::size_t WIDTH = 2;
+
+    explicit Sse2Int64(const RangeCheck<T> &check) :
+        bias(sse2_bias<T>()),
+        low(_mm_xor_si128(_mm_set_epi64x(static_cast<long long>(check.low), static_cast<long long>(check.low)),
+                          bias)),
+        high(_mm_xor_si128(_mm_set_epi64x(static_cast<long long>(check.high), static_cast<long long>(check.high)),
+                           bias)),
+        low_on(sse2_all_ones_if(check.check_low)),
+        high_on(sse2_all_ones_if(check.check_high))
+    {
+    }
+
+    __m128i test(const T *data) const
+    {
+        __m128i val = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data)), bias);
+        if constexpr(Inclusive)
+        {
+            // val <= low is !(val > low), val >= high is !(high > val)
+            return _mm_or_si128(_mm_andnot_si128(sse2_cmpgt_epi64(val, low), low_on),
+                                _mm_andnot_si128(sse2_cmpgt_epi64(high, val), high_on));
+        }
+        else
+        {
+            return _mm_or_si128(_mm_and_si128(sse2_cmpgt_epi64(low, val), low_on),
+                                _mm_and_si128(sse2_cmpgt_epi64(val, high), high_on));
+        }
+    }
+
+    __m128i bias;
+    __m128i low;
+    __m128i high;
+    __m128i low_on;
+    __m128i high_on;
+};
+
+template <typename Kernel, typename T>
+std::size_t sse2_find(const T *data, std::size_t nb, const RangeCheck<T> &check)
+{
+    const Kernel kernel(check);
+    constexpr std::size_t step = UNROLL * Kernel::WIDTH;
+
+    std::size_t i = 0;
+    for(; i + step <= nb; i += step)
+    {
+        __m128i found = kernel.test(data + i);
+        for(std::size_t j = 1; j < UNROLL; ++j)
+        {
+            found = _mm_or_si128(found, kernel.test(data + i + j * Kernel::WIDTH));
+        }
+
+        if(_mm_movemask_epi8(found) != 0)
+        {
+            break;
+        }
+    }
+
+    // The block holding the first element out of range and the remaining elements
+    return i + find_first_if(data + i, nb - i, check);
+}
+
+#endif // TANGO_RANGE_CHECK_SSE2
+
+#if defined(TANGO_RANGE_CHECK_AVX2)
+
+//+------------------------------------------------------------------------------------------------------------------
+//
+// AVX2 kernels
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+TANGO_TARGET_AVX2 __m256i avx2_all_ones_if(bool cond)
+{
+    return _mm256_set1_epi32(cond ? -1 : 0);
+}
+
+template <bool Inclusive>
+struct Avx2Double
+{
+    static constexpr std::size_t WIDTH = 4;
+
+    TANGO_TARGET_AVX2 explicit Avx2Double(const RangeCheck<DevDouble> &check) :
+        low(_mm256_set1_pd(check.low)),
+        high(_mm256_set1_pd(check.high)),
+        sign(_mm256_set1_pd(-0.0)),
+        max(_mm256_set1_pd(std::numeric_limits<DevDouble>::max())),
+        low_on(_mm256_castsi256_pd(avx2_all_ones_if(check.check_low))),
+        high_on(_mm256_castsi256_pd(avx2_all_ones_if(check.check_high))),
+        finite_on(_mm256_castsi256_pd(avx2_all_ones_if(check.check_finite)))
+    {
+    }
+
+    TANGO_TARGET_AVX2 __m256i test(const DevDouble *data) const
+    {
+        __m256d val = _mm256_loadu_pd(data);
+        __m256d below;
+        __m256d above;
+        if constexpr(Inclusive)
+        {
+            below = _mm256_cmp_pd(val, low, _CMP_LE_OQ);
+            above = _mm256_cmp_pd(val, high, _CMP_GE_OQ);
+        }
+        else
+        {
+            below = _mm256_cmp_pd(val, low, _CMP_LT_OQ);
+            above = _mm256_cmp_pd(val, high, _CMP_GT_OQ);
+        }
+        __m256d not_finite = _mm256_cmp_pd(_mm256_andnot_pd(sign, val), max, _CMP_NLE_UQ);
+
+        __m256d result = _mm256_or_pd(_mm256_and_pd(below, low_on), _mm256_and_pd(above, high_on));
+        return _mm256_castpd_si256(_mm256_or_pd(result, _mm256_and_pd(not_finite, finite_on)));
+    }
+
+    __m256d low;
+    __m256d high;
+    __m256d sign;
+    __m256d max;
+    __m256d low_on;
+    __m256d high_on;
+    __m256d finite_on;
+};
+
+template <typename T>
+TANGO_TARGET_AVX2 __m256i avx2_bias()
+{
+    if constexpr(std::is_unsigned_v<T>)
+    {
+        return _mm256_set1_epi64x(std::numeric_limits<long long>::min());
+    }
+    else
+    {
+        return _mm256_setzero_si256();
+    }
+}
+
+template <typename T, bool Inclusive>
+struct Avx2Int64
+{
+    static constexpr std::size_t WIDTH = 4;
+
+    TANGO_TARGET_AVX2 explicit Avx2Int64(const RangeCheck<T> &check) :
+        bias(avx2_bias<T>()),
+        low(_mm256_xor_si256(_mm256_set1_epi64x(static_cast<long long>(check.low)), bias)),
+        high(_mm256_xor_si256(_mm256_set1_epi64x(static_cast<long long>(check.high)), bias)),
+        low_on(avx2_all_ones_if(check.check_low)),
+        high_on(avx2_all_ones_if(check.check_high))
+    {
+    }
+
+    TANGO_TARGET_AVX2 __m256i test(const T *data) const
+    {
+        __m256i val = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(data)), bias);
+        if constexpr(Inclusive)
+        {
+            return _mm256_or_si256(_mm256_andnot_si256(_mm256_cmpgt_epi64(val, low), low_on),
+                                   _mm256_andnot_si256(_mm256_cmpgt_epi64(high, val), high_on));
+        }
+        else
+        {
+            return _mm256_or_si256(_mm256_and_si256(_mm256_cmpgt_epi64(low, val), low_on),
+                                   _mm256_and_si256(_mm256_cmpgt_epi64(val, high), high_on));
+        }
+    }
+
+    __m256i bias;
+    __m256i low;
+    __m256i high;
+    __m256i low_on;
+    __m256i high_on;
+};
+
+template <typename Kernel, typename T>
+TANGO_TARGET_AVX2 std::size_t avx2_find(const T *data, std::size_t nb, const RangeCheck<T> &check)
+{
+    const Kernel kernel(check);
+    constexpr std::size_t step = UNROLL * Kernel::WIDTH;
+
+    std::size_t i = 0;
+    for(; i + step <= nb; i += step)
+    {
+        __m256i found = kernel.test(data + i);
+        for(std::size_t j = 1; j < UNROLL; ++j)
+        {
+            found = _mm256_or_si256(found, kernel.test(data + i + j * Kernel::WIDTH));
+        }
+
+        if(_mm256_movemask_epi8(found) != 0)
+        {
+            break;
+        }
+    }
+
+    return i + find_first_if(data + i, nb - i, check);
+}
+
+#endif // TANGO_RANGE_CHECK_AVX2
+
+RangeCheckKernel detect_kernel()
+{
+#if defined(TANGO_RANGE_CHECK_AVX2)
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2"))
+    {
+        return RangeCheckKernel::AVX2;
+    }
+#endif
+#if defined(TANGO_RANGE_CHECK_SSE2)
+    return RangeCheckKernel::SSE2;
+#else
+    return RangeCheckKernel::SCALAR;
+#endif
+}
+
+template <template <bool> class Sse2Kernel, template <bool> class Avx2Kernel, typename T>
+std::size_t dispatch(const T *data, std::size_t nb, const RangeCheck<T> &check, RangeCheckKernel kernel)
+{
+    switch(kernel)
+    {
+#if defined(TANGO_RANGE_CHECK_AVX2)
+    case RangeCheckKernel::AVX2:
+        return check.inclusive ? avx2_find<Avx2Kernel<true>>(data, nb, check)
+                               : avx2_find<Avx2Kernel<false>>(data, nb, check);
+#endif
+#if defined(TANGO_RANGE_CHECK_SSE2)
+    case RangeCheckKernel::SSE2:
+        return check.inclusive ? sse2_find<Sse2Kernel<true>>(data, nb, check)
+                               : sse2_find<Sse2Kernel<false>>(data, nb, check);
+#endif
+    default:
+        return find_first_if(data, nb, check);
+    }
+}
+
+#if defined(TANGO_RANGE_CHECK_SSE2)
+template <bool Inclusive>
+using Sse2Long64 = Sse2Int64<DevLong64, Inclusive>;
+template <bool Inclusive>
+using Sse2ULong64 = Sse2Int64<DevULong64, Inclusive>;
+#else
+template <bool Inclusive>
+struct Sse2Double;
+template <bool Inclusive>
+struct Sse2Long64;
+template <bool Inclusive>
+struct Sse2ULong64;
+#endif
+
+#if defined(TANGO_RANGE_CHECK_AVX2)
+template <bool Inclusive>
+using Avx2Long64 = Avx2Int64<DevLong64, Inclusive>;
+template <bool Inclusive>
+using Avx2ULong64 = Avx2Int64<DevULong64, Inclusive>;
+#else
+template <bool Inclusive>
+struct Avx2Double;
+template <bool Inclusive>
+struct Avx2Long64;
+template <bool Inclusive>
+struct Avx2ULong64;
+#endif
+
+} // namespace
+
+RangeCheckKernel range_check_kernel()
+{
+    static const RangeCheckKernel kernel = detect_kernel();
+    return kernel;
+}
+
+std::size_t find_first_out_of_range(const DevDouble *data,
+                                    std::size_t nb,
+                                    const RangeCheck<DevDouble> &check,
+                                    RangeCheckKernel kernel)
+{
+    return dispatch<Sse2Double, Avx2Double>(data, nb, check, kernel);
+}
+
+std::size_t find_first_out_of_range(const DevLong64 *data,
+                                    std::size_t nb,
+                                    const RangeCheck<DevLong64> &check,
+                                    RangeCheckKernel kernel)
+{
+    return dispatch<Sse2Long64, Avx2Long64>(data, nb, check, kernel);
+}
+
+std::size_t find_first_out_of_range(const DevULong64 *data,
+                                    std::size_t nb,
+                                    const RangeCheck<DevULong64> &check,
+                                    RangeCheckKernel kernel)
+{
+    return dispatch<Sse2ULong64, Avx2ULong64>(data, nb, check, kernel);
+}
+
+} // namespace Tango::detail
@@ -0,0 +1,75 @@
+#include <tango/internal/server/read_plan.h>
+
+#include <cstring>
+
+namespace Tango::detail
+{
+
+bool ReadPlanCache::same_names(const std::vector<std::string> &cached, const DevVarStringArray &names)
+{
+    if(cached.size() != names.length())
+    {
+        return false;
+    }
+
+    for(std::size_t i = 0; i < cached.size(); ++i)
+    {
+        if(std::strcmp(cached[i].c_str(), names[i]) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::shared_ptr<const ReadPlan> ReadPlanCache::get(const DevVarStringArray &names, std::uint64_t generation)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if(generation != plans_generation)
+    {
+        entries.clear();
+        plans_generation = generation;
+        return nullptr;
+    }
+
+    for(auto ite = entries.begin(); ite != entries.end(); ++ite)
+    {
+        if(same_names(ite->names, names))
+        {
+            entries.splice(entries.begin(), entries, ite);
+            return entries.front().plan;
+        }
+    }
+
+    return nullptr;
+}
+
+void ReadPlanCache::put(const DevVarStringArray &names,
+                        std::uint64_t generation,
+                        std::shared_ptr<const ReadPlan> plan)
+{
+    Entry entry;
+    entry.names.reserve(names.length());
+    for(CORBA::ULong i = 0; i < names.length(); ++i)
+    {
+        entry.names.emplace_back(names[i]);
+    }
+    entry.plan = std::move(plan);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if(generation != plans_generation)
+    {
+        entries.clear();
+        plans_generation = generation;
+    }
+
+    entries.push_front(std::move(entry));
+    if(entries.size() > static_cast<std::size_t>(READ_PLAN_CACHE_SIZE))
+    {
+        entries.pop_back();
+    }
+}
+
+} // namespace Tango::detail
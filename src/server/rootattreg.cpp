@@ -37,7 +37,9 @@
 #include <tango/server/fwdattribute.h>
 #include <tango/server/dserver.h>
 #include <tango/client/event.h>
+#include <tango/client/eventconsumer.h>
 #include <tango/client/Database.h>
+#include <tango/internal/attr_read_cache.h>
 
 namespace Tango
 {
@@ -303,6 +305,17 @@ void RootAttRegistry::RootAttUserCallBack::push_event(Tango::EventData *ev)
 
             if(ptr != nullptr || zmq_mess_ptr != nullptr)
             {
+                //
+                // Feed the client attribute cache with the root attribute value (used to read forwarded attributes
+                // when a maximum age is defined). This has to be done before forwarding the event which consumes the
+                // ZMQ message
+                //
+
+                if(zmq_mess_ptr != nullptr && Util::instance()->get_fwd_att_max_age().count() != 0)
+                {
+                    store_root_value(ev, *zmq_mess_ptr, ev_fwd->get_zmq_endian());
+                }
+
                 //
                 // Now, forward the event
                 //
@@ -328,6 +341,54 @@ void RootAttRegistry::RootAttUserCallBack::push_event(Tango::EventData *ev)
     }
 }
 
+//--------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        RootAttRegistry::RootAttUserCallBack::store_root_value
+//
+// description :
+//        Store the root attribute value received with a change, periodic, archive or alarm event in the client
+//        attribute cache
+//
+// argument :
+//        in :
+//            - ev : The event data
+//            - event_data : The ZMQ message with the root attribute value
+//            - endian : The byte order of the root device server
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+void RootAttRegistry::RootAttUserCallBack::store_root_value(Tango::EventData *ev,
+                                                            const zmq::message_t &event_data,
+                                                            unsigned char endian)
+{
+    if(ev->event != EventName[CHANGE_EVENT] && ev->event != EventName[PERIODIC_EVENT] &&
+       ev->event != EventName[ARCHIVE_EVENT] && ev->event != EventName[ALARM_EVENT])
+    {
+        return;
+    }
+
+    auto &cache = detail::AttributeReadCache::instance();
+    if(!cache.is_enabled() || ev->device == nullptr)
+    {
+        return;
+    }
+
+    std::string root_att_name = ev->attr_name;
+    std::string::size_type pos = root_att_name.find(MODIFIER_DBASE_NO);
+    if(pos != std::string::npos)
+    {
+        root_att_name.erase(pos);
+    }
+    root_att_name = root_att_name.substr(root_att_name.rfind('/') + 1);
+
+    DeviceAttribute da;
+    if(EventConsumer::fwd_event_to_device(event_data, endian, da))
+    {
+        cache.store_from_event(detail::AttributeReadCache::make_key(ev->device, root_att_name), da);
+    }
+}
+
 void RootAttRegistry::RootAttUserCallBack::push_event(Tango::DataReadyEventData *ev)
 {
     try
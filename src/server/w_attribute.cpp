@@ -46,6 +46,7 @@
 #include <tango/server/seqvec.h>
 #include <tango/client/Database.h>
 #include <tango/internal/server/attribute_utils.h>
+#include <tango/internal/server/range_check.h>
 
 #include <cmath>
 
@@ -220,16 +221,17 @@ void check_enum<Tango::DevShort>(Tango::WAttribute &attr,
     if(data_type == Tango::DEV_ENUM)
     {
         std::size_t max_val = enum_labels.size();
-        for(std::size_t i = 0; i < nb_data; i++)
+        std::size_t i = Tango::detail::find_first_if(
+            seq.get_buffer(),
+            nb_data,
+            [max_val](Tango::DevShort val) { return (val < 0) | (static_cast<std::size_t>(val) >= max_val); });
+        if(i < nb_data)
         {
-            if(seq[i] < 0 || static_cast<std::size_t>(seq[i]) >= max_val)
-            {
-                std::stringstream o;
-                o << "Set value for attribute " << name << " is negative or above the maximun authorized (" << max_val
-                  << ") for at least element " << i;
+            std::stringstream o;
+            o << "Set value for attribute " << name << " is negative or above the maximun authorized (" << max_val
+              << ") for at least element " << i;
 
-                TANGO_THROW_EXCEPTION(Tango::API_WAttrOutsideLimit, o.str());
-            }
+            TANGO_THROW_EXCEPTION(Tango::API_WAttrOutsideLimit, o.str());
         }
     }
 }
@@ -310,7 +312,15 @@ void check_data_limits(Tango::WAttribute &attr,
 
     if(check_for_nan || check_min_value || check_max_value)
     {
-        for(size_t i = 0; i < nb_data; ++i)
+        //
+        // Search for the first invalid element (the write limits are not inclusive)
+        //
+
+        Tango::detail::RangeCheck<T> invalid{min_value, max_value, check_min_value, check_max_value};
+        invalid.check_finite = check_for_nan;
+
+        size_t i = Tango::detail::find_first_out_of_range(seq.get_buffer(), nb_data, invalid);
+        if(i < nb_data)
         {
             if(check_for_nan)
             {
@@ -374,10 +384,14 @@ void check_data_limits<Tango::DevEncoded>(Tango::WAttribute &attr,
 
     if(check_min_value || check_max_value)
     {
+        auto invalid = [&](Tango::DevUChar val)
+        { return (check_min_value & (val < min_value)) | (check_max_value & (val > max_value)); };
+
         for(size_t i = 0; i < nb_data; ++i)
         {
             size_t nb_data_elt = seq[i].encoded_data.length();
-            for(size_t j = 0; j < nb_data_elt; ++j)
+            size_t j = Tango::detail::find_first_if(seq[i].encoded_data.get_buffer(), nb_data_elt, invalid);
+            if(j < nb_data_elt)
             {
                 if(check_min_value)
                 {
@@ -31,6 +31,8 @@
 //+==================================================================================================================
 
 #include <tango/internal/net.h>
+#include <tango/internal/event_delta.h>
+#include <tango/internal/shm_ring.h>
 #include <tango/internal/utils.h>
 #include <tango/server/eventsupplier.h>
 #include <tango/server/pipe.h>
@@ -41,6 +43,7 @@
 
 #include <omniORB4/internal/giopStream.h>
 #include <tango/internal/perf_mon.h>
+#include <tango/internal/metrics.h>
 
 #include <iterator>
 #include <future>
@@ -62,6 +65,14 @@ namespace Tango
 // Environment variables for ZMQ publish ports - Event and Heartbeat
 static const char *TangoEventPortEnvVar = "TANGO_ZMQ_EVENT_PORT";
 static const char *TangoHeartbeatPortEnvVar = "TANGO_ZMQ_HEARTBEAT_PORT";
+// Environment variable enabling the ipc transport for clients running on the same host
+static const char *TangoLocalIpcEnvVar = "TANGO_ZMQ_LOCAL_IPC";
+// Environment variables enabling the shm transport for clients running on the same host and sizing its ring
+static const char *TangoShmTransportEnvVar = "TANGO_SHM_TRANSPORT";
+static const char *TangoShmSlotsEnvVar = "TANGO_SHM_TRANSPORT_SLOTS";
+static const char *TangoShmSlotSizeEnvVar = "TANGO_SHM_TRANSPORT_SLOT_SIZE";
+static const size_t DefaultShmSlots = 8;
+static const size_t DefaultShmSlotSize = 1024 * 1024;
 // check and use environment variables for zmq ports
 static void get_zmq_port_from_envvar(const char *, std::string &);
 
@@ -216,6 +227,16 @@ ZmqEventSupplier::ZmqEventSupplier(Util *tg) :
 
     auto port_str = detail::get_port_from_endpoint(heartbeat_endpoint);
 
+    //
+    // Also bind the socket to a local ipc endpoint if it is requested
+    //
+
+    if(detail::get_boolean_env_var(TangoLocalIpcEnvVar, false))
+    {
+        detail::remove_stale_local_ipc_files();
+        local_ipc = bind_local_ipc(heartbeat_pub_sock, port_str);
+    }
+
     //
     // If needed, replace * by host IP address in endpoint string
     //
@@ -336,6 +357,15 @@ ZmqEventSupplier::ZmqEventSupplier(Util *tg) :
 
     heartbeat_event_name = heartbeat_event_name + ".heartbeat";
     std::transform(heartbeat_event_name.begin(), heartbeat_event_name.end(), heartbeat_event_name.begin(), ::tolower);
+
+    //
+    // Create the ring of the shm transport if it is requested
+    //
+
+    if(detail::get_boolean_env_var(TangoShmTransportEnvVar, false))
+    {
+        create_shm_ring();
+    }
 }
 
 ZmqEventSupplier *ZmqEventSupplier::create(Util *tg)
@@ -392,6 +422,17 @@ ZmqEventSupplier::~ZmqEventSupplier()
             delete ite->second.pub_socket;
         }
     }
+
+    //
+    // Remove the files of the ipc endpoints (the ring of the shm transport removes its segment)
+    //
+
+#ifndef _TG_WINDOWS_
+    for(const auto &file : local_ipc_files)
+    {
+        ::unlink(file.c_str());
+    }
+#endif
 }
 
 //+-------------------------------------------------------------------------------------------------------------------
@@ -443,6 +484,210 @@ void ZmqEventSupplier::tango_bind(zmq::socket_t *sock, std::string &endpoint)
     }
 }
 
+//+-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        ZmqEventSupplier::bind_local_ipc()
+//
+// description :
+//        Bind a ZMQ socket to the ipc endpoint used by the clients running on the same host. The ipc endpoint is
+//        built from the process pid and the port of the tcp endpoint the socket is already bound to, in the ipc
+//        directory of the user (see detail::get_local_ipc_dir()). A failure is not fatal, the clients then use the
+//        tcp endpoint
+//
+// argument :
+//        in :
+//        - sock : The ZMQ socket
+//      - port : The port of the socket tcp endpoint
+//
+// return :
+//        True if the socket has been bound to the ipc endpoint
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+bool ZmqEventSupplier::bind_local_ipc(TANGO_UNUSED(zmq::socket_t *sock), TANGO_UNUSED(const std::string &port))
+{
+#ifdef _TG_WINDOWS_
+    return false;
+#else
+    std::string endpoint = detail::get_local_ipc_endpoint(getpid(), port);
+    if(endpoint.empty())
+    {
+        TANGO_LOG_DEBUG << "No private directory for the ZMQ ipc endpoints (XDG_RUNTIME_DIR or /tmp/tango-<uid>)"
+                        << std::endl;
+        return false;
+    }
+
+    //
+    // A file with the same name was left by a crashed process which had the same pid
+    //
+
+    std::string file = endpoint.substr(endpoint.find("://") + 3);
+    ::unlink(file.c_str());
+
+    try
+    {
+        sock->bind(endpoint);
+    }
+    catch(const zmq::error_t &ex)
+    {
+        TANGO_LOG_DEBUG << "Cannot bind to ZMQ endpoint " << endpoint << ": " << ex.what() << std::endl;
+        return false;
+    }
+
+    local_ipc_files.push_back(file);
+    return true;
+#endif
+}
+
+//+-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        ZmqEventSupplier::create_shm_ring()
+//
+// description :
+//        Create the shared memory ring of the shm transport. The segments left by crashed device servers are removed
+//        first. A failure is not fatal, the clients then use the network transport
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+void ZmqEventSupplier::create_shm_ring()
+{
+    size_t nb_slots = DefaultShmSlots;
+    size_t slot_size = DefaultShmSlotSize;
+
+    std::string var;
+    if(ApiUtil::get_env_var(TangoShmSlotsEnvVar, var) == 0)
+    {
+        std::istringstream iss(var);
+        size_t nb;
+        iss >> nb;
+        if(iss)
+        {
+            nb_slots = nb;
+        }
+    }
+
+    if(ApiUtil::get_env_var(TangoShmSlotSizeEnvVar, var) == 0)
+    {
+        std::istringstream iss(var);
+        size_t size;
+        iss >> size;
+        if(iss)
+        {
+            slot_size = size;
+        }
+    }
+
+    detail::remove_stale_shm_rings();
+
+    try
+    {
+        shm_ring = std::make_unique<detail::ShmRingWriter>(detail::get_shm_ring_name(getpid()), nb_slots, slot_size);
+    }
+    catch(DevFailed &e)
+    {
+        TANGO_LOG_DEBUG << "The shm transport is disabled: " << e.errors[0].desc << std::endl;
+    }
+}
+
+//+-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        ZmqEventSupplier::set_shm_subscription()
+//
+// description :
+//        Record that a client running on this host subscribed to an event through the shm transport. The event is
+//        then also sent through the shm transport until the subscription is not confirmed for
+//        EVENT_RESUBSCRIBE_PERIOD
+//
+// argument :
+//        in :
+//        - ev_name : The full event name (without the shm prefix)
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+void ZmqEventSupplier::set_shm_subscription(const std::string &ev_name)
+{
+    std::lock_guard<std::mutex> lock(shm_mutex);
+    shm_subscriptions[ev_name] = Tango::get_current_system_datetime();
+}
+
+bool ZmqEventSupplier::is_shm_subscribed(const std::string &ev_name)
+{
+    std::lock_guard<std::mutex> lock(shm_mutex);
+
+    auto ite = shm_subscriptions.find(ev_name);
+    if(ite == shm_subscriptions.end())
+    {
+        return false;
+    }
+
+    if(Tango::get_current_system_datetime() - ite->second >= EVENT_RESUBSCRIBE_PERIOD)
+    {
+        shm_subscriptions.erase(ite);
+        return false;
+    }
+
+    return true;
+}
+
+//+-------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        ZmqEventSupplier::push_shm_event()
+//
+// description :
+//        Send the event being pushed through the shm transport. The event data are copied into the ring and only
+//        their location is sent, on the event name with the shm prefix (the clients get the ring name with the
+//        QueryShmTransport command when they subscribe). The endian message then has a second byte set to 1. If the
+//        data do not fit in a slot of the ring (or if the shm transport is not enabled, for a client subscribing
+//        again after a restart of the device server), they are sent in the message as usual and the second byte is
+//        set to 0.
+//
+// argument :
+//        in :
+//        - event_call_mess : The event call message (copied)
+//        - data : The marshalled event data
+//        - size : The event data size
+//
+//-------------------------------------------------------------------------------------------------------------------
+
+void ZmqEventSupplier::push_shm_event(zmq::message_t &event_call_mess, const char *data, size_t size)
+{
+    std::string shm_event_name = detail::add_shm_prefix(event_name);
+    zmq::message_t name_mess(shm_event_name.data(), shm_event_name.size());
+
+    unsigned char endian[2] = {host_endian, 0};
+    zmq::message_t call_mess;
+    call_mess.copy(event_call_mess);
+    zmq::message_t data_mess;
+
+    std::optional<detail::ShmRingRef> ref;
+    if(shm_ring != nullptr)
+    {
+        ref = shm_ring->publish(data, size);
+    }
+
+    if(ref)
+    {
+        endian[1] = 1;
+        std::uint32_t words[detail::SHM_RING_REF_WORDS];
+        detail::shm_ring_ref_to_words(*ref, words);
+        data_mess.rebuild(words, sizeof(words));
+    }
+    else
+    {
+        data_mess.rebuild(data, size);
+    }
+    zmq::message_t endian_mess(endian, sizeof(endian));
+
+    event_pub_sock->send(name_mess, zmq::send_flags::sndmore);
+    event_pub_sock->send(endian_mess, zmq::send_flags::sndmore);
+    event_pub_sock->send(call_mess, zmq::send_flags::sndmore);
+    event_pub_sock->send(data_mess, zmq::send_flags::none);
+}
+
 //+------------------------------------------------------------------------------------------------------------------
 //
 // method :
@@ -554,6 +799,11 @@ void ZmqEventSupplier::create_event_socket()
         //
         auto port_str = detail::get_port_from_endpoint(event_endpoint);
 
+        if(local_ipc)
+        {
+            local_ipc = bind_local_ipc(event_pub_sock, port_str);
+        }
+
         if(!ip_specified)
         {
             event_endpoint.replace(6, 1, host_ip);
@@ -865,10 +1115,52 @@ struct PerfMonSample
     }
 };
 
-DoubleBuffer<PerfMonSample> g_perf_mon;
+SampleCollector<PerfMonSample> g_perf_mon;
+
+// Date of the last event sampled, in PerfClock ticks since its epoch - 0 if none
+std::atomic<PerfClock::rep> g_last_event_timestamp{0};
 
-// Must hold g_perf_mon.lock to access
-PerfClock::time_point g_last_event_timestamp;
+// Return the counter of the events pushed for the event type (without IDL prefix)
+detail::Counter &events_pushed_counter(const std::string &event_type)
+{
+    static const auto counters = []()
+    {
+        std::array<detail::Counter *, numEventType> result{};
+        for(std::size_t i = 0; i < result.size(); ++i)
+        {
+            result[i] = &detail::MetricsRegistry::instance().counter(detail::METRIC_EVENTS_PUSHED,
+                                                                     {{"event", EventName[i]}});
+        }
+        return result;
+    }();
+
+    for(std::size_t i = 0; i < counters.size(); ++i)
+    {
+        if(event_type == EventName[i])
+        {
+            return *counters[i];
+        }
+    }
+    return detail::MetricsRegistry::instance().counter(detail::METRIC_EVENTS_PUSHED, {{"event", event_type}});
+}
+
+detail::Counter &events_marshalled()
+{
+    static auto &counter = detail::MetricsRegistry::instance().counter(detail::METRIC_EVENTS_MARSHALLED);
+    return counter;
+}
+
+detail::Counter &events_marshalling_saved()
+{
+    static auto &counter = detail::MetricsRegistry::instance().counter(detail::METRIC_EVENTS_MARSHALLING_SAVED);
+    return counter;
+}
+
+detail::Counter &events_marshalling_saved_bytes()
+{
+    static auto &counter = detail::MetricsRegistry::instance().counter(detail::METRIC_EVENTS_MARSHALLING_SAVED_BYTES);
+    return counter;
+}
 } // namespace
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -924,6 +1216,10 @@ void ZmqEventSupplier::query_event_system(std::ostream &os)
 
 void ZmqEventSupplier::enable_perf_mon(Tango::DevBoolean enabled)
 {
+    if(enabled)
+    {
+        g_last_event_timestamp.store(0);
+    }
     g_perf_mon.enable(enabled);
 }
 
@@ -1094,6 +1390,172 @@ void ZmqEventSupplier::push_heartbeat_event()
     }
 }
 
+//--------------------------------------------------------------------------------------------------------------------
+//
+// method :
+//        ZmqEventSupplier::marshal_event_data()
+//
+// description :
+//        Marshal the event data (preceded by two padding words) in a CDR stream
+//
+// argument :
+//        in :
+//            - cdr : The stream, rewound before marshalling
+//            - ev_value : The event data
+//            - except : The exception to send instead of the data. nullptr if no exception
+//
+// return :
+//        True if the data is large enough to be sent with a ZMQ no-copy message
+//
+//--------------------------------------------------------------------------------------------------------------------
+
+bool ZmqEventSupplier::marshal_event_data(TangoCdrMemoryStream &cdr,
+                                          const struct SuppliedEventData &ev_value,
+                                          DevFailed *except)
+{
+    bool large_data = false;
+
+    CORBA::ULong padding = 0XDEC0DEC0UL;
+    cdr.rewindPtrs();
+
+    padding >>= cdr;
+    padding >>= cdr;
+
+    if(except == nullptr)
+    {
+        if(ev_value.attr_val != nullptr)
+        {
+            *(ev_value.attr_val) >>= cdr;
+        }
+        else if(ev_value.attr_val_3 != nullptr)
+        {
+            *(ev_value.attr_val_3) >>= cdr;
+        }
+        else if(ev_value.attr_val_4 != nullptr)
+        {
+            //
+            // Get number of data exchanged by this event. If this value is greater than a threshold, set a flag
+            // In such a case, we will use ZMQ no-copy message call
+            //
+
+            *(ev_value.attr_val_4) >>= cdr;
+
+            char *mess_ptr = (char *) cdr.bufPtr() + (sizeof(CORBA::Long) << 1);
+
+            int nb_data;
+            int data_discr = ((int *) mess_ptr)[0];
+
+            if(data_discr == ATT_ENCODED)
+            {
+                const DevVarEncodedArray &dvea = ev_value.attr_val_4->value.encoded_att_value();
+                nb_data = dvea.length();
+                if(nb_data > LARGE_DATA_THRESHOLD_ENCODED)
+                {
+                    large_data = true;
+                }
+            }
+            else if(data_discr == ATT_NO_DATA)
+            {
+                nb_data = 0;
+            }
+            else
+            {
+                nb_data = ((int *) mess_ptr)[1];
+                if(nb_data >= LARGE_DATA_THRESHOLD)
+                {
+                    large_data = true;
+                }
+            }
+        }
+        else if(ev_value.attr_val_5 != nullptr)
+        {
+            //
+            // Get number of data exchanged by this event. If this value is greater than a threshold, set a flag
+            // In such a case, we will use ZMQ no-copy message call
+            //
+
+            *(ev_value.attr_val_5) >>= cdr;
+
+            char *mess_ptr = (char *) cdr.bufPtr() + (sizeof(CORBA::Long) << 1);
+
+            int nb_data;
+            int data_discr = ((int *) mess_ptr)[0];
+
+            if(data_discr == ATT_ENCODED)
+            {
+                const DevVarEncodedArray &dvea = ev_value.attr_val_5->value.encoded_att_value();
+                nb_data = dvea.length();
+                if(nb_data > LARGE_DATA_THRESHOLD_ENCODED)
+                {
+                    large_data = true;
+                }
+            }
+            else if(data_discr == ATT_NO_DATA)
+            {
+                nb_data = 0;
+            }
+            else
+            {
+                nb_data = ((int *) mess_ptr)[1];
+                if(nb_data >= LARGE_DATA_THRESHOLD)
+                {
+                    large_data = true;
+                }
+            }
+
+            //
+            // For a delta encoded change event, the kind of value and the runs of changed elements follow
+            //
+
+            if(ev_value.delta_runs != nullptr)
+            {
+                ev_value.delta_kind >>= cdr;
+                *(ev_value.delta_runs) >>= cdr;
+            }
+        }
+        else if(ev_value.attr_conf_2 != nullptr)
+        {
+            *(ev_value.attr_conf_2) >>= cdr;
+        }
+        else if(ev_value.attr_conf_3 != nullptr)
+        {
+            *(ev_value.attr_conf_3) >>= cdr;
+        }
+        else if(ev_value.attr_conf_5 != nullptr)
+        {
+            *(ev_value.attr_conf_5) >>= cdr;
+        }
+        else if(ev_value.attr_dat_ready != nullptr)
+        {
+            *(ev_value.attr_dat_ready) >>= cdr;
+        }
+        else if(ev_value.pipe_val != nullptr)
+        {
+            //
+            // A pipe may transport many data elements of different types. Use the marshalled size to decide
+            // if it is a large message instead of walking the data element tree
+            //
+
+            *(ev_value.pipe_val) >>= cdr;
+
+            if(cdr.bufSize() > LARGE_DATA_THRESHOLD_ENCODED)
+            {
+                large_data = true;
+            }
+        }
+        else
+        {
+            *(ev_value.dev_intr_change) >>= cdr;
+        }
+    }
+    else
+    {
+        except->errors >>= cdr;
+    }
+
+    return large_data;
+}
+
 //+------------------------------------------------------------------------------------------------------------------
 //
 // method :
@@ -1145,23 +1607,19 @@ void ZmqEventSupplier::push_event(DeviceImpl *device_impl,
                                   bool inc_cptr)
 {
     PerfMonSample sample;
-    SamplePusher<PerfMonSample> pusher{false, sample, *g_perf_mon.front, g_perf_mon.lock};
+    SamplePusher<PerfMonSample> pusher{false, sample, g_perf_mon};
     TimeBlockMicros perf_mon;
-    if(g_perf_mon.lock.try_lock())
+    if(g_perf_mon.is_enabled())
     {
-        if(g_perf_mon.enabled)
-        {
-            perf_mon = TimeBlockMicros{true, &sample.push_event_micros};
-            pusher.enabled = true;
+        perf_mon = TimeBlockMicros{true, &sample.push_event_micros};
+        pusher.enabled = true;
 
-            if(g_last_event_timestamp != PerfClock::time_point{})
-            {
-                sample.micros_since_last_event = duration_micros(g_last_event_timestamp, perf_mon.start);
-            }
-            g_last_event_timestamp = perf_mon.start;
+        PerfClock::rep last = g_last_event_timestamp.exchange(perf_mon.start.time_since_epoch().count());
+        if(last != 0)
+        {
+            sample.micros_since_last_event =
+                duration_micros(PerfClock::time_point{PerfClock::duration{last}}, perf_mon.start);
         }
-
-        g_perf_mon.lock.unlock();
     }
 
     if(device_impl == nullptr)
@@ -1169,6 +1627,9 @@ void ZmqEventSupplier::push_event(DeviceImpl *device_impl,
         return;
     }
 
+    static auto &push_duration = detail::MetricsRegistry::instance().histogram(detail::METRIC_EVENT_PUSH_DURATION);
+    detail::HistogramTimer push_timer(push_duration);
+
     TANGO_LOG_DEBUG << "ZmqEventSupplier::push_event(): called for attribute/pipe " << obj_name << std::endl;
 
     //
@@ -1196,6 +1657,7 @@ void ZmqEventSupplier::push_event(DeviceImpl *device_impl,
     //
 
     std::string local_event_type = detail::remove_idl_prefix(event_type);
+    events_pushed_counter(local_event_type).add();
 
     bool intr_change = false;
     if(local_event_type == EventName[INTERFACE_CHANGE_EVENT])
@@ -1356,144 +1818,45 @@ void ZmqEventSupplier::push_event(DeviceImpl *device_impl,
     else
     {
         //
-        // Marshall the event data
+        // Marshall the event data. A value read by a poll cycle is marshalled by the first event pushed for it, the
+        // other events of the cycle reuse the marshalled data whatever their type or the sockets they are sent on
         //
 
-        CORBA::ULong padding = 0XDEC0DEC0UL;
-        data_call_cdr.rewindPtrs();
-
-        padding >>= data_call_cdr;
-        padding >>= data_call_cdr;
-
-        if(except == nullptr)
+        MarshalledValue *marshalled = nullptr;
+        if(ev_value.marshalled != nullptr && ev_value.marshalled->source == ev_value.attr_val_5 &&
+           ev_value.attr_val_5 != nullptr && ev_value.delta_runs == nullptr && except == nullptr)
         {
-            if(ev_value.attr_val != nullptr)
-            {
-                *(ev_value.attr_val) >>= data_call_cdr;
-            }
-            else if(ev_value.attr_val_3 != nullptr)
-            {
-                *(ev_value.attr_val_3) >>= data_call_cdr;
-            }
-            else if(ev_value.attr_val_4 != nullptr)
-            {
-                //
-                // Get number of data exchanged by this event. If this value is greater than a threshold, set a flag
-                // In such a case, we will use ZMQ no-copy message call
-                //
-
-                *(ev_value.attr_val_4) >>= data_call_cdr;
-
-                mess_ptr = data_call_cdr.bufPtr();
-                mess_ptr = (char *) mess_ptr + (sizeof(CORBA::Long) << 1);
-
-                int nb_data;
-                int data_discr = ((int *) mess_ptr)[0];
-
-                if(data_discr == ATT_ENCODED)
-                {
-                    const DevVarEncodedArray &dvea = ev_value.attr_val_4->value.encoded_att_value();
-                    nb_data = dvea.length();
-                    if(nb_data > LARGE_DATA_THRESHOLD_ENCODED)
-                    {
-                        large_data = true;
-                    }
-                }
-                else if(data_discr == ATT_NO_DATA)
-                {
-                    nb_data = 0;
-                }
-                else
-                {
-                    nb_data = ((int *) mess_ptr)[1];
-                    if(nb_data >= LARGE_DATA_THRESHOLD)
-                    {
-                        large_data = true;
-                    }
-                }
-            }
-            else if(ev_value.attr_val_5 != nullptr)
-            {
-                //
-                // Get number of data exchanged by this event. If this value is greater than a threshold, set a flag
-                // In such a case, we will use ZMQ no-copy message call
-                //
-
-                *(ev_value.attr_val_5) >>= data_call_cdr;
-
-                mess_ptr = data_call_cdr.bufPtr();
-                mess_ptr = (char *) mess_ptr + (sizeof(CORBA::Long) << 1);
-
-                int nb_data;
-                int data_discr = ((int *) mess_ptr)[0];
+            marshalled = ev_value.marshalled;
+        }
 
-                if(data_discr == ATT_ENCODED)
-                {
-                    const DevVarEncodedArray &dvea = ev_value.attr_val_5->value.encoded_att_value();
-                    nb_data = dvea.length();
-                    if(nb_data > LARGE_DATA_THRESHOLD_ENCODED)
-                    {
-                        large_data = true;
-                    }
-                }
-                else if(data_discr == ATT_NO_DATA)
-                {
-                    nb_data = 0;
-                }
-                else
-                {
-                    nb_data = ((int *) mess_ptr)[1];
-                    if(nb_data >= LARGE_DATA_THRESHOLD)
-                    {
-                        large_data = true;
-                    }
-                }
-            }
-            else if(ev_value.attr_conf_2 != nullptr)
-            {
-                *(ev_value.attr_conf_2) >>= data_call_cdr;
-            }
-            else if(ev_value.attr_conf_3 != nullptr)
-            {
-                *(ev_value.attr_conf_3) >>= data_call_cdr;
-            }
-            else if(ev_value.attr_conf_5 != nullptr)
-            {
-                *(ev_value.attr_conf_5) >>= data_call_cdr;
-            }
-            else if(ev_value.attr_dat_ready != nullptr)
-            {
-                *(ev_value.attr_dat_ready) >>= data_call_cdr;
-            }
-            else if(ev_value.pipe_val != nullptr)
-            {
-                size_t nb_data = get_blob_data_nb(ev_value.pipe_val->data_blob.blob_data);
-                if(nb_data >= LARGE_DATA_THRESHOLD)
-                {
-                    large_data = true;
-                }
+        TangoCdrMemoryStream &cdr = marshalled != nullptr ? marshalled->cdr : data_call_cdr;
 
-                *(ev_value.pipe_val) >>= data_call_cdr;
-            }
-            else
-            {
-                *(ev_value.dev_intr_change) >>= data_call_cdr;
-            }
+        if(marshalled != nullptr && marshalled->done)
+        {
+            large_data = marshalled->large_data;
+            events_marshalling_saved().add();
+            events_marshalling_saved_bytes().add(cdr.bufSize());
         }
         else
         {
-            except->errors >>= data_call_cdr;
+            large_data = marshal_event_data(cdr, ev_value, except);
+            events_marshalled().add();
+            if(marshalled != nullptr)
+            {
+                marshalled->done = true;
+                marshalled->large_data = large_data;
+            }
         }
 
         if(!pipe_event)
         {
-            mess_size = data_call_cdr.bufSize() - sizeof(CORBA::Long);
-            mess_ptr = (char *) data_call_cdr.bufPtr() + sizeof(CORBA::Long);
+            mess_size = cdr.bufSize() - sizeof(CORBA::Long);
+            mess_ptr = (char *) cdr.bufPtr() + sizeof(CORBA::Long);
         }
         else
         {
-            mess_size = data_call_cdr.bufSize();
-            mess_ptr = (char *) data_call_cdr.bufPtr();
+            mess_size = cdr.bufSize();
+            mess_ptr = (char *) cdr.bufPtr();
         }
 
         //
@@ -1614,6 +1977,16 @@ void ZmqEventSupplier::push_event(DeviceImpl *device_impl,
             }
         }
 
+        //
+        // Also send the event through the shm transport when a client running on this host asked for it. This is done
+        // before the regular send which may release the data
+        //
+
+        if(!mcast_event && !pipe_event && is_shm_subscribed(event_name))
+        {
+            push_shm_event(event_call_mess, static_cast<const char *>(mess_ptr), mess_size);
+        }
+
         //
         // If we have a multicast socket with also a local client we are obliged to send two times the messages.
         // ZMQ does not support local client with PGM socket
@@ -1961,173 +2334,116 @@ void ZmqEventSupplier::push_event_loop(DeviceImpl *device_impl,
             ev_name = EventName[event_type];
         }
     }
-}
 
-//+------------------------------------------------------------------------------------------------------------------
-//
-// method :
-//        ZmqEventSupplier::get_blob_data_elt()
-//
-// description :
-//        Get how many data are transferred in the blob given as parameter. For instance, for a blob transporting
-//        one array of 1000 double, the returned value will be 1000
-//
-// argument :
-//        in :
-//            - dvpdea : The sequence of data element in the blob
-//
-// return :
-//        Size (in number of data) of the data blob
-//
-//-------------------------------------------------------------------------------------------------------------------
-
-size_t ZmqEventSupplier::get_blob_data_nb(DevVarPipeDataEltArray &dvpdea)
-{
-    size_t ret = 0;
-
-    size_t nb_blob = dvpdea.length();
-    for(size_t loop = 0; loop < nb_blob; loop++)
+    if(event_type == CHANGE_EVENT)
     {
-        ret = ret + get_data_elt_data_nb(dvpdea[loop]);
+        push_change_delta_event(device_impl, attr_value, att, except);
     }
-
-    return ret;
 }
 
-//+------------------------------------------------------------------------------------------------------------------
+//+-------------------------------------------------------------------------------------------------------------------
 //
 // method :
-//        ZmqEventSupplier::get_data_elt_data_nb()
+//        ZmqEventSupplier::push_change_delta_event()
 //
 // description :
-//        Get how many data are transferred in the data element given as parameter. For instance, for a data element
-//        transporting one array of 250 floats, the returned value will be 250
+//        Push the delta encoded change event of an attribute. Only the elements which changed since the previous
+//        event are sent (see detail::EventDeltaEncoder). Nothing is done if no client subscribed to this event.
 //
 // argument :
 //        in :
-//            - dvde : The data element
-//
-// return :
-//        Size (in number of data) of the data element
+//            - device_impl : Pointer to device
+//            - attr_value : The attribute value
+//            - attr : The attribute object
+//            - except : The exception thrown during the last attribute reading. nullptr if no exception
 //
-//-------------------------------------------------------------------------------------------------------------------
+//--------------------------------------------------------------------------------------------------------------------
 
-size_t ZmqEventSupplier::get_data_elt_data_nb(DevPipeDataElt &dvde)
+void ZmqEventSupplier::push_change_delta_event(DeviceImpl *device_impl,
+                                               const struct SuppliedEventData &attr_value,
+                                               Attribute &attr,
+                                               DevFailed *except)
 {
-    size_t ret = 0;
-
-    if(dvde.inner_blob.length() != 0)
+    detail::EventDeltaEncoder &encoder = attr.get_change_delta_encoder();
+    if(!encoder.is_subscribed())
     {
-        ret = get_blob_data_nb(dvde.inner_blob);
+        return;
     }
-    else
-    {
-        switch(dvde.value._d())
-        {
-        case ATT_BOOL:
-        {
-            const DevVarBooleanArray &dvba = dvde.value.bool_att_value();
-            ret = dvba.length();
-        }
-        break;
 
-        case ATT_SHORT:
-        {
-            const DevVarShortArray &dvsa = dvde.value.short_att_value();
-            ret = dvsa.length();
-        }
-        break;
-
-        case ATT_LONG:
-        {
-            const DevVarLongArray &dvla = dvde.value.long_att_value();
-            ret = dvla.length();
-        }
-        break;
-
-        case ATT_LONG64:
-        {
-            const DevVarLong64Array &dvlo64 = dvde.value.long64_att_value();
-            ret = dvlo64.length();
-        }
-        break;
-
-        case ATT_FLOAT:
-        {
-            const DevVarFloatArray &dvfa = dvde.value.float_att_value();
-            ret = dvfa.length();
-        }
-        break;
-
-        case ATT_DOUBLE:
-        {
-            const DevVarDoubleArray &dvda = dvde.value.double_att_value();
-            ret = dvda.length();
-        }
-        break;
+    std::lock_guard<std::mutex> lock(encoder.get_mutex());
 
-        case ATT_UCHAR:
-        {
-            const DevVarCharArray &dvda = dvde.value.uchar_att_value();
-            ret = dvda.length();
-        }
-        break;
+    bool need_free = false;
+    struct SuppliedEventData sent_value;
+    ::memset(&sent_value, 0, sizeof(sent_value));
 
-        case ATT_USHORT:
-        {
-            const DevVarUShortArray &dvda = dvde.value.ushort_att_value();
-            ret = dvda.length();
-        }
-        break;
+    AttributeValue_5 delta_value;
+    DevVarULongArray runs;
 
-        case ATT_ULONG:
+    if(except == nullptr)
+    {
+        convert_att_event_to_5(attr_value, sent_value, need_free, attr);
+        if(sent_value.attr_val_5 == nullptr)
         {
-            const DevVarULongArray &dvda = dvde.value.ulong_att_value();
-            ret = dvda.length();
+            return;
         }
-        break;
 
-        case ATT_ULONG64:
-        {
-            const DevVarULong64Array &dvda = dvde.value.ulong64_att_value();
-            ret = dvda.length();
-        }
-        break;
+        AttrValUnion changed;
+        detail::EventDeltaKind kind = encoder.encode(*sent_value.attr_val_5, changed, runs);
 
-        case ATT_STRING:
+        if(kind == detail::EventDeltaKind::DELTA)
         {
-            const DevVarStringArray &dvda = dvde.value.string_att_value();
-            ret = dvda.length();
-        }
-        break;
+            const AttributeValue_5 &full_value = *sent_value.attr_val_5;
 
-        case ATT_STATE:
-        {
-            const DevVarStateArray &dvda = dvde.value.state_att_value();
-            ret = dvda.length();
-        }
-        break;
+            delta_value.quality = full_value.quality;
+            delta_value.data_format = full_value.data_format;
+            delta_value.data_type = full_value.data_type;
+            delta_value.time = full_value.time;
+            delta_value.name = full_value.name;
+            delta_value.r_dim = full_value.r_dim;
+            delta_value.w_dim = full_value.w_dim;
+            delta_value.err_list = full_value.err_list;
+            delta_value.value = changed;
 
-        case ATT_ENCODED:
-        {
-            const DevVarEncodedArray &dvda = dvde.value.encoded_att_value();
-            ret = dvda[0].encoded_data.length();
+            if(need_free)
+            {
+                delete sent_value.attr_val_5;
+                need_free = false;
+            }
+            sent_value.attr_val_5 = &delta_value;
         }
-        break;
 
-        case DEVICE_STATE:
-            [[fallthrough]];
-        case ATT_NO_DATA:
-            TANGO_THROW_EXCEPTION(API_PipeWrongArg,
-                                  "Unsupported data type in data element! (ATT_NO_DATA, DEVICE_STATE)");
-            break;
+        sent_value.delta_runs = &runs;
+        sent_value.delta_kind = static_cast<CORBA::ULong>(kind);
+    }
+    else
+    {
+        //
+        // Error events do not carry any value. Send a full value with the next event
+        //
 
-        default:
-            TANGO_ASSERT_ON_DEFAULT(dvde.value._d());
-        }
+        encoder.reset();
     }
 
-    return ret;
+    std::vector<std::string> filterable_names;
+    std::vector<double> filterable_data;
+    std::vector<std::string> filterable_names_lg;
+    std::vector<long> filterable_data_lg;
+
+    push_event(device_impl,
+               detail::add_delta_prefix(detail::add_idl_prefix(EventName[CHANGE_EVENT])),
+               filterable_names,
+               filterable_data,
+               filterable_names_lg,
+               filterable_data_lg,
+               sent_value,
+               attr.get_name_lower(),
+               except,
+               true);
+
+    if(need_free)
+    {
+        delete sent_value.attr_val_5;
+    }
 }
 
 } // namespace Tango
@@ -26,6 +26,12 @@ using command_factory_t = decltype(T::command_factory);
 template <typename T>
 constexpr bool has_command_factory = Tango::detail::is_detected_v<command_factory_t, T>;
 
+template <typename T>
+using pipe_factory_t = decltype(T::pipe_factory);
+
+template <typename T>
+constexpr bool has_pipe_factory = Tango::detail::is_detected_v<pipe_factory_t, T>;
+
 template <typename F>
 struct member_fn_traits;
 
@@ -53,6 +59,7 @@ struct member_fn_traits<R (C::*)(Args... args)>
  *
  *   - static void attribute_factory(std::vector<Tango::Attr *> &attrs);
  *   - static void command_factory(std::vector<Tango::Command *> &cmds)
+ *   - static void pipe_factory(std::vector<Tango::Pipe *> &pipes)
  *
  * Use the TANGO_TEST_AUTO_DEV_CLASS_INSTANTIATE macro (in a single
  * implementation file per Device) to instantiate AutoDeviceClass's static
@@ -164,6 +171,14 @@ class AutoDeviceClass : public Tango::DeviceClass
         }
     }
 
+    void pipe_factory() override
+    {
+        if constexpr(detail::has_pipe_factory<Device>)
+        {
+            Device::pipe_factory(pipe_list);
+        }
+    }
+
     static AutoDeviceClass *_instance;
 };
 
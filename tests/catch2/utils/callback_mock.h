@@ -32,6 +32,8 @@ class CallbackMock<Tango::AttrReadEvent, AttrReadEventCopyable>
     : public CallbackMockBase<Tango::AttrReadEvent, AttrReadEventCopyable>
 {
   public:
+    using CallbackMockBase<Tango::AttrReadEvent, AttrReadEventCopyable>::pop_next_event;
+
     void attr_read(Tango::AttrReadEvent *event) override
     {
         collect_event(AttrReadEventCopyable(event));
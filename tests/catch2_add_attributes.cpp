@@ -0,0 +1,250 @@
+#include "catch2_common.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cstdlib>
+
+namespace
+{
+
+constexpr Tango::DevLong k_nb_dyn_attr = 100;
+constexpr int k_nb_startup_attr = 2000;
+
+std::string dyn_attr_name(int index)
+{
+    return "dyn_" + std::to_string(index);
+}
+
+using CallbackMockType = TangoTest::CallbackMock<Tango::DevIntrChangeEventData>;
+
+} // anonymous namespace
+
+template <class Base>
+class AddAttributesDev : public Base
+{
+  public:
+    using Base::Base;
+
+    ~AddAttributesDev() override { }
+
+    // Attributes created at startup, used by the benchmark
+    void init_device() override
+    {
+        const char *nb = std::getenv("ADD_ATTRIBUTES_STARTUP_NB");
+        if(nb == nullptr)
+        {
+            return;
+        }
+
+        bool batched = std::getenv("ADD_ATTRIBUTES_STARTUP_BATCHED") != nullptr;
+        std::vector<Tango::Attr *> attrs = make_attrs(std::stoi(nb), Tango::DEV_LONG);
+        if(batched)
+        {
+            Base::add_attributes(attrs);
+        }
+        else
+        {
+            for(auto *attr : attrs)
+            {
+                Base::add_attribute(attr);
+            }
+        }
+    }
+
+    void read_attribute(Tango::Attribute &att)
+    {
+        value = std::stol(att.get_name().substr(4));
+        att.set_value(&value);
+    }
+
+    void add_dyn_attrs(Tango::DevLong nb)
+    {
+        Base::add_attributes(make_attrs(nb, Tango::DEV_LONG));
+    }
+
+    // The second attribute is already defined with another data type
+    void add_conflicting_attrs()
+    {
+        std::vector<Tango::Attr *> attrs{
+            new TangoTest::AutoAttr<&AddAttributesDev::read_attribute>("new_attr", Tango::DEV_LONG),
+            new TangoTest::AutoAttr<&AddAttributesDev::read_attribute>(dyn_attr_name(0).c_str(), Tango::DEV_DOUBLE)};
+
+        try
+        {
+            Base::add_attributes(attrs);
+        }
+        catch(Tango::DevFailed &)
+        {
+            for(auto *attr : attrs)
+            {
+                delete attr;
+            }
+            throw;
+        }
+    }
+
+    // The same new attribute and the same already defined attribute are both given twice
+    void add_duplicated_attrs()
+    {
+        auto *new_attr = new TangoTest::AutoAttr<&AddAttributesDev::read_attribute>("dyn_999", Tango::DEV_LONG);
+        auto *defined_attr =
+            new TangoTest::AutoAttr<&AddAttributesDev::read_attribute>(dyn_attr_name(0).c_str(), Tango::DEV_LONG);
+
+        Base::add_attributes({new_attr, defined_attr, new_attr, defined_attr});
+    }
+
+    static void command_factory(std::vector<Tango::Command *> &cmds)
+    {
+        cmds.push_back(new TangoTest::AutoCommand<&AddAttributesDev::add_dyn_attrs>("add_dyn_attrs"));
+        cmds.push_back(new TangoTest::AutoCommand<&AddAttributesDev::add_conflicting_attrs>("add_conflicting_attrs"));
+        cmds.push_back(new TangoTest::AutoCommand<&AddAttributesDev::add_duplicated_attrs>("add_duplicated_attrs"));
+    }
+
+  private:
+    std::vector<Tango::Attr *> make_attrs(int nb, long type)
+    {
+        std::vector<Tango::Attr *> attrs;
+        for(int i = 0; i < nb; ++i)
+        {
+            attrs.push_back(
+                new TangoTest::AutoAttr<&AddAttributesDev::read_attribute>(dyn_attr_name(i).c_str(), type));
+        }
+        return attrs;
+    }
+
+    Tango::DevLong value;
+};
+
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(AddAttributesDev, 5)
+
+SCENARIO("Attributes can be added in one batch")
+{
+    int idlver = GENERATE(TangoTest::idlversion(Tango::MIN_IDL_DEV_INTR));
+    GIVEN("a device proxy to a simple IDLv" << idlver << " device")
+    {
+        TangoTest::Context ctx{"add_attributes", "AddAttributesDev", idlver};
+        std::shared_ptr<Tango::DeviceProxy> device = ctx.get_proxy();
+
+        REQUIRE(idlver == device->get_idl_version());
+
+        AND_GIVEN("a subscription to the interface change event")
+        {
+            CallbackMockType cb;
+            TangoTest::Subscription sub{device, Tango::INTERFACE_CHANGE_EVENT, &cb};
+
+            REQUIRE(cb.pop_next_event() != std::nullopt);
+
+            WHEN("we add " << k_nb_dyn_attr << " attributes at once")
+            {
+                Tango::DeviceData d_in;
+                d_in << k_nb_dyn_attr;
+                REQUIRE_NOTHROW(device->command_inout("add_dyn_attrs", d_in));
+
+                THEN("we get only one event with all the new attributes")
+                {
+                    using namespace TangoTest::Matchers;
+                    using namespace Catch::Matchers;
+
+                    auto event = cb.pop_next_event();
+                    REQUIRE(event != std::nullopt);
+                    REQUIRE_THAT(event, EventType(Tango::INTERFACE_CHANGE_EVENT));
+                    REQUIRE_THAT(event, EventAttributeNamesMatches(SizeIs(k_nb_dyn_attr + 2)));
+                    REQUIRE_THAT(event,
+                                 EventAttributeNamesMatches(AnyMatch(Equals(dyn_attr_name(k_nb_dyn_attr - 1)))));
+
+                    REQUIRE(cb.pop_next_event() == std::nullopt);
+
+                    AND_THEN("the new attributes can be read")
+                    {
+                        for(Tango::DevLong i : {Tango::DevLong{0}, k_nb_dyn_attr / 2, k_nb_dyn_attr - 1})
+                        {
+                            auto da = device->read_attribute(dyn_attr_name(i));
+                            Tango::DevLong value;
+                            da >> value;
+                            REQUIRE(value == i);
+                        }
+
+                        auto state = device->read_attribute("State");
+                        Tango::DevState dev_state;
+                        state >> dev_state;
+                        REQUIRE(dev_state == Tango::UNKNOWN);
+                    }
+                }
+
+                AND_WHEN("we add the same attributes again")
+                {
+                    REQUIRE_NOTHROW(device->command_inout("add_dyn_attrs", d_in));
+
+                    THEN("we get only the event of the first addition")
+                    {
+                        REQUIRE(cb.pop_next_event() != std::nullopt);
+                        REQUIRE(cb.pop_next_event() == std::nullopt);
+                    }
+                }
+
+                AND_WHEN("we add attributes where one conflicts with an existing one")
+                {
+                    using namespace TangoTest::Matchers;
+
+                    REQUIRE_THROWS_MATCHES(device->command_inout("add_conflicting_attrs"),
+                                           Tango::DevFailed,
+                                           FirstErrorMatches(Reason(Tango::API_AttrNotFound)));
+
+                    THEN("none of them is added")
+                    {
+                        REQUIRE_THROWS_AS(device->read_attribute("new_attr"), Tango::DevFailed);
+                    }
+                }
+
+                AND_WHEN("we add attributes given twice in the list")
+                {
+                    REQUIRE(cb.pop_next_event() != std::nullopt);
+
+                    REQUIRE_NOTHROW(device->command_inout("add_duplicated_attrs"));
+
+                    THEN("the new attribute is added once")
+                    {
+                        using namespace TangoTest::Matchers;
+                        using namespace Catch::Matchers;
+
+                        auto event = cb.pop_next_event();
+                        REQUIRE(event != std::nullopt);
+                        REQUIRE_THAT(event, EventAttributeNamesMatches(SizeIs(k_nb_dyn_attr + 3)));
+                        REQUIRE(cb.pop_next_event() == std::nullopt);
+
+                        auto da = device->read_attribute("dyn_999");
+                        Tango::DevLong value;
+                        da >> value;
+                        REQUIRE(value == 999);
+                    }
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Device startup time with dynamic attributes", "[.][benchmark]")
+{
+    int idlver = GENERATE(TangoTest::idlversion(6));
+    bool batched = GENERATE(false, true);
+    GIVEN("an IDLv" << idlver << " device adding " << k_nb_startup_attr << " attributes "
+                    << (batched ? "with add_attributes()" : "with add_attribute()"))
+    {
+        std::vector<std::string> env{"ADD_ATTRIBUTES_STARTUP_NB=" + std::to_string(k_nb_startup_attr)};
+        if(batched)
+        {
+            env.emplace_back("ADD_ATTRIBUTES_STARTUP_BATCHED=1");
+        }
+
+        BENCHMARK_ADVANCED("server startup")(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<std::unique_ptr<TangoTest::Context>> contexts(meter.runs());
+            meter.measure(
+                [&contexts, &env, idlver](int run)
+                {
+                    contexts[run] =
+                        std::make_unique<TangoTest::Context>("add_attributes", "AddAttributesDev", idlver, "", env);
+                });
+        };
+    }
+}
@@ -335,3 +335,102 @@ SCENARIO("Error in cmd done callback reported")
         check_callback_cerr_output(cap.str(), errorType);
     }
 }
+
+SCENARIO("Callbacks are fired by the executor threads in push sub-model")
+{
+    int idlver = GENERATE(TangoTest::idlversion(1));
+    size_t cb_thread_nb = GENERATE(0u, 1u, 3u);
+    GIVEN("a device proxy to a simple IDLv" << idlver << " device")
+    {
+        TangoTest::Context ctx{"attr_asyn", "AsyncAttrDev", idlver};
+        auto device = ctx.get_proxy();
+
+        REQUIRE(idlver == device->get_idl_version());
+
+        auto *au = Tango::ApiUtil::instance();
+        auto old_cb_thread_nb = au->get_asynch_cb_thread_nb();
+
+        AND_GIVEN("the push sub-model with " << cb_thread_nb << " callback thread(s)")
+        {
+            au->set_asynch_cb_thread_nb(cb_thread_nb);
+            au->set_asynch_cb_sub_model(Tango::PUSH_CALLBACK);
+
+            WHEN("we send several asynchronous reads")
+            {
+                constexpr size_t nb_req = 10;
+
+                AttrReadCallbackMockType callback;
+                for(size_t i = 0; i < nb_req; ++i)
+                {
+                    device->read_attribute_asynch("attr_asyn", callback);
+                }
+
+                THEN("all the callbacks are fired without polling")
+                {
+                    using namespace Catch::Matchers;
+                    using namespace TangoTest::Matchers;
+
+                    for(size_t i = 0; i < nb_req; ++i)
+                    {
+                        auto event = callback.pop_next_event([]() { });
+                        REQUIRE(event != std::nullopt);
+                        REQUIRE_THAT(
+                            event,
+                            EventValueMatches(AnyMatch(AnyLikeMatches(WithinAbs(ATTR_INIT_VALUE_DP, 0.0000001)))));
+                    }
+
+                    auto stats = au->get_asynch_cb_stats();
+                    if(cb_thread_nb == 0)
+                    {
+                        REQUIRE(stats.executed == 0);
+                    }
+                    else
+                    {
+                        REQUIRE(stats.executed >= nb_req);
+                        REQUIRE(stats.max_delay >= stats.mean_delay);
+                    }
+                }
+            }
+
+            WHEN("we send several asynchronous reads and ask for the replies at the same time")
+            {
+                constexpr size_t nb_req = 10;
+
+                AttrReadCallbackMockType callback;
+                for(size_t i = 0; i < nb_req; ++i)
+                {
+                    device->read_attribute_asynch("attr_asyn", callback);
+                }
+
+                THEN("each callback is fired once")
+                {
+                    auto poll = [au]() { au->get_asynch_replies(); };
+                    for(size_t i = 0; i < nb_req; ++i)
+                    {
+                        REQUIRE(callback.pop_next_event(poll) != std::nullopt);
+                    }
+
+                    poll();
+                    REQUIRE(callback.pop_next_event(std::chrono::milliseconds{300}) == std::nullopt);
+                }
+            }
+
+            WHEN("we go back to the pull sub-model and send an asynchronous read")
+            {
+                au->set_asynch_cb_sub_model(Tango::PULL_CALLBACK);
+
+                AttrReadCallbackMockType callback;
+                device->read_attribute_asynch("attr_asyn", callback);
+
+                THEN("the callback is only fired when the replies are asked for")
+                {
+                    REQUIRE(callback.pop_next_event(std::chrono::milliseconds{300}) == std::nullopt);
+                    REQUIRE(callback.pop_next_event([au]() { au->get_asynch_replies(); }) != std::nullopt);
+                }
+            }
+
+            au->set_asynch_cb_sub_model(Tango::PULL_CALLBACK);
+            au->set_asynch_cb_thread_nb(old_cb_thread_nb);
+        }
+    }
+}
@@ -1,5 +1,10 @@
 #include "catch2_common.h"
 
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
 constexpr static Tango::DevBoolean k_initial_value = false;
 constexpr static Tango::DevBoolean k_new_value = true;
 constexpr static Tango::DevLong k_polling_period = TANGO_TEST_CATCH2_DEFAULT_POLL_PERIOD;
@@ -387,3 +392,121 @@ SCENARIO("The attribute polling ring can be set")
         }
     }
 }
+
+SCENARIO("Polled attributes can be read from the polling cache")
+{
+    int idlver = GENERATE(TangoTest::idlversion(4));
+    GIVEN("a device proxy to a IDLv" << idlver << " device reading from the polling cache")
+    {
+        TangoTest::Context ctx{"attr_polling", "AttrPollingCfg", idlver};
+        auto device = ctx.get_proxy();
+        REQUIRE(idlver == device->get_idl_version());
+        device->set_source(Tango::CACHE);
+
+        // Wait for the first value to be stored in the polling ring
+        auto read_when_available = [&device](const std::string &attr)
+        {
+            for(int i = 0; i < 20; ++i)
+            {
+                try
+                {
+                    return device->read_attribute(attr);
+                }
+                catch(Tango::DevFailed &e)
+                {
+                    if(std::string(e.errors[0].reason.in()) != Tango::API_NoDataYet)
+                    {
+                        throw;
+                    }
+                }
+                std::this_thread::sleep_for(std::chrono::milliseconds(k_polling_period));
+            }
+            return device->read_attribute(attr);
+        };
+
+        WHEN("we read a polled attribute with a name using a different case")
+        {
+            THEN("the value is returned from the cache")
+            {
+                using namespace TangoTest::Matchers;
+
+                Tango::DeviceAttribute da = read_when_available("Server_Enabled_Polling");
+                REQUIRE_THAT(da, AnyLikeContains(k_initial_value));
+            }
+        }
+
+        WHEN("we read an attribute which is not polled")
+        {
+            THEN("the read fails")
+            {
+                using namespace TangoTest::Matchers;
+
+                REQUIRE_THROWS_MATCHES(device->read_attribute("client_enabled_polling"),
+                                       Tango::DevFailed,
+                                       FirstErrorMatches(Reason(Tango::API_AttrNotPolled)));
+            }
+        }
+
+        WHEN("we stop and restart the polling of an attribute")
+        {
+            REQUIRE_NOTHROW(device->stop_poll_attribute("server_enabled_polling"));
+            REQUIRE_NOTHROW(device->poll_attribute("SERVER_enabled_polling", k_polling_period));
+
+            THEN("the attribute can be read again from the cache")
+            {
+                using namespace TangoTest::Matchers;
+
+                REQUIRE(device->is_attribute_polled("server_enabled_polling"));
+                Tango::DeviceAttribute da = read_when_available("server_enabled_polling");
+                REQUIRE_THAT(da, AnyLikeContains(k_initial_value));
+            }
+        }
+
+        WHEN("several clients read the attribute from the cache while the polling thread updates it")
+        {
+            read_when_available("server_enabled_polling");
+
+            constexpr int k_nb_threads = 4;
+            constexpr int k_nb_reads = 200;
+            std::atomic<int> failures{0};
+
+            std::vector<std::thread> threads;
+            for(int th = 0; th < k_nb_threads; ++th)
+            {
+                threads.emplace_back(
+                    [&device, &failures]()
+                    {
+                        auto proxy = std::make_unique<Tango::DeviceProxy>(device->name());
+                        proxy->set_source(Tango::CACHE);
+                        for(int loop = 0; loop < k_nb_reads; ++loop)
+                        {
+                            try
+                            {
+                                Tango::DevBoolean value = !k_initial_value;
+                                Tango::DeviceAttribute da = proxy->read_attribute("server_enabled_polling");
+                                da >> value;
+                                if(value != k_initial_value)
+                                {
+                                    failures++;
+                                }
+                            }
+                            catch(Tango::DevFailed &)
+                            {
+                                failures++;
+                            }
+                        }
+                    });
+            }
+
+            for(auto &thread : threads)
+            {
+                thread.join();
+            }
+
+            THEN("all the reads return the polled value")
+            {
+                REQUIRE(failures == 0);
+            }
+        }
+    }
+}
@@ -0,0 +1,194 @@
+#include "catch2_common.h"
+
+#include <tango/internal/attr_read_cache.h>
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+
+constexpr Tango::DevLong k_init_value = 42;
+
+// RAII helper to enable the client attribute cache in one test
+struct CacheEnabler
+{
+    CacheEnabler()
+    {
+        Tango::ApiUtil::instance()->enable_attribute_read_cache(true);
+    }
+
+    ~CacheEnabler()
+    {
+        Tango::ApiUtil::instance()->enable_attribute_read_cache(false);
+    }
+};
+
+} // anonymous namespace
+
+template <class Base>
+class ReadCacheDev : public Base
+{
+  public:
+    using Base::Base;
+
+    ~ReadCacheDev() override { }
+
+    void init_device() override
+    {
+        value = k_init_value;
+    }
+
+    void read_counter(Tango::Attribute &att)
+    {
+        counter_value = ++read_nb;
+        att.set_value(&counter_value);
+    }
+
+    void read_slow(Tango::Attribute &att)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        slow_value = ++slow_read_nb;
+        att.set_value(&slow_value);
+    }
+
+    void read_value(Tango::Attribute &att)
+    {
+        att.set_value(&value);
+    }
+
+    void increment()
+    {
+        value++;
+    }
+
+    static void attribute_factory(std::vector<Tango::Attr *> &attrs)
+    {
+        attrs.push_back(new TangoTest::AutoAttr<&ReadCacheDev::read_counter>("counter", Tango::DEV_LONG));
+        attrs.push_back(new TangoTest::AutoAttr<&ReadCacheDev::read_slow>("slow", Tango::DEV_LONG));
+
+        auto *attr_value = new TangoTest::AutoAttr<&ReadCacheDev::read_value>("value", Tango::DEV_LONG);
+        Tango::UserDefaultAttrProp props;
+        props.set_event_abs_change("1");
+        attr_value->set_default_properties(props);
+        attr_value->set_polling_period(100);
+        attrs.push_back(attr_value);
+    }
+
+    static void command_factory(std::vector<Tango::Command *> &cmds)
+    {
+        cmds.push_back(new TangoTest::AutoCommand<&ReadCacheDev::increment>("increment"));
+    }
+
+  private:
+    Tango::DevLong counter_value;
+    Tango::DevLong slow_value;
+    Tango::DevLong value;
+    std::atomic<Tango::DevLong> read_nb{0};
+    std::atomic<Tango::DevLong> slow_read_nb{0};
+};
+
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(ReadCacheDev, 4)
+
+SCENARIO("Attribute reads can be served by the client attribute cache")
+{
+    int idlver = GENERATE(TangoTest::idlversion(4));
+    GIVEN("a device proxy to a simple IDLv" << idlver << " device")
+    {
+        TangoTest::Context ctx{"read_cache", "ReadCacheDev", idlver};
+        std::shared_ptr<Tango::DeviceProxy> device = ctx.get_proxy();
+
+        REQUIRE(idlver == device->get_idl_version());
+
+        WHEN("the cache is disabled")
+        {
+            Tango::DevLong first;
+            Tango::DevLong second;
+            device->read_attribute_cached("counter", std::chrono::seconds(60)) >> first;
+            device->read_attribute_cached("counter", std::chrono::seconds(60)) >> second;
+
+            THEN("every read reaches the device")
+            {
+                REQUIRE(second == first + 1);
+            }
+        }
+
+        WHEN("the cache is enabled")
+        {
+            CacheEnabler enabler;
+
+            Tango::DevLong first;
+            device->read_attribute_cached("counter", std::chrono::seconds(60)) >> first;
+
+            THEN("a read within the max age returns the cached value")
+            {
+                Tango::DevLong second;
+                device->read_attribute_cached("Counter", std::chrono::seconds(60)) >> second;
+                REQUIRE(second == first);
+
+                std::unique_ptr<std::vector<Tango::DeviceAttribute>> values(
+                    device->read_attributes_cached({"counter", "value"}, std::chrono::seconds(60)));
+                Tango::DevLong third;
+                (*values)[0] >> third;
+                REQUIRE(third == first);
+            }
+
+            THEN("a read with a zero max age reaches the device")
+            {
+                Tango::DevLong second;
+                device->read_attribute_cached("counter", std::chrono::milliseconds(0)) >> second;
+                REQUIRE(second == first + 1);
+            }
+        }
+
+        WHEN("several threads read the same attribute at the same time")
+        {
+            CacheEnabler enabler;
+
+            constexpr size_t nb_threads = 4;
+            std::vector<Tango::DevLong> results(nb_threads);
+            std::vector<std::thread> threads;
+            for(size_t i = 0; i < nb_threads; ++i)
+            {
+                threads.emplace_back(
+                    [&device, &results, i]()
+                    { device->read_attribute_cached("slow", std::chrono::milliseconds(0)) >> results[i]; });
+            }
+            for(auto &th : threads)
+            {
+                th.join();
+            }
+
+            THEN("all the threads get the same value")
+            {
+                for(auto result : results)
+                {
+                    REQUIRE(result == results[0]);
+                }
+            }
+        }
+
+        WHEN("a change event is subscribed with the cache enabled")
+        {
+            CacheEnabler enabler;
+
+            TangoTest::CallbackMock<Tango::EventData> callback;
+            TangoTest::Subscription sub{device, "value", Tango::CHANGE_EVENT, &callback};
+            require_initial_events(callback, k_init_value);
+
+            auto updates = Tango::detail::AttributeReadCache::instance().get_stats().event_updates;
+
+            device->command_inout("increment");
+            REQUIRE(callback.pop_next_event() != std::nullopt);
+
+            THEN("the cache is updated by the events")
+            {
+                REQUIRE(Tango::detail::AttributeReadCache::instance().get_stats().event_updates > updates);
+
+                Tango::DevLong cached;
+                device->read_attribute_cached("value", std::chrono::seconds(60)) >> cached;
+                REQUIRE(cached == k_init_value + 1);
+            }
+        }
+    }
+}
@@ -0,0 +1,156 @@
+#include "catch2_common.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+
+constexpr auto k_read_duration = std::chrono::milliseconds(300);
+
+} // anonymous namespace
+
+template <class Base>
+class ReadLockingDev : public Base
+{
+  public:
+    using Base::Base;
+
+    ~ReadLockingDev() override { }
+
+    void init_device() override { }
+
+    void read_slow(Tango::Attribute &att)
+    {
+        int concurrent = ++nb_in_read;
+        int max = max_in_read.load();
+        while(concurrent > max && !max_in_read.compare_exchange_weak(max, concurrent))
+        {
+        }
+
+        std::this_thread::sleep_for(k_read_duration);
+        --nb_in_read;
+
+        att.set_value(&value);
+    }
+
+    void enable_locking(Tango::DevBoolean on)
+    {
+        Base::set_attribute_read_locking(on);
+    }
+
+    void group_attributes()
+    {
+        Base::set_attribute_lock_group("slow_1", "slow");
+        Base::set_attribute_lock_group("slow_2", "slow");
+    }
+
+    Tango::DevLong get_max_concurrent_reads()
+    {
+        return max_in_read.load();
+    }
+
+    static void attribute_factory(std::vector<Tango::Attr *> &attrs)
+    {
+        attrs.push_back(new TangoTest::AutoAttr<&ReadLockingDev::read_slow>("slow_1", Tango::DEV_LONG));
+        attrs.push_back(new TangoTest::AutoAttr<&ReadLockingDev::read_slow>("slow_2", Tango::DEV_LONG));
+    }
+
+    static void command_factory(std::vector<Tango::Command *> &cmds)
+    {
+        cmds.push_back(new TangoTest::AutoCommand<&ReadLockingDev::enable_locking>("enable_locking"));
+        cmds.push_back(new TangoTest::AutoCommand<&ReadLockingDev::group_attributes>("group_attributes"));
+        cmds.push_back(
+            new TangoTest::AutoCommand<&ReadLockingDev::get_max_concurrent_reads>("get_max_concurrent_reads"));
+    }
+
+  private:
+    Tango::DevLong value{1};
+    std::atomic<int> nb_in_read{0};
+    std::atomic<int> max_in_read{0};
+};
+
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(ReadLockingDev, 3)
+
+namespace
+{
+
+// Read slow_1 and slow_2 at the same time from two threads
+void read_in_parallel(const std::shared_ptr<Tango::DeviceProxy> &device)
+{
+    std::thread other([&device]() { device->read_attribute("slow_2"); });
+    device->read_attribute("slow_1");
+    other.join();
+}
+
+Tango::DevLong max_concurrent_reads(const std::shared_ptr<Tango::DeviceProxy> &device)
+{
+    Tango::DevLong max;
+    Tango::DeviceData dd = device->command_inout("get_max_concurrent_reads");
+    dd >> max;
+    return max;
+}
+
+} // anonymous namespace
+
+SCENARIO("Attributes can be read in parallel with the attribute read locking model")
+{
+    int idlver = GENERATE(TangoTest::idlversion(3));
+    GIVEN("a device proxy to an IDLv" << idlver << " device with two slow attributes")
+    {
+        TangoTest::Context ctx{"read_locking", "ReadLockingDev", idlver};
+        std::shared_ptr<Tango::DeviceProxy> device = ctx.get_proxy();
+
+        WHEN("the two attributes are read at the same time with the default model")
+        {
+            read_in_parallel(device);
+
+            THEN("the reads are serialized")
+            {
+                REQUIRE(max_concurrent_reads(device) == 1);
+            }
+        }
+
+        WHEN("the attribute read locking model is enabled")
+        {
+            Tango::DeviceData din;
+            din << true;
+            device->command_inout("enable_locking", din);
+
+            AND_WHEN("the two attributes are read at the same time")
+            {
+                read_in_parallel(device);
+
+                THEN("the reads are executed in parallel")
+                {
+                    REQUIRE(max_concurrent_reads(device) == 2);
+                }
+            }
+
+            AND_WHEN("the two attributes of the same lock group are read at the same time")
+            {
+                device->command_inout("group_attributes");
+                read_in_parallel(device);
+
+                THEN("the reads are serialized")
+                {
+                    REQUIRE(max_concurrent_reads(device) == 1);
+                }
+            }
+
+            AND_WHEN("an attribute and the State are read at the same time")
+            {
+                std::thread other([&device]() { device->read_attribute("slow_2"); });
+                std::unique_ptr<std::vector<Tango::DeviceAttribute>> values(
+                    device->read_attributes({"slow_1", "State"}));
+                other.join();
+
+                THEN("the reads are serialized")
+                {
+                    REQUIRE(max_concurrent_reads(device) == 1);
+                }
+            }
+        }
+    }
+}
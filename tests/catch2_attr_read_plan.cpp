@@ -0,0 +1,181 @@
+#include "catch2_common.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <map>
+
+namespace
+{
+
+constexpr int k_nb_attr = 200;
+constexpr Tango::DevLong k_dyn_a_value = -1;
+constexpr Tango::DevLong k_dyn_b_value = -2;
+
+std::vector<std::string> attr_names(int nb)
+{
+    std::vector<std::string> names;
+    for(int i = 0; i < nb; ++i)
+    {
+        names.push_back("attr_" + std::to_string(i));
+    }
+    return names;
+}
+
+} // anonymous namespace
+
+template <class Base>
+class ReadPlanDev : public Base
+{
+  public:
+    using Base::Base;
+
+    ~ReadPlanDev() override { }
+
+    void init_device() override { }
+
+    void read_attribute(Tango::Attribute &att)
+    {
+        const std::string &name = att.get_name();
+        Tango::DevLong &value = values[name];
+
+        if(name == "dyn_a")
+        {
+            value = k_dyn_a_value;
+        }
+        else if(name == "dyn_b")
+        {
+            value = k_dyn_b_value;
+        }
+        else
+        {
+            value = std::stol(name.substr(5));
+        }
+
+        att.set_value(&value);
+    }
+
+    void add_dyn_attrs()
+    {
+        Base::add_attribute(new TangoTest::AutoAttr<&ReadPlanDev::read_attribute>("dyn_a", Tango::DEV_LONG));
+        Base::add_attribute(new TangoTest::AutoAttr<&ReadPlanDev::read_attribute>("dyn_b", Tango::DEV_LONG));
+    }
+
+    void remove_dyn_a()
+    {
+        Base::remove_attribute("dyn_a", true, false);
+    }
+
+    static void attribute_factory(std::vector<Tango::Attr *> &attrs)
+    {
+        for(const auto &name : attr_names(k_nb_attr))
+        {
+            attrs.push_back(new TangoTest::AutoAttr<&ReadPlanDev::read_attribute>(name.c_str(), Tango::DEV_LONG));
+        }
+    }
+
+    static void command_factory(std::vector<Tango::Command *> &cmds)
+    {
+        cmds.push_back(new TangoTest::AutoCommand<&ReadPlanDev::add_dyn_attrs>("add_dyn_attrs"));
+        cmds.push_back(new TangoTest::AutoCommand<&ReadPlanDev::remove_dyn_a>("remove_dyn_a"));
+    }
+
+  private:
+    std::map<std::string, Tango::DevLong> values;
+};
+
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(ReadPlanDev, 3)
+
+SCENARIO("Repeated read_attributes calls return the requested attributes")
+{
+    int idlver = GENERATE(TangoTest::idlversion(3));
+    GIVEN("a device proxy to a simple IDLv" << idlver << " device")
+    {
+        TangoTest::Context ctx{"read_plan", "ReadPlanDev", idlver};
+        std::shared_ptr<Tango::DeviceProxy> device = ctx.get_proxy();
+
+        REQUIRE(idlver == device->get_idl_version());
+
+        WHEN("we read the same attribute list twice")
+        {
+            std::vector<std::string> names{"attr_7", "State", "attr_3", "Status"};
+
+            std::unique_ptr<std::vector<Tango::DeviceAttribute>> first(device->read_attributes(names));
+            std::unique_ptr<std::vector<Tango::DeviceAttribute>> second(device->read_attributes(names));
+
+            THEN("both replies hold the values of the requested attributes")
+            {
+                for(auto *values : {first.get(), second.get()})
+                {
+                    REQUIRE(values->size() == names.size());
+
+                    Tango::DevLong value;
+                    (*values)[0] >> value;
+                    REQUIRE(value == 7);
+                    (*values)[2] >> value;
+                    REQUIRE(value == 3);
+
+                    Tango::DevState state;
+                    (*values)[1] >> state;
+                    REQUIRE(state == Tango::UNKNOWN);
+                }
+            }
+        }
+
+        WHEN("we read twice a list with an unknown attribute")
+        {
+            std::vector<std::string> names{"attr_1", "unknown_attr"};
+
+            std::unique_ptr<std::vector<Tango::DeviceAttribute>> first(device->read_attributes(names));
+            std::unique_ptr<std::vector<Tango::DeviceAttribute>> second(device->read_attributes(names));
+
+            THEN("the unknown attribute is reported as failed in both replies")
+            {
+                for(auto *values : {first.get(), second.get()})
+                {
+                    REQUIRE(!(*values)[0].has_failed());
+                    REQUIRE((*values)[1].has_failed());
+                }
+            }
+        }
+
+        WHEN("an attribute is removed after a read of a dynamic attribute")
+        {
+            device->command_inout("add_dyn_attrs");
+
+            std::vector<std::string> names{"dyn_b", "attr_2"};
+            std::unique_ptr<std::vector<Tango::DeviceAttribute>> values(device->read_attributes(names));
+            Tango::DevLong value;
+            (*values)[0] >> value;
+            REQUIRE(value == k_dyn_b_value);
+
+            device->command_inout("remove_dyn_a");
+
+            THEN("the same list still returns the requested attributes")
+            {
+                values.reset(device->read_attributes(names));
+                (*values)[0] >> value;
+                REQUIRE(value == k_dyn_b_value);
+                (*values)[1] >> value;
+                REQUIRE(value == 2);
+            }
+        }
+    }
+}
+
+SCENARIO("Reading many attributes with the same name list", "[.][benchmark]")
+{
+    int idlver = GENERATE(TangoTest::idlversion(6));
+    GIVEN("an IDLv" << idlver << " device with " << k_nb_attr << " attributes")
+    {
+        TangoTest::Context ctx{"read_plan", "ReadPlanDev", idlver};
+        std::shared_ptr<Tango::DeviceProxy> device = ctx.get_proxy();
+
+        std::vector<std::string> names = attr_names(k_nb_attr);
+
+        BENCHMARK("read_attributes() of all the attributes")
+        {
+            std::unique_ptr<std::vector<Tango::DeviceAttribute>> values(device->read_attributes(names));
+            return values->size();
+        };
+    }
+}
@@ -0,0 +1,206 @@
+#include "catch2_common.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace
+{
+using CallbackMockType = TangoTest::CallbackMock<Tango::EventData>;
+
+constexpr Tango::DevLong k_value = 1234;
+constexpr int k_nb_attr = 20;
+
+// Unsubscribe all the successful subscriptions of a list of requests
+struct BulkUnsubscriber
+{
+    ~BulkUnsubscriber()
+    {
+        for(auto &req : requests)
+        {
+            if(req.event_id != 0)
+            {
+                req.device->unsubscribe_event(req.event_id);
+            }
+        }
+    }
+
+    std::vector<Tango::EventSubscriptionRequest> requests;
+};
+
+} // anonymous namespace
+
+template <class Base>
+class BulkSubDev : public Base
+{
+  public:
+    using Base::Base;
+
+    void init_device() override { }
+
+    void read_attribute(Tango::Attribute &att)
+    {
+        att.set_value(&value);
+    }
+
+    static void attribute_factory(std::vector<Tango::Attr *> &attrs)
+    {
+        for(int i = 0; i < k_nb_attr; ++i)
+        {
+            std::string name = "attr_" + std::to_string(i);
+            auto attr = new TangoTest::AutoAttr<&BulkSubDev::read_attribute>(name.c_str(), Tango::DEV_LONG);
+            attr->set_change_event(true, false);
+            attrs.push_back(attr);
+        }
+    }
+
+  private:
+    Tango::DevLong value{k_value};
+};
+
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(BulkSubDev, 4)
+
+SCENARIO("Events can be subscribed in bulk")
+{
+    int idlver = GENERATE(TangoTest::idlversion(Tango::MIN_IDL_ZMQ_EVENT));
+    GIVEN("two IDLv" << idlver << " devices running in separate servers")
+    {
+        TangoTest::ContextDescriptor desc;
+        desc.servers.push_back(TangoTest::ServerDescriptor{"bulk_sub_1", "BulkSubDev", idlver});
+        desc.servers.push_back(TangoTest::ServerDescriptor{"bulk_sub_2", "BulkSubDev", idlver});
+
+        TangoTest::Context ctx{desc};
+        std::shared_ptr<Tango::DeviceProxy> device_1 = ctx.get_proxy("bulk_sub_1");
+        std::shared_ptr<Tango::DeviceProxy> device_2 = ctx.get_proxy("bulk_sub_2");
+
+        WHEN("we subscribe to valid and invalid attributes of both devices in one call")
+        {
+            CallbackMockType cb;
+            BulkUnsubscriber subs;
+
+            for(auto *device : {device_1.get(), device_2.get()})
+            {
+                for(const char *attr_name : {"attr_0", "Attr_1", "unknown_attr"})
+                {
+                    Tango::EventSubscriptionRequest req;
+                    req.device = device;
+                    req.attr_name = attr_name;
+                    req.event = Tango::CHANGE_EVENT;
+                    req.callback = &cb;
+                    subs.requests.push_back(req);
+                }
+            }
+
+            REQUIRE_NOTHROW(Tango::ApiUtil::instance()->subscribe_events(subs.requests));
+
+            THEN("the valid subscriptions succeed and the invalid ones report an error")
+            {
+                using namespace Catch::Matchers;
+                using namespace TangoTest::Matchers;
+
+                for(const auto &req : subs.requests)
+                {
+                    if(req.attr_name == "unknown_attr")
+                    {
+                        REQUIRE(req.event_id == 0);
+                        REQUIRE(req.errors.length() != 0);
+                    }
+                    else
+                    {
+                        REQUIRE(req.event_id != 0);
+                        REQUIRE(req.errors.length() == 0);
+                    }
+                }
+
+                AND_THEN("we receive one initial event per subscription")
+                {
+                    for(int i = 0; i < 4; ++i)
+                    {
+                        auto event = cb.pop_next_event();
+                        REQUIRE(event != std::nullopt);
+                        REQUIRE_THAT(event, EventType(Tango::CHANGE_EVENT));
+                        REQUIRE_THAT(event, EventValueMatches(AnyLikeContains(k_value)));
+                    }
+                }
+            }
+        }
+
+        WHEN("we subscribe to an event already subscribed with subscribe_event()")
+        {
+            CallbackMockType cb;
+            TangoTest::Subscription sub{device_1, "attr_0", Tango::CHANGE_EVENT, &cb};
+            REQUIRE(cb.pop_next_event() != std::nullopt);
+
+            BulkUnsubscriber subs;
+            Tango::EventSubscriptionRequest req;
+            req.device = device_1.get();
+            req.attr_name = "attr_0";
+            req.event = Tango::CHANGE_EVENT;
+            req.event_queue_size = 10;
+            subs.requests.push_back(req);
+
+            REQUIRE_NOTHROW(Tango::ApiUtil::instance()->subscribe_events(subs.requests));
+
+            THEN("the initial event is stored in the event queue")
+            {
+                REQUIRE(subs.requests[0].event_id != 0);
+                REQUIRE(subs.requests[0].event_id != sub.get_id());
+                REQUIRE(device_1->event_queue_size(subs.requests[0].event_id) == 1);
+            }
+        }
+    }
+}
+
+SCENARIO("Event subscription startup time", "[.][benchmark]")
+{
+    int idlver = GENERATE(TangoTest::idlversion(6));
+    GIVEN("two IDLv" << idlver << " devices with " << k_nb_attr << " attributes running in separate servers")
+    {
+        TangoTest::ContextDescriptor desc;
+        desc.servers.push_back(TangoTest::ServerDescriptor{"bulk_sub_1", "BulkSubDev", idlver});
+        desc.servers.push_back(TangoTest::ServerDescriptor{"bulk_sub_2", "BulkSubDev", idlver});
+
+        TangoTest::Context ctx{desc};
+        std::shared_ptr<Tango::DeviceProxy> device_1 = ctx.get_proxy("bulk_sub_1");
+        std::shared_ptr<Tango::DeviceProxy> device_2 = ctx.get_proxy("bulk_sub_2");
+
+        std::vector<Tango::EventSubscriptionRequest> requests;
+        for(auto *device : {device_1.get(), device_2.get()})
+        {
+            for(int i = 0; i < k_nb_attr; ++i)
+            {
+                Tango::EventSubscriptionRequest req;
+                req.device = device;
+                req.attr_name = "attr_" + std::to_string(i);
+                req.event = Tango::CHANGE_EVENT;
+                req.event_queue_size = 1;
+                requests.push_back(req);
+            }
+        }
+
+        BENCHMARK_ADVANCED("subscribe_event() for each event")(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<BulkUnsubscriber> subs(meter.runs());
+            for(auto &sub : subs)
+            {
+                sub.requests = requests;
+            }
+            meter.measure(
+                [&subs](int run)
+                {
+                    for(auto &req : subs[run].requests)
+                    {
+                        req.event_id = req.device->subscribe_event(req.attr_name, req.event, req.event_queue_size);
+                    }
+                });
+        };
+
+        BENCHMARK_ADVANCED("ApiUtil::subscribe_events()")(Catch::Benchmark::Chronometer meter)
+        {
+            std::vector<BulkUnsubscriber> subs(meter.runs());
+            for(auto &sub : subs)
+            {
+                sub.requests = requests;
+            }
+            meter.measure([&subs](int run) { Tango::ApiUtil::instance()->subscribe_events(subs[run].requests); });
+        };
+    }
+}
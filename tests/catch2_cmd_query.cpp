@@ -16,7 +16,7 @@ SCENARIO("Command list can be retrieved")
             {
                 using namespace Catch::Matchers;
 
-                CHECK_THAT(*ptr, SizeIs(34));
+                CHECK_THAT(*ptr, SizeIs(37));
 
                 auto has_info_for = [](std::string name)
                 {
@@ -36,10 +36,13 @@ SCENARIO("Command list can be retrieved")
                 CHECK_THAT(*ptr, has_info_for("Init"));
                 CHECK_THAT(*ptr, has_info_for("Kill"));
                 CHECK_THAT(*ptr, has_info_for("LockDevice"));
+                CHECK_THAT(*ptr, has_info_for("PolledAttrSnapshot"));
                 CHECK_THAT(*ptr, has_info_for("PolledDevice"));
                 CHECK_THAT(*ptr, has_info_for("QueryClass"));
                 CHECK_THAT(*ptr, has_info_for("QueryDevice"));
                 CHECK_THAT(*ptr, has_info_for("QueryEventSystem"));
+                CHECK_THAT(*ptr, has_info_for("QueryMetrics"));
+                CHECK_THAT(*ptr, has_info_for("QueryShmTransport"));
                 CHECK_THAT(*ptr, has_info_for("QuerySubDevice"));
                 CHECK_THAT(*ptr, has_info_for("QueryWizardClassProperty"));
                 CHECK_THAT(*ptr, has_info_for("QueryWizardDevProperty"));
@@ -54,6 +57,7 @@ SCENARIO("Command list can be retrieved")
                 CHECK_THAT(*ptr, has_info_for("StopPolling"));
                 CHECK_THAT(*ptr, has_info_for("UnLockDevice"));
                 CHECK_THAT(*ptr, has_info_for("UpdObjPollingPeriod"));
+                CHECK_THAT(*ptr, has_info_for("ZmqEventBulkSubscribe"));
                 CHECK_THAT(*ptr, has_info_for("ZmqEventSubscriptionChange"));
             }
         }
@@ -406,6 +410,31 @@ SCENARIO("LockDevice command can be queried")
     }
 }
 
+SCENARIO("PolledAttrSnapshot command can be queried")
+{
+    GIVEN("a device proxy to a device")
+    {
+        TangoTest::Context ctx{"empty", "Empty"};
+        auto dserver = ctx.get_admin_proxy();
+
+        WHEN("we ask the device proxy about the PolledAttrSnapshot command")
+        {
+            Tango::CommandInfo cmd_inf;
+            REQUIRE_NOTHROW(cmd_inf = dserver->command_query("PolledAttrSnapshot"));
+
+            THEN("we get the expected information")
+            {
+                using namespace Catch::Matchers;
+                CHECK(cmd_inf.cmd_name == "PolledAttrSnapshot");
+                CHECK(cmd_inf.in_type == Tango::DEVVAR_STRINGARRAY);
+                CHECK(cmd_inf.out_type == Tango::DEV_ENCODED);
+                CHECK(cmd_inf.in_type_desc == "Str[0]=Device name. Str[1]=Sequence number (optional)");
+                CHECK(cmd_inf.out_type_desc == "Last polled value of the attributes polled since the sequence number");
+            }
+        }
+    }
+}
+
 SCENARIO("PolledDevice command can be queried")
 {
     GIVEN("a device proxy to a device")
@@ -857,6 +886,61 @@ SCENARIO("UpdObjPollingPeriod command can be queried")
     }
 }
 
+SCENARIO("QueryShmTransport command can be queried")
+{
+    GIVEN("a device proxy to a device")
+    {
+        TangoTest::Context ctx{"empty", "Empty"};
+        auto dserver = ctx.get_admin_proxy();
+
+        WHEN("we ask the device proxy about the QueryShmTransport command")
+        {
+            Tango::CommandInfo cmd_inf;
+            REQUIRE_NOTHROW(cmd_inf = dserver->command_query("QueryShmTransport"));
+
+            THEN("we get the expected information")
+            {
+                CHECK(cmd_inf.cmd_name == "QueryShmTransport");
+                CHECK(cmd_inf.in_type == Tango::DEV_VOID);
+                CHECK(cmd_inf.out_type == Tango::DEVVAR_LONGSTRINGARRAY);
+                CHECK(cmd_inf.in_type_desc == "Uninitialised");
+                CHECK(cmd_inf.out_type_desc == "Lg[0] = Ring key high 32 bits, Lg[1] = Ring key low 32 bits, Str[0] = "
+                                               "Ring shared memory segment name");
+            }
+        }
+    }
+}
+
+SCENARIO("ZmqEventBulkSubscribe command can be queried")
+{
+    GIVEN("a device proxy to a device")
+    {
+        TangoTest::Context ctx{"empty", "Empty"};
+        auto dserver = ctx.get_admin_proxy();
+
+        WHEN("we ask the device proxy about the ZmqEventBulkSubscribe command")
+        {
+            Tango::CommandInfo cmd_inf;
+            REQUIRE_NOTHROW(cmd_inf = dserver->command_query("ZmqEventBulkSubscribe"));
+
+            THEN("we get the expected information")
+            {
+                using namespace Catch::Matchers;
+                CHECK(cmd_inf.cmd_name == "ZmqEventBulkSubscribe");
+                CHECK(cmd_inf.in_type == Tango::DEVVAR_STRINGARRAY);
+                CHECK(cmd_inf.out_type == Tango::DEVVAR_LONGSTRINGARRAY);
+                CHECK(cmd_inf.in_type_desc == "<Tango client IDL version>, Str[0] = dev1 name, Str[1] = att1 name, "
+                                              "Str[2] = event name, Str[3] = dev2 name, Str[4] = att2 name, Str[5] = "
+                                              "event name,...");
+                CHECK(cmd_inf.out_type_desc ==
+                      "Lg[2i] = Long nb, Lg[2i+1] = String nb returned for event i (0 long and the error message if "
+                      "event i is not subscribed)\n"
+                      "Followed by the ZmqEventSubscriptionChange command results for all events");
+            }
+        }
+    }
+}
+
 SCENARIO("ZmqEventSubscriptionChange command can be queried")
 {
     GIVEN("a device proxy to a device")
@@ -904,3 +988,37 @@ SCENARIO("ZmqEventSubscriptionChange command can be queried")
         }
     }
 }
+
+SCENARIO("Commands are found independently of the case of their name")
+{
+    GIVEN("a device proxy to a device")
+    {
+        TangoTest::Context ctx{"empty", "Empty"};
+        auto device = ctx.get_proxy();
+
+        WHEN("we execute a command with a name using a different case")
+        {
+            Tango::DeviceData out;
+            REQUIRE_NOTHROW(out = device->command_inout("sTaTuS"));
+
+            THEN("the command is executed")
+            {
+                std::string status;
+                out >> status;
+                REQUIRE(!status.empty());
+            }
+        }
+
+        WHEN("we execute a command which does not exist")
+        {
+            THEN("we get an exception")
+            {
+                using namespace TangoTest::Matchers;
+
+                REQUIRE_THROWS_MATCHES(device->command_inout("Statu"),
+                                       Tango::DevFailed,
+                                       FirstErrorMatches(Reason(Tango::API_CommandNotFound)));
+            }
+        }
+    }
+}
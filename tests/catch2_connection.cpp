@@ -1,5 +1,7 @@
 #include "catch2_common.h"
 
+#include <catch2/benchmark/catch_benchmark.hpp>
+
 #include <memory>
 #include <chrono>
 #include <thread>
@@ -172,3 +174,40 @@ SCENARIO("DeviceProxy objects can have the timeout set")
         }
     }
 }
+
+SCENARIO("DeviceProxy call rate from many threads", "[.][benchmark]")
+{
+    int idlver = GENERATE(TangoTest::idlversion(6));
+    GIVEN("a device proxy to a simple IDLv" << idlver << " device")
+    {
+        TangoTest::Context ctx{"connection_test", "ConnectionTest", idlver};
+        auto device = ctx.get_proxy();
+
+        REQUIRE(idlver == device->get_idl_version());
+
+        auto nb_threads = GENERATE(1, 8, 32);
+        constexpr int k_calls_per_thread = 100;
+
+        BENCHMARK("command_inout from " + std::to_string(nb_threads) + " threads")
+        {
+            std::vector<std::thread> threads;
+            threads.reserve(nb_threads);
+            for(int i = 0; i < nb_threads; ++i)
+            {
+                threads.emplace_back(
+                    [&device]()
+                    {
+                        for(int j = 0; j < k_calls_per_thread; ++j)
+                        {
+                            device->command_inout("next");
+                        }
+                    });
+            }
+            for(auto &th : threads)
+            {
+                th.join();
+            }
+            return nb_threads * k_calls_per_thread;
+        };
+    }
+}
@@ -0,0 +1,143 @@
+#include "catch2_common.h"
+
+namespace
+{
+
+constexpr long k_nb_values = 1000;
+
+} // anonymous namespace
+
+template <class Base>
+class DeltaEventDev : public Base
+{
+  public:
+    using Base::Base;
+
+    ~DeltaEventDev() override { }
+
+    void init_device() override
+    {
+        values.assign(k_nb_values, 0.0);
+        Base::set_change_event("values", true, false);
+    }
+
+    void read_values(Tango::Attribute &att)
+    {
+        att.set_value(values.data(), values.size());
+    }
+
+    // Change a few elements only
+    void change_some()
+    {
+        for(size_t i = 0; i < values.size(); i += 100)
+        {
+            values[i] += 1.0;
+        }
+        push();
+    }
+
+    // Change all the elements
+    void change_all()
+    {
+        for(auto &value : values)
+        {
+            value += 0.5;
+        }
+        push();
+    }
+
+    // Change the number of elements
+    void shrink()
+    {
+        values.resize(values.size() / 2);
+        values.back() = -1.0;
+        push();
+    }
+
+    static void attribute_factory(std::vector<Tango::Attr *> &attrs)
+    {
+        attrs.push_back(new TangoTest::AutoSpectrumAttr<&DeltaEventDev::read_values>(
+            "values", Tango::DEV_DOUBLE, k_nb_values));
+    }
+
+    static void command_factory(std::vector<Tango::Command *> &cmds)
+    {
+        cmds.push_back(new TangoTest::AutoCommand<&DeltaEventDev::change_some>("change_some"));
+        cmds.push_back(new TangoTest::AutoCommand<&DeltaEventDev::change_all>("change_all"));
+        cmds.push_back(new TangoTest::AutoCommand<&DeltaEventDev::shrink>("shrink"));
+    }
+
+  private:
+    void push()
+    {
+        Base::push_change_event("values", values.data(), values.size());
+    }
+
+    std::vector<Tango::DevDouble> values;
+};
+
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(DeltaEventDev, 5)
+
+SCENARIO("Delta encoded change events carry the full attribute value")
+{
+    int idlver = GENERATE(TangoTest::idlversion(5));
+    bool delta = GENERATE(true, false);
+    GIVEN("a device proxy to an IDLv" << idlver << " device " << (delta ? "with" : "without")
+                                      << " delta encoded change events")
+    {
+        TangoTest::Context ctx{"delta_event", "DeltaEventDev", idlver};
+        std::shared_ptr<Tango::DeviceProxy> device = ctx.get_proxy();
+        device->set_event_delta_encoding(delta);
+        REQUIRE(device->get_event_delta_encoding() == delta);
+
+        TangoTest::CallbackMock<Tango::EventData> callback;
+        TangoTest::Subscription sub{device, "values", Tango::CHANGE_EVENT, &callback};
+
+        REQUIRE(callback.pop_next_event() != std::nullopt);
+
+        std::vector<Tango::DevDouble> expected(k_nb_values, 0.0);
+
+        WHEN("events changing a few elements or all of them are pushed")
+        {
+            std::vector<std::string> cmds{"change_some", "change_some", "change_all", "change_some", "shrink",
+                                          "change_some"};
+
+            THEN("each received event holds the full attribute value")
+            {
+                for(const auto &cmd : cmds)
+                {
+                    device->command_inout(cmd);
+
+                    if(cmd == "shrink")
+                    {
+                        expected.resize(expected.size() / 2);
+                        expected.back() = -1.0;
+                    }
+                    else
+                    {
+                        for(size_t i = 0; i < expected.size(); ++i)
+                        {
+                            if(cmd == "change_all")
+                            {
+                                expected[i] += 0.5;
+                            }
+                            else if(i % 100 == 0)
+                            {
+                                expected[i] += 1.0;
+                            }
+                        }
+                    }
+
+                    auto event = callback.pop_next_event();
+                    REQUIRE(event != std::nullopt);
+                    REQUIRE(!event->err);
+                    REQUIRE(event->event == "change");
+
+                    std::vector<Tango::DevDouble> received;
+                    *event->attr_value >> received;
+                    REQUIRE(received == expected);
+                }
+            }
+        }
+    }
+}
@@ -1,5 +1,10 @@
 #include "catch2_common.h"
 
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <chrono>
+#include <thread>
+
 constexpr static const Tango::DevDouble k_alarm_level = 20;
 constexpr static const Tango::DevDouble k_alarming_value = 99;
 constexpr static const Tango::DevDouble k_normal_value = 0;
@@ -316,3 +321,301 @@ SCENARIO("user dev_state is always called")
         }
     }
 }
+
+template <class Base, int NbAttr>
+class IncrementalStateDev : public Base
+{
+  public:
+    using Base::Base;
+
+    ~IncrementalStateDev() override { }
+
+    void init_device() override
+    {
+        Base::set_state(Tango::ON);
+    }
+
+    void read_attribute(Tango::Attribute &attr)
+    {
+        read_nb++;
+
+        Tango::DevDouble &value = m_values[attr.get_name()];
+        value = (m_alarming && attr.get_name() == "attr_0") ? k_alarming_value : k_normal_value;
+        attr.set_value(&value);
+    }
+
+    void set_alarming(Tango::DevBoolean alarming)
+    {
+        m_alarming = alarming;
+    }
+
+    void set_incremental(Tango::DevBoolean on)
+    {
+        Base::set_incremental_state(on);
+    }
+
+    Tango::DevLong get_read_nb()
+    {
+        return read_nb;
+    }
+
+    static void attribute_factory(std::vector<Tango::Attr *> &attrs)
+    {
+        Tango::UserDefaultAttrProp props;
+        props.set_max_alarm(std::to_string(k_alarm_level).c_str());
+
+        for(int i = 0; i < NbAttr; ++i)
+        {
+            std::string name = "attr_" + std::to_string(i);
+            attrs.push_back(
+                new TangoTest::AutoAttr<&IncrementalStateDev::read_attribute>(name.c_str(), Tango::DEV_DOUBLE));
+            attrs.back()->set_default_properties(props);
+        }
+    }
+
+    static void command_factory(std::vector<Tango::Command *> &cmds)
+    {
+        cmds.push_back(new TangoTest::AutoCommand<&IncrementalStateDev::set_alarming>("set_alarming"));
+        cmds.push_back(new TangoTest::AutoCommand<&IncrementalStateDev::set_incremental>("set_incremental"));
+        cmds.push_back(new TangoTest::AutoCommand<&IncrementalStateDev::get_read_nb>("get_read_nb"));
+    }
+
+  private:
+    std::unordered_map<std::string, Tango::DevDouble> m_values;
+    bool m_alarming = false;
+    Tango::DevLong read_nb = 0;
+};
+
+template <class Base>
+using IncrementalStateDev10 = IncrementalStateDev<Base, 10>;
+template <class Base>
+using IncrementalStateDev100 = IncrementalStateDev<Base, 100>;
+template <class Base>
+using IncrementalStateDev500 = IncrementalStateDev<Base, 500>;
+
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(IncrementalStateDev10, 3)
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(IncrementalStateDev100, 6)
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(IncrementalStateDev500, 6)
+
+SCENARIO("dev_state uses the attribute quality factors in incremental mode")
+{
+    int idlver = GENERATE(TangoTest::idlversion(3));
+    GIVEN("a device proxy to an IDLv" << idlver << " device with alarmed attributes")
+    {
+        using namespace TangoTest::Matchers;
+
+        TangoTest::Context ctx{"state", "IncrementalStateDev10", idlver};
+        auto device = ctx.get_proxy();
+
+        Tango::DeviceData dd;
+        Tango::DevLong read_nb;
+
+        WHEN("the incremental mode is not enabled")
+        {
+            REQUIRE_NOTHROW(dd = device->command_inout("State"));
+            REQUIRE_THAT(dd, AnyLikeContains(Tango::ON));
+
+            THEN("the State command reads all the alarmed attributes")
+            {
+                dd = device->command_inout("get_read_nb");
+                dd >> read_nb;
+                REQUIRE(read_nb == 10);
+            }
+        }
+
+        WHEN("the incremental mode is enabled")
+        {
+            Tango::DeviceData din;
+            din << true;
+            REQUIRE_NOTHROW(device->command_inout("set_incremental", din));
+
+            REQUIRE_NOTHROW(dd = device->command_inout("State"));
+            REQUIRE_THAT(dd, AnyLikeContains(Tango::ON));
+
+            THEN("the State command does not read any attribute")
+            {
+                dd = device->command_inout("get_read_nb");
+                dd >> read_nb;
+                REQUIRE(read_nb == 0);
+            }
+
+            AND_WHEN("an attribute is read with a value in alarm")
+            {
+                din << true;
+                REQUIRE_NOTHROW(device->command_inout("set_alarming", din));
+                REQUIRE_NOTHROW(device->read_attribute("attr_0"));
+
+                THEN("the state switches to ALARM")
+                {
+                    REQUIRE_NOTHROW(dd = device->command_inout("State"));
+                    REQUIRE_THAT(dd, AnyLikeContains(Tango::ALARM));
+
+                    AND_WHEN("the attribute is read again with a valid value")
+                    {
+                        din << false;
+                        REQUIRE_NOTHROW(device->command_inout("set_alarming", din));
+                        REQUIRE_NOTHROW(device->read_attribute("attr_0"));
+
+                        THEN("the state switches back to ON without any other attribute read")
+                        {
+                            REQUIRE_NOTHROW(dd = device->command_inout("State"));
+                            REQUIRE_THAT(dd, AnyLikeContains(Tango::ON));
+
+                            dd = device->command_inout("get_read_nb");
+                            dd >> read_nb;
+                            REQUIRE(read_nb == 2);
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+template <class Base>
+class IncrementalPushPollDev : public Base
+{
+  public:
+    using Base::Base;
+
+    ~IncrementalPushPollDev() override { }
+
+    void init_device() override
+    {
+        Base::set_state(Tango::ON);
+        Base::set_incremental_state(true);
+    }
+
+    void read_pushed(Tango::Attribute &attr)
+    {
+        attr.set_value(&m_pushed_value);
+    }
+
+    void read_polled(Tango::Attribute &attr)
+    {
+        m_polled_value = m_alarming ? k_alarming_value : k_normal_value;
+        attr.set_value(&m_polled_value);
+    }
+
+    void set_alarming(Tango::DevBoolean alarming)
+    {
+        m_alarming = alarming;
+    }
+
+    void push_alarm()
+    {
+        m_pushed_value = k_alarming_value;
+        Base::push_change_event("pushed", &m_pushed_value, std::chrono::system_clock::now(), Tango::ATTR_ALARM);
+    }
+
+    static void attribute_factory(std::vector<Tango::Attr *> &attrs)
+    {
+        auto pushed = new TangoTest::AutoAttr<&IncrementalPushPollDev::read_pushed>("pushed", Tango::DEV_DOUBLE);
+        pushed->set_change_event(true, false);
+        attrs.push_back(pushed);
+
+        Tango::UserDefaultAttrProp props;
+        props.set_max_alarm(std::to_string(k_alarm_level).c_str());
+
+        auto polled = new TangoTest::AutoAttr<&IncrementalPushPollDev::read_polled>("polled", Tango::DEV_DOUBLE);
+        polled->set_default_properties(props);
+        polled->set_polling_period(TANGO_TEST_CATCH2_DEFAULT_POLL_PERIOD);
+        attrs.push_back(polled);
+    }
+
+    static void command_factory(std::vector<Tango::Command *> &cmds)
+    {
+        cmds.push_back(new TangoTest::AutoCommand<&IncrementalPushPollDev::set_alarming>("set_alarming"));
+        cmds.push_back(new TangoTest::AutoCommand<&IncrementalPushPollDev::push_alarm>("push_alarm"));
+    }
+
+  private:
+    Tango::DevDouble m_pushed_value{k_normal_value};
+    Tango::DevDouble m_polled_value{k_normal_value};
+    bool m_alarming = false;
+};
+
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(IncrementalPushPollDev, 3)
+
+SCENARIO("dev_state uses the quality of pushed and polled values in incremental mode")
+{
+    int idlver = GENERATE(TangoTest::idlversion(3));
+    GIVEN("a device proxy to an IDLv" << idlver << " device in incremental state mode")
+    {
+        using namespace TangoTest::Matchers;
+
+        TangoTest::Context ctx{"state", "IncrementalPushPollDev", idlver};
+        auto device = ctx.get_proxy();
+
+        Tango::DeviceData dd;
+        REQUIRE_NOTHROW(dd = device->command_inout("State"));
+        REQUIRE_THAT(dd, AnyLikeContains(Tango::ON));
+
+        WHEN("the device pushes a change event with an ALARM quality")
+        {
+            REQUIRE_NOTHROW(device->command_inout("push_alarm"));
+
+            THEN("the state is ALARM once the event has been sent")
+            {
+                REQUIRE_NOTHROW(dd = device->command_inout("State"));
+                REQUIRE_THAT(dd, AnyLikeContains(Tango::ALARM));
+            }
+        }
+
+        WHEN("the device pushes a change event with an ALARM quality to a subscribed client")
+        {
+            TangoTest::CallbackMock<Tango::EventData> callback;
+            REQUIRE_NOTHROW(device->subscribe_event("pushed", Tango::CHANGE_EVENT, &callback));
+            REQUIRE(callback.pop_next_event() != std::nullopt);
+
+            REQUIRE_NOTHROW(device->command_inout("push_alarm"));
+
+            auto maybe_event = callback.pop_next_event();
+            REQUIRE(maybe_event != std::nullopt);
+            REQUIRE(maybe_event->attr_value->get_quality() == Tango::ATTR_ALARM);
+
+            THEN("the state is ALARM once the event has been sent")
+            {
+                REQUIRE_NOTHROW(dd = device->command_inout("State"));
+                REQUIRE_THAT(dd, AnyLikeContains(Tango::ALARM));
+            }
+        }
+
+        WHEN("the polled attribute gets a value in alarm")
+        {
+            Tango::DeviceData din;
+            din << true;
+            REQUIRE_NOTHROW(device->command_inout("set_alarming", din));
+
+            // Let the polling thread read the attribute
+            std::this_thread::sleep_for(std::chrono::milliseconds(3 * TANGO_TEST_CATCH2_DEFAULT_POLL_PERIOD));
+
+            THEN("the state is ALARM")
+            {
+                REQUIRE_NOTHROW(dd = device->command_inout("State"));
+                REQUIRE_THAT(dd, AnyLikeContains(Tango::ALARM));
+            }
+        }
+    }
+}
+
+SCENARIO("State command cost versus the number of alarmed attributes", "[.][benchmark]")
+{
+    int idlver = GENERATE(TangoTest::idlversion(6));
+    std::string dev_class = GENERATE("IncrementalStateDev10", "IncrementalStateDev100", "IncrementalStateDev500");
+    bool incremental = GENERATE(false, true);
+    GIVEN("an IDLv" << idlver << " " << dev_class << " device with incremental state " << incremental)
+    {
+        TangoTest::Context ctx{"state", dev_class, idlver};
+        auto device = ctx.get_proxy();
+
+        Tango::DeviceData din;
+        din << incremental;
+        device->command_inout("set_incremental", din);
+
+        BENCHMARK("State command")
+        {
+            return device->command_inout("State");
+        };
+    }
+}
@@ -74,3 +74,114 @@ SCENARIO("Event connection failure with stateless is reported during late subscr
         }
     }
 }
+
+SCENARIO("Events can be subscribed in bulk with the admin device")
+{
+    int idlver = GENERATE(TangoTest::idlversion(Tango::MIN_IDL_ZMQ_EVENT));
+    GIVEN("an admin device proxy to a server with a simple IDLv" << idlver << " device")
+    {
+        TangoTest::Context ctx{"efd", "EventFailureDev", idlver};
+        std::shared_ptr<Tango::DeviceProxy> device = ctx.get_proxy();
+        auto admin = ctx.get_admin_proxy();
+
+        WHEN("we subscribe to a valid and an invalid attribute")
+        {
+            std::vector<std::string> params{
+                device->dev_name(), "Short_attr", "change", device->dev_name(), "Unknown_attr", "change"};
+            Tango::DeviceData din;
+            din << params;
+
+            Tango::DeviceData dout;
+            REQUIRE_NOTHROW(dout = admin->command_inout("ZmqEventBulkSubscribe", din));
+
+            THEN("we get the subscription data for the first event and an error for the second one")
+            {
+                std::vector<Tango::DevLong> lg;
+                std::vector<std::string> str;
+                dout.extract(lg, str);
+
+                REQUIRE(lg.size() > 4);
+                REQUIRE(lg[0] == static_cast<Tango::DevLong>(lg.size() - 4));
+                REQUIRE(lg[2] == 0);
+                REQUIRE(lg[3] == 1);
+                REQUIRE(str.size() == static_cast<size_t>(lg[1] + lg[3]));
+                REQUIRE(!str.back().empty());
+            }
+        }
+
+        WHEN("we send a wrong number of arguments")
+        {
+            std::vector<std::string> params{device->dev_name(), "Short_attr"};
+            Tango::DeviceData din;
+            din << params;
+
+            THEN("the command fails")
+            {
+                using namespace TangoTest::Matchers;
+
+                REQUIRE_THROWS_MATCHES(admin->command_inout("ZmqEventBulkSubscribe", din),
+                                       Tango::DevFailed,
+                                       FirstErrorMatches(Reason(Tango::API_WrongNumberOfArgs)));
+            }
+        }
+    }
+}
+
+SCENARIO("Events are re-subscribed after a server restart")
+{
+    int idlver = GENERATE(TangoTest::idlversion(Tango::MIN_IDL_ZMQ_EVENT));
+    GIVEN("a device proxy to a simple IDLv" << idlver << " device")
+    {
+        TangoTest::Context ctx{"efd", "EventFailureDev", idlver};
+        std::shared_ptr<Tango::DeviceProxy> device = ctx.get_proxy();
+
+        REQUIRE(idlver == device->get_idl_version());
+
+        AND_GIVEN("a change event subscription")
+        {
+            CallbackMockType cb;
+            TangoTest::Subscription sub{device, "Short_attr", Tango::CHANGE_EVENT, &cb};
+
+            auto event = cb.pop_next_event();
+            REQUIRE(event != std::nullopt);
+
+            auto stats = Tango::ApiUtil::instance()->get_event_reconnection_stats();
+
+            WHEN("we stop and restart the server")
+            {
+                using namespace Catch::Matchers;
+                using namespace TangoTest::Matchers;
+
+                ctx.stop_server();
+
+                event = cb.pop_next_event(std::chrono::seconds{20});
+                REQUIRE(event != std::nullopt);
+                REQUIRE_THAT(event, EventErrorMatches(AllMatch(Reason(Tango::API_EventTimeout))));
+
+                ctx.restart_server();
+
+                THEN("a change event is received after another error event")
+                {
+                    event = cb.pop_next_event(std::chrono::seconds{20});
+                    REQUIRE(event != std::nullopt);
+                    REQUIRE_THAT(event, EventErrorMatches(AllMatch(Reason(Tango::API_EventTimeout))));
+
+                    event = cb.pop_next_event(std::chrono::seconds{20});
+                    REQUIRE(event != std::nullopt);
+                    REQUIRE_THAT(event, EventType(Tango::CHANGE_EVENT));
+                    REQUIRE(event->attr_value != nullptr);
+
+                    AND_THEN("the re-subscription is reported in the statistics")
+                    {
+                        auto new_stats = Tango::ApiUtil::instance()->get_event_reconnection_stats();
+                        REQUIRE(new_stats.reconnections > stats.reconnections);
+                        REQUIRE(new_stats.bulk_commands > stats.bulk_commands);
+                        REQUIRE(new_stats.resubscribed_events > stats.resubscribed_events);
+                        REQUIRE(new_stats.last_duration.count() > 0);
+                        REQUIRE(new_stats.max_duration >= new_stats.last_duration);
+                    }
+                }
+            }
+        }
+    }
+}
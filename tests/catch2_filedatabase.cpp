@@ -1,6 +1,9 @@
 #include "catch2_common.h"
 
+#include <catch2/benchmark/catch_benchmark.hpp>
+
 #include <filesystem>
+#include <sstream>
 
 namespace
 {
@@ -17,6 +20,40 @@ std::string create_dbfile(const std::string &device_name)
     return filename;
 }
 
+std::string read_file(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+void write_file(const std::string &filename, const std::string &content)
+{
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file << content;
+}
+
+// Run the updates and leave the file and its journal as after a crash, before the
+// journal is compacted
+template <typename F>
+void update_and_crash(const std::string &db_filename, F &&updates)
+{
+    const auto content = read_file(db_filename);
+    const auto mtime = std::filesystem::last_write_time(db_filename);
+    std::string journal;
+
+    {
+        Tango::FileDatabase db(db_filename);
+        updates(db);
+        journal = read_file(db_filename + ".journal");
+    }
+
+    write_file(db_filename, content);
+    std::filesystem::last_write_time(db_filename, mtime);
+    write_file(db_filename + ".journal", journal);
+}
+
 template <typename T>
 CORBA::Any as_any(T val)
 {
@@ -729,3 +766,232 @@ SCENARIO("Check that DbXXXProperty")
         }
     }
 }
+
+SCENARIO("Updates are journaled")
+{
+    GIVEN("a filedatabase")
+    {
+        std::string device_name{"test/device/01"};
+        std::string property_name{"property"};
+        std::vector<std::string> property_values{"someValue", "another value"};
+
+        const auto db_filename = create_dbfile(device_name);
+        const auto journal_filename = db_filename + ".journal";
+        const auto content = read_file(db_filename);
+
+        WHEN("a property is put")
+        {
+            Tango::FileDatabase db(db_filename);
+            put_device_property(db, device_name, property_name, property_values);
+
+            THEN("only the journal is written")
+            {
+                REQUIRE(read_file(db_filename) == content);
+                REQUIRE(std::filesystem::exists(journal_filename));
+            }
+
+            AND_WHEN("the file is written")
+            {
+                db.write_file();
+
+                THEN("the journal is removed")
+                {
+                    REQUIRE(!std::filesystem::exists(journal_filename));
+                    REQUIRE(read_file(db_filename) != content);
+                }
+            }
+        }
+
+        WHEN("the filedatabase is deleted")
+        {
+            {
+                Tango::FileDatabase db(db_filename);
+                put_device_property(db, device_name, property_name, property_values);
+            }
+
+            THEN("the journal is compacted in the file")
+            {
+                REQUIRE(!std::filesystem::exists(journal_filename));
+
+                Tango::FileDatabase db(db_filename);
+                assert_device_property(db, device_name, property_name, property_values);
+            }
+        }
+
+        WHEN("the filedatabase is reopened after a crash")
+        {
+            update_and_crash(db_filename,
+                             [&](Tango::FileDatabase &db)
+                             {
+                                 put_device_property(db, device_name, property_name, property_values);
+                                 put_class_property(db, "Class", property_name, property_values);
+                                 put_device_attr_property(db, device_name, "attr", property_name, property_values);
+                                 put_free_property(db, "object", property_name, property_values);
+                             });
+
+            THEN("the journal is replayed and compacted in the file")
+            {
+                Tango::FileDatabase db(db_filename);
+                REQUIRE(!std::filesystem::exists(journal_filename));
+                assert_device_property(db, device_name, property_name, property_values);
+                assert_class_property(db, "Class", property_name, property_values);
+                assert_device_attr_property(db, device_name, "attr", property_name, property_values);
+                assert_free_property(db, "object", property_name, property_values);
+            }
+        }
+
+        WHEN("the last record of the journal is truncated")
+        {
+            update_and_crash(db_filename,
+                             [&](Tango::FileDatabase &db)
+                             {
+                                 put_device_property(db, device_name, "first", {"1"});
+                                 put_device_property(db, device_name, "second", {"2"});
+                             });
+
+            auto journal = read_file(journal_filename);
+            write_file(journal_filename, journal.substr(0, journal.size() - 3));
+
+            THEN("the complete records are replayed")
+            {
+                Tango::FileDatabase db(db_filename);
+                assert_device_property(db, device_name, "first", {"1"});
+                assert_device_property(db, device_name, "second", {});
+            }
+        }
+
+        WHEN("the file is modified after a crash")
+        {
+            update_and_crash(db_filename,
+                             [&](Tango::FileDatabase &db)
+                             { put_device_property(db, device_name, property_name, property_values); });
+
+            write_file(db_filename, content + "test/device/01->other: 1\n");
+
+            THEN("the journal is not replayed")
+            {
+                Tango::FileDatabase db(db_filename);
+                assert_device_property(db, device_name, property_name, {});
+                assert_device_property(db, device_name, "other", {"1"});
+                REQUIRE(!std::filesystem::exists(journal_filename));
+                REQUIRE(std::filesystem::exists(journal_filename + ".rejected"));
+            }
+        }
+    }
+}
+
+SCENARIO("Deleted properties are removed from the lookups")
+{
+    GIVEN("a file defining a device property twice")
+    {
+        auto filename = TangoTest::get_next_file_database_location();
+        {
+            std::ofstream dbfile(filename);
+            dbfile << "DeviceServer/instance/DEVICE/Class: test/device/01\n";
+            dbfile << "test/device/01->property: first\n";
+            dbfile << "test/device/01->property: second\n";
+            dbfile << "CLASS/Class->property: classValue\n";
+        }
+
+        Tango::FileDatabase db(filename);
+        assert_device_property(db, "test/device/01", "property", {"first"});
+
+        WHEN("the properties are deleted")
+        {
+            delete_device_property(db, "test/device/01", "PROPERTY");
+            delete_class_property(db, "Class", "property");
+
+            THEN("the next definition is found, then none")
+            {
+                assert_device_property(db, "test/device/01", "property", {"second"});
+                assert_class_property(db, "Class", "property", {});
+
+                delete_device_property(db, "test/device/01", "property");
+                assert_device_property(db, "test/device/01", "property", {});
+            }
+
+            AND_WHEN("they are put again")
+            {
+                put_device_property(db, "test/device/01", "property", {"new"});
+                put_class_property(db, "Class", "property", {"new"});
+
+                THEN("the new values are found")
+                {
+                    assert_device_property(db, "test/device/01", "property", {"new"});
+                    assert_class_property(db, "Class", "property", {"new"});
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Lookups ignore the case of the names")
+{
+    GIVEN("a file without a trailing newline")
+    {
+        auto filename = TangoTest::get_next_file_database_location();
+        {
+            std::ofstream dbfile(filename);
+            dbfile << "DeviceServer/instance/DEVICE/Class: test/device/01\n";
+            dbfile << "CLASS/Class->property: classValue\n";
+            dbfile << "test/device/01->property: someValue";
+        }
+
+        WHEN("the names are given with another case")
+        {
+            Tango::FileDatabase db(filename);
+
+            THEN("the properties are found")
+            {
+                assert_device_property(db, "TEST/Device/01", "property", {"someValue"});
+                assert_class_property(db, "class", "property", {"classValue"});
+            }
+        }
+    }
+}
+
+SCENARIO("FileDatabase load and update", "[.][benchmark]")
+{
+    GIVEN("a file with 2000 devices of 10 properties each")
+    {
+        constexpr int k_nb_devices = 2000;
+        constexpr int k_nb_properties = 10;
+
+        auto filename = TangoTest::get_next_file_database_location();
+        {
+            std::ofstream dbfile(filename);
+            dbfile << "DeviceServer/instance/DEVICE/Class: ";
+            for(int d = 0; d < k_nb_devices; ++d)
+            {
+                dbfile << (d == 0 ? "" : ",\\\n    ") << "test/device/" << d;
+            }
+            dbfile << "\n";
+            for(int d = 0; d < k_nb_devices; ++d)
+            {
+                for(int p = 0; p < k_nb_properties; ++p)
+                {
+                    dbfile << "test/device/" << d << "->property" << p << ": " << p << ",value" << p << "\n";
+                }
+            }
+        }
+
+        BENCHMARK("load")
+        {
+            return std::make_unique<Tango::FileDatabase>(filename);
+        };
+
+        Tango::FileDatabase db(filename);
+        int counter = 0;
+
+        BENCHMARK("put device property")
+        {
+            auto device_name = "test/device/" + std::to_string(counter % k_nb_devices);
+            put_device_property(db, device_name, "property3", {std::to_string(counter++)});
+        };
+
+        BENCHMARK("get device property")
+        {
+            return get_device_property(db, "test/device/" + std::to_string(k_nb_devices - 1), "property9");
+        };
+    }
+}
@@ -0,0 +1,153 @@
+#include "catch2_common.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <chrono>
+#include <cstdlib>
+
+namespace
+{
+
+constexpr int k_nb_root_attr = 3;
+constexpr long k_root_polling_period = 300;
+constexpr const char *k_root_dev_env[] = {"FWD_ROOT_DEV_1", "FWD_ROOT_DEV_2"};
+
+std::string fwd_attr_name(int root, int index)
+{
+    return "fwd_" + std::to_string(root) + "_" + std::to_string(index);
+}
+
+} // anonymous namespace
+
+template <class Base>
+class FwdRootDev : public Base
+{
+  public:
+    using Base::Base;
+
+    void init_device() override { }
+
+    void read_attribute(Tango::Attribute &att)
+    {
+        att.set_value(&value);
+    }
+
+    static void attribute_factory(std::vector<Tango::Attr *> &attrs)
+    {
+        for(int i = 0; i < k_nb_root_attr; ++i)
+        {
+            std::string name = "attr_" + std::to_string(i);
+            auto attr = new TangoTest::AutoAttr<&FwdRootDev::read_attribute>(name.c_str(), Tango::DEV_DOUBLE);
+            attr->set_polling_period(k_root_polling_period);
+            attrs.push_back(attr);
+        }
+    }
+
+  private:
+    Tango::DevDouble value{1.5};
+};
+
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(FwdRootDev, 6)
+
+// The root devices are given with environment variables, as they are known only once their server is started
+template <class Base>
+class FwdDev : public Base
+{
+  public:
+    using Base::Base;
+
+    void init_device() override { }
+
+    void set_fwd_att_max_age(Tango::DevLong max_age)
+    {
+        Tango::Util::instance()->set_fwd_att_max_age(std::chrono::milliseconds(max_age));
+    }
+
+    static void attribute_factory(std::vector<Tango::Attr *> &attrs)
+    {
+        for(int root = 0; root < 2; ++root)
+        {
+            const char *root_dev = std::getenv(k_root_dev_env[root]);
+            if(root_dev == nullptr)
+            {
+                continue;
+            }
+
+            for(int i = 0; i < k_nb_root_attr; ++i)
+            {
+                std::string root_attr = std::string(root_dev) + "/attr_" + std::to_string(i);
+                attrs.push_back(new Tango::FwdAttr(fwd_attr_name(root, i), root_attr));
+            }
+        }
+    }
+
+    static void command_factory(std::vector<Tango::Command *> &cmds)
+    {
+        cmds.push_back(new TangoTest::AutoCommand<&FwdDev::set_fwd_att_max_age>("set_fwd_att_max_age"));
+    }
+};
+
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(FwdDev, 6)
+
+SCENARIO("Forwarded attribute read time", "[.][benchmark]")
+{
+    int idlver = GENERATE(TangoTest::idlversion(6));
+    GIVEN("an IDLv" << idlver << " device forwarding " << k_nb_root_attr
+                    << " attributes of two root devices running in separate servers")
+    {
+        TangoTest::ContextDescriptor root_desc;
+        root_desc.servers.push_back(TangoTest::ServerDescriptor{"fwd_root_1", "FwdRootDev", idlver});
+        root_desc.servers.push_back(TangoTest::ServerDescriptor{"fwd_root_2", "FwdRootDev", idlver});
+        TangoTest::Context root_ctx{root_desc};
+
+        // The nodb FQTRL of a root attribute is the root device FQTRL followed by the attribute name
+        std::vector<std::string> env{std::string(k_root_dev_env[0]) + "=" + root_ctx.get_fqtrl("fwd_root_1"),
+                                     std::string(k_root_dev_env[1]) + "=" + root_ctx.get_fqtrl("fwd_root_2")};
+
+        TangoTest::Context ctx{"fwd", "FwdDev", idlver, env};
+        std::shared_ptr<Tango::DeviceProxy> device = ctx.get_proxy();
+
+        std::vector<std::string> names;
+        for(int root = 0; root < 2; ++root)
+        {
+            for(int i = 0; i < k_nb_root_attr; ++i)
+            {
+                names.push_back(fwd_attr_name(root, i));
+            }
+        }
+
+        WHEN("the root attributes are read for each forwarded attribute read")
+        {
+            BENCHMARK("read_attribute() for each forwarded attribute")
+            {
+                for(const auto &name : names)
+                {
+                    device->read_attribute(name);
+                }
+            };
+
+            BENCHMARK("read_attributes() of all the forwarded attributes")
+            {
+                return std::unique_ptr<std::vector<Tango::DeviceAttribute>>(device->read_attributes(names));
+            };
+        }
+
+        WHEN("the forwarded attributes are read from the root attribute values received with events")
+        {
+            Tango::DeviceData din;
+            din << static_cast<Tango::DevLong>(10000);
+            device->command_inout("set_fwd_att_max_age", din);
+
+            std::vector<std::unique_ptr<TangoTest::Subscription<>>> subs;
+            for(const auto &name : names)
+            {
+                subs.push_back(std::make_unique<TangoTest::Subscription<>>(device, name, Tango::PERIODIC_EVENT, 1));
+            }
+
+            BENCHMARK("read_attributes() served from the root events")
+            {
+                return std::unique_ptr<std::vector<Tango::DeviceAttribute>>(device->read_attributes(names));
+            };
+        }
+    }
+}
@@ -235,6 +235,28 @@ SCENARIO("Event name functions")
         {
             REQUIRE(Tango::detail::get_event_name(qual_event_name) == "change");
             REQUIRE(Tango::detail::get_event_name(qual_event_name_intr) == "intr_change");
+            REQUIRE(Tango::detail::get_event_name(
+                        "tango://127.0.0.1:11570/testserver/tests/1/short_attr#dbase=no.idl5_delta_change") ==
+                    "change");
+        }
+
+        WHEN("add and remove the delta prefix")
+        {
+            REQUIRE(Tango::detail::add_delta_prefix(unqual_event_name) == "idl5_delta_change");
+            REQUIRE(Tango::detail::add_delta_prefix("change") == "delta_change");
+            REQUIRE(Tango::detail::remove_delta_prefix("idl5_delta_change") == unqual_event_name);
+            REQUIRE(Tango::detail::remove_delta_prefix("delta_change") == "change");
+            REQUIRE(Tango::detail::remove_delta_prefix(unqual_event_name) == unqual_event_name);
+        }
+
+        WHEN("detect a delta encoded event name")
+        {
+            REQUIRE(Tango::detail::is_delta_event_name("idl5_delta_change"));
+            REQUIRE(Tango::detail::is_delta_event_name(
+                "tango://127.0.0.1:11570/testserver/tests/1/short_attr#dbase=no.idl5_delta_change"));
+            REQUIRE(!Tango::detail::is_delta_event_name(unqual_event_name));
+            REQUIRE(!Tango::detail::is_delta_event_name(qual_event_name));
+            REQUIRE(!Tango::detail::is_delta_event_name(qual_event_name_intr));
         }
     }
 }
@@ -1,5 +1,8 @@
 #include "catch2_common.h"
 
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <algorithm>
 #include <ctime>
 #include <cstdio>
 #include <iterator>
@@ -319,3 +322,155 @@ SCENARIO("Images can be converted to and from jpeg")
         delete[] gray_buffer;
     }
 }
+
+namespace details
+{
+// Decode the last image encoded by the encoder
+std::vector<unsigned char> decode_last(Tango::EncodedAttribute &encoder, bool gray)
+{
+    Tango::DevEncoded att_de;
+    att_de.encoded_format = gray ? "JPEG_GRAY8" : "JPEG_RGB";
+    Tango::DevVarCharArray data(encoder.get_size(), encoder.get_size(), encoder.get_data(), false);
+    att_de.encoded_data = data;
+
+    Tango::DeviceAttribute da;
+    da << att_de;
+
+    int width = 0;
+    int height = 0;
+    unsigned char *buffer = nullptr;
+    if(gray)
+    {
+        encoder.decode_gray8(&da, &width, &height, &buffer);
+    }
+    else
+    {
+        encoder.decode_rgb32(&da, &width, &height, &buffer);
+    }
+
+    std::size_t size = static_cast<std::size_t>(width) * height * (gray ? 1 : 4);
+    std::vector<unsigned char> result(buffer, buffer + size);
+    delete[] buffer;
+    return result;
+}
+
+struct ImageParams
+{
+    bool gray;
+    int width;
+    int height;
+};
+
+// Tile the 512x512 test image to build a larger one
+std::vector<unsigned char> tile(const std::vector<unsigned char> &src, int components, int width, int height)
+{
+    std::vector<unsigned char> image(static_cast<std::size_t>(width) * height * components);
+    for(int y = 0; y < height; ++y)
+    {
+        for(int x = 0; x < width; ++x)
+        {
+            const unsigned char *from = &src[((y % 512) * 512 + (x % 512)) * components];
+            std::copy(from, from + components, &image[(static_cast<std::size_t>(y) * width + x) * components]);
+        }
+    }
+    return image;
+}
+} // namespace details
+
+SCENARIO("Images can be encoded to jpeg with several threads")
+{
+    GIVEN("An encoder and some raw images")
+    {
+        details::jpeg_encoder test;
+
+        // Tango was built without jpeg support
+        if(!test.encoder->is_feature_supported(Tango::EncodedAttribute::Feature::JPEG))
+        {
+            return;
+        }
+
+        int nb_threads = GENERATE(2, 3, 8);
+        auto params = GENERATE(details::ImageParams{true, 512, 512},
+                               details::ImageParams{true, 1001, 777},
+                               details::ImageParams{false, 512, 512},
+                               details::ImageParams{false, 1001, 777});
+        bool gray = params.gray;
+        int width = params.width;
+        int height = params.height;
+
+        std::vector<unsigned char> image =
+            gray ? details::tile(test.raw_8bits, 1, width, height) : details::tile(test.raw_24bits, 3, width, height);
+
+        auto encode = [&](Tango::EncodedAttribute &encoder)
+        {
+            if(gray)
+            {
+                encoder.encode_jpeg_gray8(image.data(), width, height, 90);
+            }
+            else
+            {
+                encoder.encode_jpeg_rgb24(image.data(), width, height, 90);
+            }
+        };
+
+        Tango::EncodedAttribute reference;
+        encode(reference);
+        std::vector<unsigned char> expected = details::decode_last(reference, gray);
+
+        WHEN("Encoding a " << width << "x" << height << (gray ? " gray" : " color") << " image with " << nb_threads
+                           << " threads")
+        {
+            Tango::EncodedAttribute encoder;
+            encoder.set_jpeg_encoding_threads(nb_threads);
+            encode(encoder);
+
+            THEN("The image decodes to the same pixels as with one thread")
+            {
+                REQUIRE(details::find_jpeg_start(encoder.get_data(), encoder.get_size()) != details::zero);
+                REQUIRE(details::decode_last(encoder, gray) == expected);
+
+                AND_THEN("Encoding the image again reuses the encoder")
+                {
+                    encode(encoder);
+                    encode(encoder);
+                    REQUIRE(details::decode_last(encoder, gray) == expected);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("JPEG encoding throughput", "[.][benchmark]")
+{
+    details::jpeg_encoder test;
+
+    // Tango was built without jpeg support
+    if(!test.encoder->is_feature_supported(Tango::EncodedAttribute::Feature::JPEG))
+    {
+        return;
+    }
+
+    constexpr int width = 3840;
+    constexpr int height = 2160;
+    std::vector<unsigned char> rgb24 = details::tile(test.raw_24bits, 3, width, height);
+    std::vector<unsigned char> gray8 = details::tile(test.raw_8bits, 1, width, height);
+
+    int nb_threads = GENERATE(1, 2, 4, 8);
+    GIVEN("An encoder using " << nb_threads << " threads")
+    {
+        Tango::EncodedAttribute encoder;
+        encoder.set_jpeg_encoding_threads(nb_threads);
+
+        BENCHMARK("4K gray image")
+        {
+            encoder.encode_jpeg_gray8(gray8.data(), width, height, 90);
+            return encoder.get_size();
+        };
+
+        BENCHMARK("4K color image")
+        {
+            encoder.encode_jpeg_rgb24(rgb24.data(), width, height, 90);
+            return encoder.get_size();
+        };
+    }
+}
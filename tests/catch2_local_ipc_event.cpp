@@ -0,0 +1,114 @@
+#include "catch2_common.h"
+
+template <class Base>
+class LocalIpcDev : public Base
+{
+  public:
+    using Base::Base;
+
+    ~LocalIpcDev() override { }
+
+    void init_device() override
+    {
+        value = 0;
+        Base::set_change_event("attr", true, false);
+    }
+
+    void read_attr(Tango::Attribute &att)
+    {
+        att.set_value(&value);
+    }
+
+    void push_event()
+    {
+        value++;
+        Base::push_change_event("attr", &value);
+    }
+
+    static void attribute_factory(std::vector<Tango::Attr *> &attrs)
+    {
+        attrs.push_back(new TangoTest::AutoAttr<&LocalIpcDev::read_attr>("attr", Tango::DEV_LONG));
+    }
+
+    static void command_factory(std::vector<Tango::Command *> &cmds)
+    {
+        cmds.push_back(new TangoTest::AutoCommand<&LocalIpcDev::push_event>("push_event"));
+    }
+
+  private:
+    Tango::DevLong value;
+};
+
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(LocalIpcDev, 4)
+
+namespace
+{
+
+// Return the endpoint of the client event channel to the server instance
+std::string get_channel_endpoint(const std::string &instance_name)
+{
+    std::stringstream ss;
+    Tango::ApiUtil::instance()->get_zmq_event_consumer()->query_event_system(ss);
+    std::string str = ss.str();
+
+    const std::string endpoint_key = R"("endpoint":")";
+    auto pos = str.find(R"("event_channels")");
+    pos = str.find(instance_name, pos);
+    pos = str.find(endpoint_key, pos);
+    if(pos == std::string::npos)
+    {
+        return "";
+    }
+
+    pos += endpoint_key.size();
+    return str.substr(pos, str.find('"', pos) - pos);
+}
+
+} // anonymous namespace
+
+SCENARIO("Events can be received through the local ipc transport")
+{
+    int idlver = GENERATE(TangoTest::idlversion(4));
+    bool local_ipc = GENERATE(true, false);
+    GIVEN("a device proxy to an IDLv" << idlver << " device " << (local_ipc ? "with" : "without")
+                                      << " the local ipc transport")
+    {
+        std::string instance_name = local_ipc ? "local_ipc_on" : "local_ipc_off";
+        std::vector<std::string> env{std::string("TANGO_ZMQ_LOCAL_IPC=") + (local_ipc ? "on" : "off")};
+        TangoTest::Context ctx{instance_name, "LocalIpcDev", idlver, std::move(env)};
+        std::shared_ptr<Tango::DeviceProxy> device = ctx.get_proxy();
+
+        TangoTest::CallbackMock<Tango::EventData> callback;
+        TangoTest::Subscription sub{device, "attr", Tango::CHANGE_EVENT, &callback};
+
+        REQUIRE(callback.pop_next_event() != std::nullopt);
+
+        WHEN("an event is pushed")
+        {
+            device->command_inout("push_event");
+
+            THEN("the event is received")
+            {
+                auto event = callback.pop_next_event();
+                REQUIRE(event != std::nullopt);
+                REQUIRE(!event->err);
+
+                Tango::DevLong value;
+                *event->attr_value >> value;
+                REQUIRE(value == 1);
+            }
+
+            AND_THEN("the event channel uses the expected transport")
+            {
+                using namespace Catch::Matchers;
+
+                std::string endpoint = get_channel_endpoint(instance_name);
+#ifdef _TG_WINDOWS_
+                REQUIRE_THAT(endpoint, StartsWith("tcp://"));
+#else
+                REQUIRE_THAT(endpoint, StartsWith(local_ipc ? "ipc://" : "tcp://"));
+#endif
+            }
+        }
+    }
+}
@@ -0,0 +1,272 @@
+#include "catch2_common.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+
+std::vector<unsigned char> load_file(const std::string &file)
+{
+    std::ifstream read_file(file, std::ios::binary);
+    REQUIRE(read_file.is_open());
+
+    auto signed_vec = std::vector<char>{std::istreambuf_iterator<char>(read_file), {}};
+    std::vector<unsigned char> unsigned_vec(signed_vec.size());
+    memcpy(unsigned_vec.data(), signed_vec.data(), signed_vec.size());
+    return unsigned_vec;
+}
+
+// Image looking like a detector frame: noisy background with a few bright spots
+std::vector<unsigned short> detector_image(int width, int height)
+{
+    std::mt19937 rng(42);
+    std::poisson_distribution<int> noise(100);
+
+    std::vector<unsigned short> image(static_cast<std::size_t>(width) * height);
+    for(int y = 0; y < height; ++y)
+    {
+        for(int x = 0; x < width; ++x)
+        {
+            int value = noise(rng);
+            if((x / 16) % 8 == 3 && (y / 16) % 8 == 5)
+            {
+                value += 20000;
+            }
+            image[static_cast<std::size_t>(y) * width + x] = static_cast<unsigned short>(value);
+        }
+    }
+    return image;
+}
+
+// Put the last image encoded by the encoder in a DeviceAttribute
+Tango::DeviceAttribute to_device_attribute(Tango::EncodedAttribute &encoder)
+{
+    Tango::DevEncoded att_de;
+    att_de.encoded_format = static_cast<const char *>(*encoder.get_format());
+    Tango::DevVarCharArray data(encoder.get_size(), encoder.get_size(), encoder.get_data(), false);
+    att_de.encoded_data = data;
+
+    Tango::DeviceAttribute da;
+    da << att_de;
+    return da;
+}
+
+Tango::DeviceAttribute make_device_attribute(const char *format, std::vector<unsigned char> &data)
+{
+    Tango::DevEncoded att_de;
+    att_de.encoded_format = format;
+    Tango::DevVarCharArray seq(data.size(), data.size(), data.data(), false);
+    att_de.encoded_data = seq;
+
+    Tango::DeviceAttribute da;
+    da << att_de;
+    return da;
+}
+
+} // anonymous namespace
+
+SCENARIO("Images can be compressed without loss")
+{
+    GIVEN("An encoder and some raw images")
+    {
+        std::string resource_path = TANGO_TEST_CATCH2_RESOURCE_PATH;
+        std::vector<unsigned char> peppers_gray = load_file(resource_path + "/peppers_gray.data");
+        std::vector<unsigned char> peppers_rgb = load_file(resource_path + "/peppers.data");
+
+        Tango::EncodedAttribute encoder;
+        REQUIRE(encoder.is_feature_supported(Tango::EncodedAttribute::Feature::LOSSLESS));
+
+        int width = 0;
+        int height = 0;
+
+        WHEN("Compressing a 8 bits grayscale image")
+        {
+            REQUIRE_NOTHROW(encoder.encode_lossless_gray8(peppers_gray.data(), 512, 512));
+
+            THEN("The image is smaller and is decoded unchanged")
+            {
+                REQUIRE(std::string{*encoder.get_format()} == LOSSLESS_GRAY_8);
+                REQUIRE(static_cast<std::size_t>(encoder.get_size()) < peppers_gray.size());
+
+                auto da = to_device_attribute(encoder);
+                unsigned char *gray8 = nullptr;
+                REQUIRE_NOTHROW(encoder.decode_gray8(&da, &width, &height, &gray8));
+                std::vector<unsigned char> decoded(gray8, gray8 + 512 * 512);
+                delete[] gray8;
+
+                REQUIRE(width == 512);
+                REQUIRE(height == 512);
+                REQUIRE(decoded == peppers_gray);
+            }
+        }
+
+        WHEN("Compressing a 24 bits color image")
+        {
+            REQUIRE_NOTHROW(encoder.encode_lossless_rgb24(peppers_rgb.data(), 512, 512));
+
+            THEN("The image is smaller and is decoded unchanged")
+            {
+                REQUIRE(std::string{*encoder.get_format()} == LOSSLESS_RGB_24);
+                REQUIRE(static_cast<std::size_t>(encoder.get_size()) < peppers_rgb.size());
+
+                auto da = to_device_attribute(encoder);
+                unsigned char *rgb32 = nullptr;
+                REQUIRE_NOTHROW(encoder.decode_rgb32(&da, &width, &height, &rgb32));
+                std::vector<unsigned char> decoded;
+                for(std::size_t i = 0; i < 512 * 512; ++i)
+                {
+                    decoded.insert(decoded.end(), rgb32 + 4 * i, rgb32 + 4 * i + 3);
+                    REQUIRE(rgb32[4 * i + 3] == 0);
+                }
+                delete[] rgb32;
+
+                REQUIRE(width == 512);
+                REQUIRE(height == 512);
+                REQUIRE(decoded == peppers_rgb);
+            }
+        }
+
+        WHEN("Compressing 16 bits grayscale images of various sizes")
+        {
+            auto size =
+                GENERATE(std::make_pair(1, 1), std::make_pair(31, 3), std::make_pair(33, 65), std::make_pair(0, 4));
+            std::vector<unsigned short> image = detector_image(size.first, size.second);
+            // Use the full range of values to test the largest residuals
+            for(std::size_t i = 0; i < image.size(); i += 3)
+            {
+                image[i] = (i % 2 == 0) ? 0 : 65535;
+            }
+
+            REQUIRE_NOTHROW(encoder.encode_lossless_gray16(image.data(), size.first, size.second));
+
+            THEN("The images are decoded unchanged")
+            {
+                auto da = to_device_attribute(encoder);
+                unsigned short *gray16 = nullptr;
+                REQUIRE_NOTHROW(encoder.decode_gray16(&da, &width, &height, &gray16));
+                std::vector<unsigned short> decoded(gray16, gray16 + image.size());
+                delete[] gray16;
+
+                REQUIRE(width == size.first);
+                REQUIRE(height == size.second);
+                REQUIRE(decoded == image);
+            }
+        }
+
+        WHEN("Compressing a 16 bits detector image")
+        {
+            std::vector<unsigned short> image = detector_image(1024, 1024);
+            REQUIRE_NOTHROW(encoder.encode_lossless_gray16(image.data(), 1024, 1024));
+
+            THEN("The compression ratio is better than 1.5")
+            {
+                double ratio = static_cast<double>(image.size() * 2) / encoder.get_size();
+                INFO("Compression ratio: " << ratio);
+                REQUIRE(ratio > 1.5);
+            }
+        }
+
+        WHEN("Compressing an image with a negative size")
+        {
+            THEN("An exception is thrown")
+            {
+                using namespace TangoTest::Matchers;
+
+                REQUIRE_THROWS_MATCHES(encoder.encode_lossless_gray8(peppers_gray.data(), -1, 512),
+                                       Tango::DevFailed,
+                                       FirstErrorMatches(Reason(Tango::API_EncodeErr)));
+            }
+        }
+
+        WHEN("Decoding truncated or corrupted data")
+        {
+            REQUIRE_NOTHROW(encoder.encode_lossless_gray8(peppers_gray.data(), 512, 512));
+            std::vector<unsigned char> data(encoder.get_data(), encoder.get_data() + encoder.get_size());
+
+            auto corruption = GENERATE(0, 1, 2, 3);
+            switch(corruption)
+            {
+            case 0:
+                data.resize(data.size() - 1);
+                break;
+            case 1:
+                data.resize(5);
+                break;
+            case 2:
+                // Image height larger than what the data can hold
+                data[4] = 0x7F;
+                break;
+            default:
+                // Bit width of the first block larger than 8
+                data[8] = 9;
+                break;
+            }
+
+            THEN("An exception is thrown")
+            {
+                using namespace TangoTest::Matchers;
+
+                auto da = make_device_attribute(LOSSLESS_GRAY_8, data);
+                unsigned char *gray8 = nullptr;
+                REQUIRE_THROWS_MATCHES(encoder.decode_gray8(&da, &width, &height, &gray8),
+                                       Tango::DevFailed,
+                                       FirstErrorMatches(Reason(Tango::API_DecodeErr)));
+            }
+        }
+
+        WHEN("Decoding a lossless image with the wrong method")
+        {
+            REQUIRE_NOTHROW(encoder.encode_lossless_rgb24(peppers_rgb.data(), 512, 512));
+
+            THEN("An exception is thrown")
+            {
+                using namespace TangoTest::Matchers;
+
+                auto da = to_device_attribute(encoder);
+                unsigned short *gray16 = nullptr;
+                REQUIRE_THROWS_MATCHES(encoder.decode_gray16(&da, &width, &height, &gray16),
+                                       Tango::DevFailed,
+                                       FirstErrorMatches(Reason(Tango::API_WrongFormat)));
+            }
+        }
+    }
+}
+
+SCENARIO("Lossless compression throughput", "[.][benchmark]")
+{
+    GIVEN("A 2048x2048 16 bits detector image")
+    {
+        constexpr int k_size = 2048;
+        std::vector<unsigned short> image = detector_image(k_size, k_size);
+        double megabytes = image.size() * 2 / 1e6;
+
+        Tango::EncodedAttribute encoder;
+        encoder.encode_lossless_gray16(image.data(), k_size, k_size);
+        auto da = to_device_attribute(encoder);
+
+        std::stringstream name;
+        name << megabytes << " MB, ratio " << static_cast<double>(image.size() * 2) / encoder.get_size();
+
+        BENCHMARK("encode " + name.str())
+        {
+            encoder.encode_lossless_gray16(image.data(), k_size, k_size);
+            return encoder.get_size();
+        };
+
+        BENCHMARK("decode " + name.str())
+        {
+            int width = 0;
+            int height = 0;
+            unsigned short *gray16 = nullptr;
+            encoder.decode_gray16(&da, &width, &height, &gray16);
+            delete[] gray16;
+            return width;
+        };
+    }
+}
@@ -0,0 +1,370 @@
+#include "catch2_common.h"
+
+#include <tango/internal/metrics.h>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <optional>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+constexpr static Tango::DevLong k_polling_period = TANGO_TEST_CATCH2_DEFAULT_POLL_PERIOD;
+
+template <class Base>
+class MetricsDev : public Base
+{
+  public:
+    using Base::Base;
+
+    ~MetricsDev() override { }
+
+    void init_device() override { }
+
+    void succeed() { }
+
+    void read_attribute(Tango::Attribute &att)
+    {
+        // A new value at each reading, so that each poll cycle fires a change and an archive event
+        value += 1.0;
+        att.set_value(&value);
+    }
+
+    void fail()
+    {
+        TANGO_THROW_EXCEPTION("TestReason", "This command always fails");
+    }
+
+    static void command_factory(std::vector<Tango::Command *> &cmds)
+    {
+        cmds.push_back(new TangoTest::AutoCommand<&MetricsDev::succeed>("Succeed"));
+        cmds.push_back(new TangoTest::AutoCommand<&MetricsDev::fail>("Fail"));
+        cmds.push_back(new TangoTest::AutoCommand<&MetricsDev::succeed>("Polled"));
+        cmds.back()->set_polling_period(k_polling_period);
+    }
+
+    static void attribute_factory(std::vector<Tango::Attr *> &attrs)
+    {
+        Tango::UserDefaultAttrProp props;
+        props.set_event_abs_change("0.1");
+        props.set_archive_event_abs_change("0.1");
+
+        auto attr = new TangoTest::AutoAttr<&MetricsDev::read_attribute>("attr", Tango::DEV_DOUBLE);
+        attr->set_polling_period(k_polling_period);
+        attr->set_default_properties(props);
+        attrs.push_back(attr);
+    }
+
+  private:
+    Tango::DevDouble value{0.0};
+};
+
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(MetricsDev, 4)
+
+SCENARIO("Histogram buckets have a bounded relative error")
+{
+    using Tango::detail::Histogram;
+
+    GIVEN("values spread over the whole range of the histogram")
+    {
+        std::vector<std::uint64_t> values{0, 1, 7, 8, 9, 15, 16, 17, 100, 1000, 65535, 65536, 123456789};
+        for(unsigned bits = 4; bits < Histogram::MAX_BITS; ++bits)
+        {
+            values.push_back((std::uint64_t{1} << bits) - 1);
+            values.push_back(std::uint64_t{1} << bits);
+        }
+
+        THEN("each value is held by a bucket whose bounds are within 1/8 of the value")
+        {
+            for(auto value : values)
+            {
+                INFO("value: " << value);
+                auto index = Histogram::bucket_index(value);
+                REQUIRE(index < Histogram::BUCKETS);
+                REQUIRE(Histogram::bucket_upper_bound(index) >= value);
+                REQUIRE(Histogram::bucket_upper_bound(index) - value <= value / 8);
+                if(index > 0)
+                {
+                    REQUIRE(Histogram::bucket_upper_bound(index - 1) < value);
+                }
+            }
+        }
+    }
+
+    GIVEN("a value larger than 2^MAX_BITS")
+    {
+        std::uint64_t value = std::uint64_t{1} << 40;
+
+        THEN("it is held by the last bucket")
+        {
+            REQUIRE(Histogram::bucket_index(value) == Histogram::BUCKETS - 1);
+        }
+    }
+}
+
+SCENARIO("Histograms give the quantiles of the recorded values")
+{
+    GIVEN("a histogram holding the values from 1 to 1000")
+    {
+        Tango::detail::Histogram histogram;
+        for(std::uint64_t i = 1; i <= 1000; ++i)
+        {
+            histogram.record(i);
+        }
+
+        WHEN("we take a snapshot")
+        {
+            auto snapshot = histogram.snapshot();
+
+            THEN("the count, sum and maximum are exact")
+            {
+                REQUIRE(snapshot.count == 1000);
+                REQUIRE(snapshot.sum == 500500);
+                REQUIRE(snapshot.max == 1000);
+            }
+
+            THEN("the quantiles are upper bounds within 1/8 of the actual values")
+            {
+                for(auto [q, expected] : {std::pair{0.5, 500.0}, std::pair{0.9, 900.0}, std::pair{0.99, 990.0}})
+                {
+                    INFO("quantile: " << q);
+                    auto value = static_cast<double>(snapshot.quantile(q));
+                    REQUIRE(value >= expected);
+                    REQUIRE(value <= expected * 1.125);
+                }
+                REQUIRE(snapshot.quantile(1.0) == 1000);
+            }
+        }
+    }
+
+    GIVEN("an empty histogram")
+    {
+        Tango::detail::Histogram histogram;
+
+        THEN("the quantiles are 0")
+        {
+            REQUIRE(histogram.snapshot().quantile(0.5) == 0);
+        }
+    }
+}
+
+SCENARIO("Metrics can be updated concurrently")
+{
+    GIVEN("a counter and a histogram updated by several threads")
+    {
+        constexpr int k_threads = 16;
+        constexpr int k_updates = 10000;
+
+        Tango::detail::Counter counter;
+        Tango::detail::Histogram histogram;
+        Tango::detail::Histogram one_shard_histogram{1};
+
+        std::vector<std::thread> threads;
+        for(int i = 0; i < k_threads; ++i)
+        {
+            threads.emplace_back(
+                [&counter, &histogram, &one_shard_histogram]()
+                {
+                    for(int j = 0; j < k_updates; ++j)
+                    {
+                        counter.add();
+                        histogram.record(static_cast<std::uint64_t>(j));
+                        one_shard_histogram.record(static_cast<std::uint64_t>(j));
+                    }
+                });
+        }
+        for(auto &thread : threads)
+        {
+            thread.join();
+        }
+
+        THEN("no update is lost")
+        {
+            REQUIRE(counter.value() == k_threads * k_updates);
+            REQUIRE(histogram.snapshot().count == k_threads * k_updates);
+            REQUIRE(histogram.snapshot().max == k_updates - 1);
+            REQUIRE(one_shard_histogram.snapshot().count == k_threads * k_updates);
+        }
+    }
+}
+
+SCENARIO("The metrics registry returns the same metric for the same name and labels")
+{
+    auto &registry = Tango::detail::MetricsRegistry::instance();
+
+    auto &counter = registry.counter("test.registry.counter", {{"key", "a"}});
+    REQUIRE(&counter == &registry.counter("test.registry.counter", {{"key", "a"}}));
+    REQUIRE(&counter != &registry.counter("test.registry.counter", {{"key", "b"}}));
+    REQUIRE(&counter != &registry.counter("test.registry.other", {{"key", "a"}}));
+
+    WHEN("the metrics are dumped as JSON")
+    {
+        counter.add(3);
+        registry.gauge("test.registry.gauge").set(-2);
+        registry.histogram("test.registry.histogram", {{"key", "a\"b"}}).record(42);
+
+        std::ostringstream out;
+        registry.json_dump(out);
+        auto json = out.str();
+        INFO("json: " << json);
+
+        THEN("they are all reported")
+        {
+            using namespace Catch::Matchers;
+
+            REQUIRE_THAT(json, StartsWith("{\"counters\":["));
+            REQUIRE_THAT(json, ContainsSubstring(R"({"name":"test.registry.counter","labels":{"key":"a"},"value":3})"));
+            REQUIRE_THAT(json, ContainsSubstring(R"({"name":"test.registry.gauge","labels":{},"value":-2})"));
+            REQUIRE_THAT(json,
+                         ContainsSubstring(R"({"name":"test.registry.histogram","labels":{"key":"a\"b"},"count":1,)"));
+            REQUIRE_THAT(json, ContainsSubstring(R"("buckets":[[43,1]]})"));
+        }
+    }
+
+    WHEN("the metrics having a label value are removed")
+    {
+        registry.counter("test.registry.removed", {{"device", "a/b/c"}, {"operation", "ping"}}).add();
+        registry.histogram("test.registry.removed", {{"device", "a/b/c"}}, 1).record(1);
+        registry.counter("test.registry.removed", {{"device", "a/b/d"}}).add();
+
+        registry.remove("device", "a/b/c");
+
+        std::ostringstream out;
+        registry.json_dump(out);
+        auto json = out.str();
+        INFO("json: " << json);
+
+        THEN("only the metrics of the other label values are reported")
+        {
+            using namespace Catch::Matchers;
+
+            REQUIRE_THAT(json, !ContainsSubstring("a/b/c"));
+            REQUIRE_THAT(json, ContainsSubstring(R"({"name":"test.registry.removed","labels":{"device":"a/b/d"})"));
+        }
+    }
+}
+
+SCENARIO("The admin device reports the request and polling metrics")
+{
+    int idlver = GENERATE(TangoTest::idlversion(4));
+    GIVEN("a device proxy to a IDLv" << idlver << " device with a polled command")
+    {
+        TangoTest::Context ctx{"metrics", "MetricsDev", idlver};
+        auto device = ctx.get_proxy();
+        auto admin = ctx.get_admin_proxy();
+        // the metrics are labelled with the lower case device name
+        std::string device_name = device->name();
+        std::transform(device_name.begin(), device_name.end(), device_name.begin(), ::tolower);
+
+        WHEN("we execute a command which succeeds and a command which fails")
+        {
+            REQUIRE_NOTHROW(device->command_inout("Succeed"));
+            REQUIRE_THROWS(device->command_inout("Fail"));
+
+            // Let the polling thread poll the command a few times
+            std::this_thread::sleep_for(std::chrono::milliseconds(3 * k_polling_period));
+
+            THEN("QueryMetrics reports the requests, the error and the polling lateness of the device")
+            {
+                using namespace Catch::Matchers;
+
+                Tango::DeviceData dd;
+                REQUIRE_NOTHROW(dd = admin->command_inout("QueryMetrics"));
+
+                std::string json;
+                dd >> json;
+                INFO("QueryMetrics returned: " << json);
+
+                std::string labels = R"("labels":{"device":")" + device_name + R"(","operation":"command_inout)";
+                REQUIRE_THAT(json, ContainsSubstring(R"({"name":"tango.server.request.duration",)" + labels));
+                REQUIRE_THAT(json, ContainsSubstring(R"({"name":"tango.server.request.errors",)" + labels));
+                REQUIRE_THAT(json,
+                             ContainsSubstring(R"({"name":"tango.server.polling.lateness","labels":{"device":")" +
+                                               device_name + "\"}"));
+            }
+        }
+    }
+}
+
+namespace
+{
+
+// Return the value of a counter without labels reported by QueryMetrics
+std::uint64_t query_counter(Tango::DeviceProxy &admin, const std::string &name)
+{
+    Tango::DeviceData dd = admin.command_inout("QueryMetrics");
+    std::string json;
+    dd >> json;
+
+    std::string prefix = R"({"name":")" + name + R"(","labels":{},"value":)";
+    auto pos = json.find(prefix);
+    return pos == std::string::npos ? 0 : std::stoull(json.substr(pos + prefix.size()));
+}
+
+} // namespace
+
+SCENARIO("Polled attribute values are marshalled once for all the event types")
+{
+    int idlver = GENERATE(TangoTest::idlversion(5));
+    GIVEN("a device proxy to a IDLv" << idlver << " device with a polled attribute")
+    {
+        TangoTest::Context ctx{"metrics", "MetricsDev", idlver};
+        auto device = ctx.get_proxy();
+        auto admin = ctx.get_admin_proxy();
+
+        WHEN("we subscribe to the change and archive events of the attribute")
+        {
+            std::uint64_t saved = query_counter(*admin, Tango::detail::METRIC_EVENTS_MARSHALLING_SAVED);
+
+            TangoTest::CallbackMock<Tango::EventData> change_callback;
+            TangoTest::CallbackMock<Tango::EventData> archive_callback;
+            REQUIRE_NOTHROW(device->subscribe_event("attr", Tango::CHANGE_EVENT, &change_callback));
+            REQUIRE_NOTHROW(device->subscribe_event("attr", Tango::ARCHIVE_EVENT, &archive_callback));
+
+            THEN("the events fired by a poll cycle reuse the same marshalled value")
+            {
+                // The initial events sent by the subscriptions
+                REQUIRE(change_callback.pop_next_event() != std::nullopt);
+                REQUIRE(archive_callback.pop_next_event() != std::nullopt);
+
+                auto change_event = change_callback.pop_next_event();
+                auto archive_event = archive_callback.pop_next_event();
+                REQUIRE(change_event != std::nullopt);
+                REQUIRE(archive_event != std::nullopt);
+                REQUIRE(!change_event->err);
+                REQUIRE(!archive_event->err);
+
+                REQUIRE(query_counter(*admin, Tango::detail::METRIC_EVENTS_MARSHALLING_SAVED) > saved);
+                REQUIRE(query_counter(*admin, Tango::detail::METRIC_EVENTS_MARSHALLING_SAVED_BYTES) > 0);
+            }
+        }
+    }
+}
+
+SCENARIO("Metrics update throughput", "[.][benchmark]")
+{
+    Tango::detail::Counter counter;
+    Tango::detail::Histogram histogram;
+    std::uint64_t value = 0;
+
+    BENCHMARK("counter")
+    {
+        counter.add();
+        return counter.value();
+    };
+
+    BENCHMARK("histogram")
+    {
+        histogram.record(value++ % 100000);
+        return value;
+    };
+
+    BENCHMARK("histogram timer")
+    {
+        Tango::detail::HistogramTimer timer(histogram);
+        return value;
+    };
+}
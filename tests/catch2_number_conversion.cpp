@@ -0,0 +1,263 @@
+#include "catch2_common.h"
+
+#include <tango/internal/number_conversion.h>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <cmath>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <vector>
+
+namespace
+{
+
+// Decimal separator is a comma, thousands are grouped
+struct CommaNumpunct : std::numpunct<char>
+{
+    char do_decimal_point() const override
+    {
+        return ',';
+    }
+
+    char do_thousands_sep() const override
+    {
+        return '.';
+    }
+
+    std::string do_grouping() const override
+    {
+        return "\3";
+    }
+};
+
+// Set a global locale with a comma as decimal separator for the lifetime of the object
+class CommaLocale
+{
+  public:
+    CommaLocale() :
+        old(std::locale::global(std::locale(std::locale::classic(), new CommaNumpunct)))
+    {
+    }
+
+    ~CommaLocale()
+    {
+        std::locale::global(old);
+    }
+
+  private:
+    std::locale old;
+};
+
+template <typename T>
+std::string format_with_stream(T value)
+{
+    std::ostringstream str;
+    str.imbue(std::locale::classic());
+    str.precision(Tango::TANGO_FLOAT_PRECISION);
+    str << value;
+    return str.str();
+}
+
+template <typename T>
+bool parse_with_stream(const std::string &input, T &value)
+{
+    std::istringstream str(input);
+    str.imbue(std::locale::classic());
+    return static_cast<bool>(str >> value);
+}
+
+} // namespace
+
+TEMPLATE_TEST_CASE("Numbers are converted like with the streams",
+                   "",
+                   short,
+                   unsigned short,
+                   Tango::DevLong,
+                   Tango::DevULong,
+                   Tango::DevLong64,
+                   Tango::DevULong64,
+                   float,
+                   double)
+{
+    auto input = GENERATE(as<std::string>{},
+                          "0",
+                          "42",
+                          "-42",
+                          "+42",
+                          "  17",
+                          "12abc",
+                          "3.25",
+                          "-0.5",
+                          ".5",
+                          "1e3",
+                          "1.5E-2",
+                          "1e",
+                          "1e+",
+                          "65536",
+                          "4294967296",
+                          "-9223372036854775809",
+                          "99999999999999999999",
+                          "1e-400",
+                          "1e400",
+                          "",
+                          " ",
+                          "-",
+                          "+-1",
+                          "abc",
+                          "nan",
+                          "inf");
+
+    TestType expected{};
+    bool expected_ok = parse_with_stream(input, expected);
+
+    TestType value{};
+    INFO("Parsing \"" << input << "\"");
+    REQUIRE(Tango::detail::parse_number_prefix(input, value) == expected_ok);
+    if(expected_ok)
+    {
+        REQUIRE(value == expected);
+        REQUIRE(Tango::detail::format_number(value) == format_with_stream(value));
+    }
+}
+
+SCENARIO("A number must fill the whole string to be parsed")
+{
+    double value = 1;
+    REQUIRE(Tango::detail::parse_number(" 2.5", value));
+    REQUIRE(value == 2.5);
+
+    REQUIRE(!Tango::detail::parse_number("2.5 ", value));
+    REQUIRE(!Tango::detail::parse_number("2.5mA", value));
+    REQUIRE(!Tango::detail::parse_number("", value));
+    REQUIRE(value == 2.5);
+}
+
+SCENARIO("Floating point numbers are formatted with the Tango precision")
+{
+    auto value = GENERATE(0.0, 1.0, -1.5, 0.1, 1.0 / 3.0, 1e-300, 1e300, 123456789012345678.0);
+
+    std::string str = Tango::detail::format_number(value);
+    REQUIRE(str == format_with_stream(value));
+
+    double parsed = 0;
+    REQUIRE(Tango::detail::parse_number(str, parsed));
+    REQUIRE(str == Tango::detail::format_number(parsed));
+
+    REQUIRE(Tango::detail::format_number(std::numeric_limits<double>::infinity()) == "inf");
+    REQUIRE(Tango::detail::format_number(-std::numeric_limits<float>::infinity()) == "-inf");
+    REQUIRE(std::isnan(std::stod(Tango::detail::format_number(std::numeric_limits<double>::quiet_NaN()))));
+}
+
+SCENARIO("Number conversions do not depend on the global locale")
+{
+    GIVEN("A global locale using a comma as decimal separator")
+    {
+        CommaLocale locale;
+
+        WHEN("Converting numbers")
+        {
+            THEN("The classic locale is used")
+            {
+                REQUIRE(Tango::detail::format_number(2.5) == "2.5");
+                REQUIRE(Tango::detail::format_number(Tango::DevLong{1234567}) == "1234567");
+
+                double db = 0;
+                REQUIRE(Tango::detail::parse_number("2.5", db));
+                REQUIRE(db == 2.5);
+                REQUIRE(!Tango::detail::parse_number("2,5", db));
+            }
+        }
+
+        WHEN("Converting properties with a DbDatum")
+        {
+            Tango::DbDatum datum("prop");
+            datum << std::vector<double>{0.25, -1e20};
+
+            THEN("The classic locale is used")
+            {
+                REQUIRE(datum.value_string == std::vector<std::string>{"0.25", "-1e+20"});
+
+                std::vector<double> values;
+                REQUIRE(datum >> values);
+                REQUIRE(values == std::vector<double>{0.25, -1e20});
+            }
+        }
+    }
+}
+
+SCENARIO("DbDatum extracts the special floating point values")
+{
+    Tango::DbDatum datum("prop");
+    datum.value_string = {"NaN", "-nan", "inf", "+Inf", "-INF", "1.5"};
+    datum.exceptions(0);
+
+    std::vector<double> values;
+    REQUIRE(datum >> values);
+    REQUIRE(std::isnan(values[0]));
+    REQUIRE(std::isnan(values[1]));
+    REQUIRE(values[2] == std::numeric_limits<double>::infinity());
+    REQUIRE(values[3] == std::numeric_limits<double>::infinity());
+    REQUIRE(values[4] == -std::numeric_limits<double>::infinity());
+    REQUIRE(values[5] == 1.5);
+
+    datum.value_string = {"1.5", "one"};
+    std::vector<float> floats;
+    REQUIRE(!(datum >> floats));
+
+    datum.value_string = {"-inf"};
+    float fl = 0;
+    REQUIRE(datum >> fl);
+    REQUIRE(fl == -std::numeric_limits<float>::infinity());
+}
+
+SCENARIO("Property conversion throughput", "[.][benchmark]")
+{
+    GIVEN("A property holding 100000 doubles")
+    {
+        constexpr std::size_t k_size = 100000;
+        std::vector<double> values(k_size);
+        for(std::size_t i = 0; i < k_size; ++i)
+        {
+            values[i] = std::sin(static_cast<double>(i)) * 1000;
+        }
+
+        Tango::DbDatum datum("prop");
+        datum << values;
+
+        BENCHMARK("insert")
+        {
+            Tango::DbDatum tmp("prop");
+            tmp << values;
+            return tmp.value_string.size();
+        };
+
+        BENCHMARK("extract")
+        {
+            std::vector<double> out;
+            datum >> out;
+            return out.size();
+        };
+
+        BENCHMARK("insert with streams")
+        {
+            std::vector<std::string> strings(k_size);
+            for(std::size_t i = 0; i < k_size; ++i)
+            {
+                strings[i] = format_with_stream(values[i]);
+            }
+            return strings.size();
+        };
+
+        BENCHMARK("extract with streams")
+        {
+            std::vector<double> out(k_size);
+            for(std::size_t i = 0; i < k_size; ++i)
+            {
+                parse_with_stream(datum.value_string[i], out[i]);
+            }
+            return out.size();
+        };
+    }
+}
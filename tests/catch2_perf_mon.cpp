@@ -0,0 +1,263 @@
+#include "catch2_common.h"
+
+#include <tango/internal/perf_mon.h>
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr int k_sample_base = 100000;
+
+struct TestSample
+{
+    int value = 0;
+
+    void json_dump(std::ostream &os)
+    {
+        os << value;
+    }
+};
+
+using TestCollector = Tango::SampleCollector<TestSample>;
+
+// A thread remembers its ring per sample type: all the tests share the same collector, which is never deleted as the
+// rings are not
+TestCollector &get_collector()
+{
+    static TestCollector &collector = *new TestCollector;
+    return collector;
+}
+
+// Start each test from an enabled collector without samples
+TestCollector &reset_collector()
+{
+    TestCollector &collector = get_collector();
+    collector.enable(false);
+    collector.enable(true);
+    return collector;
+}
+
+std::vector<int> parse_dump(const std::string &dump)
+{
+    REQUIRE(dump.size() >= 2);
+    REQUIRE(dump.front() == '[');
+    REQUIRE(dump.back() == ']');
+
+    std::vector<int> values;
+    std::stringstream ss(dump.substr(1, dump.size() - 2));
+    std::string item;
+    while(std::getline(ss, item, ','))
+    {
+        values.push_back(std::stoi(item));
+    }
+    return values;
+}
+
+std::string dump(TestCollector &collector)
+{
+    std::stringstream ss;
+    collector.json_dump(ss);
+    return ss.str();
+}
+
+std::vector<int> dump_values(TestCollector &collector)
+{
+    return parse_dump(dump(collector));
+}
+
+void push_samples(TestCollector &collector, int producer, int nb)
+{
+    for(int index = 0; index < nb; ++index)
+    {
+        collector.push(TestSample{producer * k_sample_base + index});
+    }
+}
+
+// Start threads pushing samples at the same time. As a thread which exits gives its ring (and the samples which are
+// still in it) to the next thread, each thread waits for all the others to have their own ring before pushing
+std::vector<std::thread> start_producers(TestCollector &collector, int nb_producers, int nb_per_producer)
+{
+    auto ready = std::make_shared<std::atomic<int>>(0);
+    std::vector<std::thread> threads;
+    for(int producer = 0; producer < nb_producers; ++producer)
+    {
+        threads.emplace_back(
+            [&collector, ready, producer, nb_producers, nb_per_producer]()
+            {
+                collector.push(TestSample{producer * k_sample_base});
+                ++*ready;
+                while(ready->load() != nb_producers)
+                {
+                    std::this_thread::yield();
+                }
+                for(int index = 1; index < nb_per_producer; ++index)
+                {
+                    collector.push(TestSample{producer * k_sample_base + index});
+                }
+            });
+    }
+    return threads;
+}
+
+// Check that each producer sample is there once, the samples of a producer being in the order they were pushed
+void require_all_samples(const std::vector<int> &values, int nb_producers, int nb_per_producer)
+{
+    std::map<int, std::vector<int>> per_producer;
+    for(int value : values)
+    {
+        per_producer[value / k_sample_base].push_back(value % k_sample_base);
+    }
+
+    REQUIRE(per_producer.size() == static_cast<size_t>(nb_producers));
+    for(const auto &[producer, indexes] : per_producer)
+    {
+        INFO("producer " << producer);
+        REQUIRE(indexes.size() == static_cast<size_t>(nb_per_producer));
+        for(int index = 0; index < nb_per_producer; ++index)
+        {
+            REQUIRE(indexes[index] == index);
+        }
+    }
+}
+
+} // anonymous namespace
+
+SCENARIO("Samples collector gathers the samples of several threads")
+{
+    GIVEN("an enabled collector")
+    {
+        TestCollector &collector = reset_collector();
+        constexpr int k_producers = 4;
+        constexpr int k_samples = static_cast<int>(TestCollector::k_ring_size);
+
+        WHEN("several threads push as many samples as their ring can hold")
+        {
+            std::vector<std::thread> threads = start_producers(collector, k_producers, k_samples);
+            for(auto &thread : threads)
+            {
+                thread.join();
+            }
+
+            THEN("each sample is dumped once")
+            {
+                require_all_samples(dump_values(collector), k_producers, k_samples);
+
+                AND_THEN("the next dump is empty")
+                {
+                    REQUIRE(dump_values(collector).empty());
+                }
+            }
+        }
+
+        WHEN("a thread pushes more samples than its ring can hold")
+        {
+            std::thread thread{[&collector]() { push_samples(collector, 0, k_samples + 10); }};
+            thread.join();
+
+            THEN("the samples which do not fit are dropped")
+            {
+                require_all_samples(dump_values(collector), 1, k_samples);
+            }
+        }
+
+        WHEN("the collector is disabled")
+        {
+            collector.enable(false);
+
+            THEN("it dumps null")
+            {
+                REQUIRE(dump(collector) == "null");
+            }
+        }
+    }
+}
+
+SCENARIO("Samples collector reuses the rings of the threads which exited")
+{
+    GIVEN("an enabled collector")
+    {
+        TestCollector &collector = reset_collector();
+        constexpr int k_producers = 8;
+        constexpr int k_samples = static_cast<int>(TestCollector::k_ring_size) / k_producers;
+
+        WHEN("threads push samples one after the other")
+        {
+            std::thread first{[&collector]() { push_samples(collector, 0, k_samples); }};
+            first.join();
+            size_t nb_rings = collector.get_nb_rings();
+
+            for(int producer = 1; producer < k_producers; ++producer)
+            {
+                std::thread thread{[&collector, producer]() { push_samples(collector, producer, k_samples); }};
+                thread.join();
+            }
+
+            THEN("no ring is added")
+            {
+                REQUIRE(collector.get_nb_rings() == nb_rings);
+
+                AND_THEN("the samples of all the threads are dumped once")
+                {
+                    require_all_samples(dump_values(collector), k_producers, k_samples);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Samples collector can be dumped while threads push samples")
+{
+    GIVEN("an enabled collector")
+    {
+        TestCollector &collector = reset_collector();
+        constexpr int k_producers = 4;
+        constexpr int k_samples = static_cast<int>(TestCollector::k_ring_size);
+
+        WHEN("samples are dumped while several threads push them")
+        {
+            std::atomic<bool> done{false};
+            std::vector<std::string> dumps;
+            std::thread dumper{[&collector, &done, &dumps]()
+                               {
+                                   while(!done.load())
+                                   {
+                                       std::string dumped = dump(collector);
+                                       if(dumped != "[]")
+                                       {
+                                           dumps.push_back(dumped);
+                                       }
+                                   }
+                               }};
+
+            std::vector<std::thread> threads = start_producers(collector, k_producers, k_samples);
+            for(auto &thread : threads)
+            {
+                thread.join();
+            }
+            done = true;
+            dumper.join();
+
+            dumps.push_back(dump(collector));
+
+            std::vector<int> values;
+            for(const auto &dumped : dumps)
+            {
+                std::vector<int> dumped_values = parse_dump(dumped);
+                values.insert(values.end(), dumped_values.begin(), dumped_values.end());
+            }
+
+            THEN("each sample is dumped once")
+            {
+                require_all_samples(values, k_producers, k_samples);
+            }
+        }
+    }
+}
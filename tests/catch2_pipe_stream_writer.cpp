@@ -0,0 +1,196 @@
+#include "catch2_common.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace
+{
+
+using CallbackMockType = TangoTest::CallbackMock<Tango::PipeEventData>;
+
+constexpr Tango::DevLong k_counter = 42;
+const std::vector<Tango::DevDouble> k_values{1.5, 2.5, 3.5};
+const std::string k_label = "stream";
+const std::vector<Tango::DevBoolean> k_flags{true, false, true};
+
+void fill_writer(Tango::PipeStreamWriter &writer)
+{
+    writer.add("counter", k_counter);
+    writer.add("values", k_values);
+    writer.add("label", k_label);
+    writer.begin_blob("inner", "inner_blob");
+    writer.add("state", Tango::ON);
+    writer.add("flags", k_flags);
+    writer.end_blob();
+}
+
+void fill_blob(Tango::DevicePipeBlob &blob)
+{
+    std::vector<Tango::DevDouble> values = k_values;
+    std::vector<Tango::DevBoolean> flags = k_flags;
+
+    Tango::DevicePipeBlob inner("inner_blob");
+    inner.set_data_elt_names({"state", "flags"});
+    inner << Tango::ON << flags;
+
+    blob.set_data_elt_names({"counter", "values", "label", "inner"});
+    blob << k_counter << values << k_label << inner;
+}
+
+} // anonymous namespace
+
+template <class Base>
+class PipeStreamDev : public Base
+{
+  public:
+    using Base::Base;
+
+    ~PipeStreamDev() override { }
+
+    void init_device() override { }
+
+    void push_with_writer()
+    {
+        Tango::PipeStreamWriter writer("stream", "root_blob");
+        fill_writer(writer);
+        Base::push_pipe_event(writer);
+    }
+
+    void push_with_blob()
+    {
+        Tango::DevicePipeBlob blob("root_blob");
+        fill_blob(blob);
+        Base::push_pipe_event("stream", &blob);
+    }
+
+    static void command_factory(std::vector<Tango::Command *> &cmds)
+    {
+        cmds.push_back(new TangoTest::AutoCommand<&PipeStreamDev::push_with_writer>("push_with_writer"));
+        cmds.push_back(new TangoTest::AutoCommand<&PipeStreamDev::push_with_blob>("push_with_blob"));
+    }
+
+    static void pipe_factory(std::vector<Tango::Pipe *> &pipes)
+    {
+        pipes.push_back(new Tango::Pipe("stream", Tango::OPERATOR));
+    }
+};
+
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(PipeStreamDev, 5)
+
+SCENARIO("Pipe events can be built with a PipeStreamWriter")
+{
+    int idlver = GENERATE(TangoTest::idlversion(5));
+    std::string cmd = GENERATE(as<std::string>(), "push_with_writer", "push_with_blob");
+    GIVEN("a device proxy to an IDLv" << idlver << " device with a pipe")
+    {
+        TangoTest::Context ctx{"pipe_stream", "PipeStreamDev", idlver};
+        std::shared_ptr<Tango::DeviceProxy> device = ctx.get_proxy();
+
+        CallbackMockType cb;
+        TangoTest::Subscription sub{device, "stream", Tango::PIPE_EVENT, &cb};
+
+        // The pipe has no read method, the event sent at subscription reports an error
+        REQUIRE(cb.pop_next_event() != std::nullopt);
+
+        WHEN("an event is pushed with " << cmd)
+        {
+            device->command_inout(cmd);
+
+            THEN("the event holds the pushed data elements")
+            {
+                auto event = cb.pop_next_event();
+                REQUIRE(event != std::nullopt);
+                REQUIRE(!event->err);
+
+                Tango::DevicePipe &pipe = *event->pipe_value;
+                REQUIRE(pipe.get_root_blob_name() == "root_blob");
+                REQUIRE(pipe.get_data_elt_names() == std::vector<std::string>{"counter", "values", "label", "inner"});
+
+                Tango::DevLong counter;
+                std::vector<Tango::DevDouble> values;
+                std::string label;
+                Tango::DevicePipeBlob inner;
+                pipe >> counter >> values >> label >> inner;
+
+                REQUIRE(counter == k_counter);
+                REQUIRE(values == k_values);
+                REQUIRE(label == k_label);
+                REQUIRE(inner.get_name() == "inner_blob");
+
+                Tango::DevState state;
+                std::vector<Tango::DevBoolean> flags;
+                inner >> state >> flags;
+
+                REQUIRE(state == Tango::ON);
+                REQUIRE(flags == k_flags);
+            }
+        }
+    }
+}
+
+SCENARIO("PipeStreamWriter detects unbalanced inner blobs")
+{
+    GIVEN("a pipe stream writer")
+    {
+        Tango::PipeStreamWriter writer("stream");
+
+        WHEN("an inner blob is ended without being started")
+        {
+            THEN("an exception is thrown")
+            {
+                using namespace TangoTest::Matchers;
+
+                REQUIRE_THROWS_MATCHES(
+                    writer.end_blob(), Tango::DevFailed, FirstErrorMatches(Reason(Tango::API_PipeWrongArg)));
+            }
+        }
+    }
+}
+
+SCENARIO("Building and marshalling a pipe with many data elements", "[.][benchmark]")
+{
+    constexpr int k_nb_elt = 2000;
+
+    std::vector<std::string> names;
+    for(int i = 0; i < k_nb_elt; ++i)
+    {
+        names.push_back("elt_" + std::to_string(i));
+    }
+    std::vector<Tango::DevDouble> values(16, 1.0);
+
+    GIVEN("a pipe with " << k_nb_elt << " data elements")
+    {
+        BENCHMARK("DevicePipeBlob and DevPipeData marshalling")
+        {
+            Tango::DevicePipeBlob blob("root_blob");
+            blob.set_data_elt_names(names);
+            for(int i = 0; i < k_nb_elt; ++i)
+            {
+                blob << values;
+            }
+
+            Tango::DevPipeData pipe_data;
+            pipe_data.name = Tango::string_dup("stream");
+            pipe_data.data_blob.name = Tango::string_dup("root_blob");
+            Tango::DevVarPipeDataEltArray *elts = blob.get_insert_data();
+            pipe_data.data_blob.blob_data.replace(
+                elts->maximum(), elts->length(), elts->get_buffer((CORBA::Boolean) true), true);
+            delete elts;
+
+            cdrMemoryStream stream;
+            pipe_data >>= stream;
+            return stream.bufSize();
+        };
+
+        Tango::PipeStreamWriter writer("stream", "root_blob");
+
+        BENCHMARK("PipeStreamWriter")
+        {
+            writer.clear();
+            for(const auto &name : names)
+            {
+                writer.add(name, values);
+            }
+            return writer.get_data_elt_nb();
+        };
+    }
+}
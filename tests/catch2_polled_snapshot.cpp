@@ -0,0 +1,139 @@
+#include "catch2_common.h"
+
+template <class Base>
+class PolledSnapshotDev : public Base
+{
+  public:
+    using Base::Base;
+
+    ~PolledSnapshotDev() override { }
+
+    void init_device() override { }
+
+    void read_long(Tango::Attribute &att)
+    {
+        long_value++;
+        att.set_value(&long_value);
+    }
+
+    void read_double(Tango::Attribute &att)
+    {
+        att.set_value(&double_value);
+    }
+
+    void trigger(Tango::DevString attr)
+    {
+        Tango::Util::instance()->trigger_attr_polling(this, attr);
+    }
+
+    static void attribute_factory(std::vector<Tango::Attr *> &attrs)
+    {
+        attrs.push_back(new TangoTest::AutoAttr<&PolledSnapshotDev::read_long>("long_attr", Tango::DEV_LONG));
+        attrs.push_back(new TangoTest::AutoAttr<&PolledSnapshotDev::read_double>("double_attr", Tango::DEV_DOUBLE));
+        attrs.push_back(new TangoTest::AutoAttr<&PolledSnapshotDev::read_double>("not_polled", Tango::DEV_DOUBLE));
+    }
+
+    static void command_factory(std::vector<Tango::Command *> &cmds)
+    {
+        cmds.push_back(new TangoTest::AutoCommand<&PolledSnapshotDev::trigger>("trigger"));
+    }
+
+  private:
+    Tango::DevLong long_value{0};
+    Tango::DevDouble double_value{1.5};
+};
+
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(PolledSnapshotDev, 5)
+
+namespace
+{
+
+void trigger(const std::shared_ptr<Tango::DeviceProxy> &device, const std::string &attr)
+{
+    Tango::DeviceData din;
+    din << attr;
+    device->command_inout("trigger", din);
+}
+
+std::vector<std::string> names_of(const std::vector<Tango::DeviceAttribute> &values)
+{
+    std::vector<std::string> names;
+    for(const auto &value : values)
+    {
+        names.push_back(value.get_name());
+    }
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+} // anonymous namespace
+
+SCENARIO("The last polled value of all polled attributes can be read at once")
+{
+    int idlver = GENERATE(TangoTest::idlversion(5));
+    GIVEN("a device proxy to an IDLv" << idlver << " device with externally triggered polled attributes")
+    {
+        TangoTest::Context ctx{"polled_snapshot", "PolledSnapshotDev", idlver};
+        std::shared_ptr<Tango::DeviceProxy> device = ctx.get_proxy();
+
+        device->poll_attribute("long_attr", 0);
+        device->poll_attribute("double_attr", 0);
+        trigger(device, "long_attr");
+        trigger(device, "double_attr");
+
+        WHEN("a snapshot of the polled attributes is read")
+        {
+            Tango::DevULong64 seq = 0;
+            std::unique_ptr<std::vector<Tango::DeviceAttribute>> values{device->read_polled_snapshot(seq)};
+
+            THEN("the last polled value of each polled attribute is returned")
+            {
+                REQUIRE(seq != 0);
+                REQUIRE(names_of(*values) == std::vector<std::string>{"double_attr", "long_attr"});
+
+                for(auto &value : *values)
+                {
+                    if(value.get_name() == "long_attr")
+                    {
+                        Tango::DevLong long_value;
+                        value >> long_value;
+                        REQUIRE(long_value == 1);
+                    }
+                    else
+                    {
+                        Tango::DevDouble double_value;
+                        value >> double_value;
+                        REQUIRE(double_value == 1.5);
+                    }
+                }
+            }
+
+            AND_WHEN("a snapshot is read again with the returned sequence number")
+            {
+                Tango::DevULong64 first_seq = seq;
+                values.reset(device->read_polled_snapshot(seq));
+
+                THEN("no attribute is returned")
+                {
+                    REQUIRE(values->empty());
+                    REQUIRE(seq == first_seq);
+                }
+            }
+
+            AND_WHEN("one attribute is polled again before the next snapshot")
+            {
+                trigger(device, "long_attr");
+                values.reset(device->read_polled_snapshot(seq));
+
+                THEN("only this attribute is returned")
+                {
+                    REQUIRE(names_of(*values) == std::vector<std::string>{"long_attr"});
+
+                    Tango::DevLong long_value;
+                    (*values)[0] >> long_value;
+                    REQUIRE(long_value == 2);
+                }
+            }
+        }
+    }
+}
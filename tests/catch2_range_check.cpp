@@ -0,0 +1,250 @@
+#include "catch2_common.h"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <tango/internal/server/range_check.h>
+
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+
+template <typename T>
+std::size_t scalar_find_first_at_or_below(const std::vector<T> &data, T threshold)
+{
+    for(std::size_t i = 0; i < data.size(); ++i)
+    {
+        if(data[i] <= threshold)
+        {
+            return i;
+        }
+    }
+    return data.size();
+}
+
+template <typename T>
+std::size_t scalar_find_first_out_of_range(const std::vector<T> &data, const Tango::detail::RangeCheck<T> &check)
+{
+    for(std::size_t i = 0; i < data.size(); ++i)
+    {
+        if((check.check_low && (check.inclusive ? data[i] <= check.low : data[i] < check.low)) ||
+           (check.check_high && (check.inclusive ? data[i] >= check.high : data[i] > check.high)) ||
+           (check.check_finite && Tango::detail::is_not_finite(data[i])))
+        {
+            return i;
+        }
+    }
+    return data.size();
+}
+
+// All the kernels supported by this build and this CPU
+std::vector<Tango::detail::RangeCheckKernel> supported_kernels()
+{
+    using Tango::detail::RangeCheckKernel;
+
+    std::vector<RangeCheckKernel> kernels{RangeCheckKernel::SCALAR};
+    for(auto kernel : {RangeCheckKernel::SSE2, RangeCheckKernel::AVX2})
+    {
+        if(kernel <= Tango::detail::range_check_kernel())
+        {
+            kernels.push_back(kernel);
+        }
+    }
+    return kernels;
+}
+
+std::string kernel_name(Tango::detail::RangeCheckKernel kernel)
+{
+    switch(kernel)
+    {
+    case Tango::detail::RangeCheckKernel::SSE2:
+        return "SSE2";
+    case Tango::detail::RangeCheckKernel::AVX2:
+        return "AVX2";
+    default:
+        return "scalar";
+    }
+}
+
+} // anonymous namespace
+
+TEMPLATE_TEST_CASE("find_first_if returns the first matching element",
+                   "",
+                   Tango::DevShort,
+                   Tango::DevLong,
+                   Tango::DevLong64,
+                   Tango::DevFloat,
+                   Tango::DevDouble,
+                   Tango::DevUChar,
+                   Tango::DevUShort,
+                   Tango::DevULong,
+                   Tango::DevULong64)
+{
+    const TestType threshold = 10;
+    auto at_or_below = [threshold](const TestType &val) { return val <= threshold; };
+
+    std::size_t nb = GENERATE(0, 1, 63, 64, 65, 1000);
+    std::vector<TestType> data(nb, 20);
+
+    REQUIRE(Tango::detail::find_first_if(data.data(), nb, at_or_below) == nb);
+
+    for(std::size_t pos : {std::size_t{0}, nb / 2, nb - 1})
+    {
+        if(nb == 0)
+        {
+            break;
+        }
+
+        std::vector<TestType> modified = data;
+        modified[pos] = threshold;
+        if(pos + 1 < nb)
+        {
+            modified.back() = 0;
+        }
+
+        REQUIRE(Tango::detail::find_first_if(modified.data(), nb, at_or_below) ==
+                scalar_find_first_at_or_below(modified, threshold));
+    }
+}
+
+TEMPLATE_TEST_CASE("find_first_if keeps the comparison semantics for NaN", "", Tango::DevFloat, Tango::DevDouble)
+{
+    const TestType nan = std::numeric_limits<TestType>::quiet_NaN();
+    std::vector<TestType> data(200, nan);
+
+    auto at_or_below = [](const TestType &val) { return val <= 0; };
+    auto not_finite = [](const TestType &val) { return Tango::detail::is_not_finite(val); };
+
+    REQUIRE(Tango::detail::find_first_if(data.data(), data.size(), at_or_below) == data.size());
+    REQUIRE(Tango::detail::find_first_if(data.data(), data.size(), not_finite) == 0);
+
+    data[150] = -1;
+    REQUIRE(Tango::detail::find_first_if(data.data(), data.size(), at_or_below) == 150);
+
+    std::vector<TestType> finite(200, 1);
+    finite[70] = std::numeric_limits<TestType>::infinity();
+    REQUIRE(Tango::detail::find_first_if(finite.data(), finite.size(), not_finite) == 70);
+}
+
+TEMPLATE_TEST_CASE("find_first_out_of_range kernels match the element per element check",
+                   "",
+                   Tango::DevLong64,
+                   Tango::DevDouble,
+                   Tango::DevULong64)
+{
+    Tango::detail::RangeCheck<TestType> check{10, 100};
+    check.inclusive = GENERATE(true, false);
+    check.check_low = GENERATE(true, false);
+    check.check_high = GENERATE(true, false);
+    check.check_finite = GENERATE(true, false) && std::is_floating_point_v<TestType>;
+
+    std::size_t nb = GENERATE(0, 1, 7, 16, 17, 64, 1000);
+    std::vector<TestType> data(nb, 50);
+
+    std::vector<TestType> values{check.low,
+                                 check.high,
+                                 check.low - 1,
+                                 check.high + 1,
+                                 std::numeric_limits<TestType>::lowest(),
+                                 std::numeric_limits<TestType>::max()};
+    if constexpr(std::is_floating_point_v<TestType>)
+    {
+        values.push_back(std::numeric_limits<TestType>::quiet_NaN());
+        values.push_back(std::numeric_limits<TestType>::infinity());
+        values.push_back(-std::numeric_limits<TestType>::infinity());
+    }
+
+    for(auto kernel : supported_kernels())
+    {
+        INFO("kernel " << kernel_name(kernel));
+
+        REQUIRE(Tango::detail::find_first_out_of_range(data.data(), nb, check, kernel) ==
+                scalar_find_first_out_of_range(data, check));
+
+        for(std::size_t pos : {std::size_t{0}, nb / 2, nb - 1})
+        {
+            if(nb == 0)
+            {
+                break;
+            }
+
+            for(auto value : values)
+            {
+                std::vector<TestType> modified = data;
+                modified[pos] = value;
+                INFO("value " << value << " at " << pos);
+                REQUIRE(Tango::detail::find_first_out_of_range(modified.data(), nb, check, kernel) ==
+                        scalar_find_first_out_of_range(modified, check));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("Checking values against a threshold",
+                   "[.][benchmark]",
+                   Tango::DevShort,
+                   Tango::DevLong,
+                   Tango::DevLong64,
+                   Tango::DevFloat,
+                   Tango::DevDouble,
+                   Tango::DevUChar,
+                   Tango::DevUShort,
+                   Tango::DevULong,
+                   Tango::DevULong64)
+{
+    const TestType threshold = 10;
+    std::size_t nb = GENERATE(16, 1024, 1024 * 1024);
+    std::vector<TestType> data(nb, 20);
+
+    BENCHMARK("element per element, " + std::to_string(nb) + " elements")
+    {
+        return scalar_find_first_at_or_below(data, threshold);
+    };
+
+    BENCHMARK("find_first_if, " + std::to_string(nb) + " elements")
+    {
+        return Tango::detail::find_first_if(
+            data.data(), data.size(), [threshold](const TestType &val) { return val <= threshold; });
+    };
+}
+
+TEMPLATE_TEST_CASE("Checking values against alarm levels and write limits",
+                   "[.][benchmark]",
+                   Tango::DevLong64,
+                   Tango::DevDouble,
+                   Tango::DevULong64)
+{
+    std::size_t nb = GENERATE(16, 1024, 1024 * 1024);
+    std::vector<TestType> data(nb, 20);
+
+    // Alarm levels are inclusive, write limits are not and also check for NaN
+    Tango::detail::RangeCheck<TestType> alarm{10, 30, true, true, true};
+    Tango::detail::RangeCheck<TestType> limits{10, 30, true, true, false, std::is_floating_point_v<TestType>};
+
+    BENCHMARK("element per element alarm levels, " + std::to_string(nb) + " elements")
+    {
+        return scalar_find_first_out_of_range(data, alarm);
+    };
+
+    BENCHMARK("element per element write limits, " + std::to_string(nb) + " elements")
+    {
+        return scalar_find_first_out_of_range(data, limits);
+    };
+
+    for(auto kernel : supported_kernels())
+    {
+        BENCHMARK(kernel_name(kernel) + " alarm levels, " + std::to_string(nb) + " elements")
+        {
+            return Tango::detail::find_first_out_of_range(data.data(), data.size(), alarm, kernel);
+        };
+
+        BENCHMARK(kernel_name(kernel) + " write limits, " + std::to_string(nb) + " elements")
+        {
+            return Tango::detail::find_first_out_of_range(data.data(), data.size(), limits, kernel);
+        };
+    }
+}
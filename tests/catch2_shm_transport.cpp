@@ -0,0 +1,361 @@
+#include "catch2_common.h"
+
+#include <tango/internal/metrics.h>
+#include <tango/internal/net.h>
+#include <tango/internal/shm_ring.h>
+
+#ifndef _TG_WINDOWS_
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <sys/wait.h>
+  #include <unistd.h>
+#endif
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+constexpr long k_nb_values = 100000;
+
+std::uint64_t client_counter(const char *name)
+{
+    return Tango::detail::MetricsRegistry::instance().counter(name).value();
+}
+
+} // anonymous namespace
+
+template <class Base>
+class ShmTransportDev : public Base
+{
+  public:
+    using Base::Base;
+
+    ~ShmTransportDev() override { }
+
+    void init_device() override
+    {
+        values.assign(k_nb_values, 0.0);
+        Base::set_change_event("values", true, false);
+    }
+
+    void read_values(Tango::Attribute &att)
+    {
+        att.set_value(values.data(), values.size());
+    }
+
+    void change()
+    {
+        for(auto &value : values)
+        {
+            value += 1.0;
+        }
+        Base::push_change_event("values", values.data(), values.size());
+    }
+
+    static void attribute_factory(std::vector<Tango::Attr *> &attrs)
+    {
+        attrs.push_back(new TangoTest::AutoSpectrumAttr<&ShmTransportDev::read_values>(
+            "values", Tango::DEV_DOUBLE, k_nb_values));
+    }
+
+    static void command_factory(std::vector<Tango::Command *> &cmds)
+    {
+        cmds.push_back(new TangoTest::AutoCommand<&ShmTransportDev::change>("change"));
+    }
+
+  private:
+    std::vector<Tango::DevDouble> values;
+};
+
+TANGO_TEST_AUTO_DEV_TMPL_INSTANTIATE(ShmTransportDev, 5)
+
+SCENARIO("Attribute events can be received through the shm transport")
+{
+    int idlver = GENERATE(TangoTest::idlversion(5));
+    bool server_shm = GENERATE(true, false);
+    const char *server_desc = server_shm ? "with" : "without";
+    GIVEN("a device proxy with the shm transport to an IDLv" << idlver << " device " << server_desc
+                                                            << " the shm transport")
+    {
+        std::string instance_name = server_shm ? "shm_on" : "shm_off";
+        std::vector<std::string> env{std::string("TANGO_SHM_TRANSPORT=") + (server_shm ? "on" : "off")};
+        TangoTest::Context ctx{instance_name, "ShmTransportDev", idlver, std::move(env)};
+        std::shared_ptr<Tango::DeviceProxy> device = ctx.get_proxy();
+        device->set_shm_transport(true);
+        REQUIRE(device->get_shm_transport());
+
+#ifdef _TG_WINDOWS_
+        bool expect_shm = false;
+#else
+        bool expect_shm = server_shm;
+#endif
+
+        WHEN("change events are subscribed and pushed")
+        {
+            TangoTest::CallbackMock<Tango::EventData> callback;
+            TangoTest::Subscription sub{device, "values", Tango::CHANGE_EVENT, &callback};
+
+            REQUIRE(callback.pop_next_event() != std::nullopt);
+
+            std::uint64_t shm_values = client_counter(Tango::detail::METRIC_CLIENT_SHM_VALUES);
+
+            device->command_inout("change");
+            device->command_inout("change");
+
+            THEN("the events hold the attribute value")
+            {
+                for(Tango::DevDouble expected : {1.0, 2.0})
+                {
+                    auto event = callback.pop_next_event();
+                    REQUIRE(event != std::nullopt);
+                    REQUIRE(!event->err);
+                    REQUIRE(event->event == "change");
+
+                    std::vector<Tango::DevDouble> received;
+                    *event->attr_value >> received;
+                    REQUIRE(received == std::vector<Tango::DevDouble>(k_nb_values, expected));
+                }
+
+                AND_THEN("the events are received through the expected transport")
+                {
+                    REQUIRE(client_counter(Tango::detail::METRIC_CLIENT_SHM_VALUES) ==
+                            shm_values + (expect_shm ? 2 : 0));
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("Clients without the shm transport are not affected")
+{
+    int idlver = GENERATE(TangoTest::idlversion(5));
+    GIVEN("two device proxies to an IDLv" << idlver << " device with the shm transport, only one using it")
+    {
+        std::vector<std::string> env{"TANGO_SHM_TRANSPORT=on"};
+        TangoTest::Context ctx{"shm_mixed", "ShmTransportDev", idlver, std::move(env)};
+        std::shared_ptr<Tango::DeviceProxy> shm_device = ctx.get_proxy();
+        shm_device->set_shm_transport(true);
+        auto net_device = std::make_shared<Tango::DeviceProxy>(shm_device->name());
+
+        TangoTest::CallbackMock<Tango::EventData> shm_callback;
+        TangoTest::CallbackMock<Tango::EventData> net_callback;
+        TangoTest::Subscription shm_sub{shm_device, "values", Tango::CHANGE_EVENT, &shm_callback};
+        TangoTest::Subscription net_sub{net_device, "values", Tango::CHANGE_EVENT, &net_callback};
+
+        REQUIRE(shm_callback.pop_next_event() != std::nullopt);
+        REQUIRE(net_callback.pop_next_event() != std::nullopt);
+
+        WHEN("an event is pushed")
+        {
+            shm_device->command_inout("change");
+
+            THEN("both clients receive it once")
+            {
+                for(auto *callback : {&shm_callback, &net_callback})
+                {
+                    auto event = callback->pop_next_event();
+                    REQUIRE(event != std::nullopt);
+                    REQUIRE(!event->err);
+
+                    std::vector<Tango::DevDouble> received;
+                    *event->attr_value >> received;
+                    REQUIRE(received == std::vector<Tango::DevDouble>(k_nb_values, 1.0));
+
+                    REQUIRE(callback->pop_next_event(std::chrono::milliseconds{300}) == std::nullopt);
+                }
+            }
+        }
+    }
+}
+
+#ifndef _TG_WINDOWS_
+
+namespace
+{
+
+std::string test_ring_name()
+{
+    static std::atomic<int> ctr{0};
+    return Tango::detail::get_shm_ring_name(getpid()) + "-test-" + std::to_string(ctr++);
+}
+
+// The pid of a process which no longer exists
+long dead_pid()
+{
+    pid_t pid = fork();
+    if(pid == 0)
+    {
+        _exit(0);
+    }
+    waitpid(pid, nullptr, 0);
+    return pid;
+}
+
+} // anonymous namespace
+
+SCENARIO("Values are read in place from the shm ring")
+{
+    GIVEN("a ring and a reader")
+    {
+        Tango::detail::ShmRingWriter writer{test_ring_name(), 2, 1024};
+        auto reader = Tango::detail::ShmRingReader::open(writer.get_name(), writer.get_key());
+        REQUIRE(reader != nullptr);
+
+        WHEN("a value is published")
+        {
+            std::vector<char> value(1000, 'a');
+            auto ref = writer.publish(value.data(), value.size());
+            REQUIRE(ref.has_value());
+
+            THEN("it is read in place")
+            {
+                std::vector<char> received;
+                REQUIRE(reader->read(*ref,
+                                     [&received](const char *data, std::size_t size)
+                                     { received.assign(data, data + size); }));
+                REQUIRE(received == value);
+            }
+
+            AND_WHEN("its slot is reused")
+            {
+                std::vector<char> other(10, 'b');
+                REQUIRE(writer.publish(other.data(), other.size()).has_value());
+                REQUIRE(writer.publish(other.data(), other.size()).has_value());
+
+                THEN("it is detected as overwritten")
+                {
+                    REQUIRE(!reader->read(*ref, [](const char *, std::size_t) { }));
+                }
+            }
+        }
+
+        WHEN("a value larger than a slot is published")
+        {
+            std::vector<char> value(1025, 'a');
+
+            THEN("it is not published")
+            {
+                REQUIRE(!writer.publish(value.data(), value.size()).has_value());
+            }
+        }
+
+        WHEN("the segment mode is checked")
+        {
+            int fd = ::shm_open(writer.get_name().c_str(), O_RDONLY, 0);
+            REQUIRE(fd != -1);
+            struct stat st;
+            int ret = ::fstat(fd, &st);
+            ::close(fd);
+            REQUIRE(ret == 0);
+
+            THEN("only the owner can access it")
+            {
+                REQUIRE((st.st_mode & 0777) == 0600);
+            }
+        }
+
+        WHEN("the ring is opened with another key")
+        {
+            THEN("it is refused")
+            {
+                REQUIRE(Tango::detail::ShmRingReader::open(writer.get_name(), writer.get_key() + 1) == nullptr);
+            }
+        }
+    }
+}
+
+SCENARIO("The shm ring can be written by several threads")
+{
+    GIVEN("a ring and a reader")
+    {
+        Tango::detail::ShmRingWriter writer{test_ring_name(), 16, 256};
+        auto reader = Tango::detail::ShmRingReader::open(writer.get_name(), writer.get_key());
+        REQUIRE(reader != nullptr);
+
+        WHEN("several threads publish values")
+        {
+            constexpr int k_threads = 4;
+            constexpr int k_values = 10000;
+            std::atomic<int> corrupted{0};
+
+            std::vector<std::thread> threads;
+            for(int th = 0; th < k_threads; ++th)
+            {
+                threads.emplace_back(
+                    [&, th]()
+                    {
+                        std::vector<char> value(200, static_cast<char>('a' + th));
+                        for(int loop = 0; loop < k_values; ++loop)
+                        {
+                            auto ref = writer.publish(value.data(), value.size());
+                            if(!ref)
+                            {
+                                continue;
+                            }
+
+                            std::vector<char> received;
+                            bool valid = reader->read(*ref,
+                                                      [&received](const char *data, std::size_t size)
+                                                      { received.assign(data, data + size); });
+                            if(valid && received != value)
+                            {
+                                corrupted++;
+                            }
+                        }
+                    });
+            }
+
+            for(auto &thread : threads)
+            {
+                thread.join();
+            }
+
+            THEN("a value which is read as valid is never mixed with another one")
+            {
+                REQUIRE(corrupted == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("Files left by crashed device servers are removed")
+{
+    GIVEN("an ipc endpoint file and a shm ring of a process which no longer exists")
+    {
+        long pid = dead_pid();
+
+        REQUIRE(!Tango::detail::get_local_ipc_dir(true).empty());
+        std::string ipc_file = Tango::detail::get_local_ipc_endpoint(pid, "1234").substr(6);
+        int fd = ::open(ipc_file.c_str(), O_CREAT | O_WRONLY, 0600);
+        REQUIRE(fd != -1);
+        ::close(fd);
+
+        std::string ring_name = Tango::detail::get_shm_ring_name(pid);
+        fd = ::shm_open(ring_name.c_str(), O_CREAT | O_RDWR, 0600);
+        REQUIRE(fd != -1);
+        ::close(fd);
+
+        WHEN("they are cleaned up")
+        {
+            Tango::detail::remove_stale_local_ipc_files();
+            Tango::detail::remove_stale_shm_rings();
+
+            THEN("they are removed")
+            {
+                REQUIRE(::access(ipc_file.c_str(), F_OK) != 0);
+  #ifdef __linux__
+                REQUIRE(::shm_open(ring_name.c_str(), O_RDONLY, 0) == -1);
+  #else
+                ::shm_unlink(ring_name.c_str());
+  #endif
+            }
+        }
+    }
+}
+
+#endif
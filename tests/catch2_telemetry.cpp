@@ -1,10 +1,57 @@
 #include "catch2_common.h"
 
+#include <catch2/benchmark/catch_benchmark.hpp>
+
 namespace
 {
 constexpr double SERVER_VALUE = 8.888;
+
+// An enabled client configuration exporting the traces to the console
+Tango::telemetry::Configuration sampling_configuration()
+{
+    Tango::telemetry::Configuration cfg{
+        "SamplingTest", "tango", Tango::telemetry::Configuration::Client{"tango.telemetry.sampling.test"}};
+    cfg.enabled = true;
+    cfg.kernel_traces_enabled = false;
+    cfg.traces_exporter = Tango::telemetry::Configuration::Exporter::console;
+    cfg.traces_endpoint = "cerr";
+    cfg.logs_exporter = Tango::telemetry::Configuration::Exporter::none;
+    return cfg;
+}
+
+int count_recorded_spans(const Tango::telemetry::InterfacePtr &interface, int nb_spans)
+{
+    int recorded = 0;
+    for(int i = 0; i < nb_spans; ++i)
+    {
+        if(interface->start_span("sampling_test")->is_recording())
+        {
+            ++recorded;
+        }
+    }
+    return recorded;
 }
 
+// Set an environment variable for the lifetime of the object
+class EnvVar
+{
+  public:
+    EnvVar(std::string name, const std::string &value) :
+        name(std::move(name))
+    {
+        set_env(this->name, value, true);
+    }
+
+    ~EnvVar()
+    {
+        unset_env(name);
+    }
+
+  private:
+    std::string name;
+};
+} // namespace
+
 template <class Base>
 class TelemetryDS : public Base
 {
@@ -203,3 +250,295 @@ SCENARIO("Telemetry DS can be restarted without memory leak")
         REQUIRE_NOTHROW(admin_dev->command_inout("RestartServer"));
     }
 }
+
+SCENARIO("Telemetry spans are sampled")
+{
+    GIVEN("a telemetry interface")
+    {
+        auto cfg = sampling_configuration();
+
+        WHEN("the sampling ratio is 0")
+        {
+            cfg.traces_sampler_ratio = 0.0;
+            auto interface = Tango::telemetry::InterfaceFactory::create(cfg);
+
+            THEN("no span is recorded")
+            {
+                REQUIRE(count_recorded_spans(interface, 100) == 0);
+            }
+        }
+
+        WHEN("the sampling ratio is 1")
+        {
+            auto interface = Tango::telemetry::InterfaceFactory::create(cfg);
+
+            THEN("all the spans are recorded")
+            {
+                REQUIRE(count_recorded_spans(interface, 10) == 10);
+            }
+        }
+
+        WHEN("a sampling rule matches the span name")
+        {
+            cfg.traces_sampler_rules = {{"*::read_attribute*", 0.0}, {"Tango::Device_5Impl::command_inout_4", 0.0}};
+            auto interface = Tango::telemetry::InterfaceFactory::create(cfg);
+
+            THEN("the ratio of the rule applies")
+            {
+                REQUIRE(!interface->start_span("Tango::Device_5Impl::read_attributes_5")->is_recording());
+                REQUIRE(!interface->start_span("Tango::Device_5Impl::command_inout_4")->is_recording());
+                REQUIRE(interface->start_span("Tango::Device_4Impl::command_inout_4")->is_recording());
+            }
+        }
+
+        WHEN("a sampling rule is only part of the span name")
+        {
+            cfg.traces_sampler_rules = {{"read_attribute", 0.0}};
+            auto interface = Tango::telemetry::InterfaceFactory::create(cfg);
+
+            THEN("the rule does not apply")
+            {
+                REQUIRE(interface->start_span("Tango::Device_5Impl::read_attributes_5")->is_recording());
+            }
+        }
+
+        WHEN("a span has a remote parent")
+        {
+            const std::string sampled_parent{"00-0af7651916cd43dd8448eb211c80319c-b7ad6b7169203331-01"};
+            const std::string dropped_parent{"00-0af7651916cd43dd8448eb211c80319c-b7ad6b7169203331-00"};
+
+            auto parent_based = GENERATE(true, false);
+            cfg.traces_sampler_ratio = parent_based ? 1.0 : 0.0;
+            cfg.traces_sampler_parent_based = parent_based;
+            auto interface = Tango::telemetry::InterfaceFactory::create(cfg);
+            Tango::telemetry::InterfaceScope interface_scope{interface};
+
+            THEN("the span follows the parent decision only if the sampler is parent based")
+            {
+                {
+                    auto scope =
+                        Tango::telemetry::Interface::set_trace_context("from_sampled_parent", sampled_parent, "");
+                    REQUIRE(interface->get_current_span()->is_recording() == parent_based);
+                }
+                {
+                    auto scope =
+                        Tango::telemetry::Interface::set_trace_context("from_dropped_parent", dropped_parent, "");
+                    REQUIRE(!interface->get_current_span()->is_recording());
+                }
+            }
+        }
+
+        WHEN("the number of spans per second is limited")
+        {
+            cfg.traces_max_rate = 2.0;
+            auto interface = Tango::telemetry::InterfaceFactory::create(cfg);
+
+            THEN("the spans above the rate are dropped")
+            {
+                int recorded = count_recorded_spans(interface, 100);
+                REQUIRE(recorded >= 2);
+                REQUIRE(recorded <= 3);
+            }
+        }
+
+        WHEN("the number of spans per second is limited and a root span is sampled")
+        {
+            // a rate used by no other test, the limiter being shared by the interfaces with the same rate
+            cfg.traces_max_rate = 5.0;
+            auto interface = Tango::telemetry::InterfaceFactory::create(cfg);
+            auto root = interface->start_span("sampling_root");
+            REQUIRE(root->is_recording());
+            auto scope = interface->scope(root, __FILE__, __LINE__);
+
+            THEN("its child spans are not limited")
+            {
+                REQUIRE(count_recorded_spans(interface, 100) == 100);
+            }
+        }
+    }
+}
+
+SCENARIO("Telemetry sampling rules match the span names")
+{
+    GIVEN("sampling rules")
+    {
+        using Rule = Tango::telemetry::Configuration::SamplingRule;
+
+        THEN("a rule without wildcard matches the exact span name only")
+        {
+            Rule rule{"Tango::Device_5Impl::read_attributes_5", 0.0};
+            REQUIRE(rule.matches("Tango::Device_5Impl::read_attributes_5"));
+            REQUIRE(!rule.matches("Tango::Device_5Impl::read_attributes_5x"));
+            REQUIRE(!rule.matches("Tango::Device_5Impl::read_attributes_"));
+        }
+
+        THEN("a '*' matches any sequence of characters")
+        {
+            REQUIRE(Rule{"*::read_attribute*", 0.0}.matches("Tango::Device_5Impl::read_attributes_5"));
+            REQUIRE(Rule{"*::read_attribute*", 0.0}.matches("Tango::DeviceProxy::read_attribute"));
+            REQUIRE(!Rule{"*::read_attribute*", 0.0}.matches("Tango::DeviceProxy::write_read_attribute"));
+            REQUIRE(Rule{"Tango::*::command_inout*", 0.0}.matches("Tango::Device_4Impl::command_inout_4"));
+            REQUIRE(Rule{"*a*b*", 0.0}.matches("xxaxxaxbx"));
+            REQUIRE(!Rule{"*a*b", 0.0}.matches("xxaxxaxbx"));
+            REQUIRE(Rule{"*", 0.0}.matches(""));
+            REQUIRE(!Rule{"", 0.0}.matches("a"));
+        }
+    }
+}
+
+SCENARIO("Telemetry interfaces tell if their spans may be sampled")
+{
+    GIVEN("a telemetry configuration")
+    {
+        auto cfg = sampling_configuration();
+
+        WHEN("a span can be sampled")
+        {
+            cfg.traces_sampler_ratio = GENERATE(0.0, 0.5);
+            cfg.traces_sampler_parent_based = cfg.traces_sampler_ratio == 0.0;
+            auto interface = Tango::telemetry::InterfaceFactory::create(cfg);
+
+            THEN("the interface may sample the spans, unless it is disabled")
+            {
+                REQUIRE(interface->may_sample_spans());
+                interface->disable();
+                REQUIRE(!interface->may_sample_spans());
+            }
+        }
+
+        WHEN("the ratios are all 0 and the sampler is not parent based")
+        {
+            cfg.traces_sampler_ratio = 0.0;
+            cfg.traces_sampler_parent_based = false;
+            cfg.traces_sampler_rules = {{"*::read_attribute*", 0.0}};
+            auto interface = Tango::telemetry::InterfaceFactory::create(cfg);
+
+            THEN("no span may be sampled")
+            {
+                REQUIRE(!interface->may_sample_spans());
+            }
+        }
+
+        WHEN("the traces are not exported")
+        {
+            cfg.traces_exporter = Tango::telemetry::Configuration::Exporter::none;
+            auto interface = Tango::telemetry::InterfaceFactory::create(cfg);
+
+            THEN("no span may be sampled")
+            {
+                REQUIRE(!interface->may_sample_spans());
+            }
+        }
+    }
+}
+
+SCENARIO("Telemetry sampling is configured with environment variables")
+{
+    GIVEN("valid sampling environment variables")
+    {
+        EnvVar ratio{Tango::telemetry::kEnvVarTelemetryTracesSamplerRatio, "0.25"};
+        EnvVar rules{Tango::telemetry::kEnvVarTelemetryTracesSamplerRules, "read_attribute=0,command_inout=0.5"};
+        EnvVar parent_based{Tango::telemetry::kEnvVarTelemetryTracesSamplerParentBased, "off"};
+        EnvVar max_rate{Tango::telemetry::kEnvVarTelemetryTracesMaxRate, "100"};
+
+        WHEN("we create a configuration")
+        {
+            Tango::telemetry::Configuration cfg;
+
+            THEN("the sampling parameters are the ones of the environment")
+            {
+                REQUIRE(cfg.traces_sampler_ratio == 0.25);
+                REQUIRE(cfg.traces_sampler_rules.size() == 2);
+                REQUIRE(cfg.traces_sampler_rules[0].operation == "read_attribute");
+                REQUIRE(cfg.traces_sampler_rules[0].ratio == 0.0);
+                REQUIRE(cfg.traces_sampler_rules[1].operation == "command_inout");
+                REQUIRE(cfg.traces_sampler_rules[1].ratio == 0.5);
+                REQUIRE(!cfg.traces_sampler_parent_based);
+                REQUIRE(cfg.traces_max_rate == 100.0);
+            }
+        }
+    }
+
+    GIVEN("an invalid sampling environment variable")
+    {
+        auto data = GENERATE(std::make_pair(Tango::telemetry::kEnvVarTelemetryTracesSamplerRatio, "1.5"),
+                             std::make_pair(Tango::telemetry::kEnvVarTelemetryTracesSamplerRatio, "half"),
+                             std::make_pair(Tango::telemetry::kEnvVarTelemetryTracesSamplerRules, "read_attribute"),
+                             std::make_pair(Tango::telemetry::kEnvVarTelemetryTracesSamplerRules, "=0.5"),
+                             std::make_pair(Tango::telemetry::kEnvVarTelemetryTracesSamplerRules, "command_inout=2"),
+                             std::make_pair(Tango::telemetry::kEnvVarTelemetryTracesMaxRate, "-1"));
+
+        EnvVar var{data.first, data.second};
+        INFO(data.first << "=" << data.second);
+
+        WHEN("we create a configuration")
+        {
+            THEN("an exception is thrown")
+            {
+                using namespace TangoTest::Matchers;
+
+                auto f = []() { Tango::telemetry::Configuration cfg; };
+                REQUIRE_THROWS_MATCHES(f(), Tango::DevFailed, FirstErrorMatches(Reason(Tango::API_InvalidArgs)));
+            }
+        }
+    }
+}
+
+SCENARIO("Telemetry instrumentation overhead", "[.][benchmark]")
+{
+    GIVEN("telemetry interfaces configured in various ways")
+    {
+        auto disabled_cfg = sampling_configuration();
+        disabled_cfg.enabled = false;
+        auto disabled = Tango::telemetry::InterfaceFactory::create(disabled_cfg);
+
+        auto dropped_cfg = sampling_configuration();
+        dropped_cfg.traces_sampler_ratio = 0.0;
+        auto dropped = Tango::telemetry::InterfaceFactory::create(dropped_cfg);
+
+        auto limited_cfg = sampling_configuration();
+        limited_cfg.traces_max_rate = 1.0;
+        auto limited = Tango::telemetry::InterfaceFactory::create(limited_cfg);
+
+        auto unsampleable_cfg = sampling_configuration();
+        unsampleable_cfg.traces_sampler_ratio = 0.0;
+        unsampleable_cfg.traces_sampler_parent_based = false;
+        auto unsampleable = Tango::telemetry::InterfaceFactory::create(unsampleable_cfg);
+
+        const Tango::telemetry::Attributes attributes{{"tango.operation.target", "sys/tg_test/1/double_scalar"}};
+
+        auto instrumented_call = [&attributes](Tango::telemetry::InterfacePtr &interface)
+        {
+            auto span = interface->start_span("Tango::Device_5Impl::read_attributes_5", attributes);
+            auto scope = interface->scope(span, __FILE__, __LINE__);
+            return span->is_recording();
+        };
+
+        BENCHMARK("telemetry disabled")
+        {
+            return instrumented_call(disabled);
+        };
+
+        BENCHMARK("span dropped by the sampler")
+        {
+            return instrumented_call(dropped);
+        };
+
+        BENCHMARK("span dropped by the rate limiter")
+        {
+            return instrumented_call(limited);
+        };
+
+        // as the kernel does: the attributes are only built if the span may be sampled
+        BENCHMARK("attributes skipped as no span can be sampled")
+        {
+            const std::string target{"sys/tg_test/1/double_scalar"};
+            auto span = unsampleable->start_span("Tango::Device_5Impl::read_attributes_5",
+                                                 unsampleable->may_sample_spans()
+                                                     ? Tango::telemetry::Attributes{{"tango.operation.target", target}}
+                                                     : Tango::telemetry::Attributes{});
+            auto scope = unsampleable->scope(span, __FILE__, __LINE__);
+            return span->is_recording();
+        };
+    }
+}
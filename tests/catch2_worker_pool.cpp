@@ -0,0 +1,117 @@
+#include "catch2_common.h"
+
+#include <tango/internal/worker_pool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+SCENARIO("The worker pool executes each iteration once")
+{
+    std::size_t nb = GENERATE(0u, 1u, 7u, 200u);
+    std::size_t max_parallel = GENERATE(0u, 1u, 4u, 8u);
+    GIVEN("a loop of " << nb << " iterations with up to " << max_parallel << " threads")
+    {
+        std::vector<std::atomic<int>> counts(nb);
+
+        WHEN("the loop is executed")
+        {
+            Tango::detail::for_each_in_parallel(nb, max_parallel, [&counts](std::size_t idx) { counts[idx]++; });
+
+            THEN("each iteration is done once")
+            {
+                REQUIRE(std::all_of(counts.begin(), counts.end(), [](const auto &count) { return count == 1; }));
+            }
+        }
+    }
+}
+
+SCENARIO("The worker pool uses at most the requested number of threads")
+{
+    GIVEN("a loop with up to 4 threads")
+    {
+        constexpr std::size_t k_max_parallel = 4;
+        std::atomic<std::size_t> running{0};
+        std::atomic<std::size_t> max_running{0};
+
+        std::mutex threads_mutex;
+        std::vector<std::thread::id> threads;
+        std::atomic<bool> omni_threads{true};
+
+        auto caller = std::this_thread::get_id();
+        auto iteration = [&](std::size_t)
+        {
+            std::size_t now = ++running;
+            std::size_t max = max_running;
+            while(now > max && !max_running.compare_exchange_weak(max, now))
+            {
+            }
+
+            if(std::this_thread::get_id() != caller && omni_thread::self() == nullptr)
+            {
+                omni_threads = false;
+            }
+            {
+                std::lock_guard<std::mutex> lg(threads_mutex);
+                threads.push_back(std::this_thread::get_id());
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            --running;
+        };
+
+        WHEN("the loop is executed")
+        {
+            Tango::detail::for_each_in_parallel(40, k_max_parallel, iteration);
+
+            THEN("no more iterations run at the same time")
+            {
+                REQUIRE(max_running <= k_max_parallel);
+
+                AND_THEN("the pool threads are known by omniORB")
+                {
+                    REQUIRE(omni_threads);
+                }
+            }
+
+            AND_WHEN("the loop is executed again")
+            {
+                std::size_t nb_threads = Tango::detail::WorkerPool::instance().get_nb_threads();
+                Tango::detail::for_each_in_parallel(40, k_max_parallel, iteration);
+
+                THEN("the pool threads are reused")
+                {
+                    REQUIRE(Tango::detail::WorkerPool::instance().get_nb_threads() == nb_threads);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("The worker pool executes nested loops")
+{
+    GIVEN("loops executing loops, with more threads than the pool can create")
+    {
+        constexpr std::size_t k_nb = 2 * Tango::detail::WORKER_POOL_MAX_THREADS;
+        std::atomic<std::size_t> done{0};
+
+        WHEN("the outer loop is executed")
+        {
+            Tango::detail::for_each_in_parallel(k_nb,
+                                                k_nb,
+                                                [&done](std::size_t)
+                                                {
+                                                    Tango::detail::for_each_in_parallel(
+                                                        k_nb, k_nb, [&done](std::size_t) { done++; });
+                                                });
+
+            THEN("all the inner iterations are done")
+            {
+                REQUIRE(done == k_nb * k_nb);
+            }
+        }
+    }
+}
@@ -21,6 +21,36 @@ class FwdAttTestSuite : public CxxTest::TestSuite
         string ev_name;
     };
 
+    void start_root_polling(const string &dev_name, const char *att_name, const char *restore_name)
+    {
+        DeviceData din;
+        DevVarLongStringArray attr_poll;
+        attr_poll.lvalue.length(1);
+        attr_poll.svalue.length(3);
+
+        attr_poll.lvalue[0] = 300;
+        attr_poll.svalue[0] = dev_name.c_str();
+        attr_poll.svalue[1] = "attribute";
+        attr_poll.svalue[2] = att_name;
+        din << attr_poll;
+        TS_ASSERT_THROWS_NOTHING(root_admin->command_inout("AddObjPolling", din));
+        CxxTest::TangoPrinter::restore_set(restore_name);
+    }
+
+    void stop_root_polling(const string &dev_name, const char *att_name, const char *restore_name)
+    {
+        DeviceData din;
+        DevVarStringArray rem_attr_poll;
+        rem_attr_poll.length(3);
+
+        rem_attr_poll[0] = dev_name.c_str();
+        rem_attr_poll[1] = "attribute";
+        rem_attr_poll[2] = att_name;
+        din << rem_attr_poll;
+        TS_ASSERT_THROWS_NOTHING(root_admin->command_inout("RemObjPolling", din));
+        CxxTest::TangoPrinter::restore_unset(restore_name);
+    }
+
     DeviceProxy *device1, *device2, *fwd_device;
     string device1_name, device2_name;
     AttributeInfoListEx *confs_root_init;
@@ -142,6 +172,38 @@ class FwdAttTestSuite : public CxxTest::TestSuite
             }
         }
 
+        if(CxxTest::TangoPrinter::is_restore_set("poll_root2"))
+        {
+            DevVarStringArray rem_attr_poll;
+            DeviceData din;
+            rem_attr_poll.length(3);
+
+            rem_attr_poll[0] = device2_name.c_str();
+            rem_attr_poll[1] = "attribute";
+            rem_attr_poll[2] = "string_ima_attr_rw";
+            din << rem_attr_poll;
+            try
+            {
+                root_admin->command_inout("RemObjPolling", din);
+            }
+            catch(Tango::DevFailed &)
+            {
+            }
+        }
+
+        if(CxxTest::TangoPrinter::is_restore_set("fwd_max_age"))
+        {
+            DeviceData din;
+            din << (DevLong) 0;
+            try
+            {
+                fwd_device->command_inout("SetFwdAttMaxAge", din);
+            }
+            catch(Tango::DevFailed &)
+            {
+            }
+        }
+
         (*confs_init)[0].label = "";
         (*confs_init)[0].description = "";
         (*confs_root_init)[0].label = "";
@@ -822,6 +884,129 @@ class FwdAttTestSuite : public CxxTest::TestSuite
         }
     }
 
+    // Read forwarded attributes of two root devices in one call
+
+    void test_reading_forwarded_attributes_of_two_root_devices(void)
+    {
+        Tango::DevShort sh = 55;
+        DeviceAttribute da_sh("short_attr_rw", sh);
+        device1->write_attribute(da_sh);
+
+        vector<string> v_str_w{"Rumba"};
+        DeviceAttribute da_v_str("string_ima_attr_rw", v_str_w, 1, 1);
+        device2->write_attribute(da_v_str);
+
+        vector<string> names{"fwd_short_rw", "fwd_ima_string_rw", "fwd_spec_double", "fwd_state", "fwd_string_rw"};
+        vector<DeviceAttribute> *das = nullptr;
+        TS_ASSERT_THROWS_NOTHING(das = fwd_device->read_attributes(names));
+        TS_ASSERT_EQUALS(das->size(), names.size());
+
+        for(size_t loop = 0; loop < names.size(); loop++)
+        {
+            TS_ASSERT_EQUALS((*das)[loop].name, names[loop]);
+            TS_ASSERT_EQUALS((*das)[loop].quality, Tango::ATTR_VALID);
+        }
+
+        Tango::DevShort sh_read;
+        (*das)[0] >> sh_read;
+        TS_ASSERT_EQUALS(sh_read, 55);
+
+        vector<string> v_str_read;
+        (*das)[1] >> v_str_read;
+        TS_ASSERT_EQUALS(v_str_read.size(), 3u);
+        TS_ASSERT_EQUALS(v_str_read[2], "Rumba");
+
+        vector<double> v_db;
+        (*das)[2] >> v_db;
+        TS_ASSERT_EQUALS(v_db.size(), 2u);
+        TS_ASSERT_EQUALS(v_db[0], 1.11);
+
+        DevState the_state;
+        (*das)[3] >> the_state;
+        TS_ASSERT_EQUALS(the_state, Tango::ON);
+
+        string str;
+        (*das)[4] >> str;
+        DeviceAttribute da_str_root = device1->read_attribute("string_attr_rw");
+        string str_root;
+        da_str_root >> str_root;
+        TS_ASSERT_EQUALS(str, str_root);
+
+        delete das;
+
+        // The same root attribute twice in the list
+
+        vector<string> names_twice{"fwd_short_rw", "fwd_ima_string_rw", "fwd_short_rw"};
+        TS_ASSERT_THROWS_NOTHING(das = fwd_device->read_attributes(names_twice));
+        TS_ASSERT_EQUALS(das->size(), 3u);
+        (*das)[2] >> sh_read;
+        TS_ASSERT_EQUALS(sh_read, 55);
+        delete das;
+    }
+
+    // Read forwarded attributes from the root attribute values received with events
+
+    void test_reading_forwarded_attributes_from_root_events(void)
+    {
+        DeviceData din;
+        din << (DevLong) 10000;
+        TS_ASSERT_THROWS_NOTHING(fwd_device->command_inout("SetFwdAttMaxAge", din));
+        CxxTest::TangoPrinter::restore_set("fwd_max_age");
+
+        start_root_polling(device1_name, "short_attr_rw", "poll_root");
+        start_root_polling(device2_name, "string_ima_attr_rw", "poll_root2");
+
+        CountingCallBack<Tango::EventData> cb;
+        CountingCallBack<Tango::EventData> cb2;
+        int eve_id = 0, eve_id2 = 0;
+        TS_ASSERT_THROWS_NOTHING(eve_id = fwd_device->subscribe_event("fwd_short_rw", Tango::PERIODIC_EVENT, &cb));
+        TS_ASSERT_THROWS_NOTHING(eve_id2 =
+                                     fwd_device->subscribe_event("fwd_ima_string_rw", Tango::PERIODIC_EVENT, &cb2));
+
+        // Fill the cache with a first read, then change the root values. With a 10 s maximum age, the new values
+        // can only come from the root events
+
+        vector<string> names{"fwd_short_rw", "fwd_ima_string_rw"};
+        vector<DeviceAttribute> *das = fwd_device->read_attributes(names);
+        delete das;
+
+        Tango::DevShort sh = 77;
+        DeviceAttribute da_sh("short_attr_rw", sh);
+        device1->write_attribute(da_sh);
+        vector<string> v_str_w{"Tango"};
+        DeviceAttribute da_v_str("string_ima_attr_rw", v_str_w, 1, 1);
+        device2->write_attribute(da_v_str);
+
+        // The second periodic event received after the writes was sent after them
+
+        cb.reset_counts();
+        cb2.reset_counts();
+        TS_ASSERT(cb.wait_for([&]() { return cb.invocation_count() >= 2; }, std::chrono::seconds(10)));
+        TS_ASSERT(cb2.wait_for([&]() { return cb2.invocation_count() >= 2; }, std::chrono::seconds(10)));
+        TS_ASSERT_EQUALS(cb.error_count(), 0);
+        TS_ASSERT_EQUALS(cb2.error_count(), 0);
+
+        das = fwd_device->read_attributes(names);
+        Tango::DevShort sh_read;
+        (*das)[0] >> sh_read;
+        TS_ASSERT_EQUALS(sh_read, 77);
+        vector<string> v_str_read;
+        (*das)[1] >> v_str_read;
+        TS_ASSERT_EQUALS(v_str_read.size(), 3u);
+        TS_ASSERT_EQUALS(v_str_read[2], "Tango");
+        delete das;
+
+        fwd_device->unsubscribe_event(eve_id);
+        fwd_device->unsubscribe_event(eve_id2);
+
+        stop_root_polling(device1_name, "short_attr_rw", "poll_root");
+        stop_root_polling(device2_name, "string_ima_attr_rw", "poll_root2");
+
+        din << (DevLong) 0;
+        TS_ASSERT_THROWS_NOTHING(fwd_device->command_inout("SetFwdAttMaxAge", din));
+        CxxTest::TangoPrinter::restore_unset("fwd_max_age");
+    }
+
     void test_forward_string_image_attribute_addition(void)
     {
         Tango::Database *db = new Tango::Database();
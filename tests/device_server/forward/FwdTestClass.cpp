@@ -404,7 +404,7 @@ void FwdTestClass::command_factory()
 	/*----- PROTECTED REGION ID(FwdTestClass::command_factory_before) ENABLED START -----*/
     /* clang-format on */
 
-    //	Add your own code
+    command_list.push_back(new SetFwdAttMaxAgeCmd());
 
     /* clang-format off */
 	/*----- PROTECTED REGION END -----*/	//	FwdTestClass::command_factory_before
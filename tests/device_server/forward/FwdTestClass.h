@@ -118,6 +118,26 @@ class FwdAttrImaStrRead : public Tango::FwdAttr
     ~FwdAttrImaStrRead() { }
 };
 
+// Set the maximum age of the root attribute values used to read the forwarded attributes (in ms)
+class SetFwdAttMaxAgeCmd : public Tango::Command
+{
+  public:
+    SetFwdAttMaxAgeCmd() :
+        Command("SetFwdAttMaxAge", Tango::DEV_LONG, Tango::DEV_VOID)
+    {
+    }
+
+    ~SetFwdAttMaxAgeCmd() { }
+
+    CORBA::Any *execute(Tango::DeviceImpl *, const CORBA::Any &in_any) override
+    {
+        Tango::DevLong max_age;
+        extract(in_any, max_age);
+        Tango::Util::instance()->set_fwd_att_max_age(std::chrono::milliseconds(max_age));
+        return insert();
+    }
+};
+
 /* clang-format off */
 /*----- PROTECTED REGION END -----*/	//	FwdTestClass::classes for dynamic creation
 